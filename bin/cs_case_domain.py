@@ -806,6 +806,9 @@ class domain(base_domain):
                 # have a file extension
                 if os.path.isdir(mesh_input):
                     link_path = os.path.join(self.exec_dir, 'mesh_input')
+                elif self.__solver_mesh_format__(mesh_input):
+                    ext = os.path.splitext(mesh_input)[1]
+                    link_path = os.path.join(self.exec_dir, 'mesh_input' + ext)
                 else:
                     link_path = os.path.join(self.exec_dir, 'mesh_input.csm')
 
@@ -856,6 +859,33 @@ class domain(base_domain):
 
     #---------------------------------------------------------------------------
 
+    def __solver_mesh_format__(self, mesh_path):
+        """
+        Returns the file extension of a mesh which may be read directly
+        by the solver (Gmsh 4.1 or CGNS), or None.
+        """
+
+        ext = os.path.splitext(mesh_path)[1]
+
+        if ext == '.msh':
+            try:
+                f = open(mesh_path, 'rb')
+                header = f.read(64).split()
+                f.close()
+                if len(header) > 1 and header[0] == b'$MeshFormat' \
+                   and header[1].startswith(b'4.1'):
+                    return ext
+            except Exception:
+                pass
+
+        elif ext == '.cgns':
+            if self.package.config.libs['cgns'].have == "yes":
+                return ext
+
+        return None
+
+    #---------------------------------------------------------------------------
+
     def preprocess(self):
         """
         Runs the preprocessor in the execution directory
@@ -921,6 +951,8 @@ class domain(base_domain):
 
         # Run once per mesh
 
+        retcode = 0
+
         for m in self.meshes:
 
             # Get absolute mesh paths
@@ -949,6 +981,22 @@ class domain(base_domain):
                     err_str += '(no mesh directory given)'
                 raise RunCaseError(err_str)
 
+            # Gmsh 4.1 and CGNS meshes with no preprocessor options are
+            # read directly by the solver, which distributes reading, face
+            # building and the mesh_output write among ranks.
+
+            if type(m) != tuple:
+                ext = self.__solver_mesh_format__(mesh_path)
+                if ext:
+                    if (mesh_id != None):
+                        mesh_id += 1
+                        link_path = os.path.join('mesh_input',
+                                                 'mesh_%02d%s' % (mesh_id, ext))
+                    else:
+                        link_path = 'mesh_input' + ext
+                    self.symlink(mesh_path, link_path)
+                    continue
+
             # Build command
 
             cmd = [self.package.get_preprocessor()]
@@ -1064,7 +1112,8 @@ class domain(base_domain):
         purge_list = []
 
         if not self.mesh_input and self.exec_solver:
-            for f in ['mesh_input', 'mesh_input.csm']:
+            for f in ['mesh_input', 'mesh_input.csm',
+                      'mesh_input.msh', 'mesh_input.cgns']:
                 if f in dir_files:
                     purge_list.append(f)
 
@@ -1428,6 +1477,33 @@ class syrthes_domain(base_domain):
 
     #---------------------------------------------------------------------------
 
+    def __solver_mesh_format__(self, mesh_path):
+        """
+        Returns the file extension of a mesh which may be read directly
+        by the solver (Gmsh 4.1 or CGNS), or None.
+        """
+
+        ext = os.path.splitext(mesh_path)[1]
+
+        if ext == '.msh':
+            try:
+                f = open(mesh_path, 'rb')
+                header = f.read(64).split()
+                f.close()
+                if len(header) > 1 and header[0] == b'$MeshFormat' \
+                   and header[1].startswith(b'4.1'):
+                    return ext
+            except Exception:
+                pass
+
+        elif ext == '.cgns':
+            if self.package.config.libs['cgns'].have == "yes":
+                return ext
+
+        return None
+
+    #---------------------------------------------------------------------------
+
     def preprocess(self):
         """
         Partition mesh for parallel run if required by user
@@ -1780,6 +1856,33 @@ class python_domain(base_domain):
 
     #---------------------------------------------------------------------------
 
+    def __solver_mesh_format__(self, mesh_path):
+        """
+        Returns the file extension of a mesh which may be read directly
+        by the solver (Gmsh 4.1 or CGNS), or None.
+        """
+
+        ext = os.path.splitext(mesh_path)[1]
+
+        if ext == '.msh':
+            try:
+                f = open(mesh_path, 'rb')
+                header = f.read(64).split()
+                f.close()
+                if len(header) > 1 and header[0] == b'$MeshFormat' \
+                   and header[1].startswith(b'4.1'):
+                    return ext
+            except Exception:
+                pass
+
+        elif ext == '.cgns':
+            if self.package.config.libs['cgns'].have == "yes":
+                return ext
+
+        return None
+
+    #---------------------------------------------------------------------------
+
     def preprocess(self):
         """
         Preprocess dummy function: Does nothing for a standard python script
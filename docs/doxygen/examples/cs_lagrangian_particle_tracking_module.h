@@ -98,6 +98,10 @@
 
   \snippet cs_user_lagr_model.c boundary_statistics
 
+  Particle trajectory output
+
+  \snippet cs_user_lagr_model.c trajectory
+
 
 
   \page cs_lagrangian_particle_tracking_bc User boundary condition definition for the Lagrangian model
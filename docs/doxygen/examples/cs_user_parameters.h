@@ -93,6 +93,12 @@
 
   \snippet cs_user_parameters-base.c duration
 
+  To adapt the mesh based on the jump of a field across faces
+  (cells are flagged during the computation, and the mesh is refined
+  or coarsened when restarting)
+
+  \snippet cs_user_parameters-base.c param_mesh_adapt
+
   For example, to change the log (run_solver.log) verbosity of all the variables:
 
   \snippet cs_user_parameters-base.c param_log_verbosity
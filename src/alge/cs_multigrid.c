@@ -60,6 +60,7 @@
 #include "cs_mesh.h"
 #include "cs_mesh_quantities.h"
 #include "cs_multigrid_smoother.h"
+#include "cs_parall.h"
 #include "cs_post.h"
 #include "cs_sles.h"
 #include "cs_sles_it.h"
@@ -2396,7 +2397,9 @@ _dot_xx(const cs_multigrid_t  *mg,
 
   if (mg->comm != MPI_COMM_NULL) {
     double _sum;
+    double t0 = cs_timer_wtime();
     MPI_Allreduce(&s, &_sum, 1, MPI_DOUBLE, MPI_SUM, mg->comm);
+    cs_parall_reduce_wait_add(t0);
     s = _sum;
   }
 
@@ -2434,7 +2437,9 @@ _dot_xx_yy(const cs_multigrid_t  *mg,
 
   if (mg->comm != MPI_COMM_NULL) {
     double _sum[2];
+    double t0 = cs_timer_wtime();
     MPI_Allreduce(s, _sum, 2, MPI_DOUBLE, MPI_SUM, mg->comm);
+    cs_parall_reduce_wait_add(t0);
     s[0] = _sum[0];
     s[1] = _sum[1];
   }
@@ -2475,7 +2480,9 @@ _dot_xy_yz(const cs_multigrid_t  *mg,
 
   if (mg->comm != MPI_COMM_NULL) {
     double _sum[2];
+    double t0 = cs_timer_wtime();
     MPI_Allreduce(s, _sum, 2, MPI_DOUBLE, MPI_SUM, mg->comm);
+    cs_parall_reduce_wait_add(t0);
     s[0] = _sum[0];
     s[1] = _sum[1];
   }
@@ -2521,7 +2528,9 @@ _dot_xu_xv_xw(const cs_multigrid_t  *mg,
 
   if (mg->comm != MPI_COMM_NULL) {
     double _sum[3];
+    double t0 = cs_timer_wtime();
     MPI_Allreduce(s, _sum, 3, MPI_DOUBLE, MPI_SUM, mg->comm);
+    cs_parall_reduce_wait_add(t0);
     s[0] = _sum[0];
     s[1] = _sum[1];
     s[2] = _sum[2];
@@ -2703,7 +2712,9 @@ _log_residual(const cs_multigrid_t   *mg,
 
   if (mg->comm != MPI_COMM_NULL) {
     double _sum;
+    double t0 = cs_timer_wtime();
     MPI_Allreduce(&s, &_sum, 1, MPI_DOUBLE, MPI_SUM, mg->comm);
+    cs_parall_reduce_wait_add(t0);
     s = _sum;
   }
 
@@ -1672,7 +1672,9 @@ _jacobi(cs_sles_it_t              *c,
 
     if (c->comm != MPI_COMM_NULL) {
       double _sum;
+      double t0 = cs_timer_wtime();
       MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+      cs_parall_reduce_wait_add(t0);
       res2 = _sum;
     }
 
@@ -1799,7 +1801,9 @@ _block_3_jacobi(cs_sles_it_t              *c,
 
     if (c->comm != MPI_COMM_NULL) {
       double _sum;
+      double t0 = cs_timer_wtime();
       MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+      cs_parall_reduce_wait_add(t0);
       res2 = _sum;
     }
 
@@ -1922,7 +1926,9 @@ _block_jacobi(cs_sles_it_t              *c,
 
     if (c->comm != MPI_COMM_NULL) {
       double _sum;
+      double t0 = cs_timer_wtime();
       MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+      cs_parall_reduce_wait_add(t0);
       res2 = _sum;
     }
 
@@ -2964,7 +2970,9 @@ _p_ordered_gauss_seidel_msr(cs_sles_it_t              *c,
 
     if (c->comm != MPI_COMM_NULL) {
       double _sum;
+      double t0 = cs_timer_wtime();
       MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+      cs_parall_reduce_wait_add(t0);
       res2 = _sum;
     }
 
@@ -3120,7 +3128,9 @@ _p_gauss_seidel_msr(cs_sles_it_t              *c,
 
       if (c->comm != MPI_COMM_NULL) {
         double _sum;
+        double t0 = cs_timer_wtime();
         MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+        cs_parall_reduce_wait_add(t0);
         res2 = _sum;
       }
 
@@ -3354,7 +3364,9 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
 
       if (c->comm != MPI_COMM_NULL) {
         double _sum;
+        double t0 = cs_timer_wtime();
         MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+        cs_parall_reduce_wait_add(t0);
         res2 = _sum;
       }
 
@@ -58,6 +58,7 @@
 #include "cs_log.h"
 #include "cs_halo.h"
 #include "cs_mesh.h"
+#include "cs_parall.h"
 #include "cs_matrix.h"
 #include "cs_matrix_default.h"
 #include "cs_matrix_util.h"
@@ -266,7 +267,9 @@ _dot_product(const cs_sles_it_t  *c,
 
   if (c->comm != MPI_COMM_NULL) {
     double _sum;
+    double t0 = cs_timer_wtime();
     MPI_Allreduce(&s, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+    cs_parall_reduce_wait_add(t0);
     s = _sum;
   }
 
@@ -298,7 +301,9 @@ _dot_product_xx(const cs_sles_it_t  *c,
 
   if (c->comm != MPI_COMM_NULL) {
     double _sum;
+    double t0 = cs_timer_wtime();
     MPI_Allreduce(&s, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+    cs_parall_reduce_wait_add(t0);
     s = _sum;
   }
 
@@ -333,7 +338,9 @@ _dot_products_xx_xy(const cs_sles_it_t  *c,
 
   if (c->comm != MPI_COMM_NULL) {
     double _sum[2];
+    double t0 = cs_timer_wtime();
     MPI_Allreduce(s, _sum, 2, MPI_DOUBLE, MPI_SUM, c->comm);
+    cs_parall_reduce_wait_add(t0);
     s[0] = _sum[0];
     s[1] = _sum[1];
   }
@@ -372,7 +379,9 @@ _dot_products_xy_yz(const cs_sles_it_t  *c,
 
   if (c->comm != MPI_COMM_NULL) {
     double _sum[2];
+    double t0 = cs_timer_wtime();
     MPI_Allreduce(s, _sum, 2, MPI_DOUBLE, MPI_SUM, c->comm);
+    cs_parall_reduce_wait_add(t0);
     s[0] = _sum[0];
     s[1] = _sum[1];
   }
@@ -414,7 +423,9 @@ _dot_products_xx_xy_yz(const cs_sles_it_t  *c,
   if (c->comm != MPI_COMM_NULL) {
     double _sum[3];
 
+    double t0 = cs_timer_wtime();
     MPI_Allreduce(s, _sum, 3, MPI_DOUBLE, MPI_SUM, c->comm);
+    cs_parall_reduce_wait_add(t0);
     s[0] = _sum[0];
     s[1] = _sum[1];
     s[2] = _sum[2];
@@ -461,7 +472,9 @@ _dot_products_xx_yy_xy_xz_yz(const cs_sles_it_t  *c,
 
   if (c->comm != MPI_COMM_NULL) {
     double _sum[5];
+    double t0 = cs_timer_wtime();
     MPI_Allreduce(s, _sum, 5, MPI_DOUBLE, MPI_SUM, c->comm);
+    cs_parall_reduce_wait_add(t0);
     memcpy(s, _sum, 5*sizeof(double));
   }
 
@@ -511,7 +524,9 @@ _dot_products_vr_vw_vq_rr(const cs_sles_it_t  *c,
 
   if (c->comm != MPI_COMM_NULL) {
     double _sum[4];
+    double t0 = cs_timer_wtime();
     MPI_Allreduce(s, _sum, 4, MPI_DOUBLE, MPI_SUM, c->comm);
+    cs_parall_reduce_wait_add(t0);
     memcpy(s, _sum, 4*sizeof(double));
   }
 
@@ -901,6 +901,14 @@ endif
 ! Test presence of control_file to modify ntmabs if required
 call cs_control_check_file
 
+! Check load balance, possibly saving a new partitioning for restart
+! and modifying ntmabs
+call cs_partition_check_restart_balance
+
+! Evaluate mesh adaptation indicator, possibly saving flagged cells
+! for restart and modifying ntmabs
+call cs_mesh_adapt_check
+
 if (      (idtvar.eq.0 .or. idtvar.eq.1)                          &
     .and. (ttmabs.gt.0 .and. ttcabs.ge.ttmabs)) then
   ntmabs = ntcabs
@@ -965,6 +965,36 @@ _cs_datatype_to_mpi_init(void)
 #endif
 }
 
+/*----------------------------------------------------------------------------
+ * Initialize MPI, with the required thread support level.
+ *
+ * MPI_THREAD_FUNNELED is required when OpenMP is available. If the
+ * CS_POST_ASYNC environment variable is defined and POSIX threads are
+ * available, MPI_THREAD_MULTIPLE is required instead, so that
+ * postprocessing output may be done by a separate thread.
+ *
+ * parameters:
+ *   argc  <-> number of command line arguments
+ *   argv  <-> array of command line arguments
+ *----------------------------------------------------------------------------*/
+
+static void
+_cs_base_mpi_init_thread(int    *argc,
+                         char  **argv[])
+{
+#if (MPI_VERSION >= 2) && (defined(HAVE_OPENMP) || defined(HAVE_PTHREAD))
+  int mpi_threads;
+  int mpi_threads_required = MPI_THREAD_FUNNELED;
+#if defined(HAVE_PTHREAD)
+  if (getenv("CS_POST_ASYNC") != NULL)
+    mpi_threads_required = MPI_THREAD_MULTIPLE;
+#endif
+  MPI_Init_thread(argc, argv, mpi_threads_required, &mpi_threads);
+#else
+  MPI_Init(argc, argv);
+#endif
+}
+
 /*----------------------------------------------------------------------------
  * Complete MPI setup.
  *
@@ -1361,14 +1391,8 @@ cs_base_mpi_init(int    *argc,
 
   if (use_mpi == true) {
     MPI_Initialized(&flag);
-    if (!flag) {
-#if (MPI_VERSION >= 2) && defined(HAVE_OPENMP)
-      int mpi_threads;
-      MPI_Init_thread(argc, argv, MPI_THREAD_FUNNELED, &mpi_threads);
-#else
-      MPI_Init(argc, argv);
-#endif
-    }
+    if (!flag)
+      _cs_base_mpi_init_thread(argc, argv);
   }
 
   /* Loop on command line arguments */
@@ -1389,14 +1413,8 @@ cs_base_mpi_init(int    *argc,
   if (use_mpi == true) {
 
     MPI_Initialized(&flag);
-    if (!flag) {
-#if (MPI_VERSION >= 2) && defined(HAVE_OPENMP)
-      int mpi_threads;
-      MPI_Init_thread(argc, argv, MPI_THREAD_FUNNELED, &mpi_threads);
-#else
-      MPI_Init(argc, argv);
-#endif
-    }
+    if (!flag)
+      _cs_base_mpi_init_thread(argc, argv);
 
   }
 
@@ -1801,6 +1819,108 @@ cs_base_mem_finalize(void)
   bft_mem_usage_end();
 }
 
+/*----------------------------------------------------------------------------
+ * Log memory use high-water mark at a given stage.
+ *
+ * The process memory high-water mark and currently instrumented memory
+ * are logged (mean, minimum and maximum over ranks, with associated
+ * ranks), so that stages leading to memory peaks on a few ranks
+ * (such as rank 0) may be identified.
+ *
+ * This function is collective over cs_glob_mpi_comm.
+ *
+ * parameters:
+ *   stage_name <-- name of current stage
+ *----------------------------------------------------------------------------*/
+
+void
+cs_base_mem_log_stage(const char  *stage_name)
+{
+  int  i, j;
+  double  valreal[2], val_mean[2];
+  double  val_min_max[2][2];
+  int  rank_min_max[2][2] = {{0, 0}, {0, 0}};
+
+  const char  unit[8] = {'K', 'M', 'G', 'T', 'P', 'E', 'Z', 'Y'};
+
+  const char  * type_bil[] = {N_("process high-water mark:"),
+                              N_("instrumented (current): ")};
+
+  valreal[0] = (double)bft_mem_usage_max_pr_size();
+  valreal[1] = (double)bft_mem_size_current();
+
+  for (i = 0; i < 2; i++) {
+    val_mean[i] = valreal[i];
+    val_min_max[i][0] = valreal[i];
+    val_min_max[i][1] = valreal[i];
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    double  val_sum[2];
+    _cs_base_mpi_double_int_t  val_in[2], val_min[2], val_max[2];
+    for (i = 0; i < 2; i++) {
+      val_in[i].val = valreal[i];
+      val_in[i].rank = cs_glob_rank_id;
+    }
+    MPI_Reduce(valreal, val_sum, 2, MPI_DOUBLE, MPI_SUM,
+               0, cs_glob_mpi_comm);
+    MPI_Reduce(val_in, val_min, 2, MPI_DOUBLE_INT, MPI_MINLOC,
+               0, cs_glob_mpi_comm);
+    MPI_Reduce(val_in, val_max, 2, MPI_DOUBLE_INT, MPI_MAXLOC,
+               0, cs_glob_mpi_comm);
+    if (cs_glob_rank_id == 0) {
+      for (i = 0; i < 2; i++) {
+        val_mean[i] = val_sum[i] / cs_glob_n_ranks;
+        val_min_max[i][0] = val_min[i].val;
+        val_min_max[i][1] = val_max[i].val;
+        rank_min_max[i][0] = val_min[i].rank;
+        rank_min_max[i][1] = val_max[i].rank;
+      }
+    }
+  }
+#endif
+
+  if (cs_glob_rank_id > 0)
+    return;
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\nMemory use after %s:\n"), stage_name);
+
+  for (i = 0; i < 2; i++) {
+
+    /* Ignore unavailable measurements */
+
+    if (val_min_max[i][1] < 1.0)
+      continue;
+
+    int  i_mean = 0, i_min_max[2] = {0, 0};
+
+    for (i_mean = 0; val_mean[i] > 1024. && i_mean < 7; i_mean++)
+      val_mean[i] /= 1024.;
+    for (j = 0; j < 2; j++) {
+      for (i_min_max[j] = 0;
+           val_min_max[i][j] > 1024. && i_min_max[j] < 7;
+           i_min_max[j]++)
+        val_min_max[i][j] /= 1024.;
+    }
+
+    if (cs_glob_n_ranks < 2)
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    _("  %s %10.3f %ciB\n"),
+                    _(type_bil[i]), val_mean[i], unit[i_mean]);
+    else
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    _("  %s mean %10.3f %ciB,"
+                      " min %10.3f %ciB (rank %d),"
+                      " max %10.3f %ciB (rank %d)\n"),
+                    _(type_bil[i]), val_mean[i], unit[i_mean],
+                    val_min_max[i][0], unit[i_min_max[0]], rank_min_max[i][0],
+                    val_min_max[i][1], unit[i_min_max[1]], rank_min_max[i][1]);
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Print summary of running time, including CPU and elapsed times.
  *----------------------------------------------------------------------------*/
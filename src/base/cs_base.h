@@ -219,6 +219,23 @@ cs_base_mem_init(void);
 void
 cs_base_mem_finalize(void);
 
+/*----------------------------------------------------------------------------
+ * Log memory use high-water mark at a given stage.
+ *
+ * The process memory high-water mark and currently instrumented memory
+ * are logged (mean, minimum and maximum over ranks, with associated
+ * ranks), so that stages leading to memory peaks on a few ranks
+ * (such as rank 0) may be identified.
+ *
+ * This function is collective over cs_glob_mpi_comm.
+ *
+ * parameters:
+ *   stage_name <-- name of current stage
+ *----------------------------------------------------------------------------*/
+
+void
+cs_base_mem_log_stage(const char  *stage_name);
+
 /*----------------------------------------------------------------------------
  * Print summary of running time, including CPU and elapsed times.
  *----------------------------------------------------------------------------*/
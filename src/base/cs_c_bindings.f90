@@ -993,6 +993,28 @@ module cs_c_bindings
 
     !---------------------------------------------------------------------------
 
+    ! Interface to C function checking load balance and saving a balanced
+    ! partitioning for restart if required.
+
+    subroutine cs_partition_check_restart_balance()  &
+      bind(C, name='cs_partition_check_restart_balance')
+      use, intrinsic :: iso_c_binding
+      implicit none
+    end subroutine cs_partition_check_restart_balance
+
+    !---------------------------------------------------------------------------
+
+    ! Interface to C function evaluating the mesh adaptation indicator and
+    ! saving flagged cells for restart if required.
+
+    subroutine cs_mesh_adapt_check()  &
+      bind(C, name='cs_mesh_adapt_check')
+      use, intrinsic :: iso_c_binding
+      implicit none
+    end subroutine cs_mesh_adapt_check
+
+    !---------------------------------------------------------------------------
+
     ! Interface to C function mapping field pointers
 
     subroutine cs_field_pointer_map_base()  &
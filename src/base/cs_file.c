@@ -3840,6 +3840,42 @@ cs_file_size(const char  *path)
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the last modification time of a file.
+ *
+ * If the file does not exist, or if the information is not available,
+ * 0 is returned.
+ *
+ * \param[in]  path  file path.
+ *
+ * \return modification time of file, in seconds since the Epoch.
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_file_mtime(const char  *path)
+{
+  double retval = 0;
+
+#if defined(HAVE_SYS_STAT_H)
+
+  struct stat s;
+
+  if (stat(path, &s) != 0) {
+    if (errno != ENOENT)
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error querying information for file:\n%s."),
+                path);
+  }
+  else
+    retval = s.st_mtime;
+
+#endif /* defined(HAVE_SYS_STAT_H) */
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Remove a file if it exists and is a regular file.
@@ -3887,6 +3923,83 @@ cs_file_remove(const char  *path)
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Link or copy a file.
+ *
+ * A hard link is used if possible (so that the file's modification time
+ * is preserved); otherwise, the file is copied. If the destination file
+ * exists, it is replaced, unless it is the same file as the source.
+ *
+ * This function is not collective, and should usually be called by
+ * a single rank.
+ *
+ * \param[in]  src   source file path.
+ * \param[in]  dest  destination file path.
+ *
+ * \return 0 in case of success, -1 otherwise.
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_file_link_or_copy(const char  *src,
+                     const char  *dest)
+{
+  int retval = -1;
+
+#if defined(HAVE_SYS_TYPES_H) && defined(HAVE_SYS_STAT_H) \
+                              && defined(HAVE_UNISTD_H)
+
+  struct stat s_src, s_dest;
+
+  if (stat(src, &s_src) != 0)
+    return -1;
+
+  if (stat(dest, &s_dest) == 0) {
+    if (s_src.st_dev == s_dest.st_dev && s_src.st_ino == s_dest.st_ino)
+      return 0;
+    if (unlink(dest) != 0)
+      return -1;
+  }
+
+  retval = link(src, dest);
+
+#endif
+
+  if (retval != 0) {
+
+    FILE *f_src = fopen(src, "rb");
+    FILE *f_dest = (f_src != NULL) ? fopen(dest, "wb") : NULL;
+
+    if (f_dest != NULL) {
+
+      char buffer[65536];
+      size_t n_read;
+
+      retval = 0;
+
+      while ((n_read = fread(buffer, 1, sizeof(buffer), f_src)) > 0) {
+        if (fwrite(buffer, 1, n_read, f_dest) != n_read) {
+          retval = -1;
+          break;
+        }
+      }
+
+      if (ferror(f_src))
+        retval = -1;
+      if (fclose(f_dest) != 0)
+        retval = -1;
+
+    }
+
+    if (f_src != NULL)
+      fclose(f_src);
+
+  }
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------*/
 
 /*----------------------------------------------------------------------------*/
@@ -818,6 +818,22 @@ cs_file_listdir(const char *path);
 cs_file_off_t
 cs_file_size(const char  *path);
 
+/*----------------------------------------------------------------------------
+ * Return the last modification time of a file.
+ *
+ * If the file does not exist, or if the information is not available,
+ * 0 is returned.
+ *
+ * parameters
+ *   path <-- file path.
+ *
+ * returns:
+ *   modification time of file, in seconds since the Epoch.
+ *----------------------------------------------------------------------------*/
+
+double
+cs_file_mtime(const char  *path);
+
 /*----------------------------------------------------------------------------
  * Remove a file if it exists and is a regular file.
  *
@@ -831,6 +847,28 @@ cs_file_size(const char  *path);
 int
 cs_file_remove(const char  *path);
 
+/*----------------------------------------------------------------------------
+ * Link or copy a file.
+ *
+ * A hard link is used if possible (so that the file's modification time
+ * is preserved); otherwise, the file is copied. If the destination file
+ * exists, it is replaced, unless it is the same file as the source.
+ *
+ * This function is not collective, and should usually be called by
+ * a single rank.
+ *
+ * parameters
+ *   src  <-- source file path.
+ *   dest <-- destination file path.
+ *
+ * returns:
+ *   0 in case of success, -1 otherwise.
+ *----------------------------------------------------------------------------*/
+
+int
+cs_file_link_or_copy(const char  *src,
+                     const char  *dest);
+
 /*----------------------------------------------------------------------------
  * Check if a file name ends with a specific string (extension)
  *
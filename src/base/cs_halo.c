@@ -44,6 +44,7 @@
 
 #include "cs_base.h"
 #include "cs_order.h"
+#include "cs_timer.h"
 
 #include "cs_interface.h"
 #include "cs_rank_neighbors.h"
@@ -84,6 +85,10 @@ static int           _cs_glob_halo_request_size = 0;
 static MPI_Request  *_cs_glob_halo_request = NULL;
 static MPI_Status   *_cs_glob_halo_status = NULL;
 
+/* Time spent waiting for halo synchronization */
+
+static cs_timer_counter_t  _cs_glob_halo_wait_time;
+
 #endif
 
 /* Buffer to save rotation halo values */
@@ -1216,7 +1221,12 @@ cs_halo_sync_untyped(const cs_halo_t  *halo,
 
     /* Wait for all exchanges */
 
+    cs_timer_t t0 = cs_timer_time();
+
     MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
+
+    cs_timer_t t1 = cs_timer_time();
+    cs_timer_counter_add_diff(&_cs_glob_halo_wait_time, &t0, &t1);
   }
 
 #endif /* defined(HAVE_MPI) */
@@ -1355,7 +1365,12 @@ cs_halo_sync_num(const cs_halo_t  *halo,
 
     /* Wait for all exchanges */
 
+    cs_timer_t t0 = cs_timer_time();
+
     MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
+
+    cs_timer_t t1 = cs_timer_time();
+    cs_timer_counter_add_diff(&_cs_glob_halo_wait_time, &t0, &t1);
   }
 
 #endif /* defined(HAVE_MPI) */
@@ -1485,7 +1500,12 @@ cs_halo_sync_var(const cs_halo_t  *halo,
 
     /* Wait for all exchanges */
 
+    cs_timer_t t0 = cs_timer_time();
+
     MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
+
+    cs_timer_t t1 = cs_timer_time();
+    cs_timer_counter_add_diff(&_cs_glob_halo_wait_time, &t0, &t1);
   }
 
 #endif /* defined(HAVE_MPI) */
@@ -1651,7 +1671,12 @@ cs_halo_sync_var_strided(const cs_halo_t  *halo,
 
     /* Wait for all exchanges */
 
+    cs_timer_t t0 = cs_timer_time();
+
     MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
+
+    cs_timer_t t1 = cs_timer_time();
+    cs_timer_counter_add_diff(&_cs_glob_halo_wait_time, &t0, &t1);
   }
 
 #endif /* defined(HAVE_MPI) */
@@ -1812,6 +1837,30 @@ cs_halo_set_use_barrier(bool use_barrier)
   _cs_glob_halo_use_barrier = use_barrier;
 }
 
+/*----------------------------------------------------------------------------
+ * Return the accumulated wall-clock time spent waiting for halo
+ * synchronization on this rank.
+ *
+ * This excludes the time spent assembling or copying values, so it mostly
+ * measures the time this rank waits for its neighbors, which may be
+ * used to estimate load imbalance.
+ *
+ * returns:
+ *   elapsed wait time, in seconds
+ *---------------------------------------------------------------------------*/
+
+double
+cs_halo_get_sync_wait_time(void)
+{
+  double retval = 0;
+
+#if defined(HAVE_MPI)
+  retval = _cs_glob_halo_wait_time.wall_nsec * 1e-9;
+#endif
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------
  * Dump a cs_halo_t structure.
  *
@@ -460,6 +460,21 @@ cs_halo_get_use_barrier(void);
 void
 cs_halo_set_use_barrier(bool use_barrier);
 
+/*----------------------------------------------------------------------------
+ * Return the accumulated wall-clock time spent waiting for halo
+ * synchronization on this rank.
+ *
+ * This excludes the time spent assembling or copying values, so it mostly
+ * measures the time this rank waits for its neighbors, which may be
+ * used to estimate load imbalance.
+ *
+ * returns:
+ *   elapsed wait time, in seconds
+ *---------------------------------------------------------------------------*/
+
+double
+cs_halo_get_sync_wait_time(void);
+
 /*----------------------------------------------------------------------------
  * Dump a cs_halo_t structure.
  *
@@ -1766,6 +1766,64 @@ _write_header(const char     *sec_name,
   return embed;
 }
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Return the first nonzero value among those of following ranks.
+ *
+ * This is a reverse exclusive scan, based on log2(n_ranks) point-to-point
+ * exchange steps, so no rank needs to store values for all ranks.
+ *
+ * parameters:
+ *   val     <-- local value (0 for ranks with no data)
+ *   rank_id <-- local rank id in communicator
+ *   n_ranks <-- number of ranks in communicator
+ *   comm    <-- associated communicator
+ *
+ * returns:
+ *   value of closest following rank with a nonzero value, or 0
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_next_rank_nonzero(cs_gnum_t  val,
+                   int        rank_id,
+                   int        n_ranks,
+                   MPI_Comm   comm)
+{
+  MPI_Status status;
+
+  cs_gnum_t retval = 0;
+
+  /* Shift values by one rank, then scan */
+
+  int dest = (rank_id > 0) ? rank_id - 1 : MPI_PROC_NULL;
+  int source = (rank_id < n_ranks - 1) ? rank_id + 1 : MPI_PROC_NULL;
+
+  MPI_Sendrecv(&val, 1, CS_MPI_GNUM, dest, CS_IO_MPI_TAG,
+               &retval, 1, CS_MPI_GNUM, source, CS_IO_MPI_TAG,
+               comm, &status);
+
+  for (int step = 1; step < n_ranks; step *= 2) {
+
+    cs_gnum_t recv_val = 0;
+
+    dest = (rank_id >= step) ? rank_id - step : MPI_PROC_NULL;
+    source = (rank_id < n_ranks - step) ? rank_id + step : MPI_PROC_NULL;
+
+    MPI_Sendrecv(&retval, 1, CS_MPI_GNUM, dest, CS_IO_MPI_TAG,
+                 &recv_val, 1, CS_MPI_GNUM, source, CS_IO_MPI_TAG,
+                 comm, &status);
+
+    if (retval == 0)
+      retval = recv_val;
+
+  }
+
+  return retval;
+}
+
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------
  * Dump a kernel IO file handle's metadata.
  *
@@ -2671,62 +2729,27 @@ cs_io_read_index_block(cs_io_sec_header_t  *header,
   if (n_ranks > 1) {
 
     cs_gnum_t  past_last_max = 0;
-    cs_gnum_t  past_last_max_0 = 0;
+    cs_gnum_t  past_last_max_g = 0;
     cs_gnum_t  past_last = 0;
-    cs_gnum_t *past_last_0 = NULL;
 
     if (   _global_num_end > global_num_end
         && _global_num_end > _global_num_start)
       past_last_max = retval[_global_num_end - _global_num_start - 1];
 
-    MPI_Reduce(&past_last_max, &past_last_max_0, 1, CS_MPI_GNUM, MPI_MAX,
-               0, comm);
-
-    /* Initially, past_last values contain the first index value
-       for a given rank; they will later be shifted to define the
-       past-the-last value for the previous rank) */
-
-    if (retval != NULL)
-      past_last = retval[0];
-
-    if (rank_id == 0)
-      BFT_MALLOC(past_last_0, n_ranks, cs_gnum_t);
-
-    MPI_Gather(&past_last, 1, CS_MPI_GNUM,
-               past_last_0, 1, CS_MPI_GNUM,
-               0, comm);
-
-    if (rank_id == 0) {
-
-      int i;
-      int last_data_rank = n_ranks - 1;
-
-      while (last_data_rank > 0 && past_last_0[last_data_rank] == 0)
-        last_data_rank -= 1;
+    MPI_Allreduce(&past_last_max, &past_last_max_g, 1, CS_MPI_GNUM, MPI_MAX,
+                  comm);
 
-      /* fill empty values before last rank with data */
-      for (i = last_data_rank; i > 0; i--) {
-        if (past_last_0[i-1] == 0)
-          past_last_0[i-1] = past_last_0[i];
-      }
-
-      /* Shift values one rank (to really define past-the-last values) */
-
-      for (i = 0; i < last_data_rank; i++)
-        past_last_0[i] = past_last_0[i+1];
+    /* First index value for this rank defines the past-the-last value
+       for the closest previous ranks; obtain it from the closest
+       following rank with data, or use the global past-the-last value
+       for ranks from the last rank with data onwards */
 
-      /* Define for all other ranks from last rank with data onwards */
-
-      for (i = last_data_rank; i < n_ranks; i++)
-        past_last_0[i] = past_last_max_0;
-    }
+    past_last = retval[0];
 
-    MPI_Scatter(past_last_0, 1, CS_MPI_GNUM,
-                &past_last, 1, CS_MPI_GNUM,
-                0, comm);
+    past_last = _next_rank_nonzero(past_last, rank_id, n_ranks, comm);
 
-    if (rank_id == 0)
-      BFT_FREE(past_last_0);
+    if (past_last == 0)
+      past_last = past_last_max_g;
 
     if (retval != NULL)
       retval[global_num_end - global_num_start] = past_last;
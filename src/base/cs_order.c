@@ -41,6 +41,8 @@
 #include "bft_mem.h"
 #include "bft_printf.h"
 
+#include "cs_sort.h"
+
 /*----------------------------------------------------------------------------
  *  Header for the current file
  *----------------------------------------------------------------------------*/
@@ -53,14 +55,298 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*=============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Minimum number of entities above which radix or merge sort
+   (using threads if available) is used instead of heap sort
+   (variable for unit tests, so that both may be compared) */
+
+#if defined(_CS_UNIT_ORDER_TEST)
+size_t  cs_order_parallel_min = 2048;
+#define CS_ORDER_PARALLEL_MIN  cs_order_parallel_min
+#else
+#define CS_ORDER_PARALLEL_MIN  2048
+#endif
+
+/* Size of runs initially ordered by insertion in merge sort */
+
+#define CS_ORDER_MERGE_RUN_SIZE  16
+
 /*============================================================================
  * Local structure definitions
  *============================================================================*/
 
+/* Function indicating if element i1 is greater than element i2 */
+
+typedef bool
+(_order_is_greater_t) (size_t       i1,
+                       size_t       i2,
+                       const void  *input);
+
+/* Indexed array description */
+
+typedef struct {
+
+  const cs_lnum_t  *index;    /* number of values for each entity */
+  const cs_gnum_t  *number;   /* entity values */
+
+} _order_indexed_t;
+
 /*=============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Order a strided array of global numbers using a radix sort.
+ *
+ * Entities are ordered by their last value first; as the sort is stable,
+ * the resulting order is lexicographical, with equal entities in
+ * increasing id order.
+ *
+ * parameters:
+ *   number   <-- array of entity numbers
+ *   stride   <-- stride of array (number of values to compare)
+ *   order    --> pre-allocated ordering table
+ *   nb_ent   <-- number of entities considered
+ *----------------------------------------------------------------------------*/
+
+static void
+_order_gnum_radix_s(const cs_gnum_t   number[],
+                    size_t            stride,
+                    cs_lnum_t         order[],
+                    const size_t      nb_ent)
+{
+  const cs_lnum_t n_ent = nb_ent;
+
+  cs_gnum_t *keys;
+  BFT_MALLOC(keys, n_ent, cs_gnum_t);
+
+# pragma omp parallel for if(n_ent > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_ent; i++)
+    order[i] = i;
+
+  for (size_t j = stride; j > 0; j--) {
+
+#   pragma omp parallel for if(n_ent > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_ent; i++)
+      keys[i] = number[order[i]*stride + j-1];
+
+    cs_sort_gnum_radix(n_ent, keys, order);
+
+  }
+
+  BFT_FREE(keys);
+}
+
+/*----------------------------------------------------------------------------
+ * Order a strided array of local numbers using a radix sort.
+ *
+ * Entities are ordered by their last value first; as the sort is stable,
+ * the resulting order is lexicographical, with equal entities in
+ * increasing id order.
+ *
+ * parameters:
+ *   number   <-- array of entity numbers
+ *   stride   <-- stride of array (number of values to compare)
+ *   order    --> pre-allocated ordering table
+ *   nb_ent   <-- number of entities considered
+ *----------------------------------------------------------------------------*/
+
+static void
+_order_lnum_radix_s(const cs_lnum_t   number[],
+                    size_t            stride,
+                    cs_lnum_t         order[],
+                    const size_t      nb_ent)
+{
+  const cs_lnum_t n_ent = nb_ent;
+
+  cs_gnum_t *keys;
+  BFT_MALLOC(keys, n_ent, cs_gnum_t);
+
+# pragma omp parallel for if(n_ent > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_ent; i++)
+    order[i] = i;
+
+  for (size_t j = stride; j > 0; j--) {
+
+    /* Shift keys by the minimum value (using unsigned arithmetic,
+       which cannot overflow) so that they may be handled as unsigned */
+
+    cs_lnum_t n_min = number[j-1];
+    for (cs_lnum_t i = 1; i < n_ent; i++)
+      n_min = CS_MIN(n_min, number[i*stride + j-1]);
+
+#   pragma omp parallel for if(n_ent > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_ent; i++)
+      keys[i] =   (cs_gnum_t)number[order[i]*stride + j-1]
+                - (cs_gnum_t)n_min;
+
+    cs_sort_gnum_radix(n_ent, keys, order);
+
+  }
+
+  BFT_FREE(keys);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the number of elements from the first of two ordered
+ * sub-arrays placed before a given position of their (stable) merge.
+ *
+ * parameters:
+ *   k          <-- position in merged array
+ *   a          <-- first ordered sub-array
+ *   n_a        <-- size of first sub-array
+ *   b          <-- second ordered sub-array
+ *   n_b        <-- size of second sub-array
+ *   is_greater <-- comparison function
+ *   input      <-- input for comparison function
+ *
+ * returns:
+ *   number of elements of a placed before position k
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_merge_co_rank(size_t                k,
+               const cs_lnum_t       a[],
+               size_t                n_a,
+               const cs_lnum_t       b[],
+               size_t                n_b,
+               _order_is_greater_t  *is_greater,
+               const void           *input)
+{
+  size_t i = CS_MIN(k, n_a);
+  size_t j = k - i;
+  size_t i_low = (k > n_b) ? k - n_b : 0;
+  size_t j_low = (k > n_a) ? k - n_a : 0;
+
+  while (true) {
+    if (i > 0 && j < n_b && is_greater(a[i-1], b[j], input)) {
+      size_t delta = (i - i_low + 1) / 2;
+      j_low = j;
+      i -= delta;
+      j += delta;
+    }
+    else if (j > 0 && i < n_a && !is_greater(a[i], b[j-1], input)) {
+      size_t delta = (j - j_low + 1) / 2;
+      i_low = i;
+      i += delta;
+      j -= delta;
+    }
+    else
+      break;
+  }
+
+  return i;
+}
+
+/*----------------------------------------------------------------------------
+ * Order an array using a merge sort.
+ *
+ * Short runs are first ordered by insertion, then merged pairwise;
+ * merges are split in independent parts (using the co-rank of their
+ * bounds) when there are fewer pairs than threads. The sort is stable,
+ * so equal entities are placed in increasing id order.
+ *
+ * parameters:
+ *   order      --> pre-allocated ordering table
+ *   nb_ent     <-- number of entities considered
+ *   is_greater <-- comparison function
+ *   input      <-- input for comparison function
+ *----------------------------------------------------------------------------*/
+
+static void
+_order_merge_sort(cs_lnum_t             order[],
+                  const size_t          nb_ent,
+                  _order_is_greater_t  *is_greater,
+                  const void           *input)
+{
+  const cs_lnum_t n_ent = nb_ent;
+  const cs_lnum_t run_size = CS_ORDER_MERGE_RUN_SIZE;
+  const cs_lnum_t n_runs = (n_ent + run_size - 1) / run_size;
+
+  /* Order runs by insertion */
+
+# pragma omp parallel for if(n_ent > CS_THR_MIN)
+  for (cs_lnum_t r_id = 0; r_id < n_runs; r_id++) {
+    cs_lnum_t s_id = r_id*run_size;
+    cs_lnum_t e_id = CS_MIN(s_id + run_size, n_ent);
+    for (cs_lnum_t i = s_id; i < e_id; i++) {
+      cs_lnum_t o_save = i;
+      cs_lnum_t j = i;
+      while (j > s_id && is_greater(order[j-1], o_save, input)) {
+        order[j] = order[j-1];
+        j--;
+      }
+      order[j] = o_save;
+    }
+  }
+
+  /* Merge runs */
+
+  int n_threads = 1;
+#if defined(HAVE_OPENMP)
+  if (n_ent > CS_THR_MIN)
+    n_threads = omp_get_max_threads();
+#endif
+
+  cs_lnum_t *tmp;
+  BFT_MALLOC(tmp, n_ent, cs_lnum_t);
+
+  cs_lnum_t *src = order, *dest = tmp;
+
+  for (cs_lnum_t width = run_size; width < n_ent; width *= 2) {
+
+    const cs_lnum_t n_pairs = (n_ent + 2*width - 1) / (2*width);
+    const cs_lnum_t n_parts = (n_threads + n_pairs - 1) / n_pairs;
+    const cs_lnum_t n_tasks = n_pairs * n_parts;
+
+#   pragma omp parallel for if(n_ent > CS_THR_MIN)
+    for (cs_lnum_t t_id = 0; t_id < n_tasks; t_id++) {
+
+      const cs_lnum_t p_id = t_id / n_parts;
+      const cs_lnum_t part_id = t_id % n_parts;
+
+      const cs_lnum_t s_id = p_id*2*width;
+      const cs_lnum_t m_id = CS_MIN(s_id + width, n_ent);
+      const cs_lnum_t e_id = CS_MIN(s_id + 2*width, n_ent);
+
+      const cs_lnum_t *a = src + s_id, *b = src + m_id;
+      const size_t n_a = m_id - s_id, n_b = e_id - m_id;
+
+      size_t k_s = ((size_t)(e_id - s_id) * part_id) / n_parts;
+      size_t k_e = ((size_t)(e_id - s_id) * (part_id + 1)) / n_parts;
+
+      size_t i = _merge_co_rank(k_s, a, n_a, b, n_b, is_greater, input);
+      size_t j = k_s - i;
+
+      cs_lnum_t *_dest = dest + s_id;
+
+      for (size_t k = k_s; k < k_e; k++) {
+        if (j >= n_b || (i < n_a && !is_greater(a[i], b[j], input)))
+          _dest[k] = a[i++];
+        else
+          _dest[k] = b[j++];
+      }
+
+    }
+
+    cs_lnum_t *swap = src;
+    src = dest;
+    dest = swap;
+
+  }
+
+  if (src != order) {
+#   pragma omp parallel for if(n_ent > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_ent; i++)
+      order[i] = src[i];
+  }
+
+  BFT_FREE(tmp);
+}
+
 /*----------------------------------------------------------------------------
  * Descend binary tree for the ordering of a cs_gnum_t (integer) array.
  *
@@ -127,6 +413,11 @@ _order_gnum(const cs_gnum_t   number[],
   size_t i;
   cs_lnum_t o_save;
 
+  if (nb_ent > CS_ORDER_PARALLEL_MIN) {
+    _order_gnum_radix_s(number, 1, order, nb_ent);
+    return;
+  }
+
   /* Initialize ordering array */
 
   for (i = 0 ; i < nb_ent ; i++)
@@ -239,6 +530,11 @@ _order_gnum_s(const cs_gnum_t   number[],
   size_t i;
   cs_lnum_t o_save;
 
+  if (nb_ent > CS_ORDER_PARALLEL_MIN) {
+    _order_gnum_radix_s(number, stride, order, nb_ent);
+    return;
+  }
+
   /* Initialize ordering array */
 
   for (i = 0 ; i < nb_ent ; i++)
@@ -367,6 +663,29 @@ _indexed_is_greater(size_t            i1,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Indicate if element i1 from an indexed list is lexicographically
+ * greater than element i2 (for merge sort).
+ *
+ * parameters:
+ *   i1     <-- position in index for the first element
+ *   i2     <-- position in index for the second element
+ *   input  <-- pointer to indexed array description
+ *
+ * returns:
+ *   true if element i1 is greater than element i2, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_indexed_is_greater_m(size_t       i1,
+                      size_t       i2,
+                      const void  *input)
+{
+  const _order_indexed_t *indexed = input;
+
+  return _indexed_is_greater(i1, i2, indexed->index, indexed->number);
+}
+
 /*----------------------------------------------------------------------------
  * Descend binary tree for the lexicographical ordering of an indexed
  * array of global numbers.
@@ -452,6 +771,12 @@ _order_gnum_i(const cs_gnum_t   number[],
   if (nb_ent < 2)
     return;
 
+  if (nb_ent > CS_ORDER_PARALLEL_MIN) {
+    _order_indexed_t input = {.index = index, .number = number};
+    _order_merge_sort(order, nb_ent, _indexed_is_greater_m, &input);
+    return;
+  }
+
   /* Create binary tree */
 
   i = (nb_ent / 2);
@@ -538,6 +863,11 @@ _order_lnum(const cs_lnum_t   number[],
   size_t i;
   cs_lnum_t o_save;
 
+  if (nb_ent > CS_ORDER_PARALLEL_MIN) {
+    _order_lnum_radix_s(number, 1, order, nb_ent);
+    return;
+  }
+
   /* Initialize ordering array */
 
   for (i = 0 ; i < nb_ent ; i++)
@@ -650,6 +980,11 @@ _order_lnum_s(const cs_lnum_t   number[],
   size_t i;
   cs_lnum_t o_save;
 
+  if (nb_ent > CS_ORDER_PARALLEL_MIN) {
+    _order_lnum_radix_s(number, stride, order, nb_ent);
+    return;
+  }
+
   /* Initialize ordering array */
 
   for (i = 0 ; i < nb_ent ; i++)
@@ -676,6 +1011,28 @@ _order_lnum_s(const cs_lnum_t   number[],
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Indicate if element i1 of a cs_real_t array is greater than element i2.
+ *
+ * parameters:
+ *   i1     <-- id of the first element
+ *   i2     <-- id of the second element
+ *   input  <-- pointer to array values
+ *
+ * returns:
+ *   true if element i1 is greater than element i2, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_real_is_greater(size_t       i1,
+                 size_t       i2,
+                 const void  *input)
+{
+  const cs_real_t *value = input;
+
+  return (value[i1] > value[i2]);
+}
+
 /*----------------------------------------------------------------------------
  * Descend binary tree for the ordering of a cs_real_t array.
  *
@@ -748,6 +1105,11 @@ _order_real(const cs_real_t   value[],
   if (nb_ent < 2)
     return;
 
+  if (nb_ent > CS_ORDER_PARALLEL_MIN) {
+    _order_merge_sort(order, nb_ent, _real_is_greater, value);
+    return;
+  }
+
   /* Create binary tree */
 
   i = (nb_ent / 2) ;
@@ -153,6 +153,10 @@ static size_t _cs_parall_min_coll_buf_size = 1024*1024*8;
 
 #endif
 
+/* Accumulated wall-clock time spent in global reductions */
+
+static double _cs_parall_reduce_wait_time = 0.;
+
 /*============================================================================
  * Prototypes for functions intended for use only by Fortran wrappers.
  * (descriptions follow, with function bodies).
@@ -255,8 +259,10 @@ _cs_parall_allreduce(int             n,
 
   memcpy(locval, val, data_size);
 
+  double t0 = cs_timer_wtime();
   MPI_Allreduce(locval, val, n, cs_datatype_to_mpi[datatype], operation,
                 cs_glob_mpi_comm);
+  cs_parall_reduce_wait_add(t0);
 
   if (locval != _locval)
     BFT_FREE(locval);
@@ -284,8 +290,10 @@ cs_f_parall_max_i(int  *max)
 
   assert (sizeof (double) == sizeof (cs_real_t));
 
+  double t0 = cs_timer_wtime();
   MPI_Allreduce (max, &global_max, 1, MPI_INT, MPI_MAX,
                  cs_glob_mpi_comm);
+  cs_parall_reduce_wait_add(t0);
 
   *max = global_max;
 
@@ -308,8 +316,10 @@ cs_f_parall_min_r(double  *min)
 
   assert (sizeof (double) == sizeof (cs_real_t));
 
+  double t0 = cs_timer_wtime();
   MPI_Allreduce (min, &global_min, 1, MPI_DOUBLE, MPI_MIN,
                  cs_glob_mpi_comm);
+  cs_parall_reduce_wait_add(t0);
 
   *min = global_min;
 
@@ -332,8 +342,10 @@ cs_f_parall_min_i(int  *min)
 
   assert (sizeof (double) == sizeof (cs_real_t));
 
+  double t0 = cs_timer_wtime();
   MPI_Allreduce (min, &global_min, 1, MPI_INT, MPI_MIN,
                  cs_glob_mpi_comm);
+  cs_parall_reduce_wait_add(t0);
 
   *min = global_min;
 
@@ -356,8 +368,10 @@ cs_f_parall_max_r(double  *max)
 
   assert (sizeof (double) == sizeof (cs_real_t));
 
+  double t0 = cs_timer_wtime();
   MPI_Allreduce (max, &global_max, 1, MPI_DOUBLE, MPI_MAX,
                  cs_glob_mpi_comm);
+  cs_parall_reduce_wait_add(t0);
 
   *max = global_max;
 
@@ -380,8 +394,10 @@ cs_f_parall_sum_i(int  *sum)
 
   assert (sizeof (double) == sizeof (cs_real_t));
 
+  double t0 = cs_timer_wtime();
   MPI_Allreduce (sum, &global_sum, 1, MPI_INT, MPI_SUM,
                  cs_glob_mpi_comm);
+  cs_parall_reduce_wait_add(t0);
 
   *sum = global_sum;
 
@@ -404,8 +420,10 @@ cs_f_parall_sum_r(double  *sum)
 
   assert (sizeof (double) == sizeof (cs_real_t));
 
+  double t0 = cs_timer_wtime();
   MPI_Allreduce (sum, &global_sum, 1, MPI_DOUBLE, MPI_SUM,
                  cs_glob_mpi_comm);
+  cs_parall_reduce_wait_add(t0);
 
   *sum = global_sum;
 
@@ -588,6 +606,43 @@ cs_f_parall_barrier(void)
  * Public function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add the wall-clock time elapsed since a given start time to the
+ *        accumulated global reduction time.
+ *
+ * The whole duration of a blocking reduction is counted, as it is mostly
+ * spent waiting for the slowest rank.
+ *
+ * \param[in]  t_start  wall-clock time before the reduction
+ *                      (from \ref cs_timer_wtime)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_reduce_wait_add(double  t_start)
+{
+  _cs_parall_reduce_wait_time += cs_timer_wtime() - t_start;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the accumulated wall-clock time spent in global reductions
+ *        on this rank.
+ *
+ * Reductions done through the cs_parall_... functions and the iterative
+ * linear solver dot products are included.
+ *
+ * \return  elapsed reduction time, in seconds
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_parall_get_reduce_wait_time(void)
+{
+  return _cs_parall_reduce_wait_time;
+}
+
 #if !defined(HAVE_MPI_IN_PLACE) && defined(HAVE_MPI)
 
 void
@@ -712,8 +767,10 @@ cs_parall_max_loc_vals(int         n,
     val_in.val  = *max;
     val_in.rank = cs_glob_rank_id;
 
+    double t0 = cs_timer_wtime();
     MPI_Allreduce(&val_in, &val_max, 1, MPI_DOUBLE_INT, MPI_MAXLOC,
                   cs_glob_mpi_comm);
+    cs_parall_reduce_wait_add(t0);
 
     *max = val_max.val;
 
@@ -750,8 +807,10 @@ cs_parall_min_loc_vals(int         n,
     val_in.val  = *min;
     val_in.rank = cs_glob_rank_id;
 
+    double t0 = cs_timer_wtime();
     MPI_Allreduce(&val_in, &val_min, 1, MPI_DOUBLE_INT, MPI_MINLOC,
                   cs_glob_mpi_comm);
+    cs_parall_reduce_wait_add(t0);
 
     *min = val_min.val;
 
@@ -793,8 +852,10 @@ cs_parall_min_id_rank_r(cs_lnum_t  *elt_id,
     val_in.val  = val;
     val_in.rank = cs_glob_rank_id;
 
+    double t0 = cs_timer_wtime();
     MPI_Allreduce(&val_in, &val_min, 1, MPI_DOUBLE_INT, MPI_MINLOC,
                   cs_glob_mpi_comm);
+    cs_parall_reduce_wait_add(t0);
 
     *rank_id = cs_glob_rank_id;
 
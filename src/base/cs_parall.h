@@ -32,6 +32,7 @@
  *----------------------------------------------------------------------------*/
 
 #include "cs_defs.h"
+#include "cs_timer.h"
 
 /*----------------------------------------------------------------------------*/
 
@@ -41,6 +42,31 @@ BEGIN_C_DECLS
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Add the wall-clock time elapsed since a given start time to the
+ * accumulated global reduction time.
+ *
+ * The whole duration of a blocking reduction is counted, as it is mostly
+ * spent waiting for the slowest rank.
+ *
+ * parameters:
+ *   t_start <-- wall-clock time before the reduction (from cs_timer_wtime())
+ *----------------------------------------------------------------------------*/
+
+void
+cs_parall_reduce_wait_add(double  t_start);
+
+/*----------------------------------------------------------------------------
+ * Return the accumulated wall-clock time spent in global reductions
+ * on this rank.
+ *
+ * returns:
+ *   elapsed reduction time, in seconds
+ *----------------------------------------------------------------------------*/
+
+double
+cs_parall_get_reduce_wait_time(void);
+
 /*----------------------------------------------------------------------------
  * Sum values of a counter on all default communicator processes.
  *
@@ -56,8 +82,10 @@ cs_parall_counter(cs_gnum_t   cpt[],
                   const int   n)
 {
   if (cs_glob_n_ranks > 1) {
+    double t0 = cs_timer_wtime();
     MPI_Allreduce(MPI_IN_PLACE, cpt, n, CS_MPI_GNUM, MPI_SUM,
                   cs_glob_mpi_comm);
+    cs_parall_reduce_wait_add(t0);
   }
 }
 
@@ -88,8 +116,10 @@ cs_parall_counter_max(cs_lnum_t   cpt[],
                       const int   n)
 {
   if (cs_glob_n_ranks > 1) {
+    double t0 = cs_timer_wtime();
     MPI_Allreduce(MPI_IN_PLACE, cpt, n, CS_MPI_LNUM, MPI_MAX,
                   cs_glob_mpi_comm);
+    cs_parall_reduce_wait_add(t0);
   }
 }
 
@@ -122,8 +152,10 @@ cs_parall_sum(int             n,
               void           *val)
 {
   if (cs_glob_n_ranks > 1) {
+    double t0 = cs_timer_wtime();
     MPI_Allreduce(MPI_IN_PLACE, val, n, cs_datatype_to_mpi[datatype], MPI_SUM,
                   cs_glob_mpi_comm);
+    cs_parall_reduce_wait_add(t0);
   }
 }
 
@@ -157,8 +189,10 @@ cs_parall_max(int             n,
               void           *val)
 {
   if (cs_glob_n_ranks > 1) {
+    double t0 = cs_timer_wtime();
     MPI_Allreduce(MPI_IN_PLACE, val, n, cs_datatype_to_mpi[datatype], MPI_MAX,
                   cs_glob_mpi_comm);
+    cs_parall_reduce_wait_add(t0);
   }
 }
 
@@ -192,8 +226,10 @@ cs_parall_min(int             n,
               void           *val)
 {
   if (cs_glob_n_ranks > 1) {
+    double t0 = cs_timer_wtime();
     MPI_Allreduce(MPI_IN_PLACE, val, n, cs_datatype_to_mpi[datatype], MPI_MIN,
                   cs_glob_mpi_comm);
+    cs_parall_reduce_wait_add(t0);
   }
 }
 
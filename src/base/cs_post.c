@@ -31,11 +31,17 @@
  *----------------------------------------------------------------------------*/
 
 #include <assert.h>
+#include <errno.h>
+#include <limits.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(HAVE_PTHREAD)
+#include <pthread.h>
+#endif
+
 /*----------------------------------------------------------------------------
  * Local headers
  *----------------------------------------------------------------------------*/
@@ -47,16 +53,21 @@
 #include "fvm_nodal_append.h"
 #include "fvm_nodal_extract.h"
 
+#include "cs_all_to_all.h"
 #include "cs_base.h"
+#include "cs_block_dist.h"
 #include "cs_boundary_zone.h"
 #include "cs_field.h"
 #include "cs_file.h"
 #include "cs_lagr_extract.h"
 #include "cs_log.h"
 #include "cs_lagr_query.h"
+#include "cs_math.h"
 #include "cs_mesh.h"
 #include "cs_mesh_connect.h"
 #include "cs_mesh_location.h"
+#include "cs_mesh_quantities.h"
+#include "cs_order.h"
 #include "cs_parall.h"
 #include "cs_prototypes.h"
 #include "cs_selector.h"
@@ -264,8 +275,39 @@ typedef struct {
 
   fvm_writer_t  *writer;        /* Associated FVM writer */
 
+  bool           async_output;  /* If true, field output is staged and
+                                   done by a separate thread */
+
 } cs_post_writer_t;
 
+/* Cartesian sampling of a volume post-processing mesh */
+/*----------------------------------------------------*/
+
+/* Selected cells are binned on a regular grid covering their bounding box;
+   only non-empty bins are exported, distributed among ranks by blocks of
+   bin ids, and cell values are replaced by their volume-weighted average
+   over each bin. */
+
+typedef struct {
+
+  int            n_samples[3];  /* Number of bins in each direction */
+
+  cs_lnum_t      n_cells;       /* Number of selected local cells */
+  cs_lnum_t     *cell_ids;      /* Selected cell ids, or NULL if all */
+  cs_lnum_t     *cell_bin;      /* Local bin id of each selected cell */
+
+  cs_lnum_t      n_l_bins;      /* Number of bins containing local cells */
+  cs_lnum_t      n_b_bins;      /* Number of non-empty bins in local block
+                                   (exported by this rank) */
+  cs_lnum_t      n_recv;        /* Number of local bins received by block */
+  cs_lnum_t     *recv_bin;      /* Block bin id of each received bin */
+
+#if defined(HAVE_MPI)
+  cs_all_to_all_t  *d;          /* Local bins to blocks distributor */
+#endif
+
+} cs_post_sampling_t;
+
 /* Post-processing mesh structure */
 /*--------------------------------*/
 
@@ -329,8 +371,48 @@ typedef struct {
   fvm_writer_time_dep_t   mod_flag_min;  /* Minimum mesh time dependency */
   fvm_writer_time_dep_t   mod_flag_max;  /* Maximum mesh time dependency */
 
+  cs_post_sampling_t     *sampling;      /* Optional Cartesian sampling
+                                            (reduction) of cell values */
+
 } cs_post_mesh_t;
 
+/* Staged variable (for asynchronous output) */
+/*-------------------------------------------*/
+
+typedef struct {
+
+  fvm_writer_t           *writer;        /* Associated FVM writer */
+  const fvm_nodal_t      *exp_mesh;      /* Associated exportable mesh */
+  char                   *name;          /* Variable name */
+  fvm_writer_var_loc_t    location;      /* Variable location */
+  int                     dim;           /* Variable dimension */
+  cs_interlace_t          interlace;     /* Interlaced or not */
+  int                     n_parent_lists;       /* Number of parent lists */
+  cs_lnum_t               parent_num_shift[2];  /* Parent number shifts */
+  cs_datatype_t           datatype;      /* Variable data type */
+  int                     nt;            /* Time step number */
+  double                  t;             /* Time value */
+
+  unsigned char          *vals;          /* Copy of variable values */
+  const void             *var_ptr[2*9];  /* Pointers to values (in vals) */
+
+} cs_post_staged_var_t;
+
+/* Staging area (for asynchronous output) */
+/*----------------------------------------*/
+
+typedef struct {
+
+  int                     n_vars;        /* Number of staged variables */
+  int                     n_vars_max;    /* Size of staged variables array */
+  cs_post_staged_var_t   *vars;          /* Staged variables */
+
+  int                     n_flush;       /* Number of writers to flush */
+  int                     n_flush_max;   /* Size of writers to flush array */
+  fvm_writer_t          **flush;         /* Writers to flush */
+
+} cs_post_stage_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -387,6 +469,38 @@ static const char  _cs_post_dirname[] = "postprocessing";
 
 static int  _post_out_stat_id = -1;
 
+/* Asynchronous output: requested status (-1 if based on the CS_POST_ASYNC
+   environment variable), and effective status (-1 if not determined yet) */
+
+static int  _cs_post_async_request = -1;
+static int  _cs_post_async_mode = -1;
+
+/* Double-buffered staging area for asynchronous output: one area is filled
+   by the main thread while the other is output by the output thread */
+
+static int              _cs_post_stage_id = 0;
+static cs_post_stage_t  _cs_post_stage[2] = {{0, 0, NULL, 0, 0, NULL},
+                                             {0, 0, NULL, 0, 0, NULL}};
+
+#if defined(HAVE_PTHREAD)
+
+static bool             _cs_post_async_thread_active = false;
+static bool             _cs_post_async_busy = false;
+static bool             _cs_post_async_quit = false;
+static pthread_t        _cs_post_async_thread;
+static pthread_mutex_t  _cs_post_async_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t   _cs_post_async_cond = PTHREAD_COND_INITIALIZER;
+
+#endif
+
+#if defined(HAVE_MPI)
+
+/* Communicator used by asynchronous writers */
+
+static MPI_Comm  _cs_post_async_comm = MPI_COMM_NULL;
+
+#endif
+
 /*============================================================================
  * Prototypes for functions intended for use only by Fortran wrappers.
  * (descriptions follow, with function bodies).
@@ -555,7 +669,417 @@ _writer_info(void)
                  writer->id, case_name, dir_name, fmt_name, fmt_opts,
                  _(fvm_writer_time_dep_name[time_dep]), frequency_s);
     }
+
+    if (_cs_post_async_mode > 0)
+      bft_printf(_("  Field output for EnSight writers with a fixed mesh\n"
+                   "  is staged and done asynchronously.\n\n"));
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Check if asynchronous output is possible.
+ *
+ * This requires POSIX threads, MPI_THREAD_MULTIPLE support if MPI is used,
+ * and no memory instrumentation (which is not thread-safe outside
+ * OpenMP parallel regions).
+ *
+ * returns:
+ *   true if asynchronous output is possible, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_async_output_possible(void)
+{
+  bool retval = false;
+
+#if defined(HAVE_PTHREAD)
+
+  retval = true;
+
+  if (bft_mem_initialized())
+    retval = false;
+
+#if defined(HAVE_MPI)
+  {
+    int mpi_flag;
+    MPI_Initialized(&mpi_flag);
+    if (mpi_flag) {
+      int mpi_threads = MPI_THREAD_SINGLE;
+      MPI_Query_thread(&mpi_threads);
+      if (mpi_threads < MPI_THREAD_MULTIPLE)
+        retval = false;
+    }
+  }
+#endif
+
+#endif /* defined(HAVE_PTHREAD) */
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Determine whether asynchronous output is used, if not done yet.
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_output_init(void)
+{
+  if (_cs_post_async_mode > -1)
+    return;
+
+  int request = _cs_post_async_request;
+  if (request < 0)
+    request = (getenv("CS_POST_ASYNC") != NULL) ? 1 : 0;
+
+  _cs_post_async_mode = 0;
+
+  if (request > 0) {
+    if (_async_output_possible())
+      _cs_post_async_mode = 1;
+    else {
+      cs_base_warn(__FILE__, __LINE__);
+      bft_printf(_("Asynchronous postprocessing output is not available\n"
+                   "(it requires POSIX threads and MPI_THREAD_MULTIPLE\n"
+                   "support, and is incompatible with memory logging);\n"
+                   "output will be synchronous.\n"));
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Output and free variables staged in a given staging area, and flush
+ * associated writers.
+ *
+ * parameters:
+ *   s <-> pointer to staging area
+ *----------------------------------------------------------------------------*/
+
+static void
+_stage_output(cs_post_stage_t  *s)
+{
+  for (int i = 0; i < s->n_vars; i++) {
+
+    cs_post_staged_var_t  *v = s->vars + i;
+
+    fvm_writer_export_field(v->writer,
+                            v->exp_mesh,
+                            v->name,
+                            v->location,
+                            v->dim,
+                            v->interlace,
+                            v->n_parent_lists,
+                            v->parent_num_shift,
+                            v->datatype,
+                            v->nt,
+                            v->t,
+                            v->var_ptr);
+
+    BFT_FREE(v->vals);
+    BFT_FREE(v->name);
+
+  }
+  s->n_vars = 0;
+
+  for (int i = 0; i < s->n_flush; i++)
+    fvm_writer_flush(s->flush[i]);
+  s->n_flush = 0;
+}
+
+#if defined(HAVE_PTHREAD)
+
+/*----------------------------------------------------------------------------
+ * Main function for asynchronous output thread.
+ *
+ * The thread outputs the staging area not currently filled by the main
+ * thread each time it is marked as busy, until asked to quit.
+ *
+ * parameters:
+ *   arg <-- unused
+ *
+ * returns:
+ *   NULL
+ *----------------------------------------------------------------------------*/
+
+static void *
+_async_output_thread(void  *arg)
+{
+  CS_UNUSED(arg);
+
+  pthread_mutex_lock(&_cs_post_async_mutex);
+
+  while (true) {
+
+    while (_cs_post_async_busy == false && _cs_post_async_quit == false)
+      pthread_cond_wait(&_cs_post_async_cond, &_cs_post_async_mutex);
+
+    if (_cs_post_async_busy == false)
+      break;
+
+    cs_post_stage_t  *s = _cs_post_stage + (1 - _cs_post_stage_id);
+
+    pthread_mutex_unlock(&_cs_post_async_mutex);
+
+    _stage_output(s);
+
+    pthread_mutex_lock(&_cs_post_async_mutex);
+
+    _cs_post_async_busy = false;
+    pthread_cond_broadcast(&_cs_post_async_cond);
+
+  }
+
+  pthread_mutex_unlock(&_cs_post_async_mutex);
+
+  return NULL;
+}
+
+#endif /* defined(HAVE_PTHREAD) */
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of asynchronous output in progress, if any.
+ *
+ * This must be called before the main thread uses an asynchronous writer
+ * or modifies an exportable mesh which may be in use by such a writer.
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_output_wait(void)
+{
+#if defined(HAVE_PTHREAD)
+
+  if (_cs_post_async_thread_active == false)
+    return;
+
+  pthread_mutex_lock(&_cs_post_async_mutex);
+  while (_cs_post_async_busy)
+    pthread_cond_wait(&_cs_post_async_cond, &_cs_post_async_mutex);
+  pthread_mutex_unlock(&_cs_post_async_mutex);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Hand the current staging area over to the asynchronous output thread.
+ *
+ * If output of the previous staging area is still in progress, wait for
+ * its completion first. The output thread is started if needed.
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_output_submit(void)
+{
+  cs_post_stage_t  *s = _cs_post_stage + _cs_post_stage_id;
+
+  if (s->n_vars == 0 && s->n_flush == 0)
+    return;
+
+#if defined(HAVE_PTHREAD)
+
+  if (_cs_post_async_thread_active == false) {
+    _cs_post_async_busy = false;
+    _cs_post_async_quit = false;
+    if (pthread_create(&_cs_post_async_thread,
+                       NULL,
+                       _async_output_thread,
+                       NULL) != 0)
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error creating asynchronous postprocessing output thread."));
+    _cs_post_async_thread_active = true;
+  }
+
+  pthread_mutex_lock(&_cs_post_async_mutex);
+
+  while (_cs_post_async_busy)
+    pthread_cond_wait(&_cs_post_async_cond, &_cs_post_async_mutex);
+
+  _cs_post_stage_id = 1 - _cs_post_stage_id;
+  _cs_post_async_busy = true;
+  pthread_cond_broadcast(&_cs_post_async_cond);
+
+  pthread_mutex_unlock(&_cs_post_async_mutex);
+
+#else
+
+  _stage_output(s);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Complete pending asynchronous output, stop the associated thread,
+ * and free staging areas.
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_output_finalize(void)
+{
+  _async_output_submit();
+
+#if defined(HAVE_PTHREAD)
+
+  if (_cs_post_async_thread_active) {
+
+    pthread_mutex_lock(&_cs_post_async_mutex);
+    while (_cs_post_async_busy)
+      pthread_cond_wait(&_cs_post_async_cond, &_cs_post_async_mutex);
+    _cs_post_async_quit = true;
+    pthread_cond_broadcast(&_cs_post_async_cond);
+    pthread_mutex_unlock(&_cs_post_async_mutex);
+
+    pthread_join(_cs_post_async_thread, NULL);
+    _cs_post_async_thread_active = false;
+
+  }
+
+#endif
+
+  for (int i = 0; i < 2; i++) {
+    cs_post_stage_t  *s = _cs_post_stage + i;
+    BFT_FREE(s->vars);
+    BFT_FREE(s->flush);
+    s->n_vars_max = 0;
+    s->n_flush_max = 0;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Copy variable values to the current staging area for asynchronous output.
+ *
+ * Arguments are those of fvm_writer_export_field(), with an additional
+ * array defining the number of values per parent list (or for the
+ * single list of values if there is no parent list).
+ *
+ * parameters:
+ *   writer           <-- FVM writer
+ *   exp_mesh         <-- exportable mesh
+ *   name             <-- variable name
+ *   location         <-- variable location
+ *   dim              <-- variable dimension
+ *   interlace        <-- indicates if variable is interlaced
+ *   n_parent_lists   <-- number of parent lists
+ *   parent_num_shift <-- parent number to value array index shifts
+ *   datatype         <-- variable data type
+ *   nt               <-- time step number
+ *   t                <-- time value
+ *   n_list_elts      <-- number of elements per parent list
+ *   field_values     <-- array of associated field value arrays
+ *----------------------------------------------------------------------------*/
+
+static void
+_stage_field(fvm_writer_t          *writer,
+             const fvm_nodal_t     *exp_mesh,
+             const char            *name,
+             fvm_writer_var_loc_t   location,
+             int                    dim,
+             cs_interlace_t         interlace,
+             int                    n_parent_lists,
+             const cs_lnum_t        parent_num_shift[],
+             cs_datatype_t          datatype,
+             int                    nt,
+             double                 t,
+             const cs_lnum_t        n_list_elts[],
+             const void            *field_values[])
+{
+  cs_post_stage_t  *s = _cs_post_stage + _cs_post_stage_id;
+
+  if (s->n_vars >= s->n_vars_max) {
+    s->n_vars_max = (s->n_vars_max < 1) ? 8 : s->n_vars_max*2;
+    BFT_REALLOC(s->vars, s->n_vars_max, cs_post_staged_var_t);
+  }
+
+  cs_post_staged_var_t  *v = s->vars + s->n_vars;
+  s->n_vars += 1;
+
+  v->writer = writer;
+  v->exp_mesh = exp_mesh;
+  BFT_MALLOC(v->name, strlen(name) + 1, char);
+  strcpy(v->name, name);
+  v->location = location;
+  v->dim = dim;
+  v->interlace = interlace;
+  v->n_parent_lists = n_parent_lists;
+  v->parent_num_shift[0] = 0;
+  v->parent_num_shift[1] = 0;
+  for (int i = 0; i < n_parent_lists; i++)
+    v->parent_num_shift[i] = parent_num_shift[i];
+  v->datatype = datatype;
+  v->nt = nt;
+  v->t = t;
+
+  /* Copy values */
+
+  const int n_lists = CS_MAX(n_parent_lists, 1);
+  const int n_ptrs = (interlace == CS_INTERLACE) ? n_lists : n_lists*dim;
+  const size_t elt_size
+    = cs_datatype_size[datatype] * ((interlace == CS_INTERLACE) ? dim : 1);
+
+  size_t n_bytes = 0;
+  for (int i = 0; i < n_ptrs; i++) {
+    int l_id = (interlace == CS_INTERLACE) ? i : i/dim;
+    if (field_values[i] != NULL)
+      n_bytes += n_list_elts[l_id]*elt_size;
+  }
+
+  BFT_MALLOC(v->vals, CS_MAX(n_bytes, 1), unsigned char);
+
+  for (int i = 0; i < 2*9; i++)
+    v->var_ptr[i] = NULL;
+
+  n_bytes = 0;
+  for (int i = 0; i < n_ptrs; i++) {
+    int l_id = (interlace == CS_INTERLACE) ? i : i/dim;
+    if (field_values[i] != NULL) {
+      size_t l_size = n_list_elts[l_id]*elt_size;
+      memcpy(v->vals + n_bytes, field_values[i], l_size);
+      v->var_ptr[i] = v->vals + n_bytes;
+      n_bytes += l_size;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Add a writer to the list of writers to flush in the current
+ * staging area.
+ *
+ * parameters:
+ *   writer <-- FVM writer
+ *----------------------------------------------------------------------------*/
+
+static void
+_stage_flush(fvm_writer_t  *writer)
+{
+  cs_post_stage_t  *s = _cs_post_stage + _cs_post_stage_id;
+
+  if (s->n_flush >= s->n_flush_max) {
+    s->n_flush_max = (s->n_flush_max < 1) ? 4 : s->n_flush_max*2;
+    BFT_REALLOC(s->flush, s->n_flush_max, fvm_writer_t *);
   }
+
+  s->flush[s->n_flush] = writer;
+  s->n_flush += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Check if a post-processing mesh is associated with an asynchronous writer.
+ *
+ * parameters:
+ *   post_mesh <-- pointer to post-processing mesh
+ *
+ * returns:
+ *   true if at least one associated writer uses asynchronous output
+ *----------------------------------------------------------------------------*/
+
+static bool
+_has_async_writer(const cs_post_mesh_t  *post_mesh)
+{
+  for (int i = 0; i < post_mesh->n_writers; i++) {
+    const cs_post_writer_t  *writer
+      = _cs_post_writers + post_mesh->writer_id[i];
+    if (writer->async_output)
+      return true;
+  }
+
+  return false;
 }
 
 /*----------------------------------------------------------------------------
@@ -582,11 +1106,37 @@ _init_writer(cs_post_writer_t  *writer)
                 _(" Invalid format name for writer (case: %s, dirname: %s)."),
                 wd->case_name, wd->dir_name);
 
-    writer->writer = fvm_writer_init(wd->case_name,
-                                     wd->dir_name,
-                                     fvm_writer_format_name(wd->fmt_id),
-                                     wd->fmt_opts,
-                                     wd->time_dep);
+    /* Field output for EnSight writers with fixed meshes may be done
+       asynchronously (using a duplicate communicator, so that the
+       associated collective operations do not interfere with those
+       of the main thread) */
+
+    _async_output_init();
+
+    writer->async_output = false;
+    if (   _cs_post_async_mode > 0
+        && wd->time_dep == FVM_WRITER_FIXED_MESH
+        && wd->fmt_id == fvm_writer_get_format_id("EnSight Gold"))
+      writer->async_output = true;
+
+#if defined(HAVE_MPI)
+    if (writer->async_output && cs_glob_mpi_comm != MPI_COMM_NULL) {
+      if (_cs_post_async_comm == MPI_COMM_NULL)
+        MPI_Comm_dup(cs_glob_mpi_comm, &_cs_post_async_comm);
+      writer->writer = fvm_writer_init_comm(wd->case_name,
+                                            wd->dir_name,
+                                            fvm_writer_format_name(wd->fmt_id),
+                                            wd->fmt_opts,
+                                            wd->time_dep,
+                                            _cs_post_async_comm);
+    }
+    else
+#endif
+      writer->writer = fvm_writer_init(wd->case_name,
+                                       wd->dir_name,
+                                       fvm_writer_format_name(wd->fmt_id),
+                                       wd->fmt_opts,
+                                       wd->time_dep);
     _destroy_writer_def(writer);
 
   }
@@ -1115,6 +1665,55 @@ _update_mesh_writer_associations(cs_post_mesh_t  *post_mesh)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Free Cartesian sampling data of a post-processing mesh.
+ *
+ * parameters:
+ *   sampling <-> pointer to sampling structure pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_free_sampling(cs_post_sampling_t  **sampling)
+{
+  cs_post_sampling_t  *s = *sampling;
+
+  if (s == NULL)
+    return;
+
+  BFT_FREE(s->cell_ids);
+  BFT_FREE(s->cell_bin);
+  BFT_FREE(s->recv_bin);
+
+#if defined(HAVE_MPI)
+  if (s->d != NULL)
+    cs_all_to_all_destroy(&(s->d));
+#endif
+
+  BFT_FREE(*sampling);
+}
+
+/*----------------------------------------------------------------------------
+ * Get ids of cells selected for a Cartesian sampling post-processing mesh.
+ *
+ * parameters:
+ *   s        <-- pointer to sampling structure
+ *   cell_ids --> array of selected cell ids (size: s->n_cells)
+ *----------------------------------------------------------------------------*/
+
+static void
+_sampling_cell_ids(const cs_post_sampling_t  *s,
+                   cs_lnum_t                  cell_ids[])
+{
+  if (s->cell_ids != NULL) {
+    for (cs_lnum_t i = 0; i < s->n_cells; i++)
+      cell_ids[i] = s->cell_ids[i];
+  }
+  else {
+    for (cs_lnum_t i = 0; i < s->n_cells; i++)
+      cell_ids[i] = i;
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Add or select a post-processing mesh, do basic initialization, and return
  * a pointer to the associated structure.
@@ -1166,6 +1765,8 @@ _predefine_mesh(int        mesh_id,
       if (post_mesh->_exp_mesh != NULL)
         post_mesh->_exp_mesh = fvm_nodal_destroy(post_mesh->_exp_mesh);
 
+      _free_sampling(&(post_mesh->sampling));
+
       break;
 
     }
@@ -1229,6 +1830,8 @@ _predefine_mesh(int        mesh_id,
   post_mesh->exp_mesh = NULL;
   post_mesh->_exp_mesh = NULL;
 
+  post_mesh->sampling = NULL;
+
   /* Minimum and maximum time dependency flags initially inverted,
      will be recalculated after mesh - writer associations */
 
@@ -1274,6 +1877,8 @@ _free_mesh(int _mesh_id)
   if (post_mesh->_exp_mesh != NULL)
     post_mesh->_exp_mesh = fvm_nodal_destroy(post_mesh->_exp_mesh);
 
+  _free_sampling(&(post_mesh->sampling));
+
   BFT_FREE(post_mesh->writer_id);
   post_mesh->n_writers = 0;
 
@@ -1351,69 +1956,399 @@ _check_mesh_cat_id(cs_post_mesh_t  *post_mesh)
  *   b_face_list <-> list of associated boundary faces
  *----------------------------------------------------------------------------*/
 
-static void
-_define_export_mesh(cs_post_mesh_t  *post_mesh,
-                    cs_lnum_t        n_cells,
-                    cs_lnum_t        n_i_faces,
-                    cs_lnum_t        n_b_faces,
-                    cs_lnum_t        cell_list[],
-                    cs_lnum_t        i_face_list[],
-                    cs_lnum_t        b_face_list[])
-{
-  /* local variables */
+static void
+_define_export_mesh(cs_post_mesh_t  *post_mesh,
+                    cs_lnum_t        n_cells,
+                    cs_lnum_t        n_i_faces,
+                    cs_lnum_t        n_b_faces,
+                    cs_lnum_t        cell_list[],
+                    cs_lnum_t        i_face_list[],
+                    cs_lnum_t        b_face_list[])
+{
+  /* local variables */
+
+  fvm_nodal_t  *exp_mesh = NULL;
+
+  /* Create associated structure */
+
+  if (post_mesh->ent_flag[0] == 1) {
+
+    if (n_cells >= cs_glob_mesh->n_cells)
+      exp_mesh = cs_mesh_connect_cells_to_nodal(cs_glob_mesh,
+                                                post_mesh->name,
+                                                post_mesh->add_groups,
+                                                cs_glob_mesh->n_cells,
+                                                NULL);
+    else
+      exp_mesh = cs_mesh_connect_cells_to_nodal(cs_glob_mesh,
+                                                post_mesh->name,
+                                                post_mesh->add_groups,
+                                                n_cells,
+                                                cell_list);
+
+  }
+  else {
+
+    if (   n_b_faces >= cs_glob_mesh->n_b_faces
+        && n_i_faces == 0)
+      exp_mesh = cs_mesh_connect_faces_to_nodal(cs_glob_mesh,
+                                                post_mesh->name,
+                                                post_mesh->add_groups,
+                                                0,
+                                                cs_glob_mesh->n_b_faces,
+                                                NULL,
+                                                NULL);
+    else
+      exp_mesh = cs_mesh_connect_faces_to_nodal(cs_glob_mesh,
+                                                post_mesh->name,
+                                                post_mesh->add_groups,
+                                                n_i_faces,
+                                                n_b_faces,
+                                                i_face_list,
+                                                b_face_list);
+
+  }
+
+  /* Fix category id now that we have knowledge of entity counts */
+
+  _check_mesh_cat_id(post_mesh);
+
+  /* Local dimensions */
+
+  post_mesh->n_i_faces = n_i_faces;
+  post_mesh->n_b_faces = n_b_faces;
+
+  /* As faces might be split, ensure the number of faces is correct */
+
+  /* Link to newly created mesh */
+
+  post_mesh->exp_mesh = exp_mesh;
+  post_mesh->_exp_mesh = exp_mesh;
+}
+
+/*----------------------------------------------------------------------------
+ * Create a Cartesian sampling post-processing mesh for a cell selection.
+ *
+ * Selected cells are assigned to bins of a regular grid covering the
+ * bounding box of their vertices, based on their centers. Only bins
+ * containing at least one cell (on any rank) are exported, as hexahedra.
+ * Bins are distributed among ranks by blocks of bin ids, so that only
+ * occupied bins are handled, and no rank needs the full grid.
+ *
+ * parameters:
+ *   post_mesh   <-> pointer to partially initialized post-processing mesh
+ *   n_cells     <-- number of associated cells
+ *   cell_list   <-- list of associated cells (1 to n), or NULL if all
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_sampled_mesh(cs_post_mesh_t  *post_mesh,
+                     cs_lnum_t        n_cells,
+                     const cs_lnum_t  cell_list[])
+{
+  const cs_mesh_t  *m = cs_glob_mesh;
+  const cs_real_3_t  *cell_cen
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->cell_cen;
+  const cs_real_3_t  *vtx_coord = (const cs_real_3_t *)m->vtx_coord;
+
+  cs_post_sampling_t  *s = post_mesh->sampling;
+
+  const cs_lnum_t  n_s[3] = {s->n_samples[0],
+                             s->n_samples[1],
+                             s->n_samples[2]};
+
+  const cs_gnum_t n_g_bins = (cs_gnum_t)n_s[0]*n_s[1]*n_s[2];
+
+  /* Store selection */
+
+  BFT_FREE(s->cell_ids);
+  BFT_FREE(s->cell_bin);
+  BFT_FREE(s->recv_bin);
+
+#if defined(HAVE_MPI)
+  if (s->d != NULL)
+    cs_all_to_all_destroy(&(s->d));
+#endif
+
+  s->n_cells = n_cells;
+
+  if (cell_list != NULL && n_cells < m->n_cells) {
+    BFT_MALLOC(s->cell_ids, n_cells, cs_lnum_t);
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      s->cell_ids[i] = cell_list[i] - 1;
+  }
+
+  BFT_MALLOC(s->cell_bin, n_cells, cs_lnum_t);
+
+  /* Bounding box of selected cells, based on their faces' vertices */
+
+  cs_real_t bbox[6] = {cs_math_big_r, cs_math_big_r, cs_math_big_r,
+                       -cs_math_big_r, -cs_math_big_r, -cs_math_big_r};
+
+  {
+    char *c_flag;
+    BFT_MALLOC(c_flag, m->n_cells_with_ghosts, char);
+
+    if (s->cell_ids != NULL) {
+      for (cs_lnum_t i = 0; i < m->n_cells_with_ghosts; i++)
+        c_flag[i] = 0;
+      for (cs_lnum_t i = 0; i < n_cells; i++)
+        c_flag[s->cell_ids[i]] = 1;
+    }
+    else {
+      for (cs_lnum_t i = 0; i < m->n_cells; i++)
+        c_flag[i] = 1;
+      for (cs_lnum_t i = m->n_cells; i < m->n_cells_with_ghosts; i++)
+        c_flag[i] = 0;
+    }
+
+    for (cs_lnum_t f_id = 0; f_id < m->n_i_faces; f_id++) {
+      if (   c_flag[m->i_face_cells[f_id][0]] == 0
+          && c_flag[m->i_face_cells[f_id][1]] == 0)
+        continue;
+      for (cs_lnum_t j = m->i_face_vtx_idx[f_id];
+           j < m->i_face_vtx_idx[f_id+1];
+           j++) {
+        const cs_real_t *c = vtx_coord[m->i_face_vtx_lst[j]];
+        for (int k = 0; k < 3; k++) {
+          bbox[k] = CS_MIN(bbox[k], c[k]);
+          bbox[k+3] = CS_MAX(bbox[k+3], c[k]);
+        }
+      }
+    }
+
+    for (cs_lnum_t f_id = 0; f_id < m->n_b_faces; f_id++) {
+      if (c_flag[m->b_face_cells[f_id]] == 0)
+        continue;
+      for (cs_lnum_t j = m->b_face_vtx_idx[f_id];
+           j < m->b_face_vtx_idx[f_id+1];
+           j++) {
+        const cs_real_t *c = vtx_coord[m->b_face_vtx_lst[j]];
+        for (int k = 0; k < 3; k++) {
+          bbox[k] = CS_MIN(bbox[k], c[k]);
+          bbox[k+3] = CS_MAX(bbox[k+3], c[k]);
+        }
+      }
+    }
+
+    BFT_FREE(c_flag);
+  }
+
+  cs_parall_min(3, CS_REAL_TYPE, bbox);
+  cs_parall_max(3, CS_REAL_TYPE, bbox + 3);
+
+  /* Assign cells to bins (global bin numbers, 1 to n) */
+
+  cs_real_t inv_h[3];
+  for (int k = 0; k < 3; k++) {
+    cs_real_t l = bbox[k+3] - bbox[k];
+    inv_h[k] = (l > 0) ? n_s[k] / l : 0.;
+  }
+
+  cs_gnum_t *c_gnum;
+  BFT_MALLOC(c_gnum, n_cells, cs_gnum_t);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    cs_lnum_t c_id = (s->cell_ids != NULL) ? s->cell_ids[i] : i;
+    cs_lnum_t ijk[3];
+    for (int k = 0; k < 3; k++) {
+      ijk[k] = (cs_lnum_t)((cell_cen[c_id][k] - bbox[k]) * inv_h[k]);
+      ijk[k] = CS_MAX(0, CS_MIN(ijk[k], n_s[k] - 1));
+    }
+    c_gnum[i] = 1 + ijk[0] + n_s[0]*(ijk[1] + (cs_gnum_t)n_s[1]*ijk[2]);
+  }
+
+  /* Local bins, ordered by global number */
+
+  cs_gnum_t *l_gnum;
+  BFT_MALLOC(l_gnum, n_cells, cs_gnum_t);
+
+  s->n_l_bins = 0;
+
+  {
+    cs_lnum_t *order = cs_order_gnum(NULL, c_gnum, n_cells);
+
+    for (cs_lnum_t i = 0; i < n_cells; i++) {
+      cs_lnum_t j = order[i];
+      if (s->n_l_bins == 0 || c_gnum[j] != l_gnum[s->n_l_bins - 1])
+        l_gnum[s->n_l_bins++] = c_gnum[j];
+      s->cell_bin[j] = s->n_l_bins - 1;
+    }
+
+    BFT_FREE(order);
+  }
+
+  BFT_FREE(c_gnum);
+  BFT_REALLOC(l_gnum, s->n_l_bins, cs_gnum_t);
+
+  /* Send local bins to the ranks handling their block */
+
+  cs_block_dist_info_t bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                                        cs_glob_n_ranks,
+                                                        1,
+                                                        0,
+                                                        n_g_bins);
+
+  cs_gnum_t *r_gnum = l_gnum;
+  s->n_recv = s->n_l_bins;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+    s->d = cs_all_to_all_create_from_block(s->n_l_bins,
+                                           0, /* flags */
+                                           l_gnum,
+                                           bi,
+                                           cs_glob_mpi_comm);
+    r_gnum = cs_all_to_all_copy_array(s->d,
+                                      CS_GNUM_TYPE,
+                                      1,
+                                      false, /* reverse */
+                                      l_gnum,
+                                      NULL);
+    s->n_recv = cs_all_to_all_n_elts_dest(s->d);
+    BFT_FREE(l_gnum);
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Compact numbering of non-empty bins of local block */
+
+  cs_lnum_t b_size = 0;
+  if (bi.gnum_range[1] > bi.gnum_range[0])
+    b_size = bi.gnum_range[1] - bi.gnum_range[0];
+
+  cs_lnum_t *b_bin_id;
+  BFT_MALLOC(b_bin_id, b_size, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < b_size; i++)
+    b_bin_id[i] = -1;
+
+  for (cs_lnum_t i = 0; i < s->n_recv; i++)
+    b_bin_id[r_gnum[i] - bi.gnum_range[0]] = 0;
+
+  s->n_b_bins = 0;
+  for (cs_lnum_t i = 0; i < b_size; i++) {
+    if (b_bin_id[i] > -1)
+      b_bin_id[i] = s->n_b_bins++;
+  }
+
+  BFT_MALLOC(s->recv_bin, s->n_recv, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < s->n_recv; i++)
+    s->recv_bin[i] = b_bin_id[r_gnum[i] - bi.gnum_range[0]];
+
+  BFT_FREE(r_gnum);
 
-  fvm_nodal_t  *exp_mesh = NULL;
+  /* Build exportable mesh from non-empty bins of local block,
+     with vertices numbered by their position in the grid */
 
-  /* Create associated structure */
+  fvm_nodal_t  *exp_mesh = fvm_nodal_create(post_mesh->name, 3);
 
-  if (post_mesh->ent_flag[0] == 1) {
+  const cs_lnum_t  n_bins = s->n_b_bins;
+  const cs_gnum_t  n_v[3] = {n_s[0] + 1, n_s[1] + 1, n_s[2] + 1};
+  const cs_lnum_t  v_shift[8][3] = {{0, 0, 0}, {1, 0, 0}, {1, 1, 0},
+                                    {0, 1, 0}, {0, 0, 1}, {1, 0, 1},
+                                    {1, 1, 1}, {0, 1, 1}};
 
-    if (n_cells >= cs_glob_mesh->n_cells)
-      exp_mesh = cs_mesh_connect_cells_to_nodal(cs_glob_mesh,
-                                                post_mesh->name,
-                                                post_mesh->add_groups,
-                                                cs_glob_mesh->n_cells,
-                                                NULL);
-    else
-      exp_mesh = cs_mesh_connect_cells_to_nodal(cs_glob_mesh,
-                                                post_mesh->name,
-                                                post_mesh->add_groups,
-                                                n_cells,
-                                                cell_list);
+  cs_lnum_t  n_vtx = 0;
+  cs_lnum_t  *vertex_num = NULL;
+  cs_gnum_t  *bin_gnum = NULL, *vtx_gnum = NULL;
+  cs_coord_t  *coords = NULL;
+
+  BFT_MALLOC(bin_gnum, n_bins, cs_gnum_t);
+  BFT_MALLOC(vtx_gnum, n_bins*8, cs_gnum_t);
 
+  for (cs_lnum_t i = 0; i < b_size; i++) {
+    cs_lnum_t b_id = b_bin_id[i];
+    if (b_id < 0)
+      continue;
+    cs_gnum_t g_id = bi.gnum_range[0] + i - 1;
+    cs_gnum_t ijk[3] = {g_id % n_s[0], (g_id / n_s[0]) % n_s[1],
+                        g_id / ((cs_gnum_t)n_s[0]*n_s[1])};
+    for (int j = 0; j < 8; j++)
+      vtx_gnum[b_id*8 + j]
+        = 1 +   (ijk[0] + v_shift[j][0])
+              + n_v[0]*(  (ijk[1] + v_shift[j][1])
+                        + n_v[1]*(ijk[2] + v_shift[j][2]));
   }
-  else {
 
-    if (   n_b_faces >= cs_glob_mesh->n_b_faces
-        && n_i_faces == 0)
-      exp_mesh = cs_mesh_connect_faces_to_nodal(cs_glob_mesh,
-                                                post_mesh->name,
-                                                post_mesh->add_groups,
-                                                0,
-                                                cs_glob_mesh->n_b_faces,
-                                                NULL,
-                                                NULL);
-    else
-      exp_mesh = cs_mesh_connect_faces_to_nodal(cs_glob_mesh,
-                                                post_mesh->name,
-                                                post_mesh->add_groups,
-                                                n_i_faces,
-                                                n_b_faces,
-                                                i_face_list,
-                                                b_face_list);
+  BFT_FREE(b_bin_id);
+
+  /* Global numbers of bins follow their block order */
 
+  {
+    cs_gnum_t b_shift = 0;
+#if defined(HAVE_MPI)
+    if (cs_glob_n_ranks > 1) {
+      cs_gnum_t _n_bins = n_bins;
+      MPI_Exscan(&_n_bins, &b_shift, 1, CS_MPI_GNUM, MPI_SUM,
+                 cs_glob_mpi_comm);
+      if (cs_glob_rank_id == 0)
+        b_shift = 0;
+    }
+#endif
+    for (cs_lnum_t i = 0; i < n_bins; i++)
+      bin_gnum[i] = b_shift + i + 1;
   }
 
-  /* Fix category id now that we have knowledge of entity counts */
+  /* Local vertices (shared by adjacent bins) */
 
-  _check_mesh_cat_id(post_mesh);
+  BFT_MALLOC(vertex_num, n_bins*8, cs_lnum_t);
 
-  /* Local dimensions */
+  {
+    cs_lnum_t *order = cs_order_gnum(NULL, vtx_gnum, n_bins*8);
 
-  post_mesh->n_i_faces = n_i_faces;
-  post_mesh->n_b_faces = n_b_faces;
+    cs_gnum_t *v_gnum;
+    BFT_MALLOC(v_gnum, n_bins*8, cs_gnum_t);
 
-  /* As faces might be split, ensure the number of faces is correct */
+    for (cs_lnum_t i = 0; i < n_bins*8; i++) {
+      cs_lnum_t j = order[i];
+      if (n_vtx == 0 || vtx_gnum[j] != v_gnum[n_vtx - 1])
+        v_gnum[n_vtx++] = vtx_gnum[j];
+      vertex_num[j] = n_vtx;
+    }
+
+    BFT_FREE(order);
+    BFT_FREE(vtx_gnum);
+
+    vtx_gnum = v_gnum;
+    BFT_REALLOC(vtx_gnum, n_vtx, cs_gnum_t);
+  }
+
+  BFT_MALLOC(coords, n_vtx*3, cs_coord_t);
+
+  for (cs_lnum_t i = 0; i < n_vtx; i++) {
+    cs_gnum_t g_id = vtx_gnum[i] - 1;
+    cs_gnum_t ijk[3] = {g_id % n_v[0], (g_id / n_v[0]) % n_v[1],
+                        g_id / (n_v[0]*n_v[1])};
+    for (int k = 0; k < 3; k++)
+      coords[i*3 + k] = bbox[k] + (bbox[k+3] - bbox[k]) * ijk[k] / n_s[k];
+  }
+
+  fvm_nodal_append_by_transfer(exp_mesh,
+                               n_bins,
+                               FVM_CELL_HEXA,
+                               NULL,
+                               NULL,
+                               NULL,
+                               vertex_num,
+                               NULL);
+
+  fvm_nodal_transfer_vertices(exp_mesh, coords);
+
+  if (cs_glob_n_ranks > 1) {
+    fvm_nodal_init_io_num(exp_mesh, bin_gnum, 3);
+    fvm_nodal_init_io_num(exp_mesh, vtx_gnum, 0);
+  }
+
+  BFT_FREE(bin_gnum);
+  BFT_FREE(vtx_gnum);
+
+  _check_mesh_cat_id(post_mesh);
+
+  post_mesh->n_i_faces = 0;
+  post_mesh->n_b_faces = 0;
 
   /* Link to newly created mesh */
 
@@ -1664,13 +2599,17 @@ _define_regular_mesh(cs_post_mesh_t  *post_mesh)
 
   /* Define mesh based on current arguments */
 
-  _define_export_mesh(post_mesh,
-                      n_cells,
-                      n_i_faces,
-                      n_b_faces,
-                      cell_list,
-                      i_face_list,
-                      b_face_list);
+  if (post_mesh->sampling != NULL && post_mesh->ent_flag[0] == 1)
+    _define_sampled_mesh(post_mesh, n_cells, cell_list);
+
+  else
+    _define_export_mesh(post_mesh,
+                        n_cells,
+                        n_i_faces,
+                        n_b_faces,
+                        cell_list,
+                        i_face_list,
+                        b_face_list);
 
   BFT_FREE(cell_list);
   BFT_FREE(i_face_list);
@@ -2022,6 +2961,9 @@ _cs_post_write_fixed_zone_info(fvm_writer_t          *writer,
   const int   *var_ptr[1] = {NULL};
   const char  *name = NULL;
 
+  if (post_mesh->sampling != NULL)
+    return;
+
   if (post_mesh->id == CS_POST_MESH_VOLUME) {
 
     /* Ignore cases where all zones include all cells */
@@ -2112,6 +3054,9 @@ static void
 _cs_post_write_transient_zone_info(const cs_post_mesh_t  *post_mesh,
                                    const cs_time_step_t  *ts)
 {
+  if (post_mesh->sampling != NULL)
+    return;
+
   if (post_mesh->id == CS_POST_MESH_VOLUME) {
     if (cs_volume_zone_n_zones_time_varying() > 0) {
       cs_post_write_var(post_mesh->id,
@@ -2200,6 +3145,8 @@ _cs_post_write_mesh(cs_post_mesh_t        *post_mesh,
 
     if (write_mesh == true) {
 
+      _async_output_wait();
+
       if (writer->writer == NULL)
         _init_writer(writer);
 
@@ -2318,6 +3265,142 @@ _cs_post_assmb_var_faces(const fvm_nodal_t  *exp_mesh,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Reduce cell variable values to the bins of a Cartesian sampling mesh.
+ *
+ * Values are averaged over each bin, weighted by cell volumes.
+ * Sums over the local cells of each bin are sent to the rank handling
+ * that bin's block, so the resulting variable is interlaced, and defined
+ * on the non-empty bins of the local block.
+ *
+ * parameters:
+ *   s          <-- pointer to sampling structure
+ *   var_dim    <-- variable dimension
+ *   interlace  <-- for vector, interlace if 1, no interlace if 0
+ *   use_parent <-- true if values are defined on parent mesh cells,
+ *                  false if defined on the selected cells only
+ *   datatype   <-- variable's data type
+ *   cel_vals   <-- cell values
+ *
+ * returns:
+ *   newly allocated array of averaged values
+ *----------------------------------------------------------------------------*/
+
+static cs_real_t *
+_cs_post_sample_var_cells(const cs_post_sampling_t  *s,
+                          int                        var_dim,
+                          cs_interlace_t             interlace,
+                          bool                       use_parent,
+                          cs_datatype_t              datatype,
+                          const void                *cel_vals)
+{
+  const cs_real_t  *cell_vol = cs_glob_mesh_quantities->cell_vol;
+  const cs_lnum_t  n_vals
+    = (use_parent) ? cs_glob_mesh->n_cells_with_ghosts : s->n_cells;
+  const int  stride = var_dim + 1;
+  const cs_lnum_t  n_sums = s->n_l_bins * stride;
+
+  cs_real_t  *sums = NULL, *bin_vals = NULL;
+
+  BFT_MALLOC(sums, n_sums, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_sums; i++)
+    sums[i] = 0.;
+
+  /* Local volume-weighted sums (last value of each bin is its volume) */
+
+  for (cs_lnum_t i = 0; i < s->n_cells; i++) {
+
+    cs_lnum_t c_id = (s->cell_ids != NULL) ? s->cell_ids[i] : i;
+    cs_lnum_t v_id = (use_parent) ? c_id : i;
+    cs_real_t *_sums = sums + s->cell_bin[i]*stride;
+
+    _sums[var_dim] += cell_vol[c_id];
+
+    for (int j = 0; j < var_dim; j++) {
+
+      size_t k = (interlace == CS_INTERLACE) ?
+        (size_t)v_id*var_dim + j : (size_t)j*n_vals + v_id;
+      double v = 0.;
+
+      switch(datatype) {
+      case CS_FLOAT:
+        v = ((const float *)cel_vals)[k];
+        break;
+      case CS_DOUBLE:
+        v = ((const double *)cel_vals)[k];
+        break;
+      case CS_UINT16:
+        v = ((const uint16_t *)cel_vals)[k];
+        break;
+      case CS_INT32:
+        v = ((const int32_t *)cel_vals)[k];
+        break;
+      case CS_INT64:
+        v = ((const int64_t *)cel_vals)[k];
+        break;
+      case CS_UINT32:
+        v = ((const uint32_t *)cel_vals)[k];
+        break;
+      case CS_UINT64:
+        v = ((const uint64_t *)cel_vals)[k];
+        break;
+      default:
+        assert(0);
+      }
+
+      _sums[j] += cell_vol[c_id] * v;
+    }
+
+  }
+
+  /* Send partial sums to ranks handling the associated blocks */
+
+#if defined(HAVE_MPI)
+
+  if (s->d != NULL) {
+    cs_real_t *r_sums = cs_all_to_all_copy_array(s->d,
+                                                 CS_REAL_TYPE,
+                                                 stride,
+                                                 false, /* reverse */
+                                                 sums,
+                                                 NULL);
+    BFT_FREE(sums);
+    sums = r_sums;
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Sum contributions to non-empty bins of local block */
+
+  cs_real_t *b_sums;
+  BFT_MALLOC(b_sums, s->n_b_bins*stride, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < s->n_b_bins*stride; i++)
+    b_sums[i] = 0.;
+
+  for (cs_lnum_t i = 0; i < s->n_recv; i++) {
+    cs_real_t *_b_sums = b_sums + s->recv_bin[i]*stride;
+    for (int j = 0; j < stride; j++)
+      _b_sums[j] += sums[i*stride + j];
+  }
+
+  BFT_FREE(sums);
+
+  BFT_MALLOC(bin_vals, s->n_b_bins*var_dim, cs_real_t);
+
+  for (cs_lnum_t b_id = 0; b_id < s->n_b_bins; b_id++) {
+    const cs_real_t *_sums = b_sums + b_id*stride;
+    cs_real_t inv_vol = (_sums[var_dim] > 0) ? 1. / _sums[var_dim] : 0.;
+    for (int j = 0; j < var_dim; j++)
+      bin_vals[b_id*var_dim + j] = _sums[j] * inv_vol;
+  }
+
+  BFT_FREE(b_sums);
+
+  return bin_vals;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Check if post-processing is activated and then update post-processing
@@ -2364,8 +3447,11 @@ _update_meshes(const cs_time_step_t  *ts)
     /* Modifiable user mesh, active at this time step */
 
     if (   active == true
-        && post_mesh->mod_flag_min == FVM_WRITER_TRANSIENT_CONNECT)
+        && post_mesh->mod_flag_min == FVM_WRITER_TRANSIENT_CONNECT) {
+      if (_has_async_writer(post_mesh))
+        _async_output_wait();
       _redefine_mesh(post_mesh, ts);
+    }
 
   }
 
@@ -3320,6 +4406,7 @@ _check_non_transient(const cs_post_writer_t  *writer,
  * - \c \b EnSight \c \b Gold (\c \b EnSight also accepted)
  * - \c \b MED
  * - \c \b CGNS
+ * - \c \b XDMF (HDF5 data with an XDMF index, \c \b HDF5 also accepted)
  * - \c \b CCM (only for the full volume and boundary meshes)
  * - \c \b Catalyst (in-situ visualization)
  * - \c \b MEDCoupling (in-memory structure, to be used from other code)
@@ -3353,6 +4440,16 @@ _check_non_transient(const cs_post_writer_t  *writer,
  *         pyramids), so that any post-processing tool can recognize them.
  * - \c \b separate_meshes to multiple meshes and associated fields to
  *         separate outputs.
+ * - \c \b rank_order to write data in parallel with each rank writing
+ *         its local elements and vertices at precomputed offsets, rather
+ *         than redistributing them by global number (for \c \b EnSight).
+ *         Post-processing output is faster for large meshes, but vertices
+ *         shared by several ranks are duplicated, and element ordering
+ *         depends on the partitioning.
+ * - \c \b serial_io to force serialized writes by successive ranks
+ *         even when parallel HDF5 is available (for \c \b XDMF).
+ * - \c \b compress or \c \b compress=<level> to compress datasets
+ *         with deflate (level 6 or 1 to 9, for \c \b XDMF).
  *
  * Note that the white-spaces in the beginning or in the end of the
  * character strings given as arguments here are suppressed automatically.
@@ -3485,6 +4582,7 @@ cs_post_define_writer(int                     writer_id,
   }
 
   w->writer = NULL;
+  w->async_output = false;
 
   /* If writer is the default writer (id -1), update defaults */
 
@@ -4202,7 +5300,9 @@ cs_post_mesh_get_n_cells(int  mesh_id)
 
   const cs_post_mesh_t  *mesh = _cs_post_meshes + _cs_post_mesh_id(mesh_id);
 
-  if (mesh->exp_mesh != NULL)
+  if (mesh->exp_mesh != NULL && mesh->sampling != NULL)
+    retval = mesh->sampling->n_cells;
+  else if (mesh->exp_mesh != NULL)
     retval = fvm_nodal_get_n_entities(mesh->exp_mesh, 3);
   else
     bft_error(__FILE__, __LINE__, 0,
@@ -4231,7 +5331,9 @@ cs_post_mesh_get_cell_ids(int         mesh_id,
 {
   const cs_post_mesh_t  *mesh = _cs_post_meshes + _cs_post_mesh_id(mesh_id);
 
-  if (mesh->exp_mesh != NULL) {
+  if (mesh->exp_mesh != NULL && mesh->sampling != NULL)
+    _sampling_cell_ids(mesh->sampling, cell_ids);
+  else if (mesh->exp_mesh != NULL) {
     cs_lnum_t i;
     cs_lnum_t n_cells = fvm_nodal_get_n_entities(mesh->exp_mesh, 3);
     fvm_nodal_get_parent_num(mesh->exp_mesh, 3, cell_ids);
@@ -4467,6 +5569,91 @@ cs_post_mesh_set_post_domain(int   mesh_id,
   mesh->post_domain = post_domain;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Reduce a volume postprocessing mesh to a Cartesian sampling grid.
+ *
+ * The bounding box of the mesh's selected cells is divided into a regular
+ * grid of n_samples[0]*n_samples[1]*n_samples[2] bins, each cell being
+ * assigned to the bin containing its center. Only non-empty bins are
+ * exported (as hexahedra), and cell values are replaced by their
+ * volume-weighted average over each bin before being passed to writers,
+ * reducing the size of outputs for large meshes.
+ *
+ * Values at vertices and parallel domain or zone information are not
+ * output for such meshes. Values defined on the postprocessing mesh itself
+ * (i.e. with use_parent = false) are expected on its selected cells, as
+ * given by \ref cs_post_mesh_get_cell_ids.
+ *
+ * This function must be called before the mesh is built, typically just
+ * after its definition.
+ *
+ * \param[in]  mesh_id    postprocessing mesh id
+ * \param[in]  n_samples  number of sampling bins in each direction,
+ *                        or NULL to revert to regular output
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_post_mesh_set_sampling(int        mesh_id,
+                          const int  n_samples[3])
+{
+  cs_post_mesh_t  *mesh = _cs_post_meshes + _cs_post_mesh_id(mesh_id);
+
+  if (mesh->exp_mesh != NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s called for mesh %d after it was built."),
+              __func__, mesh_id);
+
+  if (n_samples == NULL) {
+    _free_sampling(&(mesh->sampling));
+    return;
+  }
+
+  const int *ef = mesh->ent_flag;
+
+  if (   ef[1] != 0 || ef[2] != 0 || ef[3] != 0 || ef[4] != 0
+      || mesh->edges_ref > -1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: mesh %d is not a volume mesh; sampling\n"
+                "is only available for cell-based meshes."),
+              __func__, mesh_id);
+
+  cs_gnum_t n_g_bins = 1;
+  for (int i = 0; i < 3; i++) {
+    if (n_samples[i] < 1)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s: mesh %d number of samples must be > 0\n"
+                  "(%d, %d, %d requested)."),
+                __func__, mesh_id, n_samples[0], n_samples[1], n_samples[2]);
+    n_g_bins *= n_samples[i];
+  }
+  if (n_g_bins > INT_MAX)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: mesh %d number of sampling bins too large\n"
+                "(%d x %d x %d requested)."),
+              __func__, mesh_id, n_samples[0], n_samples[1], n_samples[2]);
+
+  if (mesh->sampling == NULL) {
+    BFT_MALLOC(mesh->sampling, 1, cs_post_sampling_t);
+    mesh->sampling->n_cells = 0;
+    mesh->sampling->cell_ids = NULL;
+    mesh->sampling->cell_bin = NULL;
+    mesh->sampling->n_l_bins = 0;
+    mesh->sampling->n_b_bins = 0;
+    mesh->sampling->n_recv = 0;
+    mesh->sampling->recv_bin = NULL;
+#if defined(HAVE_MPI)
+    mesh->sampling->d = NULL;
+#endif
+  }
+
+  for (int i = 0; i < 3; i++)
+    mesh->sampling->n_samples[i] = n_samples[i];
+
+  mesh->post_domain = false;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Remove a post-processing mesh.
@@ -4507,6 +5694,9 @@ cs_post_free_mesh(int  mesh_id)
 
   post_mesh = _cs_post_meshes + _mesh_id;
 
+  if (_has_async_writer(post_mesh))
+    _async_output_wait();
+
   for (i = 0; i < post_mesh->n_writers; i++) {
 
     cs_post_writer_t *writer = _cs_post_writers + post_mesh->writer_id[i];
@@ -4851,6 +6041,11 @@ cs_post_get_writer(int  writer_id)
   if (writer->writer == NULL)
     _init_writer(writer);
 
+  /* The caller may use the writer directly */
+
+  if (writer->async_output)
+    _async_output_wait();
+
   return writer->writer;
 }
 
@@ -4989,6 +6184,10 @@ cs_post_write_meshes(const cs_time_step_t  *ts)
  * \brief Output a variable defined at cells or faces of a post-processing mesh
  *        using associated writers.
  *
+ * For meshes reduced to a Cartesian sampling grid (see
+ * \ref cs_post_mesh_set_sampling), cell values are averaged over each bin
+ * before output.
+ *
  * \param[in]  mesh_id      id of associated mesh
  * \param[in]  writer_id    id of specified associated writer,
  *                          or \ref CS_POST_WRITER_ALL_ASSOCIATED for all
@@ -5029,6 +6228,7 @@ cs_post_write_var(int                    mesh_id,
   size_t       dec_ptr = 0;
   int          n_parent_lists = 0;
   cs_lnum_t    parent_num_shift[2]  = {0, 0};
+  cs_lnum_t    n_list_elts[2] = {0, 0};
   cs_real_t   *var_tmp = NULL;
   cs_post_mesh_t  *post_mesh = NULL;
   cs_post_writer_t    *writer = NULL;
@@ -5064,14 +6264,37 @@ cs_post_write_var(int                    mesh_id,
   /* Case of cells */
   /*---------------*/
 
-  if (post_mesh->ent_flag[CS_POST_LOCATION_CELL] == 1) {
+  if (post_mesh->sampling != NULL) {
+
+    /* Values are reduced to the non-empty bins of the sampling grid */
+
+    var_tmp = _cs_post_sample_var_cells(post_mesh->sampling,
+                                        var_dim,
+                                        _interlace,
+                                        use_parent,
+                                        datatype,
+                                        cel_vals);
+
+    _interlace = CS_INTERLACE;
+    datatype = CS_REAL_TYPE;
+
+    n_parent_lists = 0;
+    n_list_elts[0] = fvm_nodal_get_n_entities(post_mesh->exp_mesh, 3);
+
+    var_ptr[0] = var_tmp;
+  }
+
+  else if (post_mesh->ent_flag[CS_POST_LOCATION_CELL] == 1) {
 
     if (use_parent) {
       n_parent_lists = 1;
       parent_num_shift[0] = 0;
+      n_list_elts[0] = cs_glob_mesh->n_cells;
     }
-    else
+    else {
       n_parent_lists = 0;
+      n_list_elts[0] = fvm_nodal_get_n_entities(post_mesh->exp_mesh, 3);
+    }
 
     var_ptr[0] = cel_vals;
     if (interlace == false) {
@@ -5098,6 +6321,8 @@ cs_post_write_var(int                    mesh_id,
       n_parent_lists = 2;
       parent_num_shift[0] = 0;
       parent_num_shift[1] = cs_glob_mesh->n_b_faces;
+      n_list_elts[0] = cs_glob_mesh->n_b_faces;
+      n_list_elts[1] = cs_glob_mesh->n_i_faces;
 
       if (post_mesh->ent_flag[CS_POST_LOCATION_B_FACE] == 1) {
         if (interlace == false) {
@@ -5152,8 +6377,8 @@ cs_post_write_var(int                    mesh_id,
 
           _interlace = CS_NO_INTERLACE;
 
-          dec_ptr = cs_datatype_size[datatype] * (  post_mesh->n_i_faces
-                                                  + post_mesh->n_b_faces);
+          n_list_elts[0] = post_mesh->n_i_faces + post_mesh->n_b_faces;
+          dec_ptr = cs_datatype_size[datatype] * n_list_elts[0];
 
           for (i = 0; i < var_dim; i++)
             var_ptr[i] = ((char *)var_tmp) + i*dec_ptr;
@@ -5164,6 +6389,8 @@ cs_post_write_var(int                    mesh_id,
 
         else {
 
+          n_list_elts[0] = post_mesh->n_b_faces;
+
           if (interlace == false) {
             dec_ptr = cs_datatype_size[datatype] * post_mesh->n_b_faces;
             for (i = 0; i < var_dim; i++)
@@ -5179,6 +6406,8 @@ cs_post_write_var(int                    mesh_id,
 
       else if (post_mesh->ent_flag[CS_POST_LOCATION_I_FACE] == 1) {
 
+        n_list_elts[0] = post_mesh->n_i_faces;
+
         if (interlace == false) {
           dec_ptr = cs_datatype_size[datatype] * post_mesh->n_i_faces;
           for (i = 0; i < var_dim; i++)
@@ -5206,18 +6435,34 @@ cs_post_write_var(int                    mesh_id,
 
       _check_non_transient(writer, &nt_cur, &t_cur);
 
-      fvm_writer_export_field(writer->writer,
-                              post_mesh->exp_mesh,
-                              var_name,
-                              FVM_WRITER_PER_ELEMENT,
-                              var_dim,
-                              _interlace,
-                              n_parent_lists,
-                              parent_num_shift,
-                              datatype,
-                              nt_cur,
-                              t_cur,
-                              (const void * *)var_ptr);
+      if (writer->async_output)
+        _stage_field(writer->writer,
+                     post_mesh->exp_mesh,
+                     var_name,
+                     FVM_WRITER_PER_ELEMENT,
+                     var_dim,
+                     _interlace,
+                     n_parent_lists,
+                     parent_num_shift,
+                     datatype,
+                     nt_cur,
+                     t_cur,
+                     n_list_elts,
+                     (const void * *)var_ptr);
+
+      else
+        fvm_writer_export_field(writer->writer,
+                                post_mesh->exp_mesh,
+                                var_name,
+                                FVM_WRITER_PER_ELEMENT,
+                                var_dim,
+                                _interlace,
+                                n_parent_lists,
+                                parent_num_shift,
+                                datatype,
+                                nt_cur,
+                                t_cur,
+                                (const void * *)var_ptr);
 
       if (nt_cur >= 0) {
         writer->n_last = nt_cur;
@@ -5228,7 +6473,8 @@ cs_post_write_var(int                    mesh_id,
 
   }
 
-  /* Free memory (if both interior and boundary faces present) */
+  /* Free memory (if both interior and boundary faces present,
+     or values were sampled) */
 
   if (var_tmp != NULL)
     BFT_FREE(var_tmp);
@@ -5239,6 +6485,8 @@ cs_post_write_var(int                    mesh_id,
  * \brief Output a variable defined at vertices of a post-processing mesh using
  *        associated writers.
  *
+ * Nothing is output for meshes reduced to a Cartesian sampling grid.
+ *
  * \param[in]  mesh_id     id of associated mesh
  * \param[in]  writer_id   id of specified associated writer,
  *                         or \ref CS_POST_WRITER_ALL_ASSOCIATED for all
@@ -5277,6 +6525,7 @@ cs_post_write_vertex_var(int                    mesh_id,
   size_t       dec_ptr = 0;
   int          n_parent_lists = 0;
   cs_lnum_t    parent_num_shift[1]  = {0};
+  cs_lnum_t    n_list_elts[1] = {0};
 
   const void  *var_ptr[9] = {NULL, NULL, NULL,
                              NULL, NULL, NULL,
@@ -5294,6 +6543,11 @@ cs_post_write_vertex_var(int                    mesh_id,
 
   post_mesh = _cs_post_meshes + _mesh_id;
 
+  /* Vertex values have no counterpart on a sampled mesh */
+
+  if (post_mesh->sampling != NULL)
+    return;
+
   if (interlace)
     _interlace = CS_INTERLACE;
   else
@@ -5306,10 +6560,14 @@ cs_post_write_vertex_var(int                    mesh_id,
 
   /* Assign appropriate array to FVM for output */
 
-  if (use_parent)
+  if (use_parent) {
     n_parent_lists = 1;
-  else
+    n_list_elts[0] = cs_glob_mesh->n_vertices;
+  }
+  else {
     n_parent_lists = 0;
+    n_list_elts[0] = fvm_nodal_get_n_entities(post_mesh->exp_mesh, 0);
+  }
 
   var_ptr[0] = vtx_vals;
   if (interlace == false) {
@@ -5336,18 +6594,34 @@ cs_post_write_vertex_var(int                    mesh_id,
 
       _check_non_transient(writer, &nt_cur, &t_cur);
 
-      fvm_writer_export_field(writer->writer,
-                              post_mesh->exp_mesh,
-                              var_name,
-                              FVM_WRITER_PER_NODE,
-                              var_dim,
-                              _interlace,
-                              n_parent_lists,
-                              parent_num_shift,
-                              datatype,
-                              nt_cur,
-                              t_cur,
-                              (const void * *)var_ptr);
+      if (writer->async_output)
+        _stage_field(writer->writer,
+                     post_mesh->exp_mesh,
+                     var_name,
+                     FVM_WRITER_PER_NODE,
+                     var_dim,
+                     _interlace,
+                     n_parent_lists,
+                     parent_num_shift,
+                     datatype,
+                     nt_cur,
+                     t_cur,
+                     n_list_elts,
+                     (const void * *)var_ptr);
+
+      else
+        fvm_writer_export_field(writer->writer,
+                                post_mesh->exp_mesh,
+                                var_name,
+                                FVM_WRITER_PER_NODE,
+                                var_dim,
+                                _interlace,
+                                n_parent_lists,
+                                parent_num_shift,
+                                datatype,
+                                nt_cur,
+                                t_cur,
+                                (const void * *)var_ptr);
 
       if (nt_cur >= 0) {
         writer->n_last = nt_cur;
@@ -5497,6 +6771,9 @@ cs_post_write_particle_values(int                    mesh_id,
 
     if (writer->active == 1) {
 
+      if (writer->async_output)
+        _async_output_wait();
+
       fvm_writer_export_field(writer->writer,
                               post_mesh->exp_mesh,
                               var_name,
@@ -5639,6 +6916,9 @@ cs_post_write_probe_values(int                              mesh_id,
 
       cs_lnum_t  parent_num_shift[1] = {0};
 
+      if (writer->async_output)
+        _async_output_wait();
+
       fvm_writer_export_field(writer->writer,
                               post_mesh->exp_mesh,
                               var_name,
@@ -5695,6 +6975,10 @@ cs_post_renum_cells(const cs_lnum_t  init_cell_num[])
   if (init_cell_num == NULL)
     return;
 
+  /* Exportable meshes may not be modified during asynchronous output */
+
+  _async_output_wait();
+
   /* Loop on meshes */
 
   for (i = 0; i < _cs_post_n_meshes; i++) {
@@ -5723,7 +7007,30 @@ cs_post_renum_cells(const cs_lnum_t  init_cell_num[])
       post_mesh = _cs_post_meshes + i;
 
       if (   post_mesh->_exp_mesh != NULL
-          && post_mesh->ent_flag[CS_POST_LOCATION_CELL] > 0) {
+          && post_mesh->sampling != NULL) {
+
+        /* Sampled meshes only reference parent cells through their
+           selection; for a full selection, bins are permuted instead */
+
+        cs_post_sampling_t  *s = post_mesh->sampling;
+
+        if (s->cell_ids != NULL) {
+          for (cs_lnum_t j = 0; j < s->n_cells; j++)
+            s->cell_ids[j] = renum_ent_parent[s->cell_ids[j]] - 1;
+        }
+        else {
+          cs_lnum_t *cell_bin;
+          BFT_MALLOC(cell_bin, s->n_cells, cs_lnum_t);
+          for (icel = 0; icel < s->n_cells; icel++)
+            cell_bin[icel] = s->cell_bin[init_cell_num[icel]];
+          BFT_FREE(s->cell_bin);
+          s->cell_bin = cell_bin;
+        }
+
+      }
+
+      else if (   post_mesh->_exp_mesh != NULL
+               && post_mesh->ent_flag[CS_POST_LOCATION_CELL] > 0) {
 
         fvm_nodal_change_parent_num(post_mesh->_exp_mesh,
                                     renum_ent_parent,
@@ -5769,6 +7076,10 @@ cs_post_renum_faces(const cs_lnum_t  init_i_face_num[],
   cs_post_mesh_t   *post_mesh;
   const cs_mesh_t  *mesh = cs_glob_mesh;
 
+  /* Exportable meshes may not be modified during asynchronous output */
+
+  _async_output_wait();
+
   /* Loop on meshes */
 
   for (i = 0; i < _cs_post_n_meshes; i++) {
@@ -5856,6 +7167,39 @@ cs_post_set_changing_connectivity(void)
   _cs_post_mod_flag_min = FVM_WRITER_TRANSIENT_CONNECT;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Enable or disable asynchronous output of variables.
+ *
+ * When enabled, variables output through \ref cs_post_write_var and
+ * \ref cs_post_write_vertex_var (and thus \ref cs_post_write_vars) for
+ * EnSight writers with a fixed mesh are copied to a staging area, and
+ * written by a separate thread, overlapping with computation up to the
+ * next output time step. Two staging areas are used alternately, so
+ * additional memory up to twice the size of the variables output at a
+ * given time step may be required.
+ *
+ * This requires POSIX threads, and MPI_THREAD_MULTIPLE support from the
+ * MPI library, which is requested at initialization only if the
+ * CS_POST_ASYNC environment variable is defined. Defining that variable
+ * also enables asynchronous output by default. Asynchronous output is
+ * not used when memory logging is active.
+ *
+ * This function should be called before the initialization of writers,
+ * for example in \ref cs_user_postprocess_writers.
+ *
+ * \param[in]  async_output  true to enable asynchronous output,
+ *                           false to disable it
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_post_set_async_output(bool  async_output)
+{
+  _cs_post_async_request = (async_output) ? 1 : 0;
+  _cs_post_async_mode = -1;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Initialize post-processing writers
@@ -5951,6 +7295,10 @@ cs_post_init_writers(void)
                           -1,                         /* time step frequency */
                           -1.0);                      /* time value frequency */
 
+  /* Determine if asynchronous output is used */
+
+  _async_output_init();
+
   /* Print info on writers */
 
   _writer_info();
@@ -6230,6 +7578,13 @@ cs_post_time_step_output(const cs_time_step_t  *ts)
       int  dim_ent = fvm_nodal_get_max_entity_dim(exp_mesh);
       cs_lnum_t  n_elts = fvm_nodal_get_n_entities(exp_mesh, dim_ent);
 
+      /* For sampled meshes, values are based on the selected cells */
+
+      if (post_mesh->sampling != NULL) {
+        dim_ent = 3;
+        n_elts = post_mesh->sampling->n_cells;
+      }
+
       if (n_elts > n_elts_max) {
         n_elts_max = n_elts;
         BFT_REALLOC(parent_ids, n_elts_max, cs_int_t);
@@ -6237,10 +7592,15 @@ cs_post_time_step_output(const cs_time_step_t  *ts)
 
       /* Get corresponding element ids */
 
-      fvm_nodal_get_parent_num(exp_mesh, dim_ent, parent_ids);
+      if (post_mesh->sampling != NULL)
+        _sampling_cell_ids(post_mesh->sampling, parent_ids);
 
-      for (cs_lnum_t k = 0; k < n_elts; k++)
-        parent_ids[k] -= 1;
+      else {
+        fvm_nodal_get_parent_num(exp_mesh, dim_ent, parent_ids);
+
+        for (cs_lnum_t k = 0; k < n_elts; k++)
+          parent_ids[k] -= 1;
+      }
 
       /* We can output variables for this time step */
       /*--------------------------------------------*/
@@ -6437,16 +7797,24 @@ cs_post_time_step_end(void)
 {
   int t_top_id = cs_timer_stats_switch(_post_out_stat_id);
 
-  /* Flush writers if necessary */
+  /* Flush writers if necessary (staged for asynchronous writers) */
 
   for (int i = 0; i < _cs_post_n_writers; i++) {
     cs_post_writer_t  *writer = _cs_post_writers + i;
     if (writer->active == 1) {
-      if (writer->writer != NULL)
-        fvm_writer_flush(writer->writer);
+      if (writer->writer != NULL) {
+        if (writer->async_output)
+          _stage_flush(writer->writer);
+        else
+          fvm_writer_flush(writer->writer);
+      }
     }
   }
 
+  /* Start output of staged variables */
+
+  _async_output_submit();
+
   /* Free time-varying and Lagrangian meshes unless they
      are mapped to an existing mesh */
 
@@ -6455,6 +7823,8 @@ cs_post_time_step_end(void)
     if (post_mesh->_exp_mesh != NULL) {
       if (   post_mesh->ent_flag[3]
           || post_mesh->mod_flag_min == FVM_WRITER_TRANSIENT_CONNECT) {
+        if (_has_async_writer(post_mesh))
+          _async_output_wait();
         post_mesh->exp_mesh = NULL;
         post_mesh->_exp_mesh = fvm_nodal_destroy(post_mesh->_exp_mesh);
       }
@@ -6505,6 +7875,10 @@ cs_post_finalize(void)
   int i, j;
   cs_post_mesh_t  *post_mesh = NULL;
 
+  /* Complete asynchronous output if needed */
+
+  _async_output_finalize();
+
   /* Timings */
 
   for (i = 0; i < _cs_post_n_writers; i++) {
@@ -6573,6 +7947,11 @@ cs_post_finalize(void)
 
   BFT_FREE(_cs_post_writers);
 
+#if defined(HAVE_MPI)
+  if (_cs_post_async_comm != MPI_COMM_NULL)
+    MPI_Comm_free(&_cs_post_async_comm);
+#endif
+
   _cs_post_n_writers = 0;
   _cs_post_n_writers_max = 0;
 
@@ -230,6 +230,7 @@ typedef void
  * - \c \b EnSight \c \b Gold (\c \b EnSight also accepted)
  * - \c \b MED
  * - \c \b CGNS
+ * - \c \b XDMF (HDF5 data with an XDMF index, \c \b HDF5 also accepted)
  * - \c \b CCM (only for the full volume and boundary meshes)
  * - \c \b Catalyst (in-situ visualization)
  * - \c \b MEDCoupling (in-memory structure, to be used from other code)
@@ -263,6 +264,16 @@ typedef void
  *         pyramids), so that any post-processing tool can recognize them.
  * - \c \b separate_meshes to multiple meshes and associated fields to
  *         separate outputs.
+ * - \c \b rank_order to write data in parallel with each rank writing
+ *         its local elements and vertices at precomputed offsets, rather
+ *         than redistributing them by global number (for \c \b EnSight).
+ *         Post-processing output is faster for large meshes, but vertices
+ *         shared by several ranks are duplicated, and element ordering
+ *         depends on the partitioning.
+ * - \c \b serial_io to force serialized writes by successive ranks
+ *         even when parallel HDF5 is available (for \c \b XDMF).
+ * - \c \b compress or \c \b compress=<level> to compress datasets
+ *         with deflate (level 6 or 1 to 9, for \c \b XDMF).
  *
  * Note that the white-spaces in the beginning or in the end of the
  * character strings given as arguments here are suppressed automatically.
@@ -778,6 +789,35 @@ void
 cs_post_mesh_set_post_domain(int   mesh_id,
                              bool  post_domain);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Reduce a volume postprocessing mesh to a Cartesian sampling grid.
+ *
+ * The bounding box of the mesh's selected cells is divided into a regular
+ * grid of n_samples[0]*n_samples[1]*n_samples[2] bins, each cell being
+ * assigned to the bin containing its center. Only non-empty bins are
+ * exported (as hexahedra), and cell values are replaced by their
+ * volume-weighted average over each bin before being passed to writers,
+ * reducing the size of outputs for large meshes.
+ *
+ * Values at vertices and parallel domain or zone information are not
+ * output for such meshes. Values defined on the postprocessing mesh itself
+ * (i.e. with use_parent = false) are expected on its selected cells, as
+ * given by \ref cs_post_mesh_get_cell_ids.
+ *
+ * This function must be called before the mesh is built, typically just
+ * after its definition.
+ *
+ * \param[in]  mesh_id    postprocessing mesh id
+ * \param[in]  n_samples  number of sampling bins in each direction,
+ *                        or NULL to revert to regular output
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_post_mesh_set_sampling(int        mesh_id,
+                          const int  n_samples[3]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Remove a post-processing mesh.
@@ -1185,6 +1225,35 @@ cs_post_renum_faces(const cs_lnum_t  init_i_face_num[],
 void
 cs_post_set_changing_connectivity(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Enable or disable asynchronous output of variables.
+ *
+ * When enabled, variables output through \ref cs_post_write_var and
+ * \ref cs_post_write_vertex_var (and thus \ref cs_post_write_vars) for
+ * EnSight writers with a fixed mesh are copied to a staging area, and
+ * written by a separate thread, overlapping with computation up to the
+ * next output time step. Two staging areas are used alternately, so
+ * additional memory up to twice the size of the variables output at a
+ * given time step may be required.
+ *
+ * This requires POSIX threads, and MPI_THREAD_MULTIPLE support from the
+ * MPI library, which is requested at initialization only if the
+ * CS_POST_ASYNC environment variable is defined. Defining that variable
+ * also enables asynchronous output by default. Asynchronous output is
+ * not used when memory logging is active.
+ *
+ * This function should be called before the initialization of writers,
+ * for example in \ref cs_user_postprocess_writers.
+ *
+ * \param[in]  async_output  true to enable asynchronous output,
+ *                           false to disable it
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_post_set_async_output(bool  async_output);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Initialize post-processing writers
@@ -54,6 +54,8 @@
 #include "cs_log.h"
 #include "cs_map.h"
 #include "cs_mesh.h"
+#include "cs_mesh_adapt.h"
+#include "cs_mesh_cache.h"
 #include "cs_mesh_from_builder.h"
 #include "cs_mesh_location.h"
 #include "cs_mesh_quantities.h"
@@ -158,6 +160,135 @@ extern void cs_f_majgeo(const cs_int_t     *ncel,
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Read, preprocess, partition and renumber the main mesh.
+ *
+ * parameters:
+ *   halo_type    <-- type of halo (standard or extended)
+ *   allow_modify <-- allow joining and other mesh modifications
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_and_preprocess_mesh(cs_halo_type_t  halo_type,
+                          bool            allow_modify)
+{
+  double  t1, t2;
+
+  /* Read Preprocessor output */
+
+  cs_preprocessor_data_read_mesh(cs_glob_mesh,
+                                 cs_glob_mesh_builder);
+
+  if (allow_modify) {
+
+    /* Join meshes / build periodicity links if necessary */
+
+    cs_join_all(true);
+
+    cs_base_mem_log_stage(_("joining"));
+
+    /* Insert boundaries if necessary */
+
+    cs_gui_mesh_boundary(cs_glob_mesh);
+    cs_user_mesh_boundary(cs_glob_mesh);
+
+    cs_internal_coupling_preprocess(cs_glob_mesh);
+
+  }
+
+  /* Initialize extended connectivity, ghost cells and other remaining
+     parallelism-related structures */
+
+  cs_mesh_init_halo(cs_glob_mesh, cs_glob_mesh_builder, halo_type);
+  cs_mesh_update_auxiliary(cs_glob_mesh);
+
+  cs_base_mem_log_stage(_("halo construction"));
+
+  if (allow_modify) {
+
+    /* Possible geometry modification */
+
+    cs_gui_mesh_extrude(cs_glob_mesh);
+    cs_user_mesh_modify(cs_glob_mesh);
+
+    /* Discard isolated faces if present */
+
+    cs_post_add_free_faces();
+    cs_mesh_discard_free_faces(cs_glob_mesh);
+
+    /* Smoothe mesh if required */
+
+    cs_gui_mesh_smoothe(cs_glob_mesh);
+    cs_user_mesh_smoothe(cs_glob_mesh);
+
+    /* Triangulate warped faces if necessary */
+
+    {
+      double  cwf_threshold = -1.0;
+      int  cwf_post = 0;
+
+      cs_mesh_warping_get_defaults(&cwf_threshold, &cwf_post);
+
+      if (cwf_threshold >= 0.0) {
+
+        t1 = cs_timer_wtime();
+        cs_mesh_warping_cut_faces(cs_glob_mesh, cwf_threshold, cwf_post);
+        t2 = cs_timer_wtime();
+
+        bft_printf(_("\n Cutting warped faces (%.3g s)\n"), t2-t1);
+
+      }
+    }
+
+    /* Now that mesh modification is finished, save mesh if modified */
+
+    cs_gui_mesh_save_if_modified(cs_glob_mesh);
+    cs_user_mesh_save(cs_glob_mesh); /* Disable or force */
+
+  }
+
+  /* Apply mesh adaptation requested by the computation being restarted */
+
+  cs_mesh_adapt_apply(cs_glob_mesh);
+
+  bool partition_preprocess = cs_partition_get_preprocess();
+  bool need_save = false;
+  if (   (cs_glob_mesh->modified > 0 && cs_glob_mesh->save_if_modified > 0)
+      || cs_glob_mesh->save_if_modified > 1)
+    need_save = true;
+
+  if (cs_glob_mesh->modified > 0 || partition_preprocess) {
+    if (partition_preprocess) {
+      if (need_save) {
+        cs_mesh_save(cs_glob_mesh, cs_glob_mesh_builder, NULL, "mesh_output.csm");
+        need_save = false;
+      }
+      else
+        cs_mesh_to_builder(cs_glob_mesh, cs_glob_mesh_builder, true, NULL);
+      cs_partition(cs_glob_mesh, cs_glob_mesh_builder, CS_PARTITION_MAIN);
+      cs_mesh_from_builder(cs_glob_mesh, cs_glob_mesh_builder);
+      cs_mesh_init_halo(cs_glob_mesh, cs_glob_mesh_builder, halo_type);
+      cs_mesh_update_auxiliary(cs_glob_mesh);
+      cs_base_mem_log_stage(_("repartitioning"));
+    }
+  }
+
+  if (need_save)
+    cs_mesh_save(cs_glob_mesh, NULL, NULL, "mesh_output.csm");
+
+  /* Destroy the temporary structure used to build the main mesh */
+
+  cs_mesh_builder_destroy(&cs_glob_mesh_builder);
+
+  /* Renumber mesh based on code options */
+
+  cs_user_numbering();
+
+  cs_renumber_mesh(cs_glob_mesh);
+
+  cs_base_mem_log_stage(_("renumbering"));
+}
+
 /*============================================================================
  * Fortran wrapper function definitions
  *============================================================================*/
@@ -281,109 +412,23 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
     cs_user_partition();
   }
 
-  /* Read Preprocessor output */
+  /* Restore mesh from cache, or read and preprocess it
+     (a cached mesh does not include a pending adaptation, and an
+     adapted mesh does not match the cache signature, so is not cached) */
 
-  cs_preprocessor_data_read_mesh(cs_glob_mesh,
-                                 cs_glob_mesh_builder);
-
-  if (allow_modify) {
-
-    /* Join meshes / build periodicity links if necessary */
-
-    cs_join_all(true);
-
-    /* Insert boundaries if necessary */
-
-    cs_gui_mesh_boundary(cs_glob_mesh);
-    cs_user_mesh_boundary(cs_glob_mesh);
-
-    cs_internal_coupling_preprocess(cs_glob_mesh);
+  bool adapt_pending = cs_mesh_adapt_is_pending();
 
+  if (   adapt_pending == false
+      && cs_mesh_cache_read(cs_glob_mesh, cs_glob_mesh_builder, halo_type)) {
+    cs_preprocessor_data_discard_mesh();
+    cs_mesh_builder_destroy(&cs_glob_mesh_builder);
   }
-
-  /* Initialize extended connectivity, ghost cells and other remaining
-     parallelism-related structures */
-
-  cs_mesh_init_halo(cs_glob_mesh, cs_glob_mesh_builder, halo_type);
-  cs_mesh_update_auxiliary(cs_glob_mesh);
-
-  if (allow_modify) {
-
-    /* Possible geometry modification */
-
-    cs_gui_mesh_extrude(cs_glob_mesh);
-    cs_user_mesh_modify(cs_glob_mesh);
-
-    /* Discard isolated faces if present */
-
-    cs_post_add_free_faces();
-    cs_mesh_discard_free_faces(cs_glob_mesh);
-
-    /* Smoothe mesh if required */
-
-    cs_gui_mesh_smoothe(cs_glob_mesh);
-    cs_user_mesh_smoothe(cs_glob_mesh);
-
-    /* Triangulate warped faces if necessary */
-
-    {
-      double  cwf_threshold = -1.0;
-      int  cwf_post = 0;
-
-      cs_mesh_warping_get_defaults(&cwf_threshold, &cwf_post);
-
-      if (cwf_threshold >= 0.0) {
-
-        t1 = cs_timer_wtime();
-        cs_mesh_warping_cut_faces(cs_glob_mesh, cwf_threshold, cwf_post);
-        t2 = cs_timer_wtime();
-
-        bft_printf(_("\n Cutting warped faces (%.3g s)\n"), t2-t1);
-
-      }
-    }
-
-    /* Now that mesh modification is finished, save mesh if modified */
-
-    cs_gui_mesh_save_if_modified(cs_glob_mesh);
-    cs_user_mesh_save(cs_glob_mesh); /* Disable or force */
-
+  else {
+    _read_and_preprocess_mesh(halo_type, allow_modify);
+    if (adapt_pending == false)
+      cs_mesh_cache_write(cs_glob_mesh);
   }
 
-  bool partition_preprocess = cs_partition_get_preprocess();
-  bool need_save = false;
-  if (   (cs_glob_mesh->modified > 0 && cs_glob_mesh->save_if_modified > 0)
-      || cs_glob_mesh->save_if_modified > 1)
-    need_save = true;
-
-  if (cs_glob_mesh->modified > 0 || partition_preprocess) {
-    if (partition_preprocess) {
-      if (need_save) {
-        cs_mesh_save(cs_glob_mesh, cs_glob_mesh_builder, NULL, "mesh_output.csm");
-        need_save = false;
-      }
-      else
-        cs_mesh_to_builder(cs_glob_mesh, cs_glob_mesh_builder, true, NULL);
-      cs_partition(cs_glob_mesh, cs_glob_mesh_builder, CS_PARTITION_MAIN);
-      cs_mesh_from_builder(cs_glob_mesh, cs_glob_mesh_builder);
-      cs_mesh_init_halo(cs_glob_mesh, cs_glob_mesh_builder, halo_type);
-      cs_mesh_update_auxiliary(cs_glob_mesh);
-    }
-  }
-
-  if (need_save)
-    cs_mesh_save(cs_glob_mesh, NULL, NULL, "mesh_output.csm");
-
-  /* Destroy the temporary structure used to build the main mesh */
-
-  cs_mesh_builder_destroy(&cs_glob_mesh_builder);
-
-  /* Renumber mesh based on code options */
-
-  cs_user_numbering();
-
-  cs_renumber_mesh(cs_glob_mesh);
-
   /* Initialize group classes */
 
   cs_mesh_init_group_classes(cs_glob_mesh);
@@ -57,6 +57,8 @@
 #include "cs_interface.h"
 #include "cs_mesh.h"
 #include "cs_mesh_from_builder.h"
+#include "cs_mesh_cgns.h"
+#include "cs_mesh_gmsh.h"
 #include "cs_mesh_group.h"
 #include "cs_parall.h"
 #include "cs_partition.h"
@@ -91,6 +93,9 @@ typedef struct {
   const char  *const *old_group_names;
   const char  *const *new_group_names;
 
+  cs_mesh_gmsh_t     *gmsh;       /* Element-based mesh data, for Gmsh
+                                     or CGNS files */
+
   /* Single allocation for all data */
 
   size_t              data_size;
@@ -174,6 +179,9 @@ _set_default_input_if_needed(void)
   const char input_default[] = "mesh_input.csm";
   const char cp_input_default[] = "restart/mesh_input.csm";
 
+  const char input_default_gmsh[] = "mesh_input.msh";
+  const char input_default_cgns[] = "mesh_input.cgns";
+
   const char input_default_noext[] = "mesh_input";
   const char cp_input_default_noext[] = "restart/mesh_input";
 
@@ -188,6 +196,13 @@ _set_default_input_if_needed(void)
     else if (cs_file_isreg(cp_input_default))
       cs_preprocessor_data_add_file(cp_input_default, 0, NULL, NULL);
 
+    /* Then check for meshes read directly (without the Preprocessor) */
+    else if (cs_file_isreg(input_default_gmsh))
+      cs_preprocessor_data_add_file(input_default_gmsh, 0, NULL, NULL);
+
+    else if (cs_file_isreg(input_default_cgns))
+      cs_preprocessor_data_add_file(input_default_cgns, 0, NULL, NULL);
+
     /* If not present, check without extension */
     else if (cs_file_isreg(input_default_noext))
       cs_preprocessor_data_add_file(input_default_noext, 0, NULL, NULL);
@@ -291,6 +306,7 @@ _mesh_reader_destroy(_mesh_reader_t  **mr)
 
   for (i = 0; i < _mr->n_files; i++) {
     _mesh_file_info_t  *f = _mr->file_info + i;
+    cs_mesh_gmsh_destroy(&(f->gmsh));
     BFT_FREE(f->data);
   }
   BFT_FREE(_mr->file_info);
@@ -593,6 +609,12 @@ _read_perio_info(const char  *filename)
 
   int retval = 0;
 
+  /* Periodicity is not handled for Gmsh or CGNS files */
+
+  if (   cs_mesh_gmsh_is_gmsh_file(filename)
+      || cs_mesh_cgns_is_cgns_file(filename))
+    return retval;
+
   /* Initialize reading of Preprocessor output */
 
   bft_printf(_(" Checking metadata from file: \"%s\"\n"), filename);
@@ -661,6 +683,157 @@ _read_perio_info(const char  *filename)
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Append groups and group classes to those of a mesh.
+ *
+ * parameters
+ *   mesh               <-> pointer to mesh structure
+ *   n_groups           <-- number of added groups
+ *   group_name         <-- names of added groups
+ *   n_gc               <-- number of added group classes
+ *   n_gc_props_max     <-- maximum number of groups per added group class
+ *   gc_props           <-- group ids (1 to n) of added group classes
+ *                          (gc_props[n_gc*j + i] for group class i),
+ *                          0 for padding
+ *----------------------------------------------------------------------------*/
+
+static void
+_append_group_classes(cs_mesh_t          *mesh,
+                      int                 n_groups,
+                      const char *const   group_name[],
+                      int                 n_gc,
+                      int                 n_gc_props_max,
+                      const int           gc_props[])
+{
+  int i, j;
+
+  int n_groups_prev = mesh->n_groups;
+  int n_families_prev = mesh->n_families;
+  int n_items_prev = mesh->n_max_family_items;
+
+  /* Group names */
+
+  if (n_groups > 0) {
+
+    size_t names_size = 0;
+    for (i = 0; i < n_groups; i++)
+      names_size += strlen(group_name[i]) + 1;
+
+    if (mesh->group_idx == NULL) {
+      BFT_MALLOC(mesh->group_idx, n_groups + 1, int);
+      mesh->group_idx[0] = 0;
+    }
+    else
+      BFT_REALLOC(mesh->group_idx, n_groups_prev + n_groups + 1, int);
+
+    BFT_REALLOC(mesh->group,
+                mesh->group_idx[n_groups_prev] + names_size,
+                char);
+
+    for (i = 0; i < n_groups; i++) {
+      int l = strlen(group_name[i]) + 1;
+      j = n_groups_prev + i;
+      memcpy(mesh->group + mesh->group_idx[j], group_name[i], l);
+      mesh->group_idx[j+1] = mesh->group_idx[j] + l;
+    }
+
+    mesh->n_groups += n_groups;
+
+  }
+
+  /* Group classes (padding previous or added definitions if necessary) */
+
+  if (n_gc > 0) {
+
+    int n_families = n_families_prev + n_gc;
+    int n_items = CS_MAX(n_items_prev, n_gc_props_max);
+    cs_int_t *family_item = NULL;
+
+    BFT_MALLOC(family_item, n_families*n_items, cs_int_t);
+
+    for (j = 0; j < n_items; j++) {
+      for (i = 0; i < n_families_prev; i++)
+        family_item[n_families*j + i]
+          = (j < n_items_prev) ? mesh->family_item[n_families_prev*j + i] : 0;
+      for (i = 0; i < n_gc; i++) {
+        int g_id = (j < n_gc_props_max) ? gc_props[n_gc*j + i] : 0;
+        family_item[n_families*j + n_families_prev + i]
+          = (g_id > 0) ? - (n_groups_prev + g_id) : 0;
+      }
+    }
+
+    BFT_FREE(mesh->family_item);
+    mesh->family_item = family_item;
+    mesh->n_families = n_families;
+    mesh->n_max_family_items = n_items;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Read a Gmsh or CGNS file and build its faces, updating mesh dimensions.
+ *
+ * The file's data is kept in the mesh file info structure until
+ * it is transferred to the mesh builder by _read_gmsh_data().
+ *
+ * parameters
+ *   mesh <-> pointer to mesh structure
+ *   mb   <-> pointer to mesh builder helper structure
+ *   f    <-> pointer to mesh file info structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_gmsh_dimensions(cs_mesh_t          *mesh,
+                      cs_mesh_builder_t  *mb,
+                      _mesh_file_info_t  *f)
+{
+  cs_gnum_t  n_g_cells, n_g_faces, n_g_vertices, n_g_face_connect_size;
+  int  n_groups, n_gc, n_gc_props_max;
+  const char *const *group_name = NULL;
+  const int *gc_props = NULL;
+
+  if (cs_mesh_cgns_is_cgns_file(f->filename)) {
+    bft_printf(_(" Reading CGNS mesh file: \"%s\"\n"), f->filename);
+    f->gmsh = cs_mesh_cgns_read(f->filename);
+  }
+  else {
+    bft_printf(_(" Reading Gmsh mesh file: \"%s\"\n"), f->filename);
+    f->gmsh = cs_mesh_gmsh_read(f->filename);
+  }
+
+  cs_mesh_gmsh_get_dimensions(f->gmsh,
+                              &n_g_cells,
+                              &n_g_faces,
+                              &n_g_vertices,
+                              &n_g_face_connect_size);
+
+  mesh->n_g_cells += n_g_cells;
+  mb->n_g_faces += n_g_faces;
+  mesh->n_g_vertices += n_g_vertices;
+  mb->n_g_face_connect_size += n_g_face_connect_size;
+
+  cs_mesh_gmsh_get_group_classes(f->gmsh,
+                                 &n_groups,
+                                 &group_name,
+                                 &n_gc,
+                                 &n_gc_props_max,
+                                 &gc_props);
+
+  _append_group_classes(mesh,
+                        n_groups,
+                        group_name,
+                        n_gc,
+                        n_gc_props_max,
+                        gc_props);
+
+  if (f->n_group_renames > 0)
+    _mesh_groups_rename(mesh,
+                        mesh->n_groups - n_groups,
+                        f->n_group_renames,
+                        f->old_group_names,
+                        f->new_group_names);
+}
+
 /*----------------------------------------------------------------------------
  * Read sections from the pre-processor about the dimensions of mesh
  *
@@ -705,6 +878,14 @@ _read_dimensions(cs_mesh_t          *mesh,
 
   mr->gc_id_shift[file_id] = mesh->n_families;
 
+  /* Gmsh and CGNS files are read and their faces built directly */
+
+  if (   cs_mesh_gmsh_is_gmsh_file(f->filename)
+      || cs_mesh_cgns_is_cgns_file(f->filename)) {
+    _read_gmsh_dimensions(mesh, mb, f);
+    return;
+  }
+
   /* Initialize reading of Preprocessor output */
 
   bft_printf(_(" Reading metadata from file: \"%s\"\n"), f->filename);
@@ -1333,6 +1514,67 @@ _transform_perio_matrix(const double  matrix[],
   _combine_tr_matrixes(_m, _tmp_m, perio_matrix);
 }
 
+/*----------------------------------------------------------------------------
+ * Transfer data read from a Gmsh or CGNS file to the mesh builder.
+ *
+ * parameters:
+ *   mesh        <-> pointer to mesh structure
+ *   mb          <-> pointer to mesh builder helper structure
+ *   mr          <-> pointer to mesh reader structure
+ *   f           <-> pointer to mesh file info structure
+ *   gc_id_shift <-- number of group classes from previous files
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_gmsh_data(cs_mesh_t          *mesh,
+                cs_mesh_builder_t  *mb,
+                _mesh_reader_t     *mr,
+                _mesh_file_info_t  *f,
+                int                 gc_id_shift)
+{
+  cs_lnum_t  n_elts[4];
+  cs_gnum_t  n_g_cells, n_g_faces, n_g_vertices, n_g_face_connect_size;
+
+  /* Faces built here are not saved in any file yet, so mark the mesh
+     as modified so that it is written (in parallel) to mesh_output,
+     which will be used as mesh_input on restart */
+
+  mesh->modified = 1;
+
+  cs_mesh_gmsh_to_builder(f->gmsh,
+                          mb,
+                          mr->n_g_cells_read,
+                          mr->n_g_faces_read,
+                          mr->n_g_vertices_read,
+                          gc_id_shift,
+                          n_elts);
+
+  /* Transform coordinates if necessary */
+
+  if (f->matrix != NULL) {
+    _transform_coords(n_elts[3],
+                      mb->vertex_coords + mr->n_vertices_read*3,
+                      f->matrix);
+  }
+
+  cs_mesh_gmsh_get_dimensions(f->gmsh,
+                              &n_g_cells,
+                              &n_g_faces,
+                              &n_g_vertices,
+                              &n_g_face_connect_size);
+
+  cs_mesh_gmsh_destroy(&(f->gmsh));
+
+  mr->n_cells_read += n_elts[0];
+  mr->n_faces_read += n_elts[1];
+  mr->n_faces_connect_read += n_elts[2];
+  mr->n_vertices_read += n_elts[3];
+  mr->n_g_cells_read += n_g_cells;
+  mr->n_g_faces_read += n_g_faces;
+  mr->n_g_faces_connect_read += n_g_face_connect_size;
+  mr->n_g_vertices_read += n_g_vertices;
+}
+
 /*----------------------------------------------------------------------------
  * Read pre-processor mesh data for a given mesh and finalize input.
  *
@@ -1381,6 +1623,11 @@ _read_data(int                 file_id,
 
   f = mr->file_info + file_id;
 
+  if (f->gmsh != NULL) {
+    _read_gmsh_data(mesh, mb, mr, f, gc_id_shift);
+    return;
+  }
+
 #if defined(HAVE_MPI)
   {
     MPI_Info           hints;
@@ -1916,6 +2163,11 @@ CS_PROCF(ledevi, LEDEVI)(cs_int_t   *iperio,
  * The first time this function is called,  this default is overriden by the
  * defined file, and all subsequent calls define additional meshes to read.
  *
+ * Files with a ".msh" extension are read directly as Gmsh (format 4.1)
+ * meshes, and files with a ".cgns" extension as unstructured CGNS meshes
+ * (if CGNS support is available); other files are expected to be
+ * Preprocessor output.
+ *
  * parameters:
  *   file_name       <-- name of file to read
  *   n_group_renames <-- number of groups to rename
@@ -1970,6 +2222,7 @@ cs_preprocessor_data_add_file(const char     *file_name,
   /* Setup base structure fields */
 
   f->offset = 0;
+  f->gmsh = NULL;
   f->data_size = data_size;
   BFT_MALLOC(f->data, f->data_size, unsigned char);
   memset(f->data, 0, f->data_size);
@@ -2188,11 +2441,15 @@ cs_preprocessor_data_read_mesh(cs_mesh_t          *mesh,
   if (mr->n_files > 1)
     mesh->modified = 1;
 
+  cs_base_mem_log_stage(_("mesh reading"));
+
   /* Partition data */
 
   if (! pre_partitioned)
     cs_partition(mesh, mesh_builder, partition_stage);
 
+  cs_base_mem_log_stage(_("partitioning"));
+
   bft_printf("\n");
 
   /* Now send data to the correct rank */
@@ -2200,6 +2457,8 @@ cs_preprocessor_data_read_mesh(cs_mesh_t          *mesh,
 
   cs_mesh_from_builder(mesh, mesh_builder);
 
+  cs_base_mem_log_stage(_("mesh distribution"));
+
   /* Free temporary memory */
 
   _mesh_reader_destroy(&mr);
@@ -2210,6 +2469,53 @@ cs_preprocessor_data_read_mesh(cs_mesh_t          *mesh,
   cs_mesh_clean_families(mesh);
 }
 
+/*----------------------------------------------------------------------------
+ * Discard pre-processor mesh input without reading mesh data.
+ *
+ * This is used instead of cs_preprocessor_data_read_mesh when the mesh
+ * is obtained by other means after its headers have been read.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_preprocessor_data_discard_mesh(void)
+{
+  if (_cs_glob_mesh_reader != NULL)
+    _mesh_reader_destroy(&_cs_glob_mesh_reader);
+}
+
+/*----------------------------------------------------------------------------
+ * Query mesh input files whose headers have been read.
+ *
+ * This may be called between cs_preprocessor_data_read_headers and
+ * cs_preprocessor_data_read_mesh (or cs_preprocessor_data_discard_mesh).
+ *
+ * parameters:
+ *   file_id <-- id of queried file
+ *   matrix  --> associated coordinate transformation matrix
+ *               (NULL if none), or NULL
+ *
+ * returns:
+ *   name of given mesh input file, or NULL if file_id is out of range
+ *----------------------------------------------------------------------------*/
+
+const char *
+cs_preprocessor_data_get_file_info(int             file_id,
+                                   const double  **matrix)
+{
+  const _mesh_reader_t *mr = _cs_glob_mesh_reader;
+
+  if (matrix != NULL)
+    *matrix = NULL;
+
+  if (mr == NULL || file_id < 0 || file_id >= mr->n_files)
+    return NULL;
+
+  if (matrix != NULL)
+    *matrix = mr->file_info[file_id].matrix;
+
+  return mr->file_info[file_id].filename;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
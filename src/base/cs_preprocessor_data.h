@@ -75,6 +75,11 @@ CS_PROCF(ledevi, LEDEVI)(cs_int_t  *iperio,
  * The first time this function is called,  this default is overriden by the
  * defined file, and all subsequent calls define additional meshes to read.
  *
+ * Files with a ".msh" extension are read directly as Gmsh (format 4.1)
+ * meshes, and files with a ".cgns" extension as unstructured CGNS meshes
+ * (if CGNS support is available); other files are expected to be
+ * Preprocessor output.
+ *
  * parameters:
  *   file_name       <-- name of file to read
  *   n_group_renames <-- number of groups to rename
@@ -133,6 +138,35 @@ void
 cs_preprocessor_data_read_mesh(cs_mesh_t          *mesh,
                                cs_mesh_builder_t  *mesh_builder);
 
+/*----------------------------------------------------------------------------
+ * Discard pre-processor mesh input without reading mesh data.
+ *
+ * This is used instead of cs_preprocessor_data_read_mesh when the mesh
+ * is obtained by other means after its headers have been read.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_preprocessor_data_discard_mesh(void);
+
+/*----------------------------------------------------------------------------
+ * Query mesh input files whose headers have been read.
+ *
+ * This may be called between cs_preprocessor_data_read_headers and
+ * cs_preprocessor_data_read_mesh (or cs_preprocessor_data_discard_mesh).
+ *
+ * parameters:
+ *   file_id <-- id of queried file
+ *   matrix  --> associated coordinate transformation matrix
+ *               (NULL if none), or NULL
+ *
+ * returns:
+ *   name of given mesh input file, or NULL if file_id is out of range
+ *----------------------------------------------------------------------------*/
+
+const char *
+cs_preprocessor_data_get_file_info(int             file_id,
+                                   const double  **matrix);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -60,6 +60,13 @@ BEGIN_C_DECLS
   Based on the uniform, gaussian, and poisson random number generation code
   from netlib.org: lagged (-273,-607) Fibonacci; Box-Muller;
   by W.P. Petersen, IPS, ETH Zuerich.
+
+  Counter-based generation uses the Philox4x32-10 function from:
+  J.K. Salmon, M.A. Moraes, R.O. Dror and D.E. Shaw, "Parallel random
+  numbers: as easy as 1, 2, 3", SC'11 (2011). As it has no internal
+  state, values only depend on the provided key (entity id, time step,
+  stream), so they may be generated from any thread, in any order,
+  and independently of the domain partitioning.
 */
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
@@ -68,6 +75,13 @@ BEGIN_C_DECLS
  * Macro definitions
  *============================================================================*/
 
+/* Philox4x32 multipliers and Weyl sequence key increments */
+
+#define _PHILOX_M0  0xD2511F53U
+#define _PHILOX_M1  0xCD9E8D57U
+#define _PHILOX_W0  0x9E3779B9U
+#define _PHILOX_W1  0xBB67AE85U
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -171,6 +185,45 @@ _normal00(void)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Generate 2 uniform values in ]0, 1[ using a counter-based method.
+ *
+ * Each block of 4x32 random bits provides 2 values with 53-bit mantissas.
+ *
+ * \param[in]   id         entity (particle, eddy, ...) id
+ * \param[in]   time_step  associated time step
+ * \param[in]   stream     stream id
+ * \param[in]   block_id   block id in sequence
+ * \param[out]  u          uniform values
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_counter_uniform_pair(cs_gnum_t  id,
+                      int        time_step,
+                      int        stream,
+                      uint32_t   block_id,
+                      double     u[2])
+{
+  const double d_2_m53 = 1.1102230246251565e-16; /* 2^-53 */
+
+  uint64_t _id = id;
+  uint32_t ctr[4] = {block_id,
+                     (uint32_t)time_step,
+                     (uint32_t)(_id & 0xFFFFFFFFU),
+                     (uint32_t)(_id >> 32)};
+  uint32_t key[2] = {(uint32_t)stream, 0};
+  uint32_t r[4];
+
+  cs_random_philox4x32(ctr, key, r);
+
+  for (int i = 0; i < 2; i++) {
+    uint64_t b = (((uint64_t)r[2*i]) << 32 | r[2*i+1]) >> 11;
+    u[i] = ((double)b + 0.5) * d_2_m53;
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -525,6 +578,120 @@ cs_random_poisson(cs_lnum_t  n,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Philox4x32-10 counter-based random bits generator.
+ *
+ * This function has no internal state, so it is thread-safe.
+ *
+ * \param[in]   counter  counter
+ * \param[in]   key      key
+ * \param[out]  r        associated random bits
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_philox4x32(const uint32_t  counter[4],
+                     const uint32_t  key[2],
+                     uint32_t        r[4])
+{
+  uint32_t c[4] = {counter[0], counter[1], counter[2], counter[3]};
+  uint32_t k[2] = {key[0], key[1]};
+
+  for (int round = 0; round < 10; round++) {
+
+    uint64_t p0 = (uint64_t)_PHILOX_M0 * c[0];
+    uint64_t p1 = (uint64_t)_PHILOX_M1 * c[2];
+
+    uint32_t hi0 = (uint32_t)(p0 >> 32), lo0 = (uint32_t)p0;
+    uint32_t hi1 = (uint32_t)(p1 >> 32), lo1 = (uint32_t)p1;
+
+    c[0] = hi1 ^ c[1] ^ k[0];
+    c[1] = lo1;
+    c[2] = hi0 ^ c[3] ^ k[1];
+    c[3] = lo0;
+
+    k[0] += _PHILOX_W0;
+    k[1] += _PHILOX_W1;
+
+  }
+
+  for (int i = 0; i < 4; i++)
+    r[i] = c[i];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Counter-based uniform distribution random number generator.
+ *
+ * Values in ]0, 1[ are fully determined by the (id, time_step, stream)
+ * key and their rank in the returned sequence, so this function may
+ * be called concurrently from several threads, and results do not
+ * depend on the order in which entities are processed, as long as
+ * the ids are independent of the partitioning (i.e. global ids).
+ *
+ * \param[in]   id         entity (particle, eddy, ...) id
+ * \param[in]   time_step  associated time step
+ * \param[in]   stream     stream id, to separate independent uses
+ * \param[in]   n          number of values to compute
+ * \param[out]  a          pseudo-random numbers following uniform
+ *                         distribution
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_counter_uniform(cs_gnum_t  id,
+                          int        time_step,
+                          int        stream,
+                          cs_lnum_t  n,
+                          cs_real_t  a[])
+{
+  double u[2];
+
+  for (cs_lnum_t i = 0; i < n; i += 2) {
+    _counter_uniform_pair(id, time_step, stream, i/2, u);
+    a[i] = u[0];
+    if (i + 1 < n)
+      a[i+1] = u[1];
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Counter-based normal distribution random number generator.
+ *
+ * Box-Muller method applied to the values of cs_random_counter_uniform,
+ * with the same thread-safety and reproducibility properties.
+ *
+ * \param[in]   id         entity (particle, eddy, ...) id
+ * \param[in]   time_step  associated time step
+ * \param[in]   stream     stream id, to separate independent uses
+ * \param[in]   n          number of values to compute
+ * \param[out]  x          pseudo-random numbers following normal
+ *                         distribution
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_counter_normal(cs_gnum_t  id,
+                         int        time_step,
+                         int        stream,
+                         cs_lnum_t  n,
+                         cs_real_t  x[])
+{
+  const double twopi = 6.2831853071795862;
+  double u[2];
+
+  for (cs_lnum_t i = 0; i < n; i += 2) {
+    _counter_uniform_pair(id, time_step, stream, i/2, u);
+    double r = sqrt(-2.*log(u[0]));
+    double t = twopi * u[1];
+    x[i] = r * cos(t);
+    if (i + 1 < n)
+      x[i+1] = r * sin(t);
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Save static variables used by random number generator.
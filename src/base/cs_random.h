@@ -120,6 +120,72 @@ cs_random_poisson(cs_lnum_t  n,
                   cs_real_t  mu,
                   int        p[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Philox4x32-10 counter-based random bits generator.
+ *
+ * This function has no internal state, so it is thread-safe.
+ *
+ * \param[in]   counter  counter
+ * \param[in]   key      key
+ * \param[out]  r        associated random bits
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_philox4x32(const uint32_t  counter[4],
+                     const uint32_t  key[2],
+                     uint32_t        r[4]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Counter-based uniform distribution random number generator.
+ *
+ * Values in ]0, 1[ are fully determined by the (id, time_step, stream)
+ * key and their rank in the returned sequence, so this function may
+ * be called concurrently from several threads, and results do not
+ * depend on the order in which entities are processed, as long as
+ * the ids are independent of the partitioning (i.e. global ids).
+ *
+ * \param[in]   id         entity (particle, eddy, ...) id
+ * \param[in]   time_step  associated time step
+ * \param[in]   stream     stream id, to separate independent uses
+ * \param[in]   n          number of values to compute
+ * \param[out]  a          pseudo-random numbers following uniform
+ *                         distribution
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_counter_uniform(cs_gnum_t  id,
+                          int        time_step,
+                          int        stream,
+                          cs_lnum_t  n,
+                          cs_real_t  a[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Counter-based normal distribution random number generator.
+ *
+ * Box-Muller method applied to the values of cs_random_counter_uniform,
+ * with the same thread-safety and reproducibility properties.
+ *
+ * \param[in]   id         entity (particle, eddy, ...) id
+ * \param[in]   time_step  associated time step
+ * \param[in]   stream     stream id, to separate independent uses
+ * \param[in]   n          number of values to compute
+ * \param[out]  x          pseudo-random numbers following normal
+ *                         distribution
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_counter_normal(cs_gnum_t  id,
+                         int        time_step,
+                         int        stream,
+                         cs_lnum_t  n,
+                         cs_real_t  x[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Save static variables used by random number generator.
@@ -64,6 +64,7 @@
 #include "cs_block_to_part.h"
 #include "cs_file.h"
 #include "cs_io.h"
+#include "cs_map.h"
 #include "cs_mesh.h"
 #include "cs_mesh_save.h"
 #include "cs_mesh_location.h"
@@ -113,6 +114,13 @@ typedef struct _location_t {
   cs_gnum_t        *_ent_global_num;  /* Private global entity numbers,
                                          or NULL */
 
+#if defined(HAVE_MPI)
+  cs_block_dist_info_t   d_bi;        /* Block distribution for cached
+                                         distributor */
+  cs_all_to_all_t       *d;           /* Cached block to part distributor
+                                         for reading, or NULL */
+#endif
+
 } _location_t;
 
 struct _cs_restart_t {
@@ -126,6 +134,14 @@ struct _cs_restart_t {
   size_t             n_locations;    /* Number of locations */
   _location_t       *location;       /* Location definition array */
 
+  cs_map_name_to_id_t  *sec_map;     /* Section name to id map
+                                        (read mode only) */
+  int                  *sec_rec_id;  /* First index record id for each
+                                        section name id in sec_map */
+  int                  *sec_rec_next;/* Next index record id with the same
+                                        section name, or -1, for each
+                                        index record */
+
   cs_restart_mode_t  mode;           /* Read or write */
 
 };
@@ -230,6 +246,44 @@ static _cs_restart_multiwriter_t  **_restart_multiwriter             = NULL;
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Initialize cached data of a restart location.
+ *
+ * parameters:
+ *   loc <-> pointer to location structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_location_init_cache(_location_t  *loc)
+{
+#if defined(HAVE_MPI)
+  loc->d = NULL;
+  memset(&(loc->d_bi), 0, sizeof(cs_block_dist_info_t));
+#else
+  CS_UNUSED(loc);
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Free cached data of a restart location.
+ *
+ * This must be called whenever the location's distribution changes.
+ *
+ * parameters:
+ *   loc <-> pointer to location structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_location_free_cache(_location_t  *loc)
+{
+#if defined(HAVE_MPI)
+  if (loc->d != NULL)
+    cs_all_to_all_destroy(&(loc->d));
+#else
+  CS_UNUSED(loc);
+#endif
+}
+
 /*----------------------------------------------------------------------------
  * Compute number of values in a record
  *
@@ -315,12 +369,96 @@ _locations_from_index(cs_restart_t  *r)
       loc->ent_global_num = NULL;
       loc->_ent_global_num = NULL;
 
+      _location_init_cache(loc);
+
       r->n_locations += 1;
     }
 
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Build a map of section names to index records for a restart file,
+ * so that sections may be found without scanning the whole index.
+ *
+ * Records sharing the same name (at different locations) are chained
+ * in index order.
+ *
+ * parameters:
+ *   r <-> associated restart file pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_section_index(cs_restart_t  *r)
+{
+  size_t index_size = cs_io_get_index_size(r->fh);
+
+  r->sec_map = cs_map_name_to_id_create();
+
+  BFT_MALLOC(r->sec_rec_id, index_size, int);
+  BFT_MALLOC(r->sec_rec_next, index_size, int);
+
+  for (size_t i = 0; i < index_size; i++) {
+    r->sec_rec_id[i] = -1;
+    r->sec_rec_next[i] = -1;
+  }
+
+  /* Loop in reverse order so that chains are built in index order */
+
+  for (size_t i = index_size; i > 0; i--) {
+    int rec_id = i-1;
+    const char *sec_name = cs_io_get_indexed_sec_name(r->fh, rec_id);
+    int sec_id = cs_map_name_to_id(r->sec_map, sec_name);
+    r->sec_rec_next[rec_id] = r->sec_rec_id[sec_id];
+    r->sec_rec_id[sec_id] = rec_id;
+  }
+
+  BFT_REALLOC(r->sec_rec_id, cs_map_name_to_id_size(r->sec_map), int);
+}
+
+/*----------------------------------------------------------------------------
+ * Find the index record matching a section name and location.
+ *
+ * parameters:
+ *   r           <-- associated restart file pointer
+ *   sec_name    <-- section name
+ *   location_id <-- required location id, or -1 for any location
+ *   name_rec_id --> first record id matching name only, or -1
+ *                   (ignored if NULL)
+ *
+ * returns:
+ *   id of matching record, or -1 if not found
+ *----------------------------------------------------------------------------*/
+
+static int
+_section_rec_id(const cs_restart_t  *r,
+                const char          *sec_name,
+                int                  location_id,
+                int                 *name_rec_id)
+{
+  int rec_id = -1;
+
+  if (r->sec_map != NULL) {
+    int sec_id = cs_map_name_to_id_try(r->sec_map, sec_name);
+    if (sec_id > -1)
+      rec_id = r->sec_rec_id[sec_id];
+  }
+
+  if (name_rec_id != NULL)
+    *name_rec_id = rec_id;
+
+  if (location_id > -1) {
+    while (rec_id > -1) {
+      cs_io_sec_header_t h = cs_io_get_indexed_sec_header(r->fh, rec_id);
+      if (h.location_id == (size_t)location_id)
+        break;
+      rec_id = r->sec_rec_next[rec_id];
+    }
+  }
+
+  return rec_id;
+}
+
 /*----------------------------------------------------------------------------
  * Initialize a checkpoint / restart file management structure;
  *
@@ -364,6 +502,7 @@ _add_file(cs_restart_t  *r)
                                           block_comm,
                                           comm);
       _locations_from_index(r);
+      _build_section_index(r);
     }
     else {
       cs_file_get_default_access(CS_FILE_MODE_WRITE, &method, &hints);
@@ -386,6 +525,7 @@ _add_file(cs_restart_t  *r)
                                           method,
                                           echo);
       _locations_from_index(r);
+      _build_section_index(r);
     }
     else {
       cs_file_get_default_access(CS_FILE_MODE_WRITE, &method);
@@ -404,39 +544,172 @@ _add_file(cs_restart_t  *r)
   _restart_n_opens[r->mode] += 1;
 }
 
-#if defined(HAVE_MPI)
+/*----------------------------------------------------------------------------
+ * Check a section to be read from a restart file.
+ *
+ * A message is logged if the section is not present or does not match
+ * the expected location, number of values, or type.
+ *
+ * parameters:
+ *   restart         <-- associated restart file pointer
+ *   sec_name        <-- section name
+ *   location_id     <-- id of corresponding location
+ *   n_ents          <-- local number of entities of location
+ *   n_location_vals <-- number of values per location (interlaced)
+ *   val_type        <-- value type
+ *
+ * returns:
+ *   id of the section's index record, or error code (CS_RESTART_ERR_xxx)
+ *----------------------------------------------------------------------------*/
+
+static int
+_check_read_section(cs_restart_t           *restart,
+                    const char             *sec_name,
+                    int                     location_id,
+                    cs_lnum_t               n_ents,
+                    int                     n_location_vals,
+                    cs_restart_val_type_t   val_type)
+{
+  /* Search for the corresponding record in the index
+     (a section of the same name may exist at different locations) */
+
+  int name_rec_id;
+  int rec_id = _section_rec_id(restart, sec_name, location_id,
+                               &name_rec_id);
+
+  /* If the record was not found */
+
+  if (name_rec_id < 0) {
+    bft_printf(_("  %s: section \"%s\" not present.\n"),
+               restart->name, sec_name);
+    return CS_RESTART_ERR_EXISTS;
+  }
+
+  /* If the location does not fit */
+
+  if (rec_id < 0) {
+    cs_io_sec_header_t header
+      = cs_io_get_indexed_sec_header(restart->fh, name_rec_id);
+    bft_printf(_("  %s: section \"%s\" at location id %d but not at %d.\n"),
+               restart->name, sec_name,
+               (int)(header.location_id), (int)location_id);
+    return CS_RESTART_ERR_LOCATION;
+  }
+
+  cs_io_sec_header_t header
+    = cs_io_get_indexed_sec_header(restart->fh, rec_id);
+
+  /* If the number of values per location does not match */
+
+  if (   header.location_id > 0
+      && header.n_location_vals != (size_t)n_location_vals) {
+    bft_printf(_("  %s: section \"%s\" has %d values per location and "
+                 " not %d.\n"),
+               restart->name, sec_name,
+               (int)header.n_location_vals, (int)n_location_vals);
+    return CS_RESTART_ERR_N_VALS;
+  }
+  else if (header.location_id == 0 && header.n_vals != n_ents) {
+    bft_printf(_("  %s: section \"%s\" has %d values and not %d.\n"),
+               restart->name, sec_name, (int)header.n_vals, (int)n_ents);
+    return CS_RESTART_ERR_N_VALS;
+  }
+
+  /* If the type of value does not match */
+
+  if (header.elt_type == CS_CHAR) {
+    if (val_type != CS_TYPE_char) {
+      bft_printf(_("  %s: section \"%s\" is not of character type.\n"),
+                 restart->name, sec_name);
+      return CS_RESTART_ERR_VAL_TYPE;
+    }
+  }
+  else if (header.elt_type == CS_INT32 || header.elt_type == CS_INT64) {
+    cs_io_set_cs_lnum(&header, restart->fh);
+    if (val_type != CS_TYPE_cs_int_t) {
+      bft_printf(_("  %s: section \"%s\" is not of integer type.\n"),
+                 restart->name, sec_name);
+      return CS_RESTART_ERR_VAL_TYPE;
+    }
+  }
+  else if (header.elt_type == CS_UINT32 || header.elt_type == CS_UINT64) {
+    if (val_type != CS_TYPE_cs_gnum_t && val_type != CS_TYPE_cs_int_t) {
+      bft_printf(_("  %s: section \"%s\" is not of global number type.\n"),
+                 restart->name, sec_name);
+      return CS_RESTART_ERR_VAL_TYPE;
+    }
+  }
+  else if (header.elt_type == CS_FLOAT || header.elt_type == CS_DOUBLE) {
+    if (val_type != CS_TYPE_cs_real_t) {
+      bft_printf(_("  %s: section \"%s\" is not of floating-point type.\n"),
+                 restart->name, sec_name);
+      return CS_RESTART_ERR_VAL_TYPE;
+    }
+  }
+
+  return rec_id;
+}
 
 /*----------------------------------------------------------------------------
- * Read variable values defined on a mesh location.
+ * Set position in a restart file to read a section, and define the
+ * associated value conversion.
  *
  * parameters:
- *   r           <-> associated restart file pointer
- *   header          <-- header associated with current position in file
- *   n_glob_ents     <-- global number of entities
- *   n_ents          <-- local number of entities
- *   ent_global_num  <-- global entity numbers (1 to n numbering)
- *   n_location_vals <-- number of values par location
- *   val_type        <-- data type
- *   vals            --> array of values
+ *   restart  <-- associated restart file pointer
+ *   rec_id   <-- id of the section's index record
+ *   val_type <-- value type
+ *   header   <-> header associated with section
  *----------------------------------------------------------------------------*/
 
 static void
-_read_ent_values(cs_restart_t           *r,
-                 cs_io_sec_header_t     *header,
-                 cs_gnum_t               n_glob_ents,
-                 cs_lnum_t               n_ents,
-                 const cs_gnum_t         ent_global_num[],
-                 int                     n_location_vals,
-                 cs_restart_val_type_t   val_type,
-                 cs_byte_t               vals[])
+_set_read_position(cs_restart_t           *restart,
+                   int                     rec_id,
+                   cs_restart_val_type_t   val_type,
+                   cs_io_sec_header_t     *header)
 {
-  cs_byte_t  *buffer = NULL;
+  cs_io_set_indexed_position(restart->fh, header, rec_id);
 
-  cs_lnum_t  block_buf_size = 0;
+  /* Now define conversion info */
 
-  size_t  nbr_byte_ent;
+  if (header->elt_type == CS_UINT32 || header->elt_type == CS_UINT64) {
+    if (val_type == CS_TYPE_cs_gnum_t)
+      cs_io_set_cs_gnum(header, restart->fh);
+    else if (val_type == CS_TYPE_cs_int_t)
+      cs_io_set_cs_lnum(header, restart->fh);
+  }
+  else if (header->elt_type == CS_FLOAT || header->elt_type == CS_DOUBLE) {
+    if (sizeof(cs_real_t) != cs_datatype_size[header->elt_type]) {
+      if (sizeof(cs_real_t) == cs_datatype_size[CS_FLOAT])
+        header->elt_type = CS_FLOAT;
+      else
+        header->elt_type = CS_DOUBLE;
+    }
+  }
+}
 
-  /* Initialization */
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Return the number of bytes per entity of values read on a mesh location,
+ * setting the matching conversion of integer values in the section header.
+ *
+ * parameters:
+ *   r               <-- associated restart file pointer
+ *   header          <-> header associated with section
+ *   n_location_vals <-- number of values par location
+ *   val_type        <-- data type
+ *
+ * returns:
+ *   number of bytes per entity
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_read_ent_size(const cs_restart_t     *r,
+               cs_io_sec_header_t     *header,
+               int                     n_location_vals,
+               cs_restart_val_type_t   val_type)
+{
+  size_t  nbr_byte_ent = 0;
 
   switch (val_type) {
   case CS_TYPE_char:
@@ -457,19 +730,85 @@ _read_ent_values(cs_restart_t           *r,
     assert(0);
   }
 
+  return nbr_byte_ent;
+}
+
+/*----------------------------------------------------------------------------
+ * Return the block to part distributor of a location for a given block
+ * distribution, reusing the cached distributor when possible.
+ *
+ * parameters:
+ *   loc <-> associated location
+ *   bi  <-- block distribution info
+ *
+ * returns:
+ *   pointer to location's block to part distributor
+ *----------------------------------------------------------------------------*/
+
+static cs_all_to_all_t *
+_location_read_distributor(_location_t           *loc,
+                           cs_block_dist_info_t   bi)
+{
+  /* Block size and rank step are the same on all ranks, so the decision
+     to reuse the cached distributor is consistent */
+
+  if (   loc->d != NULL
+      && (   loc->d_bi.block_size != bi.block_size
+          || loc->d_bi.rank_step != bi.rank_step))
+    cs_all_to_all_destroy(&(loc->d));
+
+  if (loc->d == NULL) {
+    loc->d = cs_all_to_all_create_from_block(loc->n_ents,
+                                             CS_ALL_TO_ALL_USE_DEST_ID,
+                                             loc->ent_global_num,
+                                             bi,
+                                             cs_glob_mpi_comm);
+    loc->d_bi = bi;
+  }
+
+  return loc->d;
+}
+
+/*----------------------------------------------------------------------------
+ * Read variable values defined on a mesh location.
+ *
+ * The block to part distributor is cached with the location, and reused
+ * by following reads with the same block distribution, so that the
+ * associated metadata exchange is done only once per location.
+ *
+ * parameters:
+ *   r               <-> associated restart file pointer
+ *   header          <-- header associated with current position in file
+ *   loc             <-> associated location
+ *   n_location_vals <-- number of values par location
+ *   val_type        <-- data type
+ *   vals            --> array of values
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_ent_values(cs_restart_t           *r,
+                 cs_io_sec_header_t     *header,
+                 _location_t            *loc,
+                 int                     n_location_vals,
+                 cs_restart_val_type_t   val_type,
+                 cs_byte_t               vals[])
+{
+  cs_byte_t  *buffer = NULL;
+
+  cs_lnum_t  block_buf_size = 0;
+
+  /* Initialization */
+
+  size_t  nbr_byte_ent = _read_ent_size(r, header, n_location_vals, val_type);
+
   cs_block_dist_info_t bi
     = cs_block_dist_compute_sizes(cs_glob_rank_id,
                                   cs_glob_n_ranks,
                                   r->rank_step,
                                   r->min_block_size / nbr_byte_ent,
-                                  n_glob_ents);
+                                  loc->n_glob_ents);
 
-  cs_all_to_all_t *d
-    = cs_all_to_all_create_from_block(n_ents,
-                                      CS_ALL_TO_ALL_USE_DEST_ID,
-                                      ent_global_num,
-                                      bi,
-                                      cs_glob_mpi_comm);
+  cs_all_to_all_t *d = _location_read_distributor(loc, bi);
 
   /* Read blocks */
 
@@ -496,8 +835,140 @@ _read_ent_values(cs_restart_t           *r,
   /* Free buffer */
 
   BFT_FREE(buffer);
+}
+
+/*----------------------------------------------------------------------------
+ * Read values of several sections defined on the same mesh location.
+ *
+ * The blocks of all sections are read in turn and interlaced, so that
+ * values are distributed to ranks with a single exchange.
+ *
+ * parameters:
+ *   r               <-> associated restart file pointer
+ *   n_sections      <-- number of sections
+ *   rec_id          <-- index record id of each section, or -1 to skip it
+ *   loc             <-> associated location
+ *   n_location_vals <-- number of values par location for each section
+ *   val_type        <-- data type of each section
+ *   vals            --> array of values for each section
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_ent_values_multi(cs_restart_t                 *r,
+                       int                           n_sections,
+                       const int                     rec_id[],
+                       _location_t                  *loc,
+                       const int                     n_location_vals[],
+                       const cs_restart_val_type_t   val_type[],
+                       void                         *vals[])
+{
+  size_t  *nbr_byte_ent;
+  size_t  stride = 0, max_nbr_byte_ent = 0;
+
+  BFT_MALLOC(nbr_byte_ent, n_sections, size_t);
+
+  for (int s_id = 0; s_id < n_sections; s_id++) {
+    nbr_byte_ent[s_id] = 0;
+    if (rec_id[s_id] < 0)
+      continue;
+    cs_io_sec_header_t header
+      = cs_io_get_indexed_sec_header(r->fh, rec_id[s_id]);
+    nbr_byte_ent[s_id] = _read_ent_size(r,
+                                        &header,
+                                        n_location_vals[s_id],
+                                        val_type[s_id]);
+    stride += nbr_byte_ent[s_id];
+    if (nbr_byte_ent[s_id] > max_nbr_byte_ent)
+      max_nbr_byte_ent = nbr_byte_ent[s_id];
+  }
+
+  if (stride == 0) {
+    BFT_FREE(nbr_byte_ent);
+    return;
+  }
+
+  cs_block_dist_info_t bi
+    = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                  cs_glob_n_ranks,
+                                  r->rank_step,
+                                  r->min_block_size / stride,
+                                  loc->n_glob_ents);
+
+  cs_all_to_all_t *d = _location_read_distributor(loc, bi);
+
+  /* Read blocks of each section, and interlace them */
+
+  const cs_lnum_t n_block_ents = bi.gnum_range[1] - bi.gnum_range[0];
+
+  cs_byte_t  *buffer = NULL, *block_vals = NULL, *part_vals = NULL;
+
+  BFT_MALLOC(buffer, n_block_ents*max_nbr_byte_ent, cs_byte_t);
+  BFT_MALLOC(block_vals, n_block_ents*stride, cs_byte_t);
+
+  size_t displ = 0;
+
+  for (int s_id = 0; s_id < n_sections; s_id++) {
+
+    if (rec_id[s_id] < 0)
+      continue;
+
+    const size_t n_bytes = nbr_byte_ent[s_id];
+
+    cs_io_sec_header_t header
+      = cs_io_get_indexed_sec_header(r->fh, rec_id[s_id]);
+
+    _set_read_position(r, rec_id[s_id], val_type[s_id], &header);
+    _read_ent_size(r, &header, n_location_vals[s_id], val_type[s_id]);
+
+    cs_io_read_block(&header,
+                     bi.gnum_range[0],
+                     bi.gnum_range[1],
+                     buffer,
+                     r->fh);
+
+    for (cs_lnum_t i = 0; i < n_block_ents; i++)
+      memcpy(block_vals + i*stride + displ, buffer + i*n_bytes, n_bytes);
+
+    displ += n_bytes;
+
+  }
+
+  BFT_FREE(buffer);
+
+  /* Distribute blocks on ranks */
+
+  BFT_MALLOC(part_vals, loc->n_ents*stride, cs_byte_t);
+
+  cs_all_to_all_copy_array(d,
+                           CS_CHAR,
+                           stride,
+                           true,  /* reverse */
+                           block_vals,
+                           part_vals);
+
+  BFT_FREE(block_vals);
+
+  /* Separate values of each section */
+
+  displ = 0;
+
+  for (int s_id = 0; s_id < n_sections; s_id++) {
+
+    if (rec_id[s_id] < 0)
+      continue;
 
-  cs_all_to_all_destroy(&d);
+    const size_t n_bytes = nbr_byte_ent[s_id];
+    cs_byte_t *_vals = vals[s_id];
+
+    for (cs_lnum_t i = 0; i < loc->n_ents; i++)
+      memcpy(_vals + i*n_bytes, part_vals + i*stride + displ, n_bytes);
+
+    displ += n_bytes;
+
+  }
+
+  BFT_FREE(part_vals);
+  BFT_FREE(nbr_byte_ent);
 }
 
 /*----------------------------------------------------------------------------
@@ -849,8 +1320,6 @@ _restart_section_id(cs_restart_t     *restart,
                     const char       *name,
                     const char       *postfix)
 {
-  size_t index_size = cs_io_get_index_size(restart->fh);
-
   char *_sec_name = NULL;
   const char *sec_name = name;
 
@@ -883,13 +1352,9 @@ _restart_section_id(cs_restart_t     *restart,
 
   /* Search for the record in the index */
 
-  for (rec_id = 0; rec_id < (int)index_size; rec_id++) {
-    const char * cmp_name = cs_io_get_indexed_sec_name(restart->fh, rec_id);
-    if (strcmp(cmp_name, sec_name) == 0)
-      break;
-  }
+  rec_id = _section_rec_id(restart, sec_name, -1, NULL);
 
-  if (rec_id >= (int)index_size) {
+  if (rec_id < 0) {
     bft_printf(_("  %s: section \"%s\" not present.\n"),
                restart->name, sec_name);
     rec_id = -1;
@@ -1038,13 +1503,9 @@ _check_section(cs_restart_t           *restart,
   cs_lnum_t n_ents;
   cs_gnum_t n_glob_ents;
 
-  size_t rec_id;
+  int rec_id, name_rec_id;
   cs_io_sec_header_t header;
 
-  size_t index_size = 0;
-
-  index_size = cs_io_get_index_size(restart->fh);
-
   assert(restart != NULL);
 
   /* Check associated location */
@@ -1063,41 +1524,22 @@ _check_section(cs_restart_t           *restart,
     n_ents  = (restart->location[location_id-1]).n_ents;
   }
 
-  /* Search for the corresponding record in the index */
+  /* Search for the corresponding record in the index
+     (a section of the same name may exist at different locations) */
 
-  for (rec_id = 0; rec_id < index_size; rec_id++) {
-    const char * cmp_name = cs_io_get_indexed_sec_name(restart->fh, rec_id);
-    if (strcmp(cmp_name, sec_name) == 0)
-      break;
-  }
+  rec_id = _section_rec_id(restart, sec_name, location_id, &name_rec_id);
 
   /* If the record was not found */
 
-  if (rec_id >= index_size)
+  if (name_rec_id < 0)
     return CS_RESTART_ERR_EXISTS;
 
-  /*
-    If the location does not fit: we search for a location of same
-    name with the correct location.
-  */
+  /* If the location does not fit */
 
-  header = cs_io_get_indexed_sec_header(restart->fh, rec_id);
-
-  if (header.location_id != (size_t)location_id) {
-
-    rec_id++;
-
-    while (rec_id < index_size) {
-      header = cs_io_get_indexed_sec_header(restart->fh, rec_id);
-      if (   (strcmp(header.sec_name, sec_name) == 0)
-          && (header.location_id == (size_t)location_id))
-        break;
-      rec_id++;
-    }
+  if (rec_id < 0)
+    return CS_RESTART_ERR_LOCATION;
 
-    if (rec_id >= index_size)
-      return CS_RESTART_ERR_LOCATION;
-  }
+  header = cs_io_get_indexed_sec_header(restart->fh, rec_id);
 
   /* If the number of values per location does not match */
 
@@ -1164,13 +1606,10 @@ _read_section(cs_restart_t           *restart,
 
   const cs_gnum_t  *ent_global_num;
 
-  size_t rec_id, rec_id_tmp;
+  int rec_id;
   cs_io_sec_header_t header;
 
   cs_int_t _n_location_vals = n_location_vals;
-  size_t index_size = 0;
-
-  index_size = cs_io_get_index_size(restart->fh);
 
   assert(restart != NULL);
 
@@ -1203,119 +1642,17 @@ _read_section(cs_restart_t           *restart,
     ent_global_num = (restart->location[location_id-1]).ent_global_num;
   }
 
-  /* Search for the corresponding record in the index */
-
-  for (rec_id = 0; rec_id < index_size; rec_id++) {
-    const char * cmp_name = cs_io_get_indexed_sec_name(restart->fh, rec_id);
-    if (strcmp(cmp_name, sec_name) == 0)
-      break;
-  }
-
-  /* If the record was not found */
-
-  if (rec_id >= index_size) {
-    bft_printf(_("  %s: section \"%s\" not present.\n"),
-               restart->name, sec_name);
-    return CS_RESTART_ERR_EXISTS;
-  }
-
-  /*
-    If the location does not fit: we search for a location of same
-    name with the correct location.
-  */
-
-  header = cs_io_get_indexed_sec_header(restart->fh, rec_id);
-
-  if (header.location_id != (size_t)location_id) {
-
-    rec_id_tmp = rec_id;
-    rec_id++;
-
-    while (rec_id < index_size) {
-      header = cs_io_get_indexed_sec_header(restart->fh, rec_id);
-      if (   (strcmp(header.sec_name, sec_name) == 0)
-          && (header.location_id == (size_t)location_id))
-        break;
-      rec_id++;
-    }
-
-    if (rec_id >= index_size) {
-      header = cs_io_get_indexed_sec_header(restart->fh, rec_id_tmp);
-      bft_printf(_("  %s: section \"%s\" at location id %d but not at %d.\n"),
-                 restart->name, sec_name,
-                 (int)(header.location_id), (int)location_id);
-      return CS_RESTART_ERR_LOCATION;
-    }
-  }
-
-  /* If the number of values per location does not match */
-
-  if (   header.location_id > 0
-      && header.n_location_vals != (size_t)n_location_vals) {
-    bft_printf(_("  %s: section \"%s\" has %d values per location and "
-                 " not %d.\n"),
-               restart->name, sec_name,
-               (int)header.n_location_vals, (int)n_location_vals);
-    return CS_RESTART_ERR_N_VALS;
-  }
-  else if (header.location_id == 0 && header.n_vals != n_ents) {
-    bft_printf(_("  %s: section \"%s\" has %d values and not %d.\n"),
-               restart->name, sec_name, (int)header.n_vals, (int)n_ents);
-    return CS_RESTART_ERR_N_VALS;
-  }
-
-  /* If the type of value does not match */
+  rec_id = _check_read_section(restart, sec_name, location_id, n_ents,
+                               n_location_vals, val_type);
 
-  if (header.elt_type == CS_CHAR) {
-    if (val_type != CS_TYPE_char) {
-      bft_printf(_("  %s: section \"%s\" is not of character type.\n"),
-                 restart->name, sec_name);
-      return CS_RESTART_ERR_VAL_TYPE;
-    }
-  }
-  else if (header.elt_type == CS_INT32 || header.elt_type == CS_INT64) {
-    cs_io_set_cs_lnum(&header, restart->fh);
-    if (val_type != CS_TYPE_cs_int_t) {
-      bft_printf(_("  %s: section \"%s\" is not of integer type.\n"),
-                 restart->name, sec_name);
-      return CS_RESTART_ERR_VAL_TYPE;
-    }
-  }
-  else if (header.elt_type == CS_UINT32 || header.elt_type == CS_UINT64) {
-    if (val_type != CS_TYPE_cs_gnum_t && val_type != CS_TYPE_cs_int_t) {
-      bft_printf(_("  %s: section \"%s\" is not of global number type.\n"),
-                 restart->name, sec_name);
-      return CS_RESTART_ERR_VAL_TYPE;
-    }
-  }
-  else if (header.elt_type == CS_FLOAT || header.elt_type == CS_DOUBLE) {
-    if (val_type != CS_TYPE_cs_real_t) {
-      bft_printf(_("  %s: section \"%s\" is not of floating-point type.\n"),
-                 restart->name, sec_name);
-      return CS_RESTART_ERR_VAL_TYPE;
-    }
-  }
+  if (rec_id < 0)
+    return rec_id;
 
   /* Now set position in file to read data */
 
-  cs_io_set_indexed_position(restart->fh, &header, rec_id);
-
-  /* Now define conversion info */
+  header = cs_io_get_indexed_sec_header(restart->fh, rec_id);
 
-  if (header.elt_type == CS_UINT32 || header.elt_type == CS_UINT64) {
-    if (val_type == CS_TYPE_cs_gnum_t)
-      cs_io_set_cs_gnum(&header, restart->fh);
-    else if (val_type == CS_TYPE_cs_int_t)
-      cs_io_set_cs_lnum(&header, restart->fh);
-  }
-  else if (header.elt_type == CS_FLOAT || header.elt_type == CS_DOUBLE) {
-    if (sizeof(cs_real_t) != cs_datatype_size[header.elt_type]) {
-      if (sizeof(cs_real_t) == cs_datatype_size[CS_FLOAT])
-        header.elt_type = CS_FLOAT;
-      else
-        header.elt_type = CS_DOUBLE;
-    }
-  }
+  _set_read_position(restart, rec_id, val_type, &header);
 
   /* Section contents */
   /*------------------*/
@@ -1341,9 +1678,7 @@ _read_section(cs_restart_t           *restart,
   else if (n_glob_ents > 0)
     _read_ent_values(restart,
                      &header,
-                     n_glob_ents,
-                     n_ents,
-                     ent_global_num,
+                     restart->location + location_id - 1,
                      _n_location_vals,
                      val_type,
                      (cs_byte_t *)val);
@@ -2314,6 +2649,10 @@ cs_restart_create(const char         *name,
   restart->n_locations = 0;
   restart->location = NULL;
 
+  restart->sec_map = NULL;
+  restart->sec_rec_id = NULL;
+  restart->sec_rec_next = NULL;
+
   /* Open associated file, and build an index of sections in read mode */
 
   _add_file(restart);
@@ -2372,11 +2711,19 @@ cs_restart_destroy(cs_restart_t  **restart)
     for (loc_id = 0; loc_id < r->n_locations; loc_id++) {
       BFT_FREE((r->location[loc_id]).name);
       BFT_FREE((r->location[loc_id])._ent_global_num);
+      _location_free_cache(r->location + loc_id);
     }
   }
   if (r->location != NULL)
     BFT_FREE(r->location);
 
+  /* Free section index */
+
+  if (r->sec_map != NULL)
+    cs_map_name_to_id_destroy(&(r->sec_map));
+  BFT_FREE(r->sec_rec_id);
+  BFT_FREE(r->sec_rec_next);
+
   /* Free remaining memory */
 
   BFT_FREE(r->name);
@@ -2488,6 +2835,8 @@ cs_restart_add_location(cs_restart_t     *restart,
         (restart->location[loc_id]).ent_global_num = ent_global_num;
         (restart->location[loc_id])._ent_global_num = NULL;
 
+        _location_free_cache(restart->location + loc_id);
+
         timing[1] = cs_timer_wtime();
         _restart_wtime[restart->mode] += timing[1] - timing[0];
 
@@ -2527,6 +2876,8 @@ cs_restart_add_location(cs_restart_t     *restart,
     (restart->location[restart->n_locations-1]).ent_global_num = ent_global_num;
     (restart->location[restart->n_locations-1])._ent_global_num = NULL;
 
+    _location_init_cache(restart->location + restart->n_locations-1);
+
     cs_io_write_global(location_name, 1, restart->n_locations, 0, 0,
                        gnum_type, &n_glob_ents,
                        restart->fh);
@@ -2590,6 +2941,8 @@ cs_restart_add_location_ref(const char       *location_name,
   (_location_ref[_n_locations_ref-1]).n_ents         = n_ents;
   (_location_ref[_n_locations_ref-1]).ent_global_num
     = (_location_ref[_n_locations_ref-1])._ent_global_num;
+
+  _location_init_cache(_location_ref + _n_locations_ref-1);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2604,6 +2957,7 @@ cs_restart_clear_locations_ref(void)
   for (size_t loc_id = 0; loc_id < _n_locations_ref; loc_id++) {
     BFT_FREE((_location_ref[loc_id]).name);
     BFT_FREE((_location_ref[loc_id])._ent_global_num);
+    _location_free_cache(_location_ref + loc_id);
   }
   BFT_FREE(_location_ref);
   _n_locations_ref = 0;
@@ -2850,6 +3204,125 @@ cs_restart_read_section(cs_restart_t           *restart,
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Read several sections defined on the same location from a
+ *         restart file.
+ *
+ * In parallel, the values of all sections present in the file are
+ * distributed to ranks with a single exchange instead of one exchange
+ * per section, at the cost of buffering the values of all those sections.
+ * Sections which are not present or do not match the expected number or
+ * type of values are not read, and their error code is returned as with
+ * \ref cs_restart_read_section.
+ *
+ * If the section read function has been modified using
+ * \ref cs_restart_set_read_section_func, sections are read one by one
+ * using that function.
+ *
+ * \param[in]   restart          associated restart file pointer
+ * \param[in]   n_sections       number of sections
+ * \param[in]   sec_name         name of each section
+ * \param[in]   location_id      id of corresponding location
+ * \param[in]   n_location_vals  number of values per location (interlaced)
+ *                               for each section
+ * \param[in]   val_type         value type of each section
+ * \param[out]  val              array of values of each section
+ * \param[out]  retcode          0 (CS_RESTART_SUCCESS) or error code
+ *                               (CS_RESTART_ERR_xxx) for each section
+ *
+ * \return  number of sections read
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_restart_read_sections(cs_restart_t                 *restart,
+                         int                           n_sections,
+                         const char            *const  sec_name[],
+                         int                           location_id,
+                         const int                     n_location_vals[],
+                         const cs_restart_val_type_t   val_type[],
+                         void                         *val[],
+                         int                           retcode[])
+{
+  int n_read = 0;
+
+  assert(restart != NULL);
+
+  bool multi = false;
+
+#if defined(HAVE_MPI)
+
+  /* Sections are read together only for a valid distributed location;
+     otherwise, the single section read logs any error */
+
+  if (   _read_section_f == _read_section
+      && cs_glob_n_ranks > 1
+      && location_id > 0 && location_id <= (int)(restart->n_locations)) {
+    const _location_t *loc = restart->location + location_id - 1;
+    if (loc->n_glob_ents_f == loc->n_glob_ents && loc->n_glob_ents > 0)
+      multi = true;
+  }
+
+  if (multi) {
+
+    double timing[2];
+
+    timing[0] = cs_timer_wtime();
+
+    _location_t *loc = restart->location + location_id - 1;
+
+    int *rec_id;
+    BFT_MALLOC(rec_id, n_sections, int);
+
+    for (int s_id = 0; s_id < n_sections; s_id++) {
+      rec_id[s_id] = _check_read_section(restart,
+                                         sec_name[s_id],
+                                         location_id,
+                                         loc->n_ents,
+                                         n_location_vals[s_id],
+                                         val_type[s_id]);
+      if (rec_id[s_id] < 0)
+        retcode[s_id] = rec_id[s_id];
+      else {
+        retcode[s_id] = CS_RESTART_SUCCESS;
+        n_read += 1;
+      }
+    }
+
+    _read_ent_values_multi(restart,
+                           n_sections,
+                           rec_id,
+                           loc,
+                           n_location_vals,
+                           val_type,
+                           val);
+
+    BFT_FREE(rec_id);
+
+    timing[1] = cs_timer_wtime();
+    _restart_wtime[restart->mode] += timing[1] - timing[0];
+
+  }
+
+#endif /* #if defined(HAVE_MPI) */
+
+  if (multi == false) {
+    for (int s_id = 0; s_id < n_sections; s_id++) {
+      retcode[s_id] = cs_restart_read_section(restart,
+                                              sec_name[s_id],
+                                              location_id,
+                                              n_location_vals[s_id],
+                                              val_type[s_id],
+                                              val[s_id]);
+      if (retcode[s_id] == CS_RESTART_SUCCESS)
+        n_read += 1;
+    }
+  }
+
+  return n_read;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Write a section to a restart file.
@@ -3045,6 +3518,9 @@ cs_restart_read_particles_info(cs_restart_t  *restart,
 
     BFT_FREE(b_cell_rank);
 
+    _location_free_cache(restart->location + loc_id);
+    BFT_FREE((restart->location[loc_id])._ent_global_num);
+
     (restart->location[loc_id])._ent_global_num = ent_global_num;
     (restart->location[loc_id]).ent_global_num
       = (restart->location[loc_id])._ent_global_num;
@@ -3062,6 +3538,8 @@ cs_restart_read_particles_info(cs_restart_t  *restart,
 
   if (cs_glob_n_ranks == 1) {
 
+    _location_free_cache(restart->location + loc_id);
+
     (restart->location[loc_id]).n_glob_ents = n_glob_particles;
     (restart->location[loc_id]).n_ents = n_glob_particles;
 
@@ -649,6 +649,47 @@ cs_restart_read_section(cs_restart_t           *restart,
                         cs_restart_val_type_t   val_type,
                         void                   *val);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Read several sections defined on the same location from a
+ *         restart file.
+ *
+ * In parallel, the values of all sections present in the file are
+ * distributed to ranks with a single exchange instead of one exchange
+ * per section, at the cost of buffering the values of all those sections.
+ * Sections which are not present or do not match the expected number or
+ * type of values are not read, and their error code is returned as with
+ * \ref cs_restart_read_section.
+ *
+ * If the section read function has been modified using
+ * \ref cs_restart_set_read_section_func, sections are read one by one
+ * using that function.
+ *
+ * \param[in]   restart          associated restart file pointer
+ * \param[in]   n_sections       number of sections
+ * \param[in]   sec_name         name of each section
+ * \param[in]   location_id      id of corresponding location
+ * \param[in]   n_location_vals  number of values per location (interlaced)
+ *                               for each section
+ * \param[in]   val_type         value type of each section
+ * \param[out]  val              array of values of each section
+ * \param[out]  retcode          0 (CS_RESTART_SUCCESS) or error code
+ *                               (CS_RESTART_ERR_xxx) for each section
+ *
+ * \return  number of sections read
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_restart_read_sections(cs_restart_t                 *restart,
+                         int                           n_sections,
+                         const char            *const  sec_name[],
+                         int                           location_id,
+                         const int                     n_location_vals[],
+                         const cs_restart_val_type_t   val_type[],
+                         void                         *val[],
+                         int                           retcode[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Write a section to a restart file.
@@ -52,6 +52,8 @@
 #include "fvm_nodal.h"
 #include "ple_locator.h"
 
+#include "cs_all_to_all.h"
+#include "cs_block_dist.h"
 #include "cs_io.h"
 #include "cs_coupling.h"
 #include "cs_mesh.h"
@@ -59,6 +61,7 @@
 #include "cs_mesh_location.h"
 #include "cs_mesh_quantities.h"
 #include "cs_parall.h"
+#include "cs_part_to_block.h"
 #include "cs_preprocessor_data.h"
 #include "cs_timer.h"
 #include "cs_timer_stats.h"
@@ -100,6 +103,30 @@ static cs_restart_read_section_t   *_read_section_f  = NULL;
 
 static  ple_locator_t  *_locator = NULL;  /* PLE locator for restart */
 
+/* Optional groups of restart mesh cells whose values are replaced by
+   their volume-weighted mean before mapping; group number and volume of
+   restart mesh cells are first defined in a block distribution, then
+   transferred to the distribution used for reading when the mapping
+   is built */
+
+static cs_gnum_t              _n_g_cell_groups = 0;
+static cs_block_dist_info_t   _cell_bi;
+static cs_gnum_t             *_block_cell_group = NULL;
+static cs_real_t             *_block_cell_vol = NULL;
+
+static cs_lnum_t              _n_grouped_cells = 0;
+static cs_lnum_t             *_grouped_cell_id = NULL;
+static cs_real_t             *_grouped_cell_vol = NULL;
+
+static cs_block_dist_info_t   _group_bi;
+static cs_lnum_t              _n_group_recv = 0;
+static cs_lnum_t             *_group_recv_id = NULL;
+static cs_real_t             *_group_block_vol = NULL;
+
+#if defined(HAVE_MPI)
+static cs_all_to_all_t       *_group_d = NULL;
+#endif
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -139,6 +166,241 @@ _type_size(cs_restart_val_type_t   val_type)
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Exchange values between grouped restart mesh cells and the block
+ * distribution of their groups.
+ *
+ * parameters:
+ *   stride  <-- number of values per element
+ *   reverse <-- if true, send from groups to cells
+ *   src     <-- source values
+ *   dest    --> destination values
+ *----------------------------------------------------------------------------*/
+
+static void
+_exchange_group_values(int              stride,
+                       bool             reverse,
+                       const cs_real_t  src[],
+                       cs_real_t        dest[])
+{
+#if defined(HAVE_MPI)
+  if (_group_d != NULL) {
+    cs_all_to_all_copy_array(_group_d,
+                             CS_REAL_TYPE,
+                             stride,
+                             reverse,
+                             src,
+                             dest);
+    return;
+  }
+#endif
+
+  /* Without a distributor, groups are local and in the same order */
+
+  assert(_n_group_recv == _n_grouped_cells);
+
+  if (_n_grouped_cells > 0)
+    memcpy(dest, src, _n_grouped_cells*stride*sizeof(cs_real_t));
+}
+
+/*----------------------------------------------------------------------------
+ * Prepare volume-weighted averaging of cell groups for the restart mesh
+ * read for mapping.
+ *
+ * Group numbers and volumes defined in a block distribution are transferred
+ * to the given mesh's distribution, and the exchange of values between
+ * grouped cells and the block distribution of groups is prepared.
+ *
+ * parameters:
+ *   m <-- restart mesh
+ *----------------------------------------------------------------------------*/
+
+static void
+_map_cell_groups(const cs_mesh_t  *m)
+{
+  if (_n_g_cell_groups == 0)
+    return;
+
+  const cs_lnum_t n_cells = m->n_cells;
+
+  cs_gnum_t *c_group;
+  cs_real_t *c_vol;
+  BFT_MALLOC(c_group, n_cells, cs_gnum_t);
+  BFT_MALLOC(c_vol, n_cells, cs_real_t);
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_all_to_all_t *d
+      = cs_all_to_all_create_from_block(n_cells,
+                                        CS_ALL_TO_ALL_USE_DEST_ID,
+                                        m->global_cell_num,
+                                        _cell_bi,
+                                        cs_glob_mpi_comm);
+
+    cs_all_to_all_copy_array(d, CS_GNUM_TYPE, 1, true,
+                             _block_cell_group, c_group);
+    cs_all_to_all_copy_array(d, CS_REAL_TYPE, 1, true,
+                             _block_cell_vol, c_vol);
+
+    cs_all_to_all_destroy(&d);
+  }
+#endif
+
+  if (cs_glob_n_ranks == 1) {
+    for (cs_lnum_t i = 0; i < n_cells; i++) {
+      cs_gnum_t j = (m->global_cell_num != NULL) ?
+        m->global_cell_num[i] - 1 : (cs_gnum_t)i;
+      c_group[i] = _block_cell_group[j];
+      c_vol[i] = _block_cell_vol[j];
+    }
+  }
+
+  BFT_FREE(_block_cell_group);
+  BFT_FREE(_block_cell_vol);
+
+  /* Select grouped cells */
+
+  _n_grouped_cells = 0;
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    if (c_group[i] > 0)
+      _n_grouped_cells++;
+  }
+
+  cs_gnum_t *grouped_cell_group;
+  BFT_MALLOC(grouped_cell_group, _n_grouped_cells, cs_gnum_t);
+  BFT_MALLOC(_grouped_cell_id, _n_grouped_cells, cs_lnum_t);
+  BFT_MALLOC(_grouped_cell_vol, _n_grouped_cells, cs_real_t);
+
+  _n_grouped_cells = 0;
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    if (c_group[i] > 0) {
+      grouped_cell_group[_n_grouped_cells] = c_group[i];
+      _grouped_cell_id[_n_grouped_cells] = i;
+      _grouped_cell_vol[_n_grouped_cells] = c_vol[i];
+      _n_grouped_cells++;
+    }
+  }
+
+  BFT_FREE(c_group);
+  BFT_FREE(c_vol);
+
+  /* Prepare exchange with block distribution of groups */
+
+  _group_bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                          cs_glob_n_ranks,
+                                          1,
+                                          0,
+                                          _n_g_cell_groups);
+
+  cs_gnum_t *recv_group = grouped_cell_group;
+  _n_group_recv = _n_grouped_cells;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    _group_d = cs_all_to_all_create_from_block(_n_grouped_cells,
+                                               0, /* flags */
+                                               grouped_cell_group,
+                                               _group_bi,
+                                               cs_glob_mpi_comm);
+
+    recv_group = cs_all_to_all_copy_array(_group_d,
+                                          CS_GNUM_TYPE,
+                                          1,
+                                          false, /* reverse */
+                                          grouped_cell_group,
+                                          NULL);
+
+    _n_group_recv = cs_all_to_all_n_elts_dest(_group_d);
+
+    BFT_FREE(grouped_cell_group);
+  }
+#endif
+
+  BFT_MALLOC(_group_recv_id, _n_group_recv, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < _n_group_recv; i++)
+    _group_recv_id[i] = recv_group[i] - _group_bi.gnum_range[0];
+
+  BFT_FREE(recv_group);
+
+  /* Total volume of each group */
+
+  cs_lnum_t n_block = _group_bi.gnum_range[1] - _group_bi.gnum_range[0];
+
+  cs_real_t *recv_vol;
+  BFT_MALLOC(recv_vol, _n_group_recv, cs_real_t);
+  BFT_MALLOC(_group_block_vol, n_block, cs_real_t);
+
+  _exchange_group_values(1, false, _grouped_cell_vol, recv_vol);
+
+  for (cs_lnum_t i = 0; i < n_block; i++)
+    _group_block_vol[i] = 0;
+
+  for (cs_lnum_t i = 0; i < _n_group_recv; i++)
+    _group_block_vol[_group_recv_id[i]] += recv_vol[i];
+
+  BFT_FREE(recv_vol);
+}
+
+/*----------------------------------------------------------------------------
+ * Replace values of grouped restart mesh cells by the volume-weighted
+ * mean of their group.
+ *
+ * parameters:
+ *   stride <-- number of values per cell
+ *   vals   <-> cell values
+ *----------------------------------------------------------------------------*/
+
+static void
+_average_cell_groups(int        stride,
+                     cs_real_t  vals[])
+{
+  const cs_lnum_t n_block = _group_bi.gnum_range[1] - _group_bi.gnum_range[0];
+
+  cs_real_t *send_buf, *recv_buf, *block_sum;
+  BFT_MALLOC(send_buf, _n_grouped_cells*stride, cs_real_t);
+  BFT_MALLOC(recv_buf, _n_group_recv*stride, cs_real_t);
+  BFT_MALLOC(block_sum, n_block*stride, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < _n_grouped_cells; i++) {
+    const cs_real_t *v = vals + _grouped_cell_id[i]*stride;
+    for (int k = 0; k < stride; k++)
+      send_buf[i*stride + k] = _grouped_cell_vol[i] * v[k];
+  }
+
+  _exchange_group_values(stride, false, send_buf, recv_buf);
+
+  for (cs_lnum_t i = 0; i < n_block*stride; i++)
+    block_sum[i] = 0;
+
+  for (cs_lnum_t i = 0; i < _n_group_recv; i++) {
+    cs_lnum_t j = _group_recv_id[i];
+    for (int k = 0; k < stride; k++)
+      block_sum[j*stride + k] += recv_buf[i*stride + k];
+  }
+
+  for (cs_lnum_t i = 0; i < _n_group_recv; i++) {
+    cs_lnum_t j = _group_recv_id[i];
+    cs_real_t vol = _group_block_vol[j];
+    for (int k = 0; k < stride; k++)
+      recv_buf[i*stride + k] = (vol > 0) ? block_sum[j*stride + k] / vol : 0;
+  }
+
+  BFT_FREE(block_sum);
+
+  _exchange_group_values(stride, true, recv_buf, send_buf);
+
+  BFT_FREE(recv_buf);
+
+  for (cs_lnum_t i = 0; i < _n_grouped_cells; i++) {
+    cs_real_t *v = vals + _grouped_cell_id[i]*stride;
+    for (int k = 0; k < stride; k++)
+      v[k] = send_buf[i*stride + k];
+  }
+
+  BFT_FREE(send_buf);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Use P0 interpolation (projection) from source to destination
@@ -253,6 +515,10 @@ _read_section_interpolate(cs_restart_t           *restart,
                              val_type,
                              read_buffer);
 
+    if (retval == CS_RESTART_SUCCESS && val_type == CS_TYPE_cs_real_t
+        && _n_g_cell_groups > 0)
+      _average_cell_groups(n_location_vals, (cs_real_t *)read_buffer);
+
     if (retval == CS_RESTART_SUCCESS)
       _interpolate_p0(_locator,
                       n_location_vals,
@@ -311,6 +577,83 @@ cs_restart_map_set_options(float  tolerance_base,
   _tolerance[1] = tolerance_fraction;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define groups of restart mesh cells whose values are replaced
+ *         by their volume-weighted mean before mapping.
+ *
+ * This is used for cells merged by coarsening, so that the merged cell
+ * receives the volume-weighted average of the values of its former
+ * cells, rather than the value of the cell containing its center.
+ *
+ * \param[in]  n_g_cells   global number of restart mesh cells
+ * \param[in]  n_cells     local number of restart mesh cells
+ * \param[in]  cell_gnum   global number of local cells, or NULL
+ *                         (if identical to local cell id + 1)
+ * \param[in]  cell_group  global group number of local cells
+ *                         (1 to n), or 0 for cells not in a group
+ * \param[in]  cell_vol    volume of local cells
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_map_set_cell_groups(cs_gnum_t        n_g_cells,
+                               cs_lnum_t        n_cells,
+                               const cs_gnum_t  cell_gnum[],
+                               const cs_gnum_t  cell_group[],
+                               const cs_real_t  cell_vol[])
+{
+  BFT_FREE(_block_cell_group);
+  BFT_FREE(_block_cell_vol);
+
+  _n_g_cell_groups = 0;
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    if (cell_group[i] > _n_g_cell_groups)
+      _n_g_cell_groups = cell_group[i];
+  }
+
+  cs_parall_max(1, CS_GNUM_TYPE, &_n_g_cell_groups);
+
+  if (_n_g_cell_groups == 0)
+    return;
+
+  _cell_bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                         cs_glob_n_ranks,
+                                         1,
+                                         0,
+                                         n_g_cells);
+
+  cs_lnum_t n_block = _cell_bi.gnum_range[1] - _cell_bi.gnum_range[0];
+
+  BFT_MALLOC(_block_cell_group, n_block, cs_gnum_t);
+  BFT_MALLOC(_block_cell_vol, n_block, cs_real_t);
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_part_to_block_t *d
+      = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm,
+                                        _cell_bi,
+                                        n_cells,
+                                        cell_gnum);
+
+    cs_part_to_block_copy_array(d, CS_GNUM_TYPE, 1,
+                                cell_group, _block_cell_group);
+    cs_part_to_block_copy_array(d, CS_REAL_TYPE, 1,
+                                cell_vol, _block_cell_vol);
+
+    cs_part_to_block_destroy(&d);
+  }
+#endif
+
+  if (cs_glob_n_ranks == 1) {
+    for (cs_lnum_t i = 0; i < n_cells; i++) {
+      cs_gnum_t j = (cell_gnum != NULL) ? cell_gnum[i] - 1 : (cs_gnum_t)i;
+      _block_cell_group[j] = cell_group[i];
+      _block_cell_vol[j] = cell_vol[i];
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Build mapping of restart files to different mesh if defined.
@@ -369,6 +712,10 @@ cs_restart_map_build(void)
                                 m->n_g_vertices, m->n_vertices,
                                 m->global_vtx_num);
 
+    /* Prepare averaging of grouped cells */
+
+    _map_cell_groups(m);
+
     /* Build FVM mesh from previous mesh */
 
     nm = cs_mesh_connect_cells_to_nodal(m,
@@ -487,6 +834,24 @@ cs_restart_map_free(void)
 
 
   _locator = ple_locator_destroy(_locator);
+
+  /* Free cell groups */
+
+  _n_g_cell_groups = 0;
+  _n_grouped_cells = 0;
+  _n_group_recv = 0;
+
+  BFT_FREE(_block_cell_group);
+  BFT_FREE(_block_cell_vol);
+  BFT_FREE(_grouped_cell_id);
+  BFT_FREE(_grouped_cell_vol);
+  BFT_FREE(_group_recv_id);
+  BFT_FREE(_group_block_vol);
+
+#if defined(HAVE_MPI)
+  if (_group_d != NULL)
+    cs_all_to_all_destroy(&_group_d);
+#endif
 }
 
 /*----------------------------------------------------------------------------*/
@@ -87,6 +87,32 @@ void
 cs_restart_map_set_options(float  tolerance_base,
                            float  tolerance_fraction);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define groups of restart mesh cells whose values are replaced
+ *         by their volume-weighted mean before mapping.
+ *
+ * This is used for cells merged by coarsening, so that the merged cell
+ * receives the volume-weighted average of the values of its former
+ * cells, rather than the value of the cell containing its center.
+ *
+ * \param[in]  n_g_cells   global number of restart mesh cells
+ * \param[in]  n_cells     local number of restart mesh cells
+ * \param[in]  cell_gnum   global number of local cells, or NULL
+ *                         (if identical to local cell id + 1)
+ * \param[in]  cell_group  global group number of local cells
+ *                         (1 to n), or 0 for cells not in a group
+ * \param[in]  cell_vol    volume of local cells
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_map_set_cell_groups(cs_gnum_t        n_g_cells,
+                               cs_lnum_t        n_cells,
+                               const cs_gnum_t  cell_gnum[],
+                               const cs_gnum_t  cell_group[],
+                               const cs_real_t  cell_vol[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Build mapping of restart files to different mesh if defined.
@@ -52,6 +52,14 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*=============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Minimum array size above which radix sort is used instead of heap sort */
+
+#define CS_SORT_RADIX_MIN  2048
+
 /*============================================================================
  * Local structure definitions
  *============================================================================*/
@@ -573,9 +581,147 @@ cs_sort_coupled_gnum_shell(cs_lnum_t   l,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Sort an array of global numbers, and apply the sort to an optional
+ * associated array of ids, using a least significant digit radix sort.
+ *
+ * The sort is stable, so elements with equal keys keep their relative
+ * positions, and its result does not depend on the number of threads.
+ * Only the bytes for which keys differ are considered, so the number of
+ * passes depends on the range of the keys.
+ *
+ * parameters:
+ *   n_elts <-- number of elements considered
+ *   keys   <-> array of keys to sort
+ *   ids    <-> associated ids, or NULL
+ *----------------------------------------------------------------------------*/
+
+void
+cs_sort_gnum_radix(cs_lnum_t  n_elts,
+                   cs_gnum_t  keys[],
+                   cs_lnum_t  ids[])
+{
+  if (n_elts < 2)
+    return;
+
+  /* Determine which bytes vary among keys */
+
+  const cs_gnum_t k_0 = keys[0];
+  cs_gnum_t k_diff = 0;
+
+# pragma omp parallel for reduction(|:k_diff) if(n_elts > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_elts; i++)
+    k_diff |= (keys[i] ^ k_0);
+
+  if (k_diff == 0)
+    return;
+
+  int n_threads = 1;
+#if defined(HAVE_OPENMP)
+  if (n_elts > CS_THR_MIN)
+    n_threads = omp_get_max_threads();
+#endif
+
+  cs_gnum_t *k_tmp;
+  cs_lnum_t *i_tmp = NULL;
+  cs_lnum_t *count;
+
+  BFT_MALLOC(k_tmp, n_elts, cs_gnum_t);
+  if (ids != NULL)
+    BFT_MALLOC(i_tmp, n_elts, cs_lnum_t);
+  BFT_MALLOC(count, n_threads*256, cs_lnum_t);
+
+  cs_gnum_t *k_src = keys, *k_dest = k_tmp;
+  cs_lnum_t *i_src = ids, *i_dest = i_tmp;
+
+  for (size_t b_id = 0; b_id < sizeof(cs_gnum_t); b_id++) {
+
+    const int shift = 8*b_id;
+
+    if (((k_diff >> shift) & 0xff) == 0)
+      continue;
+
+#   pragma omp parallel num_threads(n_threads)
+    {
+      int t_id = 0, n_t = 1;
+#if defined(HAVE_OPENMP)
+      t_id = omp_get_thread_num();
+      n_t = omp_get_num_threads();
+#endif
+      cs_lnum_t t_n = (n_elts + n_t - 1) / n_t;
+      cs_lnum_t s_id = CS_MIN(t_id*t_n, n_elts);
+      cs_lnum_t e_id = CS_MIN((t_id+1)*t_n, n_elts);
+
+      cs_lnum_t *_count = count + t_id*256;
+
+      for (int j = 0; j < 256; j++)
+        _count[j] = 0;
+
+      for (cs_lnum_t i = s_id; i < e_id; i++)
+        _count[(k_src[i] >> shift) & 0xff] += 1;
+
+#     pragma omp barrier
+#     pragma omp single
+      {
+        /* Threads' shares of each digit are placed in thread order,
+           which ensures the sort is stable */
+
+        cs_lnum_t n_prev = 0;
+        for (int j = 0; j < 256; j++) {
+          for (int t = 0; t < n_t; t++) {
+            cs_lnum_t n_cur = count[t*256 + j];
+            count[t*256 + j] = n_prev;
+            n_prev += n_cur;
+          }
+        }
+      }
+
+      if (i_src != NULL) {
+        for (cs_lnum_t i = s_id; i < e_id; i++) {
+          cs_lnum_t j = _count[(k_src[i] >> shift) & 0xff]++;
+          k_dest[j] = k_src[i];
+          i_dest[j] = i_src[i];
+        }
+      }
+      else {
+        for (cs_lnum_t i = s_id; i < e_id; i++) {
+          cs_lnum_t j = _count[(k_src[i] >> shift) & 0xff]++;
+          k_dest[j] = k_src[i];
+        }
+      }
+    }
+
+    cs_gnum_t *k_swap = k_src;
+    k_src = k_dest;
+    k_dest = k_swap;
+
+    cs_lnum_t *i_swap = i_src;
+    i_src = i_dest;
+    i_dest = i_swap;
+
+  }
+
+  if (k_src != keys) {
+#   pragma omp parallel for if(n_elts > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      keys[i] = k_src[i];
+    if (ids != NULL) {
+#     pragma omp parallel for if(n_elts > CS_THR_MIN)
+      for (cs_lnum_t i = 0; i < n_elts; i++)
+        ids[i] = i_src[i];
+    }
+  }
+
+  BFT_FREE(count);
+  BFT_FREE(i_tmp);
+  BFT_FREE(k_tmp);
+}
+
 /*----------------------------------------------------------------------------
  * Order an array of local numbers.
  *
+ * Radix sort is used for large arrays.
+ *
  * parameters:
  *   number   <-> array of numbers to sort
  *   n_elts   <-- number of elements considered
@@ -592,9 +738,36 @@ cs_sort_lnum(cs_lnum_t  number[],
   if (n_elts < 2)
     return;
 
+  /* Use radix sort for large arrays, on keys shifted by the
+     minimum value (using unsigned arithmetic, which cannot overflow) */
+
+  if (n_elts > CS_SORT_RADIX_MIN) {
+
+    const cs_lnum_t _n_elts = n_elts;
+    cs_lnum_t n_min = number[0];
+    for (cs_lnum_t i = 1; i < _n_elts; i++)
+      n_min = CS_MIN(n_min, number[i]);
+
+    cs_gnum_t *keys;
+    BFT_MALLOC(keys, n_elts, cs_gnum_t);
+
+#   pragma omp parallel for if(_n_elts > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < _n_elts; i++)
+      keys[i] = (cs_gnum_t)number[i] - (cs_gnum_t)n_min;
+
+    cs_sort_gnum_radix(_n_elts, keys, NULL);
+
+#   pragma omp parallel for if(_n_elts > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < _n_elts; i++)
+      number[i] = n_min + (cs_lnum_t)keys[i];
+
+    BFT_FREE(keys);
+
+  }
+
   /* Use shell sort for short arrays */
 
-  if (n_elts < 50) {
+  else if (n_elts < 50) {
 
     size_t inc;
 
@@ -744,9 +917,14 @@ cs_sort_and_compact_gnum(cs_lnum_t  n_elts,
   if (no_need)
     return n_elts;
 
+  /* Use radix sort for large arrays */
+
+  if (n_elts > CS_SORT_RADIX_MIN)
+    cs_sort_gnum_radix(n_elts, elts, NULL);
+
   /* Use shell sort for short arrays */
 
-  if (n_elts < 50) {
+  else if (n_elts < 50) {
 
     cs_lnum_t inc;
 
@@ -842,9 +1020,48 @@ cs_sort_and_compact_gnum_2(cs_lnum_t  n_elts,
   if (no_need)
     return n_elts;
 
+  /* Use radix sort for large arrays, first on the second value of each
+     couple, then on the first (the sort being stable) */
+
+  if (n_elts > CS_SORT_RADIX_MIN) {
+
+    cs_gnum_t *keys;
+    cs_lnum_t *ids;
+    BFT_MALLOC(keys, n_elts*2, cs_gnum_t);
+    BFT_MALLOC(ids, n_elts, cs_lnum_t);
+
+#   pragma omp parallel for if(n_elts > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_elts; i++) {
+      keys[i] = elts[i*2+1];
+      ids[i] = i;
+    }
+
+    cs_sort_gnum_radix(n_elts, keys, ids);
+
+#   pragma omp parallel for if(n_elts > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      keys[i] = elts[ids[i]*2];
+
+    cs_sort_gnum_radix(n_elts, keys, ids);
+
+#   pragma omp parallel for if(n_elts > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      keys[n_elts + i] = elts[ids[i]*2 + 1];
+
+#   pragma omp parallel for if(n_elts > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_elts; i++) {
+      elts[i*2] = keys[i];
+      elts[i*2+1] = keys[n_elts + i];
+    }
+
+    BFT_FREE(ids);
+    BFT_FREE(keys);
+
+  }
+
   /* Use shell sort for short arrays */
 
-  if (n_elts < 50) {
+  else if (n_elts < 50) {
 
     cs_lnum_t inc;
 
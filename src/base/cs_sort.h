@@ -175,9 +175,31 @@ cs_sort_coupled_gnum_shell(cs_lnum_t  l,
                            cs_gnum_t  a[],
                            cs_gnum_t  b[]);
 
+/*----------------------------------------------------------------------------
+ * Sort an array of global numbers, and apply the sort to an optional
+ * associated array of ids, using a least significant digit radix sort.
+ *
+ * The sort is stable, so elements with equal keys keep their relative
+ * positions, and its result does not depend on the number of threads.
+ * Only the bytes for which keys differ are considered, so the number of
+ * passes depends on the range of the keys.
+ *
+ * parameters:
+ *   n_elts <-- number of elements considered
+ *   keys   <-> array of keys to sort
+ *   ids    <-> associated ids, or NULL
+ *----------------------------------------------------------------------------*/
+
+void
+cs_sort_gnum_radix(cs_lnum_t  n_elts,
+                   cs_gnum_t  keys[],
+                   cs_lnum_t  ids[]);
+
 /*----------------------------------------------------------------------------
  * Order an array of local numbers.
  *
+ * Radix sort is used for large arrays.
+ *
  * parameters:
  *   number   <-> array of numbers to sort
  *   n_elts   <-- number of elements considered
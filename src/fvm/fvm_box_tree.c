@@ -1667,179 +1667,144 @@ _build_rank_to_box_list(const fvm_box_tree_t  *bt,
 #endif /* defined(HAVE_MPI) */
 
 /*----------------------------------------------------------------------------
- * Recursively build an index on boxes which intersect.
+ * Recursively build the list of leaf ids of a tree.
  *
  * parameters:
- *   bt      <-> pointer to fvm_box_tree_t structure.
- *   boxes   <-- pointer to associated boxes structure
- *   node_id <-- id of the current node (to traverse)
- *   count   <-> intersection count
+ *   bt       <-- pointer to fvm_box_tree_t structure.
+ *   node_id  <-- id of the current node (to traverse)
+ *   n_leaves <-> number of leaves
+ *   leaf_ids <-> ids of leaf nodes
  *----------------------------------------------------------------------------*/
 
 static void
-_count_intersections(const fvm_box_tree_t  *bt,
-                     const fvm_box_set_t   *boxes,
-                     cs_lnum_t              node_id,
-                     cs_lnum_t              count[])
+_get_leaf_ids(const fvm_box_tree_t  *bt,
+              cs_lnum_t              node_id,
+              cs_lnum_t             *n_leaves,
+              cs_lnum_t              leaf_ids[])
 {
-  cs_lnum_t   i, j;
-
-  const cs_coord_t  *box_extents = boxes->extents;
   const _node_t  *node = bt->nodes + node_id;
 
   if (node->is_leaf == false) {
-
-    for (i = 0; i < bt->n_children; i++) /* traverse downwards */
-      _count_intersections(bt,
-                           boxes,
-                           bt->child_ids[bt->n_children*node_id + i],
-                           count);
+    for (int i = 0; i < bt->n_children; i++) /* traverse downwards */
+      _get_leaf_ids(bt,
+                    bt->child_ids[bt->n_children*node_id + i],
+                    n_leaves,
+                    leaf_ids);
   }
-  else { /* node is a leaf */
-
-    if (boxes->dim == 3) {
-
-      for (i = 0; i < node->n_boxes - 1; i++) {
-        for (j = i+1; j < node->n_boxes; j++) {
-          cs_lnum_t   id0 = bt->box_ids[node->start_id + i];
-          cs_lnum_t   id1 = bt->box_ids[node->start_id + j];
-          if (_boxes_intersect_3d(box_extents, id0, id1)) {
-            count[id0] += 1;
-            count[id1] += 1;
-          }
-
-        }
-      }
-    }
-
-    else if (boxes->dim == 2) {
-
-      for (i = 0; i < node->n_boxes - 1; i++) {
-        for (j = i+1; j < node->n_boxes; j++) {
-          cs_lnum_t   id0 = bt->box_ids[node->start_id + i];
-          cs_lnum_t   id1 = bt->box_ids[node->start_id + j];
-          if (_boxes_intersect_2d(box_extents, id0, id1)) {
-            count[id0] += 1;
-            count[id1] += 1;
-          }
-
-        }
-      }
-    }
+  else {
+    leaf_ids[*n_leaves] = node_id;
+    *n_leaves += 1;
+  }
+}
 
-    else if (boxes->dim == 1) {
+/*----------------------------------------------------------------------------
+ * Build an index on boxes which intersect.
+ *
+ * Leaves are handled in parallel when multiple threads are available.
+ *
+ * parameters:
+ *   bt       <-- pointer to fvm_box_tree_t structure.
+ *   boxes    <-- pointer to associated boxes structure
+ *   n_leaves <-- number of leaves
+ *   leaf_ids <-- ids of leaf nodes
+ *   count    <-> intersection count
+ *----------------------------------------------------------------------------*/
 
-      for (i = 0; i < node->n_boxes - 1; i++) {
-        for (j = i+1; j < node->n_boxes; j++) {
-          cs_lnum_t   id0 = bt->box_ids[node->start_id + i];
-          cs_lnum_t   id1 = bt->box_ids[node->start_id + j];
-          if (_boxes_intersect_1d(box_extents, id0, id1)) {
-            count[id0] += 1;
-            count[id1] += 1;
-          }
+static void
+_count_intersections(const fvm_box_tree_t  *bt,
+                     const fvm_box_set_t   *boxes,
+                     cs_lnum_t              n_leaves,
+                     const cs_lnum_t        leaf_ids[],
+                     cs_lnum_t              count[])
+{
+  const cs_coord_t  *box_extents = boxes->extents;
 
+  bool (*_boxes_intersect)(const cs_coord_t *, cs_lnum_t, cs_lnum_t)
+    = _boxes_intersect_3d;
+  if (boxes->dim == 2)
+    _boxes_intersect = _boxes_intersect_2d;
+  else if (boxes->dim == 1)
+    _boxes_intersect = _boxes_intersect_1d;
+
+# pragma omp parallel for schedule(dynamic) if (n_leaves > CS_THR_MIN)
+  for (cs_lnum_t l_id = 0; l_id < n_leaves; l_id++) {
+
+    const _node_t  *node = bt->nodes + leaf_ids[l_id];
+
+    for (cs_lnum_t i = 0; i < node->n_boxes - 1; i++) {
+      for (cs_lnum_t j = i+1; j < node->n_boxes; j++) {
+        cs_lnum_t   id0 = bt->box_ids[node->start_id + i];
+        cs_lnum_t   id1 = bt->box_ids[node->start_id + j];
+        if (_boxes_intersect(box_extents, id0, id1)) {
+#         pragma omp atomic
+          count[id0] += 1;
+#         pragma omp atomic
+          count[id1] += 1;
         }
       }
     }
 
   }
-
 }
 
 /*----------------------------------------------------------------------------
- * Recursively build a list on bounding boxes which intersect together.
+ * Build a list on bounding boxes which intersect together.
+ *
+ * Leaves are handled in parallel when multiple threads are available,
+ * in which case the order of intersecting boxes relative to a given box
+ * is not deterministic.
  *
  * parameters:
- *   bt        <-> pointer to fvm_box_tree_t structure.
+ *   bt        <-- pointer to fvm_box_tree_t structure.
  *   boxes     <-- pointer to associated boxes structure
- *   node_id   <-- id of the current node (to traverse)
- *   count     <-> intersection count (workin array)
- *   index     <-- index on intersections
+ *   n_leaves  <-- number of leaves
+ *   leaf_ids  <-- ids of leaf nodes
+ *   count     <-> intersection count (working array)
+ *   box_index <-- index on intersections
  *   box_g_num <-> global number of intersection boxes
  *----------------------------------------------------------------------------*/
 
 static void
 _get_intersections(const fvm_box_tree_t  *bt,
                    const fvm_box_set_t   *boxes,
-                   cs_lnum_t              node_id,
+                   cs_lnum_t              n_leaves,
+                   const cs_lnum_t        leaf_ids[],
                    cs_lnum_t              count[],
                    cs_lnum_t              box_index[],
                    cs_gnum_t              box_g_num[])
 {
-  int  i, j;
-
   const cs_coord_t  *box_extents = boxes->extents;
-  const _node_t  *node = bt->nodes + node_id;
-
-  if (node->is_leaf == false) {
 
-    for (i = 0; i < bt->n_children; i++) /* traverse downwards */
-      _get_intersections(bt,
-                         boxes,
-                         bt->child_ids[bt->n_children*node_id + i],
-                         count,
-                         box_index,
-                         box_g_num);
-  }
-  else { /* node is a leaf */
-
-    if (boxes->dim == 3) {
-
-      for (i = 0; i < node->n_boxes - 1; i++) {
-        for (j = i+1; j < node->n_boxes; j++) {
-          cs_lnum_t   id0 = bt->box_ids[node->start_id + i];
-          cs_lnum_t   id1 = bt->box_ids[node->start_id + j];
-
-          if (_boxes_intersect_3d(box_extents, id0, id1)) {
-            cs_lnum_t   shift0 = box_index[id0] + count[id0];
-            cs_lnum_t   shift1 = box_index[id1] + count[id1];
-            box_g_num[shift0] = boxes->g_num[id1];
-            box_g_num[shift1] = boxes->g_num[id0];
-            count[id0] += 1;
-            count[id1] += 1;
-          }
-        }
-      }
-    }
-    else if (boxes->dim == 2) {
-
-      for (i = 0; i < node->n_boxes - 1; i++) {
-        for (j = i+1; j < node->n_boxes; j++) {
-          cs_lnum_t   id0 = bt->box_ids[node->start_id + i];
-          cs_lnum_t   id1 = bt->box_ids[node->start_id + j];
-
-          if (_boxes_intersect_2d(box_extents, id0, id1)) {
-            cs_lnum_t   shift0 = box_index[id0] + count[id0];
-            cs_lnum_t   shift1 = box_index[id1] + count[id1];
-            box_g_num[shift0] = boxes->g_num[id1];
-            box_g_num[shift1] = boxes->g_num[id0];
-            count[id0] += 1;
-            count[id1] += 1;
-          }
+  bool (*_boxes_intersect)(const cs_coord_t *, cs_lnum_t, cs_lnum_t)
+    = _boxes_intersect_3d;
+  if (boxes->dim == 2)
+    _boxes_intersect = _boxes_intersect_2d;
+  else if (boxes->dim == 1)
+    _boxes_intersect = _boxes_intersect_1d;
+
+# pragma omp parallel for schedule(dynamic) if (n_leaves > CS_THR_MIN)
+  for (cs_lnum_t l_id = 0; l_id < n_leaves; l_id++) {
+
+    const _node_t  *node = bt->nodes + leaf_ids[l_id];
+
+    for (cs_lnum_t i = 0; i < node->n_boxes - 1; i++) {
+      for (cs_lnum_t j = i+1; j < node->n_boxes; j++) {
+        cs_lnum_t   id0 = bt->box_ids[node->start_id + i];
+        cs_lnum_t   id1 = bt->box_ids[node->start_id + j];
+
+        if (_boxes_intersect(box_extents, id0, id1)) {
+          cs_lnum_t   shift0, shift1;
+#         pragma omp atomic capture
+          shift0 = count[id0]++;
+#         pragma omp atomic capture
+          shift1 = count[id1]++;
+          box_g_num[box_index[id0] + shift0] = boxes->g_num[id1];
+          box_g_num[box_index[id1] + shift1] = boxes->g_num[id0];
         }
       }
     }
 
-    else if (boxes->dim == 1) {
-
-      for (i = 0; i < node->n_boxes - 1; i++) {
-        for (j = i+1; j < node->n_boxes; j++) {
-          cs_lnum_t   id0 = bt->box_ids[node->start_id + i];
-          cs_lnum_t   id1 = bt->box_ids[node->start_id + j];
-
-          if (_boxes_intersect_1d(box_extents, id0, id1)) {
-            cs_lnum_t   shift0 = box_index[id0] + count[id0];
-            cs_lnum_t   shift1 = box_index[id1] + count[id1];
-            box_g_num[shift0] = boxes->g_num[id1];
-            box_g_num[shift1] = boxes->g_num[id0];
-            count[id0] += 1;
-            count[id1] += 1;
-          }
-        }
-      }
-    }
-
-  } /* End if node is a leaf */
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -2334,6 +2299,10 @@ fvm_box_tree_get_distrib(fvm_box_tree_t        *bt,
  * relative to boxes intersecting box i of the boxes set, while
  * box_g_num contains the global numbers associated with those boxes.
  *
+ * Tree leaves are queried in parallel when multiple threads are available,
+ * so the order of global numbers relative to a given box is not
+ * guaranteed.
+ *
  * parameters:
  *   bt        <-- pointer to box tree structure to query
  *   boxes     <-- pointer to a associated box set
@@ -2349,10 +2318,22 @@ fvm_box_tree_get_intersects(fvm_box_tree_t       *bt,
 {
   cs_lnum_t  i, list_size;
 
+  cs_lnum_t  n_leaves = 0;
+  cs_lnum_t  *leaf_ids = NULL;
   cs_lnum_t  *counter = NULL;
   cs_lnum_t  *_index = NULL;
   cs_gnum_t  *_g_num = NULL;
 
+  /* List leaves */
+
+  BFT_MALLOC(leaf_ids, bt->n_nodes, cs_lnum_t);
+
+  if (bt->n_nodes > 0)
+    _get_leaf_ids(bt,
+                  0, /* start from root */
+                  &n_leaves,
+                  leaf_ids);
+
   /* Build index */
 
   BFT_MALLOC(_index, boxes->n_boxes + 1, cs_lnum_t);
@@ -2362,7 +2343,8 @@ fvm_box_tree_get_intersects(fvm_box_tree_t       *bt,
 
   _count_intersections(bt,
                        boxes,
-                       0, /* start from root */
+                       n_leaves,
+                       leaf_ids,
                        _index + 1);
 
   /* Build index from counts */
@@ -2383,12 +2365,14 @@ fvm_box_tree_get_intersects(fvm_box_tree_t       *bt,
 
   _get_intersections(bt,
                      boxes,
-                     0, /* start from root */
+                     n_leaves,
+                     leaf_ids,
                      counter,
                      _index,
                      _g_num);
 
   BFT_FREE(counter);
+  BFT_FREE(leaf_ids);
 
   /* Return pointers */
 
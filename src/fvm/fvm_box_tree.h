@@ -162,6 +162,10 @@ fvm_box_tree_get_distrib(fvm_box_tree_t        *bt,
  * relative to boxes intersecting box i of the boxes set, while
  * box_g_num contains the global numbers associated with those boxes.
  *
+ * Tree leaves are queried in parallel when multiple threads are available,
+ * so the order of global numbers relative to a given box is not
+ * guaranteed.
+ *
  * parameters:
  *   bt        <-- pointer to box tree structure to query
  *   boxes     <-- pointer to a associated box set
@@ -94,6 +94,9 @@ typedef struct {
   bool         divide_polygons;    /* Option to tesselate polygonal elements */
   bool         divide_polyhedra;   /* Option to tesselate polyhedral elements */
 
+  bool         rank_order;         /* Option to write entities in rank order,
+                                      with no redistribution to blocks */
+
   fvm_to_ensight_case_t  *case_info;  /* Associated case structure */
 
 #if defined(HAVE_MPI)
@@ -2332,6 +2335,660 @@ _export_nodal_strided_g(const fvm_to_ensight_writer_t  *w,
 
 #endif /* defined(HAVE_MPI) */
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Compute the global range of local entities when writing in rank order.
+ *
+ * In this mode, entities are not redistributed to blocks based on their
+ * global numbering, but written in local order, at offsets determined by
+ * the cumulative count of entities on preceding ranks.
+ *
+ * parameters:
+ *   w       <-- pointer to writer structure
+ *   n_local <-- local number of entities
+ *   range   --> global numbers of first and past-the-last local entities
+ *
+ * returns:
+ *   total number of entities over all ranks
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_rank_order_range(const fvm_to_ensight_writer_t  *w,
+                  cs_lnum_t                       n_local,
+                  cs_gnum_t                       range[2])
+{
+  cs_gnum_t n = n_local, n_end = 0;
+
+  MPI_Scan(&n, &n_end, 1, CS_MPI_GNUM, MPI_SUM, w->comm);
+
+  range[0] = n_end - n + 1;
+  range[1] = n_end + 1;
+
+  MPI_Bcast(&n_end, 1, CS_MPI_GNUM, w->n_ranks - 1, w->comm);
+
+  return n_end;
+}
+
+/*----------------------------------------------------------------------------
+ * Write vertex coordinates to an EnSight Gold file in rank order.
+ *
+ * Vertices shared by several ranks are written once per rank.
+ *
+ * parameters:
+ *   w    <-- pointer to associated writer
+ *   mesh <-- pointer to nodal mesh structure
+ *   f    <-- associated file handle
+ *
+ * returns:
+ *   number of vertices written by preceding ranks
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_export_vertex_coords_r(const fvm_to_ensight_writer_t  *w,
+                        const fvm_nodal_t              *mesh,
+                        _ensight_file_t                 f)
+{
+  cs_gnum_t  range[2];
+  float  *coords = NULL;
+
+  const cs_lnum_t    n_vertices = mesh->n_vertices;
+  const cs_coord_t  *vertex_coords = mesh->vertex_coords;
+  const cs_lnum_t   *parent_vertex_num = mesh->parent_vertex_num;
+
+  const size_t  stride = (size_t)(mesh->dim);
+
+  cs_gnum_t n_g_vertices = _rank_order_range(w, n_vertices, range);
+
+  BFT_MALLOC(coords, n_vertices, float);
+
+  _write_string(f, "coordinates");
+  _write_int(f, (int)n_g_vertices);
+
+  /* Loop on dimension (de-interlace coordinates, always 3D for EnSight) */
+
+  for (int j = 0; j < 3; j++) {
+
+    if (j < mesh->dim) {
+      if (parent_vertex_num != NULL) {
+        for (cs_lnum_t i = 0; i < n_vertices; i++)
+          coords[i] = vertex_coords[(parent_vertex_num[i]-1)*stride + j];
+      }
+      else {
+        for (cs_lnum_t i = 0; i < n_vertices; i++)
+          coords[i] = vertex_coords[i*stride + j];
+      }
+    }
+    else {
+      for (cs_lnum_t i = 0; i < n_vertices; i++)
+        coords[i] = 0.0;
+    }
+
+    _write_block_floats_g(range[0],
+                          range[1],
+                          coords,
+                          w->comm,
+                          f);
+
+  }
+
+  BFT_FREE(coords);
+
+  return range[0] - 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Write "trivial" point elements to an EnSight Gold file in rank order
+ *
+ * parameters:
+ *   w    <-- pointer to writer structure
+ *   mesh <-- pointer to nodal mesh structure
+ *   f    <-- file to write to
+ *----------------------------------------------------------------------------*/
+
+static void
+_export_point_elements_r(const fvm_to_ensight_writer_t  *w,
+                         const fvm_nodal_t              *mesh,
+                         _ensight_file_t                 f)
+{
+  cs_gnum_t  range[2];
+  int32_t  *connect = NULL;
+
+  const cs_lnum_t  n_vertices = mesh->n_vertices;
+
+  cs_gnum_t n_g_vertices = _rank_order_range(w, n_vertices, range);
+
+  _write_string(f, "point");
+  _write_int(f, (int)n_g_vertices);
+
+  BFT_MALLOC(connect, n_vertices, int32_t);
+
+  for (cs_lnum_t i = 0; i < n_vertices; i++)
+    connect[i] = range[0] + i;
+
+  _write_block_connect_g(1,
+                         range[0],
+                         range[1],
+                         connect,
+                         w->comm,
+                         f);
+
+  BFT_FREE(connect);
+}
+
+/*----------------------------------------------------------------------------
+ * Write indexed element lengths to an EnSight Gold file in rank order
+ *
+ * parameters:
+ *   w            <-- pointer to writer structure
+ *   n_elements   <-- local number of elements
+ *   vertex_index <-- pointer to element -> vertex index
+ *   f            <-- associated file handle
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_lengths_r(const fvm_to_ensight_writer_t  *w,
+                 cs_lnum_t                       n_elements,
+                 const cs_lnum_t                 vertex_index[],
+                 _ensight_file_t                 f)
+{
+  cs_gnum_t  range[2];
+  int32_t  *lengths = NULL;
+
+  _rank_order_range(w, n_elements, range);
+
+  BFT_MALLOC(lengths, n_elements, int32_t);
+
+  for (cs_lnum_t i = 0; i < n_elements; i++)
+    lengths[i] = vertex_index[i+1] - vertex_index[i];
+
+  _write_block_connect_g(1,
+                         range[0],
+                         range[1],
+                         lengths,
+                         w->comm,
+                         f);
+
+  BFT_FREE(lengths);
+}
+
+/*----------------------------------------------------------------------------
+ * Write strided elements from a nodal mesh to an EnSight Gold file in
+ * rank order
+ *
+ * parameters:
+ *   w              <-- pointer to writer structure
+ *   export_section <-- pointer to EnSight section helper structure
+ *   vertex_base    <-- number of vertices written by preceding ranks
+ *   f              <-- associated file handle
+ *
+ * returns:
+ *  pointer to next EnSight section helper structure in list
+ *----------------------------------------------------------------------------*/
+
+static const fvm_writer_section_t *
+_export_nodal_strided_r(const fvm_to_ensight_writer_t  *w,
+                        const fvm_writer_section_t     *export_section,
+                        cs_gnum_t                       vertex_base,
+                        _ensight_file_t                 f)
+{
+  const fvm_writer_section_t  *current_section = export_section;
+
+  do { /* loop on sections which should be appended */
+
+    cs_gnum_t  range[2];
+    int32_t  *vtx_num = NULL;
+
+    const fvm_nodal_section_t  *section = current_section->section;
+    const int  stride = fvm_nodal_n_vertices_element[section->type];
+    const cs_lnum_t  n_values = section->n_elements * stride;
+
+    _rank_order_range(w, section->n_elements, range);
+
+    BFT_MALLOC(vtx_num, n_values, int32_t);
+
+    for (cs_lnum_t i = 0; i < n_values; i++)
+      vtx_num[i] = vertex_base + section->vertex_num[i];
+
+    _write_block_connect_g(stride,
+                           range[0],
+                           range[1],
+                           vtx_num,
+                           w->comm,
+                           f);
+
+    BFT_FREE(vtx_num);
+
+    current_section = current_section->next;
+
+  } while (   current_section != NULL
+           && current_section->continues_previous == true
+           &&  (   current_section->section->type
+                == export_section->section->type));
+
+  return current_section;
+}
+
+/*----------------------------------------------------------------------------
+ * Write polygons from a nodal mesh to an EnSight Gold file in rank order
+ *
+ * parameters:
+ *   w              <-- pointer to writer structure
+ *   export_section <-- pointer to EnSight section helper structure
+ *   vertex_base    <-- number of vertices written by preceding ranks
+ *   f              <-- associated file handle
+ *
+ * returns:
+ *  pointer to next EnSight section helper structure in list
+ *----------------------------------------------------------------------------*/
+
+static const fvm_writer_section_t *
+_export_nodal_polygons_r(const fvm_to_ensight_writer_t  *w,
+                         const fvm_writer_section_t     *export_section,
+                         cs_gnum_t                       vertex_base,
+                         _ensight_file_t                 f)
+{
+  const fvm_writer_section_t  *current_section;
+
+  /* Export number of vertices per polygon */
+  /*---------------------------------------*/
+
+  current_section = export_section;
+
+  do { /* loop on sections which should be appended */
+
+    const fvm_nodal_section_t  *section = current_section->section;
+
+    _write_lengths_r(w, section->n_elements, section->vertex_index, f);
+
+    current_section = current_section->next;
+
+  } while (   current_section != NULL
+           && current_section->continues_previous == true);
+
+  /* Export face->vertex connectivity */
+  /*----------------------------------*/
+
+  current_section = export_section;
+
+  do { /* loop on sections which should be appended */
+
+    cs_gnum_t  range[2];
+    cs_lnum_t  *vtx_idx = NULL;
+    int32_t  *vtx_num = NULL;
+
+    const fvm_nodal_section_t  *section = current_section->section;
+
+    /* In text mode, add zeroes to face vertex connectivity to mark face
+       bounds (so as to add newlines) */
+
+    const cs_lnum_t  sep = (f.bf != NULL) ? 0 : 1;
+
+    _rank_order_range(w, section->n_elements, range);
+
+    BFT_MALLOC(vtx_idx, section->n_elements + 1, cs_lnum_t);
+
+    vtx_idx[0] = 0;
+    for (cs_lnum_t i = 0; i < section->n_elements; i++)
+      vtx_idx[i+1] = vtx_idx[i] + (  section->vertex_index[i+1]
+                                   - section->vertex_index[i]) + sep;
+
+    BFT_MALLOC(vtx_num, vtx_idx[section->n_elements], int32_t);
+
+    for (cs_lnum_t i = 0, k = 0; i < section->n_elements; i++) {
+      for (cs_lnum_t j = section->vertex_index[i];
+           j < section->vertex_index[i+1];
+           j++)
+        vtx_num[k++] = vertex_base + section->vertex_num[j];
+      if (sep)
+        vtx_num[k++] = 0;
+    }
+
+    _write_block_indexed(range[0],
+                         range[1],
+                         vtx_idx,
+                         vtx_num,
+                         w->comm,
+                         f);
+
+    BFT_FREE(vtx_num);
+    BFT_FREE(vtx_idx);
+
+    current_section = current_section->next;
+
+  } while (   current_section != NULL
+           && current_section->continues_previous == true);
+
+  return current_section;
+}
+
+/*----------------------------------------------------------------------------
+ * Write polyhedra from a nodal mesh to an EnSight Gold file in rank order
+ *
+ * parameters:
+ *   w              <-- pointer to writer structure
+ *   export_section <-- pointer to EnSight section helper structure
+ *   vertex_base    <-- number of vertices written by preceding ranks
+ *   f              <-- associated file handle
+ *
+ * returns:
+ *  pointer to next EnSight section helper structure in list
+ *----------------------------------------------------------------------------*/
+
+static const fvm_writer_section_t *
+_export_nodal_polyhedra_r(const fvm_to_ensight_writer_t  *w,
+                          const fvm_writer_section_t     *export_section,
+                          cs_gnum_t                       vertex_base,
+                          _ensight_file_t                 f)
+{
+  const fvm_writer_section_t  *current_section;
+
+  /* Export number of faces per polyhedron */
+  /*---------------------------------------*/
+
+  current_section = export_section;
+
+  do { /* loop on sections which should be appended */
+
+    const fvm_nodal_section_t  *section = current_section->section;
+
+    _write_lengths_r(w, section->n_elements, section->face_index, f);
+
+    current_section = current_section->next;
+
+  } while (   current_section != NULL
+           && current_section->continues_previous == true);
+
+  /* Export number of vertices per face per polyhedron */
+  /*---------------------------------------------------*/
+
+  current_section = export_section;
+
+  do { /* loop on sections which should be appended */
+
+    cs_gnum_t  range[2];
+    int32_t  *face_len = NULL;
+
+    const fvm_nodal_section_t  *section = current_section->section;
+    const cs_lnum_t  n_faces = section->face_index[section->n_elements];
+
+    BFT_MALLOC(face_len, n_faces, int32_t);
+
+    for (cs_lnum_t j = 0; j < n_faces; j++) {
+      cs_lnum_t face_id = CS_ABS(section->face_num[j]) - 1;
+      face_len[j] = (  section->vertex_index[face_id+1]
+                     - section->vertex_index[face_id]);
+    }
+
+    _rank_order_range(w, n_faces, range);
+
+    _write_block_connect_g(1,
+                           range[0],
+                           range[1],
+                           face_len,
+                           w->comm,
+                           f);
+
+    BFT_FREE(face_len);
+
+    current_section = current_section->next;
+
+  } while (   current_section != NULL
+           && current_section->continues_previous == true);
+
+  /* Export cell->vertex connectivity */
+  /*----------------------------------*/
+
+  current_section = export_section;
+
+  do { /* loop on sections which should be appended */
+
+    cs_gnum_t  range[2];
+    cs_lnum_t  *vtx_idx = NULL;
+    int32_t  *vtx_num = NULL;
+
+    const fvm_nodal_section_t  *section = current_section->section;
+
+    /* In text mode, add zeroes to cell vertex connectivity to mark face
+       bounds (so as to add newlines) */
+
+    const cs_lnum_t  sep = (f.bf != NULL) ? 0 : 1;
+
+    _rank_order_range(w, section->n_elements, range);
+
+    BFT_MALLOC(vtx_idx, section->n_elements + 1, cs_lnum_t);
+
+    vtx_idx[0] = 0;
+    for (cs_lnum_t i = 0; i < section->n_elements; i++) {
+      cs_lnum_t cell_length = 0;
+      for (cs_lnum_t j = section->face_index[i];
+           j < section->face_index[i+1];
+           j++) {
+        cs_lnum_t face_id = CS_ABS(section->face_num[j]) - 1;
+        cell_length += (  section->vertex_index[face_id+1]
+                        - section->vertex_index[face_id]) + sep;
+      }
+      vtx_idx[i+1] = vtx_idx[i] + cell_length;
+    }
+
+    BFT_MALLOC(vtx_num, vtx_idx[section->n_elements], int32_t);
+
+    cs_lnum_t l = 0;
+
+    for (cs_lnum_t i = 0; i < section->n_elements; i++) {
+      for (cs_lnum_t j = section->face_index[i];
+           j < section->face_index[i+1];
+           j++) {
+        if (section->face_num[j] > 0) {
+          cs_lnum_t face_id = section->face_num[j] - 1;
+          for (cs_lnum_t k = section->vertex_index[face_id];
+               k < section->vertex_index[face_id+1];
+               k++)
+            vtx_num[l++] = vertex_base + section->vertex_num[k];
+        }
+        else {
+          cs_lnum_t face_id = -section->face_num[j] - 1;
+          cs_lnum_t k = section->vertex_index[face_id];
+          vtx_num[l++] = vertex_base + section->vertex_num[k];
+          for (k = section->vertex_index[face_id+1] - 1;
+               k > section->vertex_index[face_id];
+               k--)
+            vtx_num[l++] = vertex_base + section->vertex_num[k];
+        }
+        if (sep)
+          vtx_num[l++] = 0; /* mark face limits in text mode */
+      }
+    }
+
+    _write_block_indexed(range[0],
+                         range[1],
+                         vtx_idx,
+                         vtx_num,
+                         w->comm,
+                         f);
+
+    BFT_FREE(vtx_num);
+    BFT_FREE(vtx_idx);
+
+    current_section = current_section->next;
+
+  } while (   current_section != NULL
+           && current_section->continues_previous == true);
+
+  return current_section;
+}
+
+/*----------------------------------------------------------------------------
+ * Write field values associated with nodal values of a nodal mesh to
+ * an EnSight Gold file in rank order.
+ *
+ * parameters:
+ *   w                <-- pointer to writer structure
+ *   mesh             <-- pointer to nodal mesh structure
+ *   helper           <-- pointer to general writer helper structure
+ *   input_dim        <-- input field dimension
+ *   interlace        <-- indicates if field in memory is interlaced
+ *   n_parent_lists   <-- indicates if field values are to be obtained
+ *                        directly through the local entity index (when 0) or
+ *                        through the parent entity numbers (when 1 or more)
+ *   parent_num_shift <-- parent list to common number index shifts;
+ *                        size: n_parent_lists
+ *   datatype         <-- indicates the data type of (source) field values
+ *   field_values     <-- array of associated field value arrays
+ *   f                <-- associated file handle
+ *----------------------------------------------------------------------------*/
+
+static void
+_export_field_values_nr(const fvm_to_ensight_writer_t  *w,
+                        const fvm_nodal_t              *mesh,
+                        fvm_writer_field_helper_t      *helper,
+                        int                             input_dim,
+                        cs_interlace_t                  interlace,
+                        int                             n_parent_lists,
+                        const cs_lnum_t                 parent_num_shift[],
+                        cs_datatype_t                   datatype,
+                        const void               *const field_values[],
+                        _ensight_file_t                 f)
+{
+  cs_gnum_t  range[2];
+  float  *values = NULL;
+
+  const int output_dim = fvm_writer_field_helper_field_dim(helper);
+  const size_t  n_values = mesh->n_vertices;
+
+  _rank_order_range(w, mesh->n_vertices, range);
+
+  BFT_MALLOC(values, n_values, float);
+
+  for (int i = 0; i < output_dim; i++) {
+
+    size_t  n = 0, output_size = 0;
+
+    const int i_in = (input_dim == 6) ? _ensight_c_order_6[i] : i;
+
+    while (fvm_writer_field_helper_step_nl(helper,
+                                           mesh,
+                                           input_dim,
+                                           i_in,
+                                           interlace,
+                                           n_parent_lists,
+                                           parent_num_shift,
+                                           datatype,
+                                           field_values,
+                                           values + n,
+                                           n_values - n,
+                                           &output_size) == 0)
+      n += output_size;
+
+    _write_block_floats_g(range[0],
+                          range[1],
+                          values,
+                          w->comm,
+                          f);
+
+  }
+
+  BFT_FREE(values);
+}
+
+/*----------------------------------------------------------------------------
+ * Write field values associated with element values of a nodal mesh to
+ * an EnSight Gold file in rank order.
+ *
+ * parameters:
+ *   w                <-- pointer to writer structure
+ *   export_section   <-- pointer to EnSight section helper structure
+ *   helper           <-- pointer to general writer helper structure
+ *   input_dim        <-- input field dimension
+ *   interlace        <-- indicates if field in memory is interlaced
+ *   n_parent_lists   <-- indicates if field values are to be obtained
+ *                        directly through the local entity index (when 0) or
+ *                        through the parent entity numbers (when 1 or more)
+ *   parent_num_shift <-- parent list to common number index shifts;
+ *                        size: n_parent_lists
+ *   datatype         <-- indicates the data type of (source) field values
+ *   field_values     <-- array of associated field value arrays
+ *   f                <-- associated file handle
+ *
+ * returns:
+ *  pointer to next EnSight section helper structure in list
+ *----------------------------------------------------------------------------*/
+
+static const fvm_writer_section_t *
+_export_field_values_er(const fvm_to_ensight_writer_t  *w,
+                        const fvm_writer_section_t     *export_section,
+                        fvm_writer_field_helper_t      *helper,
+                        int                             input_dim,
+                        cs_interlace_t                  interlace,
+                        int                             n_parent_lists,
+                        const cs_lnum_t                 parent_num_shift[],
+                        cs_datatype_t                   datatype,
+                        const void               *const field_values[],
+                        _ensight_file_t                 f)
+{
+  size_t  values_size = 0;
+  float  *values = NULL;
+
+  const fvm_writer_section_t  *current_section = NULL;
+
+  const int output_dim = fvm_writer_field_helper_field_dim(helper);
+
+  /* Loop on dimension (de-interlace vectors, always 3D for EnSight) */
+
+  for (int i = 0; i < output_dim; i++) {
+
+    const int i_in = (input_dim == 6) ? _ensight_c_order_6[i] : i;
+
+    current_section = export_section;
+
+    do { /* loop on sections which should be appended */
+
+      cs_gnum_t  range[2];
+      size_t  n = 0, output_size = 0;
+
+      const size_t  n_values = current_section->section->n_elements;
+
+      _rank_order_range(w, n_values, range);
+
+      if (values_size < n_values) {
+        values_size = n_values;
+        BFT_REALLOC(values, values_size, float);
+      }
+
+      while (fvm_writer_field_helper_step_el(helper,
+                                             current_section,
+                                             input_dim,
+                                             i_in,
+                                             interlace,
+                                             n_parent_lists,
+                                             parent_num_shift,
+                                             datatype,
+                                             field_values,
+                                             values + n,
+                                             n_values - n,
+                                             &output_size) == 0)
+        n += output_size;
+
+      _write_block_floats_g(range[0],
+                            range[1],
+                            values,
+                            w->comm,
+                            f);
+
+      current_section = current_section->next;
+
+    } while (   current_section != NULL
+             && current_section->continues_previous == true);
+
+  } /* end of loop on spatial dimension */
+
+  BFT_FREE(values);
+
+  return current_section;
+}
+
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------
  * Write field values associated with nodal values of a nodal mesh to
  * an EnSight Gold file in serial mode.
@@ -2530,6 +3187,11 @@ _export_field_values_el(const fvm_writer_section_t      *export_section,
  *   divide_polygons     tesselate polygons with triangles
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
+ *   rank_order          in parallel, write entities in rank order, each
+ *                       rank writing its local data at precomputed offsets,
+ *                       instead of redistributing it by global number
+ *                       (vertices on rank boundaries are duplicated;
+ *                       ignored if polygons or polyhedra are divided)
  *
  * parameters:
  *   name           <-- base output case name.
@@ -2571,6 +3233,7 @@ fvm_to_ensight_init_writer(const char             *name,
   this_writer->discard_polyhedra = false;
   this_writer->divide_polygons = false;
   this_writer->divide_polyhedra = false;
+  this_writer->rank_order = false;
 
   this_writer->rank = 0;
   this_writer->n_ranks = 1;
@@ -2597,6 +3260,8 @@ fvm_to_ensight_init_writer(const char             *name,
         this_writer->min_block_size = min_block_size;
         this_writer->block_comm = w_block_comm;
       }
+      else if (w_block_comm != MPI_COMM_NULL)
+        this_writer->block_comm = comm;
       this_writer->comm = comm;
     }
   }
@@ -2644,12 +3309,31 @@ fvm_to_ensight_init_writer(const char             *name,
                && (strncmp(options + i1, "divide_polyhedra", l_opt) == 0))
         this_writer->divide_polyhedra = true;
 
+      else if (   (l_opt == 10)
+               && (strncmp(options + i1, "rank_order", l_opt) == 0))
+        this_writer->rank_order = true;
+
       for (i1 = i2 + 1; i1 < l_tot && options[i1] == ' '; i1++);
 
     }
 
   }
 
+  /* Writing in rank order requires all ranks to take part in I/O, and
+     is not compatible with the global numbering of tesselation vertices */
+
+#if defined(HAVE_MPI)
+  if (this_writer->n_ranks < 2)
+    this_writer->rank_order = false;
+  if (   this_writer->divide_polygons == true
+      || this_writer->divide_polyhedra == true)
+    this_writer->rank_order = false;
+  if (this_writer->rank_order == true)
+    this_writer->block_comm = this_writer->comm;
+#else
+  this_writer->rank_order = false;
+#endif
+
   this_writer->case_info = fvm_to_ensight_case_create(name,
                                                       path,
                                                       time_dependency);
@@ -2781,6 +3465,11 @@ fvm_to_ensight_export_nodal(void               *this_writer_p,
   const int  rank = this_writer->rank;
   const int  n_ranks = this_writer->n_ranks;
 
+#if defined(HAVE_MPI)
+  const bool  rank_order = this_writer->rank_order;
+  cs_gnum_t  vertex_base = 0;
+#endif
+
   /* Initialization */
   /*----------------*/
 
@@ -2829,8 +3518,12 @@ fvm_to_ensight_export_nodal(void               *this_writer_p,
   /*--------------------*/
 
 #if defined(HAVE_MPI)
-  if (n_ranks > 1)
-    _export_vertex_coords_g(this_writer, mesh, f);
+  if (n_ranks > 1) {
+    if (rank_order)
+      vertex_base = _export_vertex_coords_r(this_writer, mesh, f);
+    else
+      _export_vertex_coords_g(this_writer, mesh, f);
+  }
 #endif
 
   if (n_ranks == 1)
@@ -2842,8 +3535,12 @@ fvm_to_ensight_export_nodal(void               *this_writer_p,
   if (export_list == NULL) {
 
 #if defined(HAVE_MPI)
-    if (n_ranks > 1)
-      _export_point_elements_g(this_writer, mesh, f);
+    if (n_ranks > 1) {
+      if (rank_order)
+        _export_point_elements_r(this_writer, mesh, f);
+      else
+        _export_point_elements_g(this_writer, mesh, f);
+    }
 #endif
     if (n_ranks == 1)
       _export_point_elements_l(mesh, f);
@@ -2884,6 +3581,23 @@ fvm_to_ensight_export_nodal(void               *this_writer_p,
 
       } while (next_section != NULL && next_section->continues_previous == true);
 
+      /* In rank order, elements present on several ranks
+         are written once per rank */
+
+#if defined(HAVE_MPI)
+      if (rank_order) {
+        cs_gnum_t n_elements = 0;
+        next_section = export_section;
+        do {
+          n_elements += next_section->section->n_elements;
+          next_section = next_section->next;
+        } while (   next_section != NULL
+                 && next_section->continues_previous == true);
+        MPI_Allreduce(&n_elements, &n_g_elements, 1, CS_MPI_GNUM, MPI_SUM,
+                      this_writer->comm);
+      }
+#endif
+
       _write_string(f, _ensight_type_name[export_section->type]);
       _write_int(f, n_g_elements);
     }
@@ -2895,11 +3609,18 @@ fvm_to_ensight_export_nodal(void               *this_writer_p,
 
 #if defined(HAVE_MPI)
 
-      if (n_ranks > 1)
-        export_section = _export_nodal_strided_g(this_writer,
-                                                 export_section,
-                                                 mesh->global_vertex_num,
-                                                 f);
+      if (n_ranks > 1) {
+        if (rank_order)
+          export_section = _export_nodal_strided_r(this_writer,
+                                                   export_section,
+                                                   vertex_base,
+                                                   f);
+        else
+          export_section = _export_nodal_strided_g(this_writer,
+                                                   export_section,
+                                                   mesh->global_vertex_num,
+                                                   f);
+      }
 
 #endif /* defined(HAVE_MPI) */
 
@@ -2946,11 +3667,18 @@ fvm_to_ensight_export_nodal(void               *this_writer_p,
 
       /* output in parallel mode */
 
-      if (n_ranks > 1)
-        export_section = _export_nodal_polygons_g(this_writer,
-                                                  export_section,
-                                                  mesh->global_vertex_num,
-                                                  f);
+      if (n_ranks > 1) {
+        if (rank_order)
+          export_section = _export_nodal_polygons_r(this_writer,
+                                                    export_section,
+                                                    vertex_base,
+                                                    f);
+        else
+          export_section = _export_nodal_polygons_g(this_writer,
+                                                    export_section,
+                                                    mesh->global_vertex_num,
+                                                    f);
+      }
 #endif /* defined(HAVE_MPI) */
 
       if (n_ranks == 1)
@@ -2968,11 +3696,18 @@ fvm_to_ensight_export_nodal(void               *this_writer_p,
 
       /* output in parallel mode */
 
-      if (n_ranks > 1)
-        export_section =_export_nodal_polyhedra_g(this_writer,
-                                                  export_section,
-                                                  mesh->global_vertex_num,
-                                                  f);
+      if (n_ranks > 1) {
+        if (rank_order)
+          export_section = _export_nodal_polyhedra_r(this_writer,
+                                                     export_section,
+                                                     vertex_base,
+                                                     f);
+        else
+          export_section = _export_nodal_polyhedra_g(this_writer,
+                                                     export_section,
+                                                     mesh->global_vertex_num,
+                                                     f);
+      }
 
 #endif /* defined(HAVE_MPI) */
 
@@ -3045,6 +3780,10 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
   const int  rank = w->rank;
   const int  n_ranks = w->n_ranks;
 
+#if defined(HAVE_MPI)
+  const bool  rank_order = w->rank_order;
+#endif
+
   /* Initialization */
   /*----------------*/
 
@@ -3119,7 +3858,7 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
 
 #if defined(HAVE_MPI)
 
-  if (n_ranks > 1)
+  if (n_ranks > 1 && rank_order == false)
     fvm_writer_field_helper_init_g(helper,
                                    w->min_rank_step,
                                    w->min_block_size,
@@ -3141,7 +3880,19 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
 
 #if defined(HAVE_MPI)
 
-    if (n_ranks > 1) {
+    if (n_ranks > 1 && rank_order)
+      _export_field_values_nr(w,
+                              mesh,
+                              helper,
+                              dimension,
+                              interlace,
+                              n_parent_lists,
+                              parent_num_shift,
+                              datatype,
+                              field_values,
+                              f);
+
+    else if (n_ranks > 1) {
 
         _ensight_context_t c;
         c.writer = w;
@@ -3193,7 +3944,19 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
 
 #if defined(HAVE_MPI)
 
-      if (n_ranks > 1) {
+      if (n_ranks > 1 && rank_order)
+        export_section = _export_field_values_er(w,
+                                                 export_section,
+                                                 helper,
+                                                 dimension,
+                                                 interlace,
+                                                 n_parent_lists,
+                                                 parent_num_shift,
+                                                 datatype,
+                                                 field_values,
+                                                 f);
+
+      else if (n_ranks > 1) {
 
         _ensight_context_t c;
         c.writer = w;
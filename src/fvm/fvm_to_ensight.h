@@ -66,6 +66,11 @@ BEGIN_C_DECLS
  *   divide_polygons     tesselate polygons with triangles
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
+ *   rank_order          in parallel, write entities in rank order, each
+ *                       rank writing its local data at precomputed offsets,
+ *                       instead of redistributing it by global number
+ *                       (vertices on rank boundaries are duplicated;
+ *                       ignored if polygons or polyhedra are divided)
  *
  * parameters:
  *   name           <-- base output case name.
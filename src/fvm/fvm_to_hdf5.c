@@ -0,0 +1,1733 @@
+/*============================================================================
+ * Write a nodal representation associated with a mesh and associated
+ * variables to HDF5 files, with an XDMF index
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#if defined(HAVE_HDF5)
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * HDF5 library headers
+ *----------------------------------------------------------------------------*/
+
+#include <hdf5.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "fvm_defs.h"
+#include "fvm_io_num.h"
+#include "fvm_nodal.h"
+#include "fvm_nodal_priv.h"
+#include "fvm_writer_helper.h"
+#include "fvm_writer_priv.h"
+
+#include "cs_parall.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "fvm_to_hdf5.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/* Parallel HDF5 is usable only if HDF5 was built with MPI support */
+
+#if defined(HAVE_MPI) && defined(H5_HAVE_PARALLEL)
+#define _HDF5_PARALLEL_IO 1
+#endif
+
+/* XDMF mixed topology element type codes */
+
+#define _XDMF_POLYVERTEX   1
+#define _XDMF_POLYLINE     2
+#define _XDMF_POLYGON      3
+#define _XDMF_TRIANGLE     4
+#define _XDMF_QUADRILATERAL 5
+#define _XDMF_TETRAHEDRON  6
+#define _XDMF_PYRAMID      7
+#define _XDMF_WEDGE        8
+#define _XDMF_HEXAHEDRON   9
+#define _XDMF_POLYHEDRON  16
+
+/*============================================================================
+ * Local Type Definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Output field structure
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  char       *name;             /* Field name */
+  char       *path;             /* Dataset path in HDF5 file */
+
+  int         time_step;        /* Time step, or -1 if time-independent */
+  int         dim;              /* Output field dimension */
+  bool        on_nodes;         /* true if defined on vertices,
+                                   false if defined on elements */
+
+} _hdf5_field_t;
+
+/*----------------------------------------------------------------------------
+ * Output geometry structure
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  char       *path;             /* Group path in HDF5 file */
+
+  int         time_step;        /* Time step, or -1 if time-independent */
+
+  cs_gnum_t   n_g_vertices;     /* Global number of output vertices */
+  cs_gnum_t   n_g_elements;     /* Global number of output elements */
+  cs_gnum_t   topology_size;    /* Global size of topology array */
+
+} _hdf5_grid_t;
+
+/*----------------------------------------------------------------------------
+ * Output mesh structure
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  char           *name;         /* Mesh name */
+  char           *h5_name;      /* Mesh name in HDF5 file */
+
+  int             n_grids;      /* Number of output geometries */
+  _hdf5_grid_t   *grids;        /* Output geometries, in time order */
+
+  int             n_fields;     /* Number of output fields */
+  _hdf5_field_t  *fields;       /* Output fields */
+
+} _hdf5_mesh_t;
+
+/*----------------------------------------------------------------------------
+ * HDF5/XDMF writer structure
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  char          *name;              /* Writer name */
+  char          *path;              /* Path prefix */
+
+  char          *h5_file_name;      /* HDF5 file name (with path) */
+  char          *h5_base_name;      /* HDF5 file name relative to index */
+  char          *index_file_name;   /* XDMF index file name */
+
+  int            rank;              /* Rank of current process
+                                       in communicator */
+  int            n_ranks;           /* Number of processes in communicator */
+
+  fvm_writer_time_dep_t   time_dependency;  /* Mesh time dependency */
+
+  bool           discard_polygons;  /* Option to discard polygonal elements */
+  bool           discard_polyhedra; /* Option to discard polyhedral elements */
+
+  bool           parallel_io;       /* true if using parallel HDF5 */
+  int            compression;       /* Deflate compression level, or 0 */
+  bool           created;           /* true once file has been created */
+  bool           modified;          /* true if index needs update */
+
+  int            nt;                /* Current time step */
+  double         t;                 /* Current time value */
+
+  int            n_time_values;     /* Number of time steps */
+  int           *time_steps;        /* Array of time step numbers */
+  double        *time_values;       /* Array of time step values */
+
+  int            n_meshes;          /* Number of associated meshes */
+  _hdf5_mesh_t  *meshes;            /* Associated meshes */
+
+  hid_t          file;              /* Associated HDF5 file handle,
+                                       or -1 if closed */
+
+#if defined(HAVE_MPI)
+  MPI_Comm       comm;              /* Associated MPI communicator */
+#endif
+
+} fvm_to_hdf5_writer_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static char _hdf5_version_string_[2][32] = {"", ""};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Return true if writes of a given writer are serialized over ranks.
+ *
+ * When parallel HDF5 is not available, each rank writes its own hyperslab
+ * of a dataset in turn, opening and closing the file in between.
+ *
+ * parameters:
+ *   w <-- pointer to writer structure
+ *
+ * returns:
+ *   true if writes are serialized, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_serialized_io(const fvm_to_hdf5_writer_t  *w)
+{
+  return (w->n_ranks > 1 && w->parallel_io == false);
+}
+
+/*----------------------------------------------------------------------------
+ * Copy a name for use in HDF5 paths, replacing the path separator.
+ *
+ * parameters:
+ *   name <-- name to copy
+ *
+ * returns:
+ *   pointer to newly allocated copy
+ *----------------------------------------------------------------------------*/
+
+static char *
+_h5_name(const char  *name)
+{
+  char *s = NULL;
+
+  BFT_MALLOC(s, strlen(name) + 1, char);
+  strcpy(s, name);
+
+  for (size_t i = 0; s[i] != '\0'; i++) {
+    if (s[i] == '/')
+      s[i] = '_';
+  }
+  if (strcmp(s, ".") == 0)
+    s[0] = '_';
+
+  return s;
+}
+
+/*----------------------------------------------------------------------------
+ * Print a string to an XML file, escaping reserved characters.
+ *
+ * parameters:
+ *   f <-- pointer to file
+ *   s <-- string to print
+ *----------------------------------------------------------------------------*/
+
+static void
+_xml_print(FILE        *f,
+           const char  *s)
+{
+  for (size_t i = 0; s[i] != '\0'; i++) {
+    switch(s[i]) {
+    case '&':
+      fputs("&amp;", f);
+      break;
+    case '<':
+      fputs("&lt;", f);
+      break;
+    case '>':
+      fputs("&gt;", f);
+      break;
+    case '"':
+      fputs("&quot;", f);
+      break;
+    default:
+      fputc(s[i], f);
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Add a time step to a writer's list of time values.
+ *
+ * parameters:
+ *   w          <-> pointer to writer structure
+ *   time_step  <-- time step number
+ *   time_value <-- time_value number
+ *----------------------------------------------------------------------------*/
+
+static void
+_add_time(fvm_to_hdf5_writer_t  *w,
+          int                    time_step,
+          double                 time_value)
+{
+  if (time_step < 0)
+    return;
+
+  int i = w->n_time_values;
+  while (i > 0 && w->time_steps[i-1] > time_step)
+    i--;
+
+  if (i > 0 && w->time_steps[i-1] == time_step) {
+    w->time_values[i-1] = time_value;
+    return;
+  }
+
+  BFT_REALLOC(w->time_steps, w->n_time_values + 1, int);
+  BFT_REALLOC(w->time_values, w->n_time_values + 1, double);
+
+  for (int j = w->n_time_values; j > i; j--) {
+    w->time_steps[j] = w->time_steps[j-1];
+    w->time_values[j] = w->time_values[j-1];
+  }
+
+  w->time_steps[i] = time_step;
+  w->time_values[i] = time_value;
+  w->n_time_values += 1;
+
+  w->modified = true;
+}
+
+/*----------------------------------------------------------------------------
+ * Return the writer's output mesh structure matching a given name,
+ * adding it if not present yet.
+ *
+ * parameters:
+ *   w         <-> pointer to writer structure
+ *   mesh_name <-- name of associated mesh
+ *
+ * returns:
+ *   pointer to output mesh structure
+ *----------------------------------------------------------------------------*/
+
+static _hdf5_mesh_t *
+_get_mesh(fvm_to_hdf5_writer_t  *w,
+          const char            *mesh_name)
+{
+  for (int i = 0; i < w->n_meshes; i++) {
+    if (strcmp(w->meshes[i].name, mesh_name) == 0)
+      return w->meshes + i;
+  }
+
+  BFT_REALLOC(w->meshes, w->n_meshes + 1, _hdf5_mesh_t);
+
+  _hdf5_mesh_t *m = w->meshes + w->n_meshes;
+  w->n_meshes += 1;
+
+  BFT_MALLOC(m->name, strlen(mesh_name) + 1, char);
+  strcpy(m->name, mesh_name);
+  m->h5_name = _h5_name(mesh_name);
+
+  m->n_grids = 0;
+  m->grids = NULL;
+  m->n_fields = 0;
+  m->fields = NULL;
+
+  return m;
+}
+
+/*----------------------------------------------------------------------------
+ * Return the geometry of an output mesh associated with a given time step.
+ *
+ * This is the last geometry output at or before the given time step.
+ *
+ * parameters:
+ *   m         <-- pointer to output mesh structure
+ *   time_step <-- time step number
+ *
+ * returns:
+ *   pointer to output geometry, or NULL if none matches
+ *----------------------------------------------------------------------------*/
+
+static const _hdf5_grid_t *
+_get_grid(const _hdf5_mesh_t  *m,
+          int                  time_step)
+{
+  const _hdf5_grid_t *g = NULL;
+
+  for (int i = 0; i < m->n_grids; i++) {
+    if (m->grids[i].time_step <= time_step)
+      g = m->grids + i;
+  }
+
+  return g;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the global range of local entities.
+ *
+ * Entities are written in local order, at offsets determined by
+ * the cumulative count of entities on preceding ranks.
+ *
+ * parameters:
+ *   w       <-- pointer to writer structure
+ *   n_local <-- local number of entities
+ *   n_g     --> total number of entities over all ranks
+ *
+ * returns:
+ *   number of entities on preceding ranks
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_rank_offset(const fvm_to_hdf5_writer_t  *w,
+             cs_gnum_t                    n_local,
+             cs_gnum_t                   *n_g)
+{
+  cs_gnum_t n_end = n_local;
+
+#if defined(HAVE_MPI)
+  if (w->n_ranks > 1) {
+    MPI_Scan(&n_local, &n_end, 1, CS_MPI_GNUM, MPI_SUM, w->comm);
+    *n_g = n_end;
+    MPI_Bcast(n_g, 1, CS_MPI_GNUM, w->n_ranks - 1, w->comm);
+    return n_end - n_local;
+  }
+#endif
+
+  *n_g = n_end;
+
+  return 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Open the HDF5 file associated with a writer, creating it if needed.
+ *
+ * parameters:
+ *   w <-> pointer to writer structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_file_open(fvm_to_hdf5_writer_t  *w)
+{
+  if (w->file >= 0)
+    return;
+
+  hid_t fapl = H5Pcreate(H5P_FILE_ACCESS);
+
+#if defined(_HDF5_PARALLEL_IO)
+  if (w->parallel_io)
+    H5Pset_fapl_mpio(fapl, w->comm, MPI_INFO_NULL);
+#endif
+
+  /* With serialized writes, only the first rank creates the file */
+
+  if (w->created == false && (w->rank == 0 || _serialized_io(w) == false))
+    w->file = H5Fcreate(w->h5_file_name, H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+  else
+    w->file = H5Fopen(w->h5_file_name, H5F_ACC_RDWR, fapl);
+
+  H5Pclose(fapl);
+
+  if (w->file < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("HDF5: error opening file \"%s\"."), w->h5_file_name);
+
+  w->created = true;
+}
+
+/*----------------------------------------------------------------------------
+ * Close the HDF5 file associated with a writer.
+ *
+ * parameters:
+ *   w <-> pointer to writer structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_file_close(fvm_to_hdf5_writer_t  *w)
+{
+  if (w->file < 0)
+    return;
+
+  if (H5Fclose(w->file) < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("HDF5: error closing file \"%s\"."), w->h5_file_name);
+
+  w->file = -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Check if a link exists in an HDF5 file, checking intermediate groups
+ * so as to avoid errors in older HDF5 versions.
+ *
+ * parameters:
+ *   file <-- HDF5 file handle
+ *   path <-- absolute path of link
+ *
+ * returns:
+ *   true if the link exists, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_link_exists(hid_t        file,
+             const char  *path)
+{
+  bool retval = true;
+  size_t l = strlen(path);
+  char *s = NULL;
+
+  BFT_MALLOC(s, l + 1, char);
+  strcpy(s, path);
+
+  for (size_t i = 1; i <= l && retval; i++) {
+    if (s[i] == '/' || s[i] == '\0') {
+      char c = s[i];
+      s[i] = '\0';
+      if (H5Lexists(file, s, H5P_DEFAULT) <= 0)
+        retval = false;
+      s[i] = c;
+    }
+  }
+
+  BFT_FREE(s);
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Create a dataset in an HDF5 file, replacing a previous one with the same
+ * path if present.
+ *
+ * parameters:
+ *   w         <-- pointer to writer structure
+ *   path      <-- absolute dataset path
+ *   file_type <-- HDF5 datatype in file
+ *   n_dims    <-- number of dimensions (1 or 2)
+ *   dims      <-- dataset dimensions
+ *
+ * returns:
+ *   HDF5 dataset handle
+ *----------------------------------------------------------------------------*/
+
+static hid_t
+_create_dataset(const fvm_to_hdf5_writer_t  *w,
+                const char                  *path,
+                hid_t                        file_type,
+                int                          n_dims,
+                const hsize_t                dims[])
+{
+  if (_link_exists(w->file, path))
+    H5Ldelete(w->file, path, H5P_DEFAULT);
+
+  hid_t lcpl = H5Pcreate(H5P_LINK_CREATE);
+  H5Pset_create_intermediate_group(lcpl, 1);
+
+  hid_t space = H5Screate_simple(n_dims, dims, NULL);
+
+  /* Use a chunked layout (required for compression), with chunks of
+     about 1 MiB spanning complete rows; collective writes with parallel
+     HDF5 versions not supporting filters keep a contiguous layout. */
+
+  hid_t dcpl = H5Pcreate(H5P_DATASET_CREATE);
+
+  bool chunked = (dims[0] > 0) ? true : false;
+
+#if defined(_HDF5_PARALLEL_IO) && !H5_VERSION_GE(1, 10, 2)
+  if (w->parallel_io)
+    chunked = false;
+#endif
+
+  if (chunked) {
+    hsize_t chunk_dims[2] = {1, 1};
+    hsize_t row_size = H5Tget_size(file_type);
+    if (n_dims > 1) {
+      chunk_dims[1] = dims[1];
+      row_size *= dims[1];
+    }
+    chunk_dims[0] = (1 << 20) / row_size;
+    if (chunk_dims[0] < 1)
+      chunk_dims[0] = 1;
+    else if (chunk_dims[0] > dims[0])
+      chunk_dims[0] = dims[0];
+    H5Pset_chunk(dcpl, n_dims, chunk_dims);
+    if (w->compression > 0)
+      H5Pset_deflate(dcpl, w->compression);
+  }
+
+  hid_t dset = H5Dcreate2(w->file, path, file_type, space,
+                          lcpl, dcpl, H5P_DEFAULT);
+
+  H5Sclose(space);
+  H5Pclose(dcpl);
+  H5Pclose(lcpl);
+
+  if (dset < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("HDF5: error creating dataset \"%s\" in file \"%s\"."),
+              path, w->h5_file_name);
+
+  return dset;
+}
+
+/*----------------------------------------------------------------------------
+ * Write the local hyperslab of a dataset.
+ *
+ * parameters:
+ *   w         <-- pointer to writer structure
+ *   dset      <-- HDF5 dataset handle
+ *   mem_type  <-- HDF5 datatype in memory
+ *   n_dims    <-- number of dimensions (1 or 2)
+ *   start     <-- start of local hyperslab
+ *   count     <-- size of local hyperslab
+ *   data      <-- local values
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_hyperslab(const fvm_to_hdf5_writer_t  *w,
+                 hid_t                        dset,
+                 hid_t                        mem_type,
+                 int                          n_dims,
+                 const hsize_t                start[],
+                 const hsize_t                count[],
+                 const void                  *data)
+{
+  hid_t dxpl = H5P_DEFAULT;
+  hid_t f_space = H5Dget_space(dset);
+  hid_t m_space = H5Screate_simple(n_dims, count, NULL);
+
+  if (count[0] > 0)
+    H5Sselect_hyperslab(f_space, H5S_SELECT_SET, start, NULL, count, NULL);
+  else {
+    H5Sselect_none(f_space);
+    H5Sselect_none(m_space);
+  }
+
+#if defined(_HDF5_PARALLEL_IO)
+  if (w->parallel_io) {
+    dxpl = H5Pcreate(H5P_DATASET_XFER);
+    H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE);
+  }
+#endif
+
+  herr_t retval = H5Dwrite(dset, mem_type, m_space, f_space, dxpl, data);
+
+  if (dxpl != H5P_DEFAULT)
+    H5Pclose(dxpl);
+
+  H5Sclose(m_space);
+  H5Sclose(f_space);
+
+  if (retval < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("HDF5: error writing to file \"%s\"."), w->h5_file_name);
+}
+
+/*----------------------------------------------------------------------------
+ * Write a dataset to the HDF5 file, each rank writing its local values
+ * as a hyperslab, with no redistribution.
+ *
+ * Rows of the dataset are ordered by rank, then by local order.
+ *
+ * parameters:
+ *   w         <-> pointer to writer structure
+ *   path      <-- absolute dataset path
+ *   datatype  <-- data type of values (CS_DOUBLE or CS_INT64)
+ *   n_cols    <-- number of values per row (1 for a 1d dataset)
+ *   n_rows    <-- local number of rows
+ *   data      <-- local values
+ *
+ * returns:
+ *   global number of rows
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_write_dataset(fvm_to_hdf5_writer_t  *w,
+               const char            *path,
+               cs_datatype_t          datatype,
+               int                    n_cols,
+               cs_lnum_t              n_rows,
+               const void            *data)
+{
+  cs_gnum_t n_g_rows = 0;
+  cs_gnum_t row_start = _rank_offset(w, n_rows, &n_g_rows);
+
+  const int n_dims = (n_cols > 1) ? 2 : 1;
+  const hsize_t dims[2] = {n_g_rows, n_cols};
+  const hsize_t start[2] = {row_start, 0};
+  const hsize_t count[2] = {n_rows, n_cols};
+
+  hid_t file_type = H5T_IEEE_F64LE, mem_type = H5T_NATIVE_DOUBLE;
+  if (datatype == CS_INT64) {
+    file_type = H5T_STD_I64LE;
+    mem_type = H5T_NATIVE_INT64;
+  }
+
+  /* Collective (or serial) write */
+
+  if (_serialized_io(w) == false) {
+
+    _file_open(w);
+
+    hid_t dset = _create_dataset(w, path, file_type, n_dims, dims);
+    _write_hyperslab(w, dset, mem_type, n_dims, start, count, data);
+    H5Dclose(dset);
+
+  }
+
+#if defined(HAVE_MPI)
+
+  /* Ranks write in turn, passing a token */
+
+  else {
+
+    int token = 0;
+
+    if (w->rank > 0)
+      MPI_Recv(&token, 1, MPI_INT, w->rank - 1, 0, w->comm,
+               MPI_STATUS_IGNORE);
+
+    if (w->rank == 0 || n_rows > 0) {
+
+      _file_open(w);
+
+      hid_t dset = -1;
+      if (w->rank == 0)
+        dset = _create_dataset(w, path, file_type, n_dims, dims);
+      else
+        dset = H5Dopen2(w->file, path, H5P_DEFAULT);
+
+      if (dset < 0)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("HDF5: error opening dataset \"%s\" in file \"%s\"."),
+                  path, w->h5_file_name);
+
+      _write_hyperslab(w, dset, mem_type, n_dims, start, count, data);
+      H5Dclose(dset);
+
+      _file_close(w);
+
+    }
+
+    w->created = true;
+
+    if (w->rank < w->n_ranks - 1)
+      MPI_Send(&token, 1, MPI_INT, w->rank + 1, 0, w->comm);
+
+    /* Ensure the file is released by all ranks before the next write */
+
+    MPI_Barrier(w->comm);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  return n_g_rows;
+}
+
+/*----------------------------------------------------------------------------
+ * Build local mixed topology array.
+ *
+ * Vertex ids are based on the global (rank order) vertex numbering, and
+ * each element is defined by its XDMF type code, possibly followed by its
+ * size, then its vertex ids (polyhedra are defined by their number of
+ * faces, then by the number of vertices and vertex ids of each face).
+ *
+ * parameters:
+ *   mesh        <-- pointer to nodal mesh structure
+ *   export_list <-- pointer to section helper structure list
+ *   vertex_base <-- number of vertices written by preceding ranks
+ *   n_elements  --> local number of output elements
+ *   size        --> size of topology array
+ *
+ * returns:
+ *   pointer to allocated topology array
+ *----------------------------------------------------------------------------*/
+
+static int64_t *
+_build_topology(const fvm_nodal_t           *mesh,
+                const fvm_writer_section_t  *export_list,
+                cs_gnum_t                    vertex_base,
+                cs_lnum_t                   *n_elements,
+                cs_lnum_t                   *size)
+{
+  const fvm_writer_section_t  *export_section;
+
+  cs_lnum_t n_elts = 0, n_vals = 0;
+  int64_t *topo = NULL;
+
+  const int64_t v_base = vertex_base - 1;
+
+  /* Vertex-only meshes are output as polyvertices */
+
+  if (export_list == NULL) {
+
+    BFT_MALLOC(topo, mesh->n_vertices*3, int64_t);
+
+    for (cs_lnum_t i = 0; i < mesh->n_vertices; i++) {
+      topo[i*3] = _XDMF_POLYVERTEX;
+      topo[i*3 + 1] = 1;
+      topo[i*3 + 2] = vertex_base + i;
+    }
+
+    *n_elements = mesh->n_vertices;
+    *size = mesh->n_vertices*3;
+
+    return topo;
+  }
+
+  /* Count required size */
+
+  for (export_section = export_list;
+       export_section != NULL;
+       export_section = export_section->next) {
+
+    const fvm_nodal_section_t  *section = export_section->section;
+
+    n_elts += section->n_elements;
+
+    if (section->type == FVM_FACE_POLY)
+      n_vals +=   section->n_elements*2
+                + section->vertex_index[section->n_elements];
+
+    else if (section->type == FVM_CELL_POLY) {
+      n_vals += section->n_elements*2;
+      for (cs_lnum_t j = 0; j < section->face_index[section->n_elements]; j++) {
+        cs_lnum_t face_id = CS_ABS(section->face_num[j]) - 1;
+        n_vals += 1 + (  section->vertex_index[face_id+1]
+                       - section->vertex_index[face_id]);
+      }
+    }
+
+    else {
+      n_vals += section->n_elements * (1 + section->stride);
+      if (section->type == FVM_EDGE)
+        n_vals += section->n_elements;
+    }
+
+  }
+
+  BFT_MALLOC(topo, n_vals, int64_t);
+
+  /* Now fill topology */
+
+  cs_lnum_t l = 0;
+
+  for (export_section = export_list;
+       export_section != NULL;
+       export_section = export_section->next) {
+
+    const fvm_nodal_section_t  *section = export_section->section;
+    const cs_lnum_t *vertex_num = section->vertex_num;
+
+    switch(section->type) {
+
+    case FVM_FACE_POLY:
+      for (cs_lnum_t i = 0; i < section->n_elements; i++) {
+        topo[l++] = _XDMF_POLYGON;
+        topo[l++] = section->vertex_index[i+1] - section->vertex_index[i];
+        for (cs_lnum_t j = section->vertex_index[i];
+             j < section->vertex_index[i+1];
+             j++)
+          topo[l++] = v_base + vertex_num[j];
+      }
+      break;
+
+    case FVM_CELL_POLY:
+      for (cs_lnum_t i = 0; i < section->n_elements; i++) {
+        topo[l++] = _XDMF_POLYHEDRON;
+        topo[l++] = section->face_index[i+1] - section->face_index[i];
+        for (cs_lnum_t j = section->face_index[i];
+             j < section->face_index[i+1];
+             j++) {
+          cs_lnum_t face_id = CS_ABS(section->face_num[j]) - 1;
+          cs_lnum_t s_id = section->vertex_index[face_id];
+          cs_lnum_t e_id = section->vertex_index[face_id+1];
+          topo[l++] = e_id - s_id;
+          if (section->face_num[j] > 0) {
+            for (cs_lnum_t k = s_id; k < e_id; k++)
+              topo[l++] = v_base + vertex_num[k];
+          }
+          else {
+            topo[l++] = v_base + vertex_num[s_id];
+            for (cs_lnum_t k = e_id - 1; k > s_id; k--)
+              topo[l++] = v_base + vertex_num[k];
+          }
+        }
+      }
+      break;
+
+    case FVM_CELL_PRISM:
+      /* XDMF wedge orientation is the opposite of that of FVM prisms */
+      for (cs_lnum_t i = 0; i < section->n_elements; i++) {
+        const cs_lnum_t *_vtx = vertex_num + i*6;
+        topo[l++] = _XDMF_WEDGE;
+        topo[l++] = v_base + _vtx[0];
+        topo[l++] = v_base + _vtx[2];
+        topo[l++] = v_base + _vtx[1];
+        topo[l++] = v_base + _vtx[3];
+        topo[l++] = v_base + _vtx[5];
+        topo[l++] = v_base + _vtx[4];
+      }
+      break;
+
+    default:
+      {
+        int64_t type_code = 0;
+        const int stride = section->stride;
+        switch(section->type) {
+        case FVM_EDGE:
+          type_code = _XDMF_POLYLINE;
+          break;
+        case FVM_FACE_TRIA:
+          type_code = _XDMF_TRIANGLE;
+          break;
+        case FVM_FACE_QUAD:
+          type_code = _XDMF_QUADRILATERAL;
+          break;
+        case FVM_CELL_TETRA:
+          type_code = _XDMF_TETRAHEDRON;
+          break;
+        case FVM_CELL_PYRAM:
+          type_code = _XDMF_PYRAMID;
+          break;
+        case FVM_CELL_HEXA:
+          type_code = _XDMF_HEXAHEDRON;
+          break;
+        default:
+          assert(0);
+        }
+        for (cs_lnum_t i = 0; i < section->n_elements; i++) {
+          topo[l++] = type_code;
+          if (section->type == FVM_EDGE)
+            topo[l++] = 2;
+          for (int j = 0; j < stride; j++)
+            topo[l++] = v_base + vertex_num[i*stride + j];
+        }
+      }
+
+    }
+
+  }
+
+  assert(l == n_vals);
+
+  *n_elements = n_elts;
+  *size = n_vals;
+
+  return topo;
+}
+
+/*----------------------------------------------------------------------------
+ * Write the XDMF index file describing the contents of the HDF5 file.
+ *
+ * Only the root rank writes the index.
+ *
+ * parameters:
+ *   w <-> pointer to writer structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_index(fvm_to_hdf5_writer_t  *w)
+{
+  w->modified = false;
+
+  if (w->rank > 0)
+    return;
+
+  FILE *f = fopen(w->index_file_name, "w");
+
+  if (f == NULL) {
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error opening file: \"%s\""), w->index_file_name);
+    return;
+  }
+
+  const char *h5 = w->h5_base_name;
+  const char *indent = (w->n_time_values > 0) ? "      " : "    ";
+
+  fprintf(f,
+          "<?xml version=\"1.0\" ?>\n"
+          "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" []>\n"
+          "<Xdmf Version=\"3.0\">\n"
+          "  <Domain>\n");
+
+  for (int m_id = 0; m_id < w->n_meshes; m_id++) {
+
+    const _hdf5_mesh_t *m = w->meshes + m_id;
+
+    if (w->n_time_values > 0) {
+      fprintf(f, "    <Grid Name=\"");
+      _xml_print(f, m->name);
+      fprintf(f, "\" GridType=\"Collection\" CollectionType=\"Temporal\">\n");
+    }
+
+    int n_steps = (w->n_time_values > 0) ? w->n_time_values : 1;
+
+    for (int t_id = 0; t_id < n_steps; t_id++) {
+
+      int time_step = (w->n_time_values > 0) ? w->time_steps[t_id] : -1;
+
+      const _hdf5_grid_t *g = _get_grid(m, time_step);
+      if (g == NULL)
+        continue;
+
+      fprintf(f, "%s<Grid Name=\"", indent);
+      _xml_print(f, m->name);
+      fprintf(f, "\" GridType=\"Uniform\">\n");
+
+      if (time_step > -1)
+        fprintf(f, "%s  <Time Value=\"%.12g\"/>\n",
+                indent, w->time_values[t_id]);
+
+      fprintf(f,
+              "%s  <Topology TopologyType=\"Mixed\""
+              " NumberOfElements=\"%llu\">\n"
+              "%s    <DataItem Dimensions=\"%llu\" NumberType=\"Int\""
+              " Precision=\"8\" Format=\"HDF\">",
+              indent, (unsigned long long)(g->n_g_elements),
+              indent, (unsigned long long)(g->topology_size));
+      _xml_print(f, h5);
+      fprintf(f, ":");
+      _xml_print(f, g->path);
+      fprintf(f, "/topology</DataItem>\n"
+              "%s  </Topology>\n", indent);
+
+      fprintf(f,
+              "%s  <Geometry GeometryType=\"XYZ\">\n"
+              "%s    <DataItem Dimensions=\"%llu 3\" NumberType=\"Float\""
+              " Precision=\"8\" Format=\"HDF\">",
+              indent, indent, (unsigned long long)(g->n_g_vertices));
+      _xml_print(f, h5);
+      fprintf(f, ":");
+      _xml_print(f, g->path);
+      fprintf(f, "/geometry</DataItem>\n"
+              "%s  </Geometry>\n", indent);
+
+      for (int f_id = 0; f_id < m->n_fields; f_id++) {
+
+        const _hdf5_field_t *fld = m->fields + f_id;
+
+        if (fld->time_step > -1 && fld->time_step != time_step)
+          continue;
+
+        const char *a_type = "Scalar";
+        switch(fld->dim) {
+        case 3:
+          a_type = "Vector";
+          break;
+        case 6:
+          a_type = "Tensor6";
+          break;
+        case 9:
+          a_type = "Tensor";
+          break;
+        default:
+          break;
+        }
+
+        unsigned long long n_vals = (fld->on_nodes) ?
+          g->n_g_vertices : g->n_g_elements;
+
+        fprintf(f, "%s  <Attribute Name=\"", indent);
+        _xml_print(f, fld->name);
+        fprintf(f, "\" AttributeType=\"%s\" Center=\"%s\">\n",
+                a_type, (fld->on_nodes) ? "Node" : "Cell");
+
+        if (fld->dim > 1)
+          fprintf(f,
+                  "%s    <DataItem Dimensions=\"%llu %d\"",
+                  indent, n_vals, fld->dim);
+        else
+          fprintf(f,
+                  "%s    <DataItem Dimensions=\"%llu\"",
+                  indent, n_vals);
+
+        fprintf(f, " NumberType=\"Float\" Precision=\"8\" Format=\"HDF\">");
+        _xml_print(f, h5);
+        fprintf(f, ":");
+        _xml_print(f, fld->path);
+        fprintf(f, "</DataItem>\n"
+                "%s  </Attribute>\n", indent);
+
+      }
+
+      fprintf(f, "%s</Grid>\n", indent);
+
+    }
+
+    if (w->n_time_values > 0)
+      fprintf(f, "    </Grid>\n");
+
+  }
+
+  fprintf(f,
+          "  </Domain>\n"
+          "</Xdmf>\n");
+
+  if (fclose(f) != 0)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error closing file: \"%s\""), w->index_file_name);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Returns number of library version strings associated with the
+ * HDF5/XDMF format.
+ *
+ * returns:
+ *   number of library version strings associated with the HDF5/XDMF format.
+ *----------------------------------------------------------------------------*/
+
+int
+fvm_to_hdf5_n_version_strings(void)
+{
+  return 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Returns a library version string associated with the HDF5/XDMF format.
+ *
+ * In certain cases, when using dynamic libraries, fvm may be compiled
+ * with one library version, and linked with another. If both run-time
+ * and compile-time version information is available, this function
+ * will return the run-time version string by default.
+ *
+ * Setting the compile_time flag to 1, the compile-time version string
+ * will be returned if this is different from the run-time version.
+ * If the version is the same, or only one of the 2 version strings are
+ * available, a NULL character string will be returned with this flag set.
+ *
+ * parameters:
+ *   string_index <-- index in format's version string list (0 to n-1)
+ *   compile_time <-- 0 by default, 1 if we want the compile-time version
+ *                    string, if different from the run-time version.
+ *
+ * returns:
+ *   pointer to constant string containing the library's version.
+ *----------------------------------------------------------------------------*/
+
+const char *
+fvm_to_hdf5_version_string(int string_index,
+                           int compile_time_version)
+{
+  const char * retval = NULL;
+
+  if (string_index != 0)
+    return retval;
+
+  if (compile_time_version) {
+    snprintf(_hdf5_version_string_[1], 31, "HDF5 %d.%d.%d",
+             H5_VERS_MAJOR, H5_VERS_MINOR, H5_VERS_RELEASE);
+    _hdf5_version_string_[1][31] = '\0';
+    retval = _hdf5_version_string_[1];
+  }
+
+  else {
+    unsigned h5_major, h5_minor, h5_release;
+    H5get_libversion(&h5_major, &h5_minor, &h5_release);
+    snprintf(_hdf5_version_string_[0], 31, "HDF5 %u.%u.%u",
+             h5_major, h5_minor, h5_release);
+    _hdf5_version_string_[0][31] = '\0';
+    retval = _hdf5_version_string_[0];
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Initialize FVM to HDF5/XDMF file writer.
+ *
+ * Options are:
+ *   discard_polygons    do not output polygons or related values
+ *   discard_polyhedra   do not output polyhedra or related values
+ *   serial_io           force serialized writes even when parallel HDF5
+ *                       is available
+ *   compress            compress datasets using deflate (level 6)
+ *   compress=<level>    compress datasets using deflate with the given
+ *                       level (1 to 9); ignored with parallel HDF5 versions
+ *                       older than 1.10.2, which cannot apply filters
+ *                       with collective writes
+ *
+ * parameters:
+ *   name           <-- base output case name.
+ *   path           <-- base output path.
+ *   options        <-- whitespace separated, lowercase options list
+ *   time_dependecy <-- indicates if and how meshes will change with time
+ *   comm           <-- associated MPI communicator.
+ *
+ * returns:
+ *   pointer to opaque HDF5/XDMF writer structure.
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+void *
+fvm_to_hdf5_init_writer(const char             *name,
+                        const char             *path,
+                        const char             *options,
+                        fvm_writer_time_dep_t   time_dependency,
+                        MPI_Comm                comm)
+#else
+void *
+fvm_to_hdf5_init_writer(const char             *name,
+                        const char             *path,
+                        const char             *options,
+                        fvm_writer_time_dep_t   time_dependency)
+#endif
+{
+  fvm_to_hdf5_writer_t  *w = NULL;
+
+  /* Initialize writer */
+
+  BFT_MALLOC(w, 1, fvm_to_hdf5_writer_t);
+
+  BFT_MALLOC(w->name, strlen(name) + 1, char);
+  strcpy(w->name, name);
+
+  const char *_path = (path != NULL) ? path : "";
+
+  BFT_MALLOC(w->path, strlen(_path) + 1, char);
+  strcpy(w->path, _path);
+
+  BFT_MALLOC(w->h5_base_name, strlen(name) + 4, char);
+  sprintf(w->h5_base_name, "%s.h5", name);
+
+  BFT_MALLOC(w->h5_file_name, strlen(_path) + strlen(name) + 4, char);
+  sprintf(w->h5_file_name, "%s%s.h5", _path, name);
+
+  BFT_MALLOC(w->index_file_name, strlen(_path) + strlen(name) + 5, char);
+  sprintf(w->index_file_name, "%s%s.xmf", _path, name);
+
+  w->rank = 0;
+  w->n_ranks = 1;
+
+#if defined(HAVE_MPI)
+  {
+    int mpi_flag, rank, n_ranks;
+    w->comm = MPI_COMM_NULL;
+    MPI_Initialized(&mpi_flag);
+    if (mpi_flag && comm != MPI_COMM_NULL) {
+      w->comm = comm;
+      MPI_Comm_rank(w->comm, &rank);
+      MPI_Comm_size(w->comm, &n_ranks);
+      w->rank = rank;
+      w->n_ranks = n_ranks;
+    }
+  }
+#endif /* defined(HAVE_MPI) */
+
+  w->time_dependency = time_dependency;
+
+  /* Defaults */
+
+  w->discard_polygons = false;
+  w->discard_polyhedra = false;
+
+#if defined(_HDF5_PARALLEL_IO)
+  w->parallel_io = (w->n_ranks > 1) ? true : false;
+#else
+  w->parallel_io = false;
+#endif
+
+  w->compression = 0;
+
+  w->created = false;
+  w->modified = false;
+
+  w->nt = -1;
+  w->t = -1;
+
+  w->n_time_values = 0;
+  w->time_steps = NULL;
+  w->time_values = NULL;
+
+  w->n_meshes = 0;
+  w->meshes = NULL;
+
+  w->file = -1;
+
+  /* Parse options */
+
+  if (options != NULL) {
+
+    int i1, i2, l_opt;
+    int l_tot = strlen(options);
+
+    i1 = 0; i2 = 0;
+    while (i1 < l_tot) {
+
+      for (i2 = i1; i2 < l_tot && options[i2] != ' '; i2++);
+      l_opt = i2 - i1;
+
+      if (   (l_opt == 16)
+          && (strncmp(options + i1, "discard_polygons", l_opt) == 0))
+        w->discard_polygons = true;
+      else if (   (l_opt == 17)
+               && (strncmp(options + i1, "discard_polyhedra", l_opt) == 0))
+        w->discard_polyhedra = true;
+      else if (   (l_opt == 9)
+               && (strncmp(options + i1, "serial_io", l_opt) == 0))
+        w->parallel_io = false;
+      else if (   (l_opt == 8)
+               && (strncmp(options + i1, "compress", l_opt) == 0))
+        w->compression = 6;
+      else if (   (l_opt > 9)
+               && (strncmp(options + i1, "compress=", 9) == 0)) {
+        w->compression = atoi(options + i1 + 9);
+        if (w->compression < 1)
+          w->compression = 1;
+        else if (w->compression > 9)
+          w->compression = 9;
+      }
+
+      for (i1 = i2 + 1 ; i1 < l_tot && options[i1] == ' ' ; i1++);
+
+    }
+
+  }
+
+  /* Return writer */
+
+  return w;
+}
+
+/*----------------------------------------------------------------------------
+ * Finalize FVM to HDF5/XDMF file writer.
+ *
+ * parameters:
+ *   writer <-- pointer to opaque HDF5/XDMF writer structure.
+ *
+ * returns:
+ *   NULL pointer.
+ *----------------------------------------------------------------------------*/
+
+void *
+fvm_to_hdf5_finalize_writer(void  *writer)
+{
+  fvm_to_hdf5_writer_t  *w = (fvm_to_hdf5_writer_t *)writer;
+
+  fvm_to_hdf5_flush(writer);
+
+  _file_close(w);
+
+  for (int i = 0; i < w->n_meshes; i++) {
+    _hdf5_mesh_t *m = w->meshes + i;
+    for (int j = 0; j < m->n_grids; j++)
+      BFT_FREE(m->grids[j].path);
+    for (int j = 0; j < m->n_fields; j++) {
+      BFT_FREE(m->fields[j].name);
+      BFT_FREE(m->fields[j].path);
+    }
+    BFT_FREE(m->grids);
+    BFT_FREE(m->fields);
+    BFT_FREE(m->h5_name);
+    BFT_FREE(m->name);
+  }
+  BFT_FREE(w->meshes);
+
+  BFT_FREE(w->time_values);
+  BFT_FREE(w->time_steps);
+
+  BFT_FREE(w->index_file_name);
+  BFT_FREE(w->h5_file_name);
+  BFT_FREE(w->h5_base_name);
+  BFT_FREE(w->path);
+  BFT_FREE(w->name);
+
+  BFT_FREE(w);
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Associate new time step with an HDF5/XDMF geometry.
+ *
+ * parameters:
+ *   writer     <-- pointer to associated writer
+ *   time_step  <-- time step number
+ *   time_value <-- time_value number
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_hdf5_set_mesh_time(void    *writer,
+                          int      time_step,
+                          double   time_value)
+{
+  fvm_to_hdf5_writer_t  *w = (fvm_to_hdf5_writer_t *)writer;
+
+  w->nt = time_step;
+  w->t = time_value;
+
+  _add_time(w, time_step, time_value);
+}
+
+/*----------------------------------------------------------------------------
+ * Write nodal mesh to an HDF5 file.
+ *
+ * Each rank writes its local vertices and elements as a hyperslab of
+ * the global datasets, at offsets given by the cumulative count of
+ * entities on preceding ranks (so vertices shared by several ranks are
+ * duplicated).
+ *
+ * parameters:
+ *   writer <-- pointer to associated writer
+ *   mesh   <-- pointer to nodal mesh structure that should be written
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_hdf5_export_nodal(void               *writer,
+                         const fvm_nodal_t  *mesh)
+{
+  fvm_to_hdf5_writer_t  *w = (fvm_to_hdf5_writer_t *)writer;
+
+  _hdf5_mesh_t *m = _get_mesh(w, mesh->name);
+
+  const int time_step
+    = (w->time_dependency == FVM_WRITER_FIXED_MESH) ? -1 : w->nt;
+
+  /* Define or update matching geometry */
+
+  _hdf5_grid_t *g = NULL;
+
+  for (int i = 0; i < m->n_grids; i++) {
+    if (m->grids[i].time_step == time_step)
+      g = m->grids + i;
+  }
+
+  if (g == NULL) {
+    int i = m->n_grids;
+    BFT_REALLOC(m->grids, m->n_grids + 1, _hdf5_grid_t);
+    while (i > 0 && m->grids[i-1].time_step > time_step) {
+      m->grids[i] = m->grids[i-1];
+      i--;
+    }
+    g = m->grids + i;
+    m->n_grids += 1;
+
+    BFT_MALLOC(g->path, strlen(m->h5_name) + 32, char);
+    if (time_step > -1)
+      sprintf(g->path, "/meshes/%s/%d", m->h5_name, time_step);
+    else
+      sprintf(g->path, "/meshes/%s", m->h5_name);
+    g->time_step = time_step;
+  }
+
+  char *ds_path = NULL;
+  BFT_MALLOC(ds_path, strlen(g->path) + 16, char);
+
+  /* Vertex coordinates (always 3D) */
+
+  const cs_lnum_t n_vertices = mesh->n_vertices;
+  const int dim = mesh->dim;
+
+  double *coords = NULL;
+  BFT_MALLOC(coords, n_vertices*3, double);
+
+  for (cs_lnum_t i = 0; i < n_vertices; i++) {
+    cs_lnum_t v_id = (mesh->parent_vertex_num != NULL) ?
+      mesh->parent_vertex_num[i] - 1 : i;
+    for (int j = 0; j < 3; j++)
+      coords[i*3 + j] = (j < dim) ? mesh->vertex_coords[v_id*dim + j] : 0.;
+  }
+
+  cs_gnum_t n_g_vertices = 0;
+  cs_gnum_t vertex_base = _rank_offset(w, n_vertices, &n_g_vertices);
+
+  sprintf(ds_path, "%s/geometry", g->path);
+  g->n_g_vertices = _write_dataset(w, ds_path, CS_DOUBLE, 3,
+                                   n_vertices, coords);
+
+  BFT_FREE(coords);
+
+  /* Element connectivity, as mixed topology */
+
+  fvm_writer_section_t *export_list
+    = fvm_writer_export_list(mesh,
+                             fvm_nodal_get_max_entity_dim(mesh),
+                             false,
+                             true,
+                             w->discard_polygons,
+                             w->discard_polyhedra,
+                             false,
+                             false);
+
+  cs_lnum_t n_elements = 0, topology_size = 0;
+
+  int64_t *topo = _build_topology(mesh,
+                                  export_list,
+                                  vertex_base,
+                                  &n_elements,
+                                  &topology_size);
+
+  BFT_FREE(export_list);
+
+  sprintf(ds_path, "%s/topology", g->path);
+  g->topology_size = _write_dataset(w, ds_path, CS_INT64, 1,
+                                    topology_size, topo);
+
+  BFT_FREE(topo);
+
+  _rank_offset(w, n_elements, &(g->n_g_elements));
+
+  BFT_FREE(ds_path);
+
+  w->modified = true;
+}
+
+/*----------------------------------------------------------------------------
+ * Write field associated with a nodal mesh to an HDF5 file.
+ *
+ * Assigning a negative value to the time step indicates a time-independent
+ * field (in which case the time_value argument is unused).
+ *
+ * parameters:
+ *   writer           <-- pointer to associated writer
+ *   mesh             <-- pointer to associated nodal mesh structure
+ *   name             <-- variable name
+ *   location         <-- variable definition location (nodes or elements)
+ *   dimension        <-- variable dimension (0: constant, 1: scalar,
+ *                        3: vector, 6: sym. tensor, 9: asym. tensor)
+ *   interlace        <-- indicates if variable in memory is interlaced
+ *   n_parent_lists   <-- indicates if variable values are to be obtained
+ *                        directly through the local entity index (when 0) or
+ *                        through the parent entity numbers (when 1 or more)
+ *   parent_num_shift <-- parent number to value array index shifts;
+ *                        size: n_parent_lists
+ *   datatype         <-- indicates the data type of (source) field values
+ *   time_step        <-- number of the current time step
+ *   time_value       <-- associated time value
+ *   field_values     <-- array of associated field value arrays
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_hdf5_export_field(void                  *writer,
+                         const fvm_nodal_t     *mesh,
+                         const char            *name,
+                         fvm_writer_var_loc_t   location,
+                         int                    dimension,
+                         cs_interlace_t         interlace,
+                         int                    n_parent_lists,
+                         const cs_lnum_t        parent_num_shift[],
+                         cs_datatype_t          datatype,
+                         int                    time_step,
+                         double                 time_value,
+                         const void      *const field_values[])
+{
+  fvm_to_hdf5_writer_t  *w = (fvm_to_hdf5_writer_t *)writer;
+
+  /* Dimension */
+
+  int output_dim = dimension;
+  if (dimension == 2)
+    output_dim = 3;
+  else if (dimension > 3 && dimension != 6 && dimension != 9)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Data of dimension %d not handled"), dimension);
+
+  const int _time_step = (time_step > -1) ? time_step : -1;
+
+  _add_time(w, _time_step, time_value);
+
+  _hdf5_mesh_t *m = _get_mesh(w, mesh->name);
+
+  /* Build list of sections that are used here, in order of output */
+
+  fvm_writer_section_t *export_list
+    = fvm_writer_export_list(mesh,
+                             fvm_nodal_get_max_entity_dim(mesh),
+                             false,
+                             true,
+                             w->discard_polygons,
+                             w->discard_polyhedra,
+                             false,
+                             false);
+
+  /* Vertex-only meshes have no sections, and elements are vertices */
+
+  if (export_list == NULL)
+    location = FVM_WRITER_PER_NODE;
+
+  fvm_writer_field_helper_t  *helper
+    = fvm_writer_field_helper_create(mesh,
+                                     export_list,
+                                     output_dim,
+                                     CS_INTERLACE,
+                                     CS_DOUBLE,
+                                     location);
+
+  /* Extract local values */
+
+  cs_lnum_t n_local = 0;
+
+  if (location == FVM_WRITER_PER_NODE)
+    n_local = mesh->n_vertices;
+  else {
+    for (const fvm_writer_section_t *s = export_list; s != NULL; s = s->next)
+      n_local += s->section->n_elements;
+  }
+
+  const size_t n_values = (size_t)n_local * (size_t)output_dim;
+  size_t n = 0, output_size = 0;
+
+  double *values = NULL;
+  BFT_MALLOC(values, n_values, double);
+
+  if (location == FVM_WRITER_PER_NODE) {
+
+    while (fvm_writer_field_helper_step_nl(helper,
+                                           mesh,
+                                           dimension,
+                                           0,
+                                           interlace,
+                                           n_parent_lists,
+                                           parent_num_shift,
+                                           datatype,
+                                           field_values,
+                                           values + n,
+                                           n_values - n,
+                                           &output_size) == 0)
+      n += output_size;
+
+  }
+
+  else if (location == FVM_WRITER_PER_ELEMENT) {
+
+    for (const fvm_writer_section_t *s = export_list; s != NULL; s = s->next) {
+      while (fvm_writer_field_helper_step_el(helper,
+                                             s,
+                                             dimension,
+                                             0,
+                                             interlace,
+                                             n_parent_lists,
+                                             parent_num_shift,
+                                             datatype,
+                                             field_values,
+                                             values + n,
+                                             n_values - n,
+                                             &output_size) == 0)
+        n += output_size;
+    }
+
+  }
+
+  assert(n == n_values);
+
+  fvm_writer_field_helper_destroy(&helper);
+  BFT_FREE(export_list);
+
+  /* XDMF symmetric tensors are ordered as xx, xy, xz, yy, yz, zz */
+
+  if (output_dim == 6) {
+    for (cs_lnum_t i = 0; i < n_local; i++) {
+      double *v = values + i*6;
+      double t[6] = {v[0], v[3], v[5], v[1], v[4], v[2]};
+      for (int j = 0; j < 6; j++)
+        v[j] = t[j];
+    }
+  }
+
+  /* Define or update matching field entry */
+
+  const bool on_nodes = (location == FVM_WRITER_PER_NODE) ? true : false;
+
+  _hdf5_field_t *fld = NULL;
+
+  for (int i = 0; i < m->n_fields; i++) {
+    _hdf5_field_t *_fld = m->fields + i;
+    if (   _fld->time_step == _time_step
+        && _fld->on_nodes == on_nodes
+        && strcmp(_fld->name, name) == 0)
+      fld = _fld;
+  }
+
+  if (fld == NULL) {
+    BFT_REALLOC(m->fields, m->n_fields + 1, _hdf5_field_t);
+    fld = m->fields + m->n_fields;
+    m->n_fields += 1;
+
+    BFT_MALLOC(fld->name, strlen(name) + 1, char);
+    strcpy(fld->name, name);
+
+    char *h5_name = _h5_name(name);
+    BFT_MALLOC(fld->path,
+               strlen(m->h5_name) + strlen(h5_name) + 48,
+               char);
+    if (_time_step > -1)
+      sprintf(fld->path, "/fields/%s/%s/%s/%d",
+              m->h5_name, (on_nodes) ? "node" : "cell", h5_name, _time_step);
+    else
+      sprintf(fld->path, "/fields/%s/%s/%s/static",
+              m->h5_name, (on_nodes) ? "node" : "cell", h5_name);
+    BFT_FREE(h5_name);
+
+    fld->time_step = _time_step;
+    fld->on_nodes = on_nodes;
+  }
+
+  fld->dim = output_dim;
+
+  /* Write values */
+
+  _write_dataset(w, fld->path, CS_DOUBLE, output_dim, n_local, values);
+
+  BFT_FREE(values);
+
+  w->modified = true;
+}
+
+/*----------------------------------------------------------------------------
+ * Flush files associated with a given writer, and update the XDMF index.
+ *
+ * parameters:
+ *   writer <-- pointer to associated writer
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_hdf5_flush(void  *writer)
+{
+  fvm_to_hdf5_writer_t  *w = (fvm_to_hdf5_writer_t *)writer;
+
+  if (w->file >= 0)
+    H5Fflush(w->file, H5F_SCOPE_GLOBAL);
+
+  if (w->modified)
+    _write_index(w);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* HAVE_HDF5 */
@@ -67,6 +67,7 @@
 
 #include "fvm_to_ccm.h"
 #include "fvm_to_cgns.h"
+#include "fvm_to_hdf5.h"
 #include "fvm_to_med.h"
 #include "fvm_to_ensight.h"
 #include "fvm_to_histogram.h"
@@ -107,9 +108,9 @@ BEGIN_C_DECLS
 
 /* Number and status of defined formats */
 
-static const int _fvm_writer_n_formats = 10;
+static const int _fvm_writer_n_formats = 11;
 
-static fvm_writer_format_t _fvm_writer_format_list[10] = {
+static fvm_writer_format_t _fvm_writer_format_list[11] = {
 
   /* Built-in EnSight Gold writer */
   {
@@ -202,6 +203,41 @@ static fvm_writer_format_t _fvm_writer_format_list[10] = {
 #endif
   },
 
+  /* XDMF writer (with HDF5 data) */
+  {
+    "XDMF",
+    "3.0 +",
+    (  FVM_WRITER_FORMAT_USE_EXTERNAL
+     | FVM_WRITER_FORMAT_HAS_POLYGON
+     | FVM_WRITER_FORMAT_HAS_POLYHEDRON),
+    FVM_WRITER_TRANSIENT_CONNECT,
+    0,                                 /* dynamic library count */
+    NULL,                              /* dynamic library */
+    NULL,                              /* dynamic library name */
+    NULL,                              /* dynamic library prefix */
+#if defined(HAVE_HDF5)
+    fvm_to_hdf5_n_version_strings,     /* n_version_strings_func */
+    fvm_to_hdf5_version_string,        /* version_string_func */
+    fvm_to_hdf5_init_writer,           /* init_func */
+    fvm_to_hdf5_finalize_writer,       /* finalize_func */
+    fvm_to_hdf5_set_mesh_time,         /* set_mesh_time_func */
+    NULL,                              /* needs_tesselation_func */
+    fvm_to_hdf5_export_nodal,          /* export_nodal_func */
+    fvm_to_hdf5_export_field,          /* export_field_func */
+    fvm_to_hdf5_flush                  /* flush_func */
+#else
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL
+#endif
+  },
+
   /* Catalyst (VTK) writer (plugin) */
   {
     "Catalyst",
@@ -715,7 +751,7 @@ _format_writer_init(fvm_writer_t  *this_writer,
                               path,
                               this_writer->options,
                               this_writer->time_dep,
-                              cs_glob_mpi_comm);
+                              this_writer->comm);
 #else
     format_writer = init_func(name,
                               path,
@@ -789,6 +825,166 @@ _find_or_add_format_writer(fvm_writer_t        *this_writer,
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
+/*----------------------------------------------------------------------------
+ * Initialize FVM mesh and field output writer.
+ *
+ * parameters:
+ *   name            <-- base name of output
+ *   path            <-- optional directory name for output
+ *   format_name     <-- name of selected format (case-independent)
+ *   format_options  <-- options for the selected format (case-independent,
+ *                       whitespace or comma separated list)
+ *   time_dependency <-- indicates if and how meshes will change with time
+ *   comm            <-- associated MPI communicator
+ *
+ * returns:
+ *   pointer to mesh and field output writer
+ *----------------------------------------------------------------------------*/
+
+static fvm_writer_t *
+_writer_init(const char             *name,
+             const char             *path,
+             const char             *format_name,
+             const char             *format_options,
+             fvm_writer_time_dep_t   time_dependency
+#if defined(HAVE_MPI)
+             ,
+             MPI_Comm                comm
+#endif
+             )
+{
+  int  i;
+  char  *tmp_options = NULL;
+  fvm_writer_t  *this_writer = NULL;
+  bool separate_meshes = false;
+
+  /* Find corresponding format and check coherency */
+
+  for (i = 0 ; i < _fvm_writer_n_formats ; i++)
+    if (strcmp(format_name, _fvm_writer_format_list[i].name) == 0)
+      break;
+
+  if (i >= _fvm_writer_n_formats)
+    i = fvm_writer_get_format_id(format_name);
+
+  if (i < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Format type \"%s\" required for case \"%s\" is unknown"),
+              format_name, name);
+
+  if (!fvm_writer_format_available(i))
+    bft_error(__FILE__, __LINE__, 0,
+              _("Format type \"%s\" required for case \"%s\" is not available"),
+              format_name, name);
+
+  tmp_options = _fvm_writer_option_list(format_options);
+
+  /* Parse top-level options (consuming those handled here);
+     the options string now contains options separated by a single
+     whitespace. */
+
+  if (tmp_options != NULL) {
+
+    int i0 = 0, i1;
+
+    while (tmp_options[i0] != '\0') {
+
+      for (i1 = i0; tmp_options[i1] != '\0' && tmp_options[i1] != ' '; i1++);
+      int l_opt = i1 - i0;
+
+      if (   (l_opt == 15)
+          && (strncmp(tmp_options + i0, "separate_meshes", l_opt) == 0)) {
+        separate_meshes = true;
+        if (tmp_options[i1] == ' ')
+          strcpy(tmp_options + i0, tmp_options + i1 + 1);
+        else {
+          if (i0 > 1) {
+            assert(tmp_options[i0-1] = ' ');
+            i0--;
+          }
+          tmp_options[i0] = '\0';
+        }
+      }
+      else {
+        i0 = i1;
+        if (tmp_options[i0] == ' ')
+          i0++;
+      }
+
+      i1 = strlen(tmp_options);
+      if (i1 > 0)
+        BFT_REALLOC(tmp_options, i1+1, char);
+      else {
+        BFT_FREE(tmp_options);
+        break;
+      }
+
+    }
+
+  }
+
+  /* Initialize writer */
+
+  BFT_MALLOC(this_writer, 1, fvm_writer_t);
+
+  BFT_MALLOC(this_writer->name, strlen(name) + 1, char);
+  strcpy(this_writer->name, name);
+
+  this_writer->format = &(_fvm_writer_format_list[i]);
+
+  /* Load plugin if required */
+
+#if defined(HAVE_DLOPEN)
+  if (this_writer->format->dl_name != NULL)
+    _load_plugin(this_writer->format);
+#endif
+
+  if (path) {
+    BFT_MALLOC(this_writer->path, strlen(path) + 1, char);
+    strcpy(this_writer->path, path);
+  }
+  else
+    this_writer->path = NULL;
+
+  this_writer->options = tmp_options;
+  tmp_options = NULL;
+
+  this_writer->time_dep = CS_MIN(time_dependency,
+                                 this_writer->format->max_time_dep);
+
+#if defined(HAVE_MPI)
+  this_writer->comm = comm;
+#endif
+
+  CS_TIMER_COUNTER_INIT(this_writer->mesh_time);
+  CS_TIMER_COUNTER_INIT(this_writer->field_time);
+  CS_TIMER_COUNTER_INIT(this_writer->flush_time);
+
+  if (this_writer->format->info_mask & FVM_WRITER_FORMAT_SEPARATE_MESHES)
+    separate_meshes = true;
+
+  if (separate_meshes)
+    this_writer->n_format_writers = 0; /* Delay contruction */
+  else
+    this_writer->n_format_writers = 1;
+
+  this_writer->mesh_names = NULL;
+
+  /* Initialize format-specific writer */
+
+  if  (this_writer->n_format_writers > 0) {
+    BFT_MALLOC(this_writer->format_writer, 1, void *);
+    this_writer->format_writer[0] = _format_writer_init(this_writer,
+                                                        NULL);
+  }
+  else
+    this_writer->format_writer = NULL;
+
+  /* Return pointer to initialized writer */
+
+  return this_writer;
+}
+
 /*============================================================================
  * Public function definitions
  *============================================================================*/
@@ -834,6 +1030,9 @@ fvm_writer_get_format_id(const char  *format_name)
     strcpy(closest_name, "MED");
   else if (strncmp(tmp_name, "cgns", 4) == 0)
     strcpy(closest_name, "CGNS");
+  else if (   strncmp(tmp_name, "xdmf", 4) == 0
+           || strncmp(tmp_name, "hdf5", 4) == 0)
+    strcpy(closest_name, "XDMF");
   else if (strncmp(tmp_name, "catalyst", 8) == 0)
     strcpy(closest_name, "Catalyst");
   else if (strncmp(tmp_name, "ccm", 3) == 0)
@@ -1065,6 +1264,11 @@ fvm_writer_filter_option(char        *format_options,
  *   divide_polygons     tesselate polygons with triangles
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
+ *   rank_order          write local data in rank order, with no
+ *                       redistribution by global number (EnSight only)
+ *   compress[=<level>]  compress datasets with deflate (XDMF)
+ *   serial_io           force serialized writes by successive ranks
+ *                       even when parallel I/O is available (XDMF)
  *   separate_meshes     use a different writer for each mesh
  *
  * parameters:
@@ -1087,134 +1291,54 @@ fvm_writer_init(const char             *name,
                 const char             *format_options,
                 fvm_writer_time_dep_t   time_dependency)
 {
-  int  i;
-  char  *tmp_options = NULL;
-  fvm_writer_t  *this_writer = NULL;
-  bool separate_meshes = false;
-
-  /* Find corresponding format and check coherency */
-
-  for (i = 0 ; i < _fvm_writer_n_formats ; i++)
-    if (strcmp(format_name, _fvm_writer_format_list[i].name) == 0)
-      break;
-
-  if (i >= _fvm_writer_n_formats)
-    i = fvm_writer_get_format_id(format_name);
-
-  if (i < 0)
-    bft_error(__FILE__, __LINE__, 0,
-              _("Format type \"%s\" required for case \"%s\" is unknown"),
-              format_name, name);
-
-  if (!fvm_writer_format_available(i))
-    bft_error(__FILE__, __LINE__, 0,
-              _("Format type \"%s\" required for case \"%s\" is not available"),
-              format_name, name);
-
-  tmp_options = _fvm_writer_option_list(format_options);
-
-  /* Parse top-level options (consuming those handled here);
-     the options string now contains options separated by a single
-     whitespace. */
-
-  if (tmp_options != NULL) {
-
-    int i0 = 0, i1;
-
-    while (tmp_options[i0] != '\0') {
-
-      for (i1 = i0; tmp_options[i1] != '\0' && tmp_options[i1] != ' '; i1++);
-      int l_opt = i1 - i0;
-
-      if (   (l_opt == 15)
-          && (strncmp(tmp_options + i0, "separate_meshes", l_opt) == 0)) {
-        separate_meshes = true;
-        if (tmp_options[i1] == ' ')
-          strcpy(tmp_options + i0, tmp_options + i1 + 1);
-        else {
-          if (i0 > 1) {
-            assert(tmp_options[i0-1] = ' ');
-            i0--;
-          }
-          tmp_options[i0] = '\0';
-        }
-      }
-      else {
-        i0 = i1;
-        if (tmp_options[i0] == ' ')
-          i0++;
-      }
-
-      i1 = strlen(tmp_options);
-      if (i1 > 0)
-        BFT_REALLOC(tmp_options, i1+1, char);
-      else {
-        BFT_FREE(tmp_options);
-        break;
-      }
-
-    }
-
-  }
-
-  /* Initialize writer */
-
-  BFT_MALLOC(this_writer, 1, fvm_writer_t);
-
-  BFT_MALLOC(this_writer->name, strlen(name) + 1, char);
-  strcpy(this_writer->name, name);
-
-  this_writer->format = &(_fvm_writer_format_list[i]);
-
-  /* Load plugin if required */
-
-#if defined(HAVE_DLOPEN)
-  if (this_writer->format->dl_name != NULL)
-    _load_plugin(this_writer->format);
+#if defined(HAVE_MPI)
+  return _writer_init(name, path, format_name, format_options,
+                      time_dependency, cs_glob_mpi_comm);
+#else
+  return _writer_init(name, path, format_name, format_options,
+                      time_dependency);
 #endif
+}
 
-  if (path) {
-    BFT_MALLOC(this_writer->path, strlen(path) + 1, char);
-    strcpy(this_writer->path, path);
-  }
-  else
-    this_writer->path = NULL;
-
-  this_writer->options = tmp_options;
-  tmp_options = NULL;
-
-  this_writer->time_dep = CS_MIN(time_dependency,
-                                 this_writer->format->max_time_dep);
-
-  CS_TIMER_COUNTER_INIT(this_writer->mesh_time);
-  CS_TIMER_COUNTER_INIT(this_writer->field_time);
-  CS_TIMER_COUNTER_INIT(this_writer->flush_time);
-
-  if (this_writer->format->info_mask & FVM_WRITER_FORMAT_SEPARATE_MESHES)
-    separate_meshes = true;
-
-  if (separate_meshes)
-    this_writer->n_format_writers = 0; /* Delay contruction */
-  else
-    this_writer->n_format_writers = 1;
-
-  this_writer->mesh_names = NULL;
-
-  /* Initialize format-specific writer */
-
-  if  (this_writer->n_format_writers > 0) {
-    BFT_MALLOC(this_writer->format_writer, 1, void *);
-    this_writer->format_writer[0] = _format_writer_init(this_writer,
-                                                        NULL);
-  }
-  else
-    this_writer->format_writer = NULL;
+#if defined(HAVE_MPI)
 
-  /* Return pointer to initialized writer */
+/*----------------------------------------------------------------------------
+ * Initialize FVM mesh and field output writer using a given
+ * MPI communicator.
+ *
+ * This is similar to fvm_writer_init(), except that output operations
+ * use the given communicator instead of the default one, so that a
+ * duplicate communicator may be used when output is done by a separate
+ * thread.
+ *
+ * parameters:
+ *   name            <-- base name of output
+ *   path            <-- optional directory name for output
+ *                       (directory automatically created if necessary)
+ *   format_name     <-- name of selected format (case-independent)
+ *   format_options  <-- options for the selected format (case-independent,
+ *                       whitespace or comma separated list)
+ *   time_dependency <-- indicates if and how meshes will change with time
+ *   comm            <-- associated MPI communicator
+ *
+ * returns:
+ *   pointer to mesh and field output writer
+ *----------------------------------------------------------------------------*/
 
-  return this_writer;
+fvm_writer_t *
+fvm_writer_init_comm(const char             *name,
+                     const char             *path,
+                     const char             *format_name,
+                     const char             *format_options,
+                     fvm_writer_time_dep_t   time_dependency,
+                     MPI_Comm                comm)
+{
+  return _writer_init(name, path, format_name, format_options,
+                      time_dependency, comm);
 }
 
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------
  * Finalize FVM mesh and field output writer.
  *
@@ -240,6 +240,41 @@ fvm_writer_init(const char             *name,
                 const char             *format_options,
                 fvm_writer_time_dep_t   time_dependency);
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Initialize FVM mesh and field output writer using a given
+ * MPI communicator.
+ *
+ * This is similar to fvm_writer_init(), except that output operations
+ * use the given communicator instead of the default one, so that a
+ * duplicate communicator may be used when output is done by a separate
+ * thread.
+ *
+ * parameters:
+ *   name            <-- base name of output
+ *   path            <-- optional directory name for output
+ *                       (directory automatically created if necessary)
+ *   format_name     <-- name of selected format (case-independent)
+ *   format_options  <-- options for the selected format (case-independent,
+ *                       whitespace or comma separated list)
+ *   time_dependency <-- indicates if and how meshes will change with time
+ *   comm            <-- associated MPI communicator
+ *
+ * returns:
+ *   pointer to mesh and field output writer
+ *----------------------------------------------------------------------------*/
+
+fvm_writer_t *
+fvm_writer_init_comm(const char             *name,
+                     const char             *path,
+                     const char             *format_name,
+                     const char             *format_options,
+                     fvm_writer_time_dep_t   time_dependency,
+                     MPI_Comm                comm);
+
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------
  * Finalize FVM mesh and field output writer.
  *
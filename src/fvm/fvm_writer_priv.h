@@ -179,6 +179,10 @@ struct _fvm_writer_t {
   char                  **mesh_names;        /* List of mesh names if one
                                                 writer per mesh is required */
 
+#if defined(HAVE_MPI)
+  MPI_Comm                comm;              /* Associated communicator */
+#endif
+
   cs_timer_counter_t      mesh_time;         /* Meshes output timer */
   cs_timer_counter_t      field_time;        /* Fields output timer */
   cs_timer_counter_t      flush_time;        /* output "completion" timer */
@@ -71,6 +71,7 @@
 #include "cs_turbulence_model.h"
 #include "cs_physical_model.h"
 #include "cs_parall.h"
+#include "cs_partition.h"
 #include "cs_post.h"
 #include "cs_post_default.h"
 #include "cs_prototypes.h"
@@ -96,7 +97,9 @@
 #include "cs_lagr_tracking.h"
 #include "cs_lagr_print.h"
 #include "cs_lagr_poisson.h"
+#include "cs_lagr_population.h"
 #include "cs_lagr_post.h"
+#include "cs_lagr_trajectory.h"
 #include "cs_lagr_sde.h"
 #include "cs_lagr_sde_model.h"
 #include "cs_lagr_orientation.h"
@@ -1100,6 +1103,35 @@ _get_n_deleted(cs_lagr_particle_set_t  *p_set,
   return res;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Count particles in each cell, as additional work used for
+ *        restart-time load balancing.
+ *
+ * \param[in]   mesh       pointer to mesh structure
+ * \param[out]  cell_work  number of particles in each cell
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cell_particle_count(const cs_mesh_t  *mesh,
+                     double            cell_work[])
+{
+  const cs_lagr_particle_set_t *p_set = cs_glob_lagr_particle_set;
+
+  for (cs_lnum_t i = 0; i < mesh->n_cells; i++)
+    cell_work[i] = 0;
+
+  if (p_set == NULL)
+    return;
+
+  for (cs_lnum_t p_id = 0; p_id < p_set->n_particles; p_id++) {
+    cs_lnum_t c_id = cs_lagr_particles_get_lnum(p_set, p_id, CS_LAGR_CELL_ID);
+    if (c_id > -1 && c_id < mesh->n_cells)
+      cell_work[c_id] += 1;
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1190,6 +1222,10 @@ cs_lagr_finalize(void)
 
   cs_lagr_print_finalize();
 
+  /* Close trajectory output */
+
+  cs_lagr_trajectory_finalize();
+
   /* Close tracking structures */
 
   cs_lagr_tracking_finalize();
@@ -1744,6 +1780,10 @@ cs_lagr_solve_initialize(const cs_real_t  *dt)
   /* Read statistics restart data */
 
   cs_lagr_stat_restart_read();
+
+  /* Account for particles when balancing loads */
+
+  cs_partition_set_balance_cell_work(_cell_particle_count);
 }
 
 /*----------------------------------------------------------------------------
@@ -2034,6 +2074,10 @@ cs_lagr_solve_time_step(const int         itypfb[],
 
   cs_lagr_injection(iprev, itypfb, vislen);
 
+  cs_lagr_particle_set_assign_ids(p_set,
+                                  p_set->n_particles - p_set->n_part_new,
+                                  p_set->n_particles);
+
   /* Initialization for the agglomeration/fragmentation models
      --------------------------------------------------------- */
 
@@ -2399,6 +2443,10 @@ cs_lagr_solve_time_step(const int         itypfb[],
                       cell_particle_idx);
         p_set->n_particles += cell_particle_idx[n_occupied_cells];
 
+        cs_lagr_particle_set_assign_ids(p_set,
+                                        enter_parts,
+                                        p_set->n_particles);
+
         BFT_FREE(cell_particle_idx);
       }
 
@@ -2624,6 +2672,11 @@ cs_lagr_solve_time_step(const int         itypfb[],
 
   cs_user_lagr_extra_operations(dt);
 
+  /* Particle population control
+     --------------------------- */
+
+  cs_lagr_population_control();
+
   /* Update particle counter */
   /*-------------------------*/
 
@@ -2631,6 +2684,11 @@ cs_lagr_solve_time_step(const int         itypfb[],
   part_c->n_g_cumulative_total += part_c->n_g_new;
   part_c->n_g_cumulative_failed += part_c->n_g_failed;
 
+  /* Trajectory output
+     ----------------- */
+
+  cs_lagr_trajectory_write(ts);
+
   /* Logging
      ------- */
 
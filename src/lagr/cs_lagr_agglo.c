@@ -286,12 +286,201 @@ _gaps_classes(cs_lnum_2_t  *array,
   return 0;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the hash slot associated with a given class in a class
+ *        index (either the slot holding that class or an empty slot).
+ *
+ * \param[in]  ci        pointer to class index
+ * \param[in]  class_id  searched class
+ *
+ * \return  slot id
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline cs_lnum_t
+_class_slot(const cs_lagr_agglo_class_index_t  *ci,
+            cs_lnum_t                           class_id)
+{
+  const unsigned long long mask = ci->size - 1;
+  unsigned long long h = ((unsigned long long)class_id * 2654435761ULL) & mask;
+
+  /* Linear probing; the table is never more than half full */
+
+  while (ci->key[h] != class_id && ci->key[h] != -1)
+    h = (h + 1) & mask;
+
+  return (cs_lnum_t)h;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Double the number of hash slots of a class index.
+ *
+ * \param[in, out]  ci  pointer to class index
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_class_index_grow(cs_lagr_agglo_class_index_t  *ci)
+{
+  cs_lnum_t  old_size = ci->size;
+  cs_lnum_t  *old_key = ci->key, *old_first = ci->first, *old_last = ci->last;
+
+  ci->size *= 2;
+  BFT_MALLOC(ci->key, ci->size, cs_lnum_t);
+  BFT_MALLOC(ci->first, ci->size, cs_lnum_t);
+  BFT_MALLOC(ci->last, ci->size, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < ci->size; i++)
+    ci->key[i] = -1;
+
+  for (cs_lnum_t i = 0; i < old_size; i++) {
+    if (old_key[i] != -1) {
+      cs_lnum_t j = _class_slot(ci, old_key[i]);
+      ci->key[j] = old_key[i];
+      ci->first[j] = old_first[i];
+      ci->last[j] = old_last[i];
+    }
+  }
+
+  BFT_FREE(old_key);
+  BFT_FREE(old_first);
+  BFT_FREE(old_last);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
  * Public function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create an empty index of parcels by class.
+ *
+ * \return  pointer to new class index
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lagr_agglo_class_index_t *
+cs_lagr_agglo_class_index_create(void)
+{
+  cs_lagr_agglo_class_index_t *ci;
+
+  BFT_MALLOC(ci, 1, cs_lagr_agglo_class_index_t);
+
+  ci->n_elts = 0;
+  ci->n_elts_max = 16;
+  BFT_MALLOC(ci->next, ci->n_elts_max, cs_lnum_t);
+
+  ci->n_keys = 0;
+  ci->size = 16;
+  BFT_MALLOC(ci->key, ci->size, cs_lnum_t);
+  BFT_MALLOC(ci->first, ci->size, cs_lnum_t);
+  BFT_MALLOC(ci->last, ci->size, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < ci->size; i++)
+    ci->key[i] = -1;
+
+  return ci;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy an index of parcels by class.
+ *
+ * \param[in, out]  ci  pointer to class index pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_agglo_class_index_destroy(cs_lagr_agglo_class_index_t  **ci)
+{
+  if (*ci != NULL) {
+    cs_lagr_agglo_class_index_t *_ci = *ci;
+
+    BFT_FREE(_ci->next);
+    BFT_FREE(_ci->key);
+    BFT_FREE(_ci->first);
+    BFT_FREE(_ci->last);
+
+    BFT_FREE(*ci);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Append a parcel of a given class to an index.
+ *
+ * Parcels are numbered in order of addition (0 to n-1), and parcels of
+ * a given class are chained in that order.
+ *
+ * \param[in, out]  ci        pointer to class index
+ * \param[in]       class_id  class of added parcel
+ *
+ * \return  id of added parcel in index
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_lagr_agglo_class_index_add(cs_lagr_agglo_class_index_t  *ci,
+                              cs_lnum_t                     class_id)
+{
+  assert(class_id > -1);
+
+  cs_lnum_t elt_id = ci->n_elts;
+
+  if (ci->n_elts >= ci->n_elts_max) {
+    ci->n_elts_max *= 2;
+    BFT_REALLOC(ci->next, ci->n_elts_max, cs_lnum_t);
+  }
+  ci->next[elt_id] = -1;
+  ci->n_elts += 1;
+
+  cs_lnum_t slot = _class_slot(ci, class_id);
+
+  if (ci->key[slot] == class_id) {
+    ci->next[ci->last[slot]] = elt_id;
+    ci->last[slot] = elt_id;
+  }
+  else {
+    ci->key[slot] = class_id;
+    ci->first[slot] = elt_id;
+    ci->last[slot] = elt_id;
+    ci->n_keys += 1;
+    if (ci->n_keys*2 > ci->size)
+      _class_index_grow(ci);
+  }
+
+  return elt_id;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the first parcel of a given class in an index.
+ *
+ * Following parcels of the same class are obtained through ci->next.
+ *
+ * \param[in]  ci        pointer to class index
+ * \param[in]  class_id  searched class
+ *
+ * \return  id of first parcel of class in index, or -1 if none
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_lagr_agglo_class_index_first(const cs_lagr_agglo_class_index_t  *ci,
+                                cs_lnum_t                           class_id)
+{
+  cs_lnum_t slot = _class_slot(ci, class_id);
+
+  if (ci->key[slot] == class_id)
+    return ci->first[slot];
+
+  return -1;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Merge two sorted arrays in a third sorted array
@@ -429,6 +618,10 @@ cs_lagr_agglomeration(cs_lnum_t  cell_id,
   /* Sort by class */
   qsort(interf, lnum_particles, sizeof(cs_lnum_2_t), _compare_interface);
 
+  /* Index of parcels created in this cell, by class */
+  cs_lagr_agglo_class_index_t *new_classes
+    = cs_lagr_agglo_class_index_create();
+
   /* Select pairs of parcticles (for agglomeration) */
   cs_gnum_t _gn_particles = lnum_particles;
   cs_gnum_t lnum_maxpairs = _gn_particles*(_gn_particles+1) / 2;
@@ -570,15 +763,14 @@ cs_lagr_agglomeration(cs_lnum_t  cell_id,
 
       cs_lnum_t add_to_end = 1;
 
-      for (cs_lnum_t indx = p_set->n_particles;
-          indx < p_set->n_particles + newpart;
-          indx++) {
-        cs_lnum_t stat_class
-          = cs_lagr_particles_get_lnum(p_set, indx, CS_LAGR_AGGLO_CLASS_ID);
+      for (cs_lnum_t j = cs_lagr_agglo_class_index_first(new_classes,
+                                                         n_classes_new);
+           j > -1;
+           j = new_classes->next[j]) {
+        cs_lnum_t indx = p_set->n_particles + j;
         cs_real_t stat_weight
           = cs_lagr_particles_get_real(p_set, indx, CS_LAGR_STAT_WEIGHT);
-        if (   (stat_class == n_classes_new)
-            && (stat_weight + vp <= agglo_max_weight)) {
+        if (stat_weight + vp <= agglo_max_weight) {
           cs_lagr_particles_set_real(p_set, indx, CS_LAGR_STAT_WEIGHT,
                                      round(stat_weight)+vp);
 
@@ -592,6 +784,8 @@ cs_lagr_agglomeration(cs_lnum_t  cell_id,
       if ( add_to_end == 1 ) {
         newpart++;
 
+        cs_lagr_agglo_class_index_add(new_classes, n_classes_new);
+
         /* Copy parcel p1 into a new parcel */
         cs_lnum_t inserted_parts = p_set->n_particles + newpart;
 
@@ -655,6 +849,8 @@ cs_lagr_agglomeration(cs_lnum_t  cell_id,
     kk--;
   }
 
+  cs_lagr_agglo_class_index_destroy(&new_classes);
+
   /* Store class and index of newly created particles */
   cs_lnum_2_t *interf_agglo;
   BFT_MALLOC(interf_agglo, newpart, cs_lnum_2_t);
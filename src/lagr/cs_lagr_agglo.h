@@ -41,10 +41,89 @@
 
 BEGIN_C_DECLS
 
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*! Index of parcels by agglomeration class, used to find parcels of a
+    given class among those created in a cell during the current step */
+/*---------------------------------------------------------------------*/
+
+typedef struct {
+
+  cs_lnum_t   n_elts;      /*!< number of indexed parcels */
+  cs_lnum_t   n_elts_max;  /*!< allocated size of next */
+  cs_lnum_t  *next;        /*!< next parcel of the same class, or -1 */
+
+  cs_lnum_t   n_keys;      /*!< number of distinct classes */
+  cs_lnum_t   size;        /*!< number of hash slots (power of 2) */
+  cs_lnum_t  *key;         /*!< class of each slot, or -1 if empty */
+  cs_lnum_t  *first;       /*!< first parcel of the class of each slot */
+  cs_lnum_t  *last;        /*!< last parcel of the class of each slot */
+
+} cs_lagr_agglo_class_index_t;
+
 /*============================================================================
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create an empty index of parcels by class.
+ *
+ * \return  pointer to new class index
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lagr_agglo_class_index_t *
+cs_lagr_agglo_class_index_create(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy an index of parcels by class.
+ *
+ * \param[in, out]  ci  pointer to class index pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_agglo_class_index_destroy(cs_lagr_agglo_class_index_t  **ci);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Append a parcel of a given class to an index.
+ *
+ * Parcels are numbered in order of addition (0 to n-1), and parcels of
+ * a given class are chained in that order.
+ *
+ * \param[in, out]  ci        pointer to class index
+ * \param[in]       class_id  class of added parcel
+ *
+ * \return  id of added parcel in index
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_lagr_agglo_class_index_add(cs_lagr_agglo_class_index_t  *ci,
+                              cs_lnum_t                     class_id);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the first parcel of a given class in an index.
+ *
+ * Following parcels of the same class are obtained through ci->next.
+ *
+ * \param[in]  ci        pointer to class index
+ * \param[in]  class_id  searched class
+ *
+ * \return  id of first parcel of class in index, or -1 if none
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_lagr_agglo_class_index_first(const cs_lagr_agglo_class_index_t  *ci,
+                                cs_lnum_t                           class_id);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Merge two sorted arrays in a third sorted array
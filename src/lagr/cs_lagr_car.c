@@ -140,9 +140,6 @@ cs_lagr_car(int              iprev,
 
   cs_lnum_t nor = cs_glob_lagr_time_step->nor;
 
-  cs_real_t bbi[3] = {0.0, 0.0, 0.0};
-  cs_real_t ktil   = 0.0;
-
   cs_real_t rec    = 1000.0;
   cs_real_t c0     = 2.1;
   cs_real_t cl     = 1.0 / (0.5 + (3.0 / 4.0) * c0);
@@ -327,6 +324,23 @@ cs_lagr_car(int              iprev,
 
     /* -> Calcul de TL et BX     */
 
+    /* Mean particle velocity statistics, when used for the
+       complete model (looked up once, outside the threaded loop) */
+
+    const cs_field_t *stat_vel = NULL, *stat_w = NULL;
+
+    if (   cs_glob_lagr_time_scheme->modcpl > 0
+        && cs_glob_time_step->nt_cur > cs_glob_lagr_time_scheme->modcpl) {
+      int stat_type = cs_lagr_stat_type_from_attr_id(CS_LAGR_VELOCITY);
+      stat_vel = cs_lagr_stat_get_moment(stat_type,
+                                         CS_LAGR_STAT_GROUP_PARTICLE,
+                                         CS_LAGR_MOMENT_MEAN,
+                                         0,
+                                         -1);
+      stat_w = cs_lagr_stat_get_stat_weight(0);
+    }
+
+#   pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
     for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
 
       if (cs_lagr_particles_get_flag(p_set, ip, CS_LAGR_PART_FIXED)) {
@@ -342,6 +356,8 @@ cs_lagr_car(int              iprev,
                                                     CS_LAGR_CELL_ID);
 
       cs_real_t vpart[3], vflui[3];
+      cs_real_t bbi[3] = {0.0, 0.0, 0.0};
+      cs_real_t ktil   = 0.0;
 
       if (dissip[cell_id] > 0.0 && energi[cell_id] > 0.0) {
 
@@ -360,19 +376,7 @@ cs_lagr_car(int              iprev,
 
         }
 
-        if (   cs_glob_lagr_time_scheme->modcpl > 0
-            && cs_glob_time_step->nt_cur > cs_glob_lagr_time_scheme->modcpl) {
-
-          int stat_type = cs_lagr_stat_type_from_attr_id(CS_LAGR_VELOCITY);
-
-          cs_field_t *stat_vel
-            = cs_lagr_stat_get_moment(stat_type,
-                                      CS_LAGR_STAT_GROUP_PARTICLE,
-                                      CS_LAGR_MOMENT_MEAN,
-                                      0,
-                                      -1);
-
-          cs_field_t *stat_w = cs_lagr_stat_get_stat_weight(0);
+        if (stat_vel != NULL) {
 
           if (stat_w->val[cell_id] > cs_glob_lagr_stat_options->threshold) {
 
@@ -557,6 +561,7 @@ cs_lagr_car(int              iprev,
 
   else {
 
+#   pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
     for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
 
       /* FIXME we may still need to do computations here */
@@ -592,6 +597,7 @@ cs_lagr_car(int              iprev,
 
     cs_field_t *stat_w = cs_lagr_stat_get_stat_weight(0);
 
+#   pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
     for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
 
       unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
@@ -625,6 +631,7 @@ cs_lagr_car(int              iprev,
 
   else {
 
+#   pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
     for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
 
       unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
@@ -188,6 +188,7 @@ cs_lagr_coupling(const cs_real_t  taup[],
   /* Finalization of external forces (if the particle interacts with a
      domain boundary, revert to order 1). */
 
+# pragma omp parallel for if (nbpart > CS_THR_MIN)
   for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
 
     cs_real_t aux1 = dtp / taup[npt];
@@ -203,6 +204,7 @@ cs_lagr_coupling(const cs_real_t  taup[],
 
   }
 
+# pragma omp parallel for if (nbpart > CS_THR_MIN)
   for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
 
     cs_real_t  p_stat_w = cs_lagr_particles_get_real(p_set, npt,
@@ -225,7 +227,10 @@ cs_lagr_coupling(const cs_real_t  taup[],
   }
 
   /* Momentum source terms
-     ===================== */
+     =====================
+
+     Accumulation to cells is kept sequential, so that summation order
+     (and thus results) does not depend on the number of threads. */
 
   if (cs_glob_lagr_source_terms->ltsdyn == 1) {
 
@@ -211,20 +211,24 @@ _find_class(cs_lnum_t  array[][2],
  * \param[in]  mass                    mass of the particles
  * \param[in]  agglo_max_weight                 maximum statistical weight that a
  *                                     particle can have
+ * \param[in]  interf                  existing particles (class, index),
+ *                                     sorted by class
+ * \param[in, out]  new_classes        index of created particles by class
  */
 /*----------------------------------------------------------------------------*/
 
 static void
-_add_particle(cs_lnum_t   lnum_particles,
-              cs_lnum_t  *newpart,
-              cs_lnum_t   vp,
-              cs_lnum_t  *corr,
-              cs_lnum_t   frag_idx,
-              cs_lnum_t   newclass,
-              cs_real_t   minimum_particle_diam,
-              cs_real_t   mass,
-              cs_real_t   agglo_max_weight,
-              cs_lnum_t   interf[][2])
+_add_particle(cs_lnum_t                     lnum_particles,
+              cs_lnum_t                    *newpart,
+              cs_lnum_t                     vp,
+              cs_lnum_t                    *corr,
+              cs_lnum_t                     frag_idx,
+              cs_lnum_t                     newclass,
+              cs_real_t                     minimum_particle_diam,
+              cs_real_t                     mass,
+              cs_real_t                     agglo_max_weight,
+              cs_lnum_t                     interf[][2],
+              cs_lagr_agglo_class_index_t  *new_classes)
 {
   /* Get information on the new fragment*/
   cs_lagr_particle_set_t *p_set = cs_glob_lagr_particle_set;
@@ -246,15 +250,13 @@ _add_particle(cs_lnum_t   lnum_particles,
 
   /* Add a new particle at the end of the set (otherwise)*/
   cs_lnum_t add_to_end = 1;
-  for (cs_lnum_t indx = p_set->n_particles;
-       indx < p_set->n_particles + *newpart;
-       indx++) {
-    int stat_class = cs_lagr_particles_get_lnum(p_set, indx,
-                                                CS_LAGR_AGGLO_CLASS_ID);
+  for (cs_lnum_t j = cs_lagr_agglo_class_index_first(new_classes, newclass);
+       j > -1;
+       j = new_classes->next[j]) {
+    cs_lnum_t indx = p_set->n_particles + j;
     cs_real_t stat_weight = cs_lagr_particles_get_real(p_set, indx,
                                                        CS_LAGR_STAT_WEIGHT);
-    if ((stat_class == newclass)
-       && (stat_weight + vp <= agglo_max_weight)) {
+    if (stat_weight + vp <= agglo_max_weight) {
       long long int auxx = round(stat_weight);
       cs_lagr_particles_set_real(p_set, indx, CS_LAGR_STAT_WEIGHT, auxx+vp);
 
@@ -265,6 +267,7 @@ _add_particle(cs_lnum_t   lnum_particles,
 
   if (add_to_end) {
     (*newpart)++;
+    cs_lagr_agglo_class_index_add(new_classes, newclass);
     _insert_particles(*newpart, vp, corr, frag_idx, newclass,
                       minimum_particle_diam, mass);
   }
@@ -477,6 +480,10 @@ cs_lagr_fragmentation(cs_real_t  dt,
   /* Sort particles by class */
   qsort(interf, lnum_particles, sizeof(cs_lnum_2_t), _compare_interface);
 
+  /* Index of parcels created in this cell, by class */
+  cs_lagr_agglo_class_index_t *new_classes
+    = cs_lagr_agglo_class_index_create();
+
   /* Get fragmentation kernel */
   cs_real_t cker = 0.;
   cker = cs_glob_lagr_fragmentation_model->scalar_kernel;
@@ -522,21 +529,23 @@ cs_lagr_fragmentation(cs_real_t  dt,
 
           _add_particle(lnum_particles, &newpart, vp, corr, i, class_nb_1,
                         minimum_particle_diam, mass*class_nb_1/class_nb,
-                        agglo_max_weight, interf);
+                        agglo_max_weight, interf, new_classes);
           _add_particle(lnum_particles, &newpart, vp, corr, i, class_nb_2,
                         minimum_particle_diam, mass*class_nb_2/class_nb,
-                        agglo_max_weight, interf);
+                        agglo_max_weight, interf, new_classes);
         }
         else {
           cs_lnum_t class_nb_even = class_nb / 2;
           _add_particle(lnum_particles, &newpart, 2*vp, corr, i, class_nb_even,
                         minimum_particle_diam, mass*0.5, agglo_max_weight,
-                        interf);
+                        interf, new_classes);
         }
       }
     }
   }
 
+  cs_lagr_agglo_class_index_destroy(&new_classes);
+
   /* Local array to save new fragments (class, index) */
   cs_lnum_2_t *interf_frag;
   BFT_MALLOC(interf_frag, newpart, cs_lnum_2_t);
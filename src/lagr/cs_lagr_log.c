@@ -59,6 +59,7 @@
 #include "cs_lagr.h"
 #include "cs_lagr_particle.h"
 #include "cs_lagr_tracking.h"
+#include "cs_lagr_population.h"
 #include "cs_lagr_post.h"
 #include "cs_lagr_stat.h"
 
@@ -409,6 +410,20 @@ cs_lagr_log_setup(void)
        _status(cs_glob_lagr_source_terms->ltsthe));
   }
 
+  if (   cs_glob_lagr_population_control->n_cell_max > 0
+      || cs_glob_lagr_population_control->n_cell_min > 0)
+    cs_log_printf
+      (CS_LOG_SETUP,
+       _("\n  Population control options:\n"
+         "    n_cell_max:           %5d  (merge above, 0: off)\n"
+         "    n_cell_min:           %5d  (split under, 0: off)\n"
+         "    diameter_tol:       %11.3e\n"
+         "    min_split_weight:   %11.3e\n"),
+       (int)cs_glob_lagr_population_control->n_cell_max,
+       (int)cs_glob_lagr_population_control->n_cell_min,
+       cs_glob_lagr_population_control->diameter_tol,
+       cs_glob_lagr_population_control->min_split_weight);
+
   cs_log_printf
     (CS_LOG_SETUP,
      _("\n"
@@ -578,6 +593,45 @@ cs_lagr_log_iteration(void)
     cs_log_printf(CS_LOG_DEFAULT,
                   _("%% of lost particles (restart(s) included): %13.4E\n"),
                   pc->n_g_cumulative_failed * 100. / pc->n_g_cumulative_total);
+
+  /* Particle distribution among ranks */
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_gnum_t n_rank_min = cs_glob_lagr_particle_set->n_particles;
+    cs_gnum_t n_rank_max = n_rank_min;
+    int n_ranks_active = (n_rank_min > 0) ? 1 : 0;
+
+    cs_parall_min(1, CS_GNUM_TYPE, &n_rank_min);
+    cs_parall_max(1, CS_GNUM_TYPE, &n_rank_max);
+    cs_parall_sum(1, CS_INT_TYPE, &n_ranks_active);
+
+    double n_rank_mean = (double)(pc->n_g_total) / cs_glob_n_ranks;
+    double imbalance = (n_rank_mean > 0) ? n_rank_max / n_rank_mean : 1.;
+
+    cs_log_printf(CS_LOG_DEFAULT, "\n");
+    cs_log_printf(CS_LOG_DEFAULT,
+                  _("   Distribution of particles among ranks:\n"));
+    cs_log_printf(CS_LOG_DEFAULT, "\n");
+    cs_log_printf
+      (CS_LOG_DEFAULT,
+       _("ln  minimum and maximum per rank             %8llu   %8llu\n"),
+       (unsigned long long)n_rank_min, (unsigned long long)n_rank_max);
+    cs_log_printf
+      (CS_LOG_DEFAULT,
+       _("ln  mean per rank                            %14.5E\n"),
+       n_rank_mean);
+    cs_log_printf
+      (CS_LOG_DEFAULT,
+       _("ln  imbalance (maximum / mean)               %14.5E\n"),
+       imbalance);
+    cs_log_printf
+      (CS_LOG_DEFAULT,
+       _("ln  ranks holding particles                  %8d / %d\n"),
+       n_ranks_active, cs_glob_n_ranks);
+
+  }
+
       cs_log_separator(CS_LOG_DEFAULT);
 
   /* Flow rate for each zone   */
@@ -102,7 +102,8 @@ BEGIN_C_DECLS
    rprp real properties at current an previous time steps
    iprp integer properties at current and previous time steps
    rkid values are for rank ids, useful and valid only for previous
-   time steps */
+   time steps
+   gprp global number properties at current time step */
 
 typedef enum {
   CS_LAGR_P_RVAR_TS = 1, /* CS_LAGR_P_RVAR with possible source terms */
@@ -111,6 +112,7 @@ typedef enum {
   CS_LAGR_P_RPRP,
   CS_LAGR_P_IPRP,
   CS_LAGR_P_RKID,
+  CS_LAGR_P_GPRP,
 } _array_map_id_t;
 
 /*============================================================================
@@ -157,6 +159,7 @@ const char *cs_lagr_attribute_name[] = {
   "state_flag",
   "cell_id",
   "rank_id",
+  "id",
   "rebound_id",
   "random_value",
   "stat_weight",
@@ -224,6 +227,10 @@ static cs_lagr_attribute_map_t  *_p_attr_map = NULL;
 static  double              _reallocation_factor = 2.0;
 static  unsigned long long  _n_g_max_particles = ULLONG_MAX;
 
+/* Highest global particle id assigned so far */
+
+static  cs_gnum_t  _n_g_particle_ids = 0;
+
 /*============================================================================
  * Global variables
  *============================================================================*/
@@ -257,6 +264,97 @@ _align_extents(size_t  size)
   return retval;
 }
 
+/*----------------------------------------------------------------------------*
+ * Determine datatype and time values range of an attribute based on the
+ * array (attribute key) it is associated with.
+ *
+ * parameters:
+ *   array_key   <-- associated array key
+ *   datatype    --> associated datatype
+ *   min_time_id --> minimum time id
+ *   max_time_id --> maximum time id
+ *
+ * returns:
+ *   true if the attribute is present, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_attr_array_info(cs_lnum_t       array_key,
+                 cs_datatype_t  *datatype,
+                 int            *min_time_id,
+                 int            *max_time_id)
+{
+  /*
+    ieptp/ieptpa integer values at current and previous time steps
+    pepa real values at current time step
+    ipepa integer values at current time step */
+
+  *datatype = CS_REAL_TYPE;
+  *min_time_id = 0;
+  *max_time_id = 0;
+
+  /* Behavior depending on array */
+
+  switch(array_key) {
+  case CS_LAGR_P_RVAR_TS:
+  case CS_LAGR_P_RVAR:
+    *max_time_id = 1;
+    break;
+  case CS_LAGR_P_IVAR:
+    *datatype = CS_LNUM_TYPE;
+    *max_time_id = 1;
+    break;
+  case CS_LAGR_P_RPRP:
+    break;
+  case CS_LAGR_P_IPRP:
+    *datatype = CS_LNUM_TYPE;
+    break;
+  case CS_LAGR_P_RKID:
+    *datatype = CS_LNUM_TYPE;
+    *min_time_id = 1;
+    *max_time_id = 1;
+    break;
+  case CS_LAGR_P_GPRP:
+    *datatype = CS_GNUM_TYPE;
+    break;
+  default:
+    return false;
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*
+ * Add an attribute to a particle attribute map.
+ *
+ * parameters:
+ *   p_am        <-> particle attribute map
+ *   attr        <-- attribute
+ *   attr_count  <-- number of values for this attribute
+ *   datatype    <-- associated datatype
+ *   time_id     <-- associated time id
+ *   min_time_id <-- first time id for this attribute
+ *----------------------------------------------------------------------------*/
+
+static void
+_add_attr_to_map(cs_lagr_attribute_map_t  *p_am,
+                 cs_lagr_attribute_t       attr,
+                 int                       attr_count,
+                 cs_datatype_t             datatype,
+                 int                       time_id,
+                 int                       min_time_id)
+{
+  p_am->displ[time_id][attr] = p_am->extents;
+  p_am->count[time_id][attr] = attr_count;
+  if (time_id == min_time_id) {
+    p_am->datatype[attr] = datatype;
+    p_am->size[attr] =   p_am->count[time_id][attr]
+                       * cs_datatype_size[p_am->datatype[attr]];
+  }
+
+  p_am->extents += p_am->size[attr];
+}
+
 /*----------------------------------------------------------------------------*
  * Map particle attributes for a given configuration.
  *
@@ -327,7 +425,54 @@ _create_attr_map(cs_lnum_t attr_keys[CS_LAGR_N_ATTRIBUTES][3])
                             order,
                             CS_LAGR_N_ATTRIBUTES);
 
-  /* Loop on available times */
+  for (attr = 0; attr < CS_LAGR_N_ATTRIBUTES; attr++) {
+    p_am->datatype[attr] = CS_DATATYPE_NULL;
+    for (int time_id = 0; time_id < p_am->n_time_vals; time_id++) {
+      p_am->displ[time_id][attr] =-1;
+      p_am->count[time_id][attr] = 0;
+    }
+  }
+
+  /* Attributes used by the trajectory integration and tracking stages
+     are placed first, with their current and previous values side
+     by side, so that those stages only access the first cache lines
+     of each particle record. Real values are placed before integer
+     values to avoid padding. */
+
+  const cs_lagr_attribute_t hot_attrs[]
+    = {CS_LAGR_COORDS, CS_LAGR_VELOCITY, CS_LAGR_VELOCITY_SEEN,
+       CS_LAGR_STAT_WEIGHT, CS_LAGR_MASS, CS_LAGR_DIAMETER,
+       CS_LAGR_CELL_ID, CS_LAGR_P_FLAG};
+  const int n_hot_attrs = sizeof(hot_attrs) / sizeof(hot_attrs[0]);
+
+  bool is_hot[CS_LAGR_N_ATTRIBUTES];
+  for (attr = 0; attr < CS_LAGR_N_ATTRIBUTES; attr++)
+    is_hot[attr] = false;
+
+  for (int i = 0; i < n_hot_attrs; i++) {
+
+    cs_datatype_t datatype;
+    int min_time_id, max_time_id;
+
+    attr = hot_attrs[i];
+
+    if (attr_keys[attr][0] < 1)
+      continue;
+    if (! _attr_array_info(attr_keys[attr][0],
+                           &datatype, &min_time_id, &max_time_id))
+      continue;
+
+    is_hot[attr] = true;
+
+    for (int time_id = min_time_id; time_id <= max_time_id; time_id++)
+      _add_attr_to_map(p_am, attr, attr_keys[attr][2], datatype,
+                       time_id, min_time_id);
+
+  }
+
+  p_am->extents = _align_extents(p_am->extents);
+
+  /* Loop on available times for other attributes */
 
   for (int time_id = 0; time_id < p_am->n_time_vals; time_id++) {
 
@@ -337,48 +482,16 @@ _create_attr_map(cs_lnum_t attr_keys[CS_LAGR_N_ATTRIBUTES][3])
 
     for (int i = 0; i < CS_LAGR_N_ATTRIBUTES; i++) {
 
-      cs_datatype_t datatype = CS_REAL_TYPE;
-      int min_time_id = 0;
-      int max_time_id = 0;
+      cs_datatype_t datatype;
+      int min_time_id, max_time_id;
 
       attr = order[i];
 
-      if (time_id == 0)
-        p_am->datatype[attr] = CS_DATATYPE_NULL;
-      p_am->displ[time_id][attr] =-1;
-      p_am->count[time_id][attr] = 0;
+      if (attr_keys[attr][0] < 1 || is_hot[attr]) continue;
 
-      if (attr_keys[attr][0] < 1) continue;
-
-      /*
-        ieptp/ieptpa integer values at current and previous time steps
-        pepa real values at current time step
-        ipepa integer values at current time step */
-
-      /* Behavior depending on array */
-
-      switch(attr_keys[attr][0]) {
-      case CS_LAGR_P_RVAR_TS:
-      case CS_LAGR_P_RVAR:
-        max_time_id = 1;
-        break;
-      case CS_LAGR_P_IVAR:
-        datatype = CS_LNUM_TYPE;
-        max_time_id = 1;
-        break;
-      case CS_LAGR_P_RPRP:
-        break;
-      case CS_LAGR_P_IPRP:
-        datatype = CS_LNUM_TYPE;
-        break;
-      case CS_LAGR_P_RKID:
-        datatype = CS_LNUM_TYPE;
-        min_time_id = 1;
-        max_time_id = 1;
-        break;
-      default:
+      if (! _attr_array_info(attr_keys[attr][0],
+                             &datatype, &min_time_id, &max_time_id))
         continue;
-      }
 
       if (time_id < min_time_id || time_id > max_time_id)
         continue;
@@ -392,15 +505,8 @@ _create_attr_map(cs_lnum_t attr_keys[CS_LAGR_N_ATTRIBUTES][3])
 
       /* Add attribute to map */
 
-      p_am->displ[time_id][attr] = p_am->extents;
-      p_am->count[time_id][attr] = attr_keys[attr][2];
-      if (time_id == min_time_id) {
-        p_am->datatype[attr] = datatype;
-        p_am->size[attr] =   p_am->count[time_id][attr]
-                           * cs_datatype_size[p_am->datatype[attr]];
-      }
-
-      p_am->extents += p_am->size[attr];
+      _add_attr_to_map(p_am, attr, attr_keys[attr][2], datatype,
+                       time_id, min_time_id);
 
     }
 
@@ -689,6 +795,9 @@ cs_lagr_particle_attr_initialize(void)
   attr_keys[CS_LAGR_RANK_ID][0] = CS_LAGR_P_RKID;
   attr_keys[CS_LAGR_RANK_ID][1] = 1;
 
+  attr_keys[CS_LAGR_ID][0] = CS_LAGR_P_GPRP;
+  attr_keys[CS_LAGR_ID][1] = ++loc_count;
+
   /* Other attributes */
 
   attr_keys[CS_LAGR_P_FLAG][0] = CS_LAGR_P_IPRP;
@@ -1256,6 +1365,172 @@ cs_lagr_particles_current_to_previous(cs_lagr_particle_set_t  *particles,
   *((cs_lnum_t *)(p_buf + p_am->displ[1][CS_LAGR_RANK_ID])) = cs_glob_rank_id;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Reorder a range of particles by increasing cell id.
+ *
+ * A stable counting sort is used, so the relative order of particles
+ * in a given cell is preserved. Particles with a negative cell id
+ * are placed after all others. If the range is already ordered,
+ * particle data is not moved.
+ *
+ * If cell_index is non-NULL, it is filled so that particles
+ * of cell i are found in range [cell_index[i], cell_index[i+1]) of
+ * the particle set, while particles with no cell are found in
+ * range [cell_index[n_cells], end).
+ *
+ * \param[in, out]  particles   associated particle set
+ * \param[in]       start       id of first particle of range
+ * \param[in]       end         past-the-end id of range
+ * \param[in]       n_cells     number of cells
+ * \param[out]      cell_index  cell -> particles index (size: n_cells+1),
+ *                              or NULL
+ *
+ * \return  true if particles were moved, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_lagr_particle_set_sort_by_cell(cs_lagr_particle_set_t  *particles,
+                                  cs_lnum_t                start,
+                                  cs_lnum_t                end,
+                                  cs_lnum_t                n_cells,
+                                  cs_lnum_t                cell_index[])
+{
+  const cs_lagr_attribute_map_t  *p_am = particles->p_am;
+  const size_t extents = p_am->extents;
+  const ptrdiff_t displ = p_am->displ[0][CS_LAGR_CELL_ID];
+
+  const cs_lnum_t n_p = end - start;
+  unsigned char *p_buf = particles->p_buffer + extents*start;
+
+  /* Count particles per cell (particles with no cell counted last) */
+
+  cs_lnum_t *p_count;
+  BFT_MALLOC(p_count, n_cells + 3, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_cells + 3; i++)
+    p_count[i] = 0;
+
+  bool is_sorted = true;
+  cs_lnum_t prev_key = -1;
+
+  for (cs_lnum_t i = 0; i < n_p; i++) {
+    cs_lnum_t cell_id
+      = *((const cs_lnum_t *)(p_buf + extents*i + displ));
+    cs_lnum_t key = (cell_id > -1 && cell_id < n_cells) ? cell_id : n_cells;
+    if (key < prev_key)
+      is_sorted = false;
+    prev_key = key;
+    p_count[key + 2] += 1;
+  }
+
+  /* p_count[i+1] is the start of cell i after this */
+
+  p_count[1] = 0;
+  for (cs_lnum_t i = 2; i < n_cells + 2; i++)
+    p_count[i] += p_count[i-1];
+
+  if (cell_index != NULL) {
+    for (cs_lnum_t i = 0; i < n_cells + 1; i++)
+      cell_index[i] = p_count[i+1] + start;
+  }
+
+  /* Permute particle data if needed */
+
+  if (is_sorted == false) {
+
+    unsigned char *s_buf;
+    BFT_MALLOC(s_buf, extents*n_p, unsigned char);
+
+    memcpy(s_buf, p_buf, extents*n_p);
+
+    for (cs_lnum_t i = 0; i < n_p; i++) {
+      const unsigned char *src = s_buf + extents*i;
+      cs_lnum_t cell_id = *((const cs_lnum_t *)(src + displ));
+      cs_lnum_t key = (cell_id > -1 && cell_id < n_cells) ? cell_id : n_cells;
+      cs_lnum_t j = p_count[key + 1];
+      p_count[key + 1] += 1;
+      memcpy(p_buf + extents*j, src, extents);
+    }
+
+    BFT_FREE(s_buf);
+
+  }
+
+  BFT_FREE(p_count);
+
+  return (! is_sorted);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Assign new global ids to a range of particles.
+ *
+ * Ids are numbered in rank order, following the highest id assigned
+ * (or read) so far, so that a given id is never reused during a
+ * computation.
+ *
+ * This function is collective.
+ *
+ * \param[in, out]  particles  associated particle set
+ * \param[in]       start      id of first particle of range
+ * \param[in]       end        past-the-end id of range
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_assign_ids(cs_lagr_particle_set_t  *particles,
+                                cs_lnum_t                start,
+                                cs_lnum_t                end)
+{
+  cs_gnum_t n_new = (end > start) ? end - start : 0;
+  cs_gnum_t base_shift = _n_g_particle_ids + 1;
+  cs_gnum_t n_g_new = n_new;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_gnum_t g_shift = 0;
+    MPI_Scan(&n_new, &g_shift, 1, CS_MPI_GNUM, MPI_SUM, cs_glob_mpi_comm);
+    base_shift += g_shift - n_new;
+    cs_parall_counter(&n_g_new, 1);
+  }
+#endif
+
+  for (cs_lnum_t i = start; i < end; i++)
+    cs_lagr_particles_set_gnum(particles, i, CS_LAGR_ID,
+                               base_shift + (cs_gnum_t)(i - start));
+
+  _n_g_particle_ids += n_g_new;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update the global particle id counter based on the ids of
+ *        existing particles (such as those read from a checkpoint).
+ *
+ * This function is collective.
+ *
+ * \param[in]  particles  associated particle set
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_sync_ids(const cs_lagr_particle_set_t  *particles)
+{
+  cs_gnum_t id_max = _n_g_particle_ids;
+
+  for (cs_lnum_t i = 0; i < particles->n_particles; i++) {
+    cs_gnum_t p_id = cs_lagr_particles_get_gnum(particles, i, CS_LAGR_ID);
+    if (p_id > id_max)
+      id_max = p_id;
+  }
+
+  cs_parall_max(1, CS_GNUM_TYPE, &id_max);
+
+  _n_g_particle_ids = id_max;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Dump a cs_lagr_particle_set_t structure
@@ -82,6 +82,8 @@ typedef enum {
 
   CS_LAGR_CELL_ID,             /*!< local cell id (0 to n-1) */
   CS_LAGR_RANK_ID,             /*!< local parallel rank id */
+  CS_LAGR_ID,                  /*!< global particle id (1 to n),
+                                    or 0 if not assigned */
 
   CS_LAGR_REBOUND_ID,          /*!< number of time steps since rebound, or -1 */
 
@@ -1439,6 +1441,73 @@ void
 cs_lagr_particles_current_to_previous(cs_lagr_particle_set_t  *particles,
                                       cs_lnum_t                particle_id);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Reorder a range of particles by increasing cell id.
+ *
+ * A stable counting sort is used, so the relative order of particles
+ * in a given cell is preserved. Particles with a negative cell id
+ * are placed after all others. If the range is already ordered,
+ * particle data is not moved.
+ *
+ * If cell_index is non-NULL, it is filled so that particles
+ * of cell i are found in range [cell_index[i], cell_index[i+1]) of
+ * the particle set, while particles with no cell are found in
+ * range [cell_index[n_cells], end).
+ *
+ * \param[in, out]  particles   associated particle set
+ * \param[in]       start       id of first particle of range
+ * \param[in]       end         past-the-end id of range
+ * \param[in]       n_cells     number of cells
+ * \param[out]      cell_index  cell -> particles index (size: n_cells+1),
+ *                              or NULL
+ *
+ * \return  true if particles were moved, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_lagr_particle_set_sort_by_cell(cs_lagr_particle_set_t  *particles,
+                                  cs_lnum_t                start,
+                                  cs_lnum_t                end,
+                                  cs_lnum_t                n_cells,
+                                  cs_lnum_t                cell_index[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Assign new global ids to a range of particles.
+ *
+ * Ids are numbered in rank order, following the highest id assigned
+ * (or read) so far, so that a given id is never reused during a
+ * computation.
+ *
+ * This function is collective.
+ *
+ * \param[in, out]  particles  associated particle set
+ * \param[in]       start      id of first particle of range
+ * \param[in]       end        past-the-end id of range
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_assign_ids(cs_lagr_particle_set_t  *particles,
+                                cs_lnum_t                start,
+                                cs_lnum_t                end);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update the global particle id counter based on the ids of
+ *        existing particles (such as those read from a checkpoint).
+ *
+ * This function is collective.
+ *
+ * \param[in]  particles  associated particle set
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_sync_ids(const cs_lagr_particle_set_t  *particles);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Dump a cs_lagr_particle_set_t structure
@@ -0,0 +1,516 @@
+/*============================================================================
+ * Lagrangian module particle population control
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_math.h"
+#include "cs_mesh.h"
+#include "cs_random.h"
+
+#include "cs_lagr.h"
+#include "cs_lagr_particle.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_lagr_population.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_lagr_population.c
+
+  Particle population control keeps the number of particles of each cell
+  within user-defined bounds:
+
+  - in cells holding more than \ref cs_lagr_population_control_t::n_cell_max
+    particles, pairs of particles of the same statistical class and
+    similar diameter are merged, the heavier particle of each pair
+    absorbing the other;
+  - in cells holding less than \ref cs_lagr_population_control_t::n_cell_min
+    particles, the heaviest particles are split into two identical
+    particles of half weight, whose trajectories then diverge through
+    the stochastic terms of the trajectory equations.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local types and structures
+ *============================================================================*/
+
+/* Sorting key for particles of a cell */
+
+typedef struct {
+
+  cs_lnum_t  class_id;   /* statistical class */
+  cs_real_t  val;        /* diameter or weight */
+  cs_lnum_t  p_id;       /* particle id */
+
+} _p_key_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static cs_lagr_population_control_t  _cs_glob_lagr_population_control
+  = {.n_cell_max = 0,
+     .n_cell_min = 0,
+     .diameter_tol = 0.1,
+     .min_split_weight = 0.};
+
+/*============================================================================
+ * Global variables
+ *============================================================================*/
+
+cs_lagr_population_control_t  *cs_glob_lagr_population_control
+  = &_cs_glob_lagr_population_control;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Compare particle keys by class, then increasing value, then id.
+ *----------------------------------------------------------------------------*/
+
+static int
+_compare_keys(const void  *a,
+              const void  *b)
+{
+  const _p_key_t *ka = a, *kb = b;
+
+  if (ka->class_id != kb->class_id)
+    return (ka->class_id < kb->class_id) ? -1 : 1;
+  if (ka->val < kb->val)
+    return -1;
+  if (ka->val > kb->val)
+    return 1;
+  return (ka->p_id < kb->p_id) ? -1 : (ka->p_id > kb->p_id);
+}
+
+/*----------------------------------------------------------------------------
+ * Merge a particle into another one.
+ *
+ * Statistical weight, mass and momentum are conserved, as is thermal
+ * energy when particle temperature is present. The surviving particle
+ * keeps its position and density.
+ *
+ * parameters:
+ *   p_set <-> particle set
+ *   i     <-- id of surviving particle
+ *   j     <-- id of absorbed particle
+ *----------------------------------------------------------------------------*/
+
+static void
+_merge_pair(cs_lagr_particle_set_t  *p_set,
+            cs_lnum_t                i,
+            cs_lnum_t                j)
+{
+  const cs_lagr_attribute_map_t  *p_am = p_set->p_am;
+
+  const cs_real_t w_i = cs_lagr_particles_get_real(p_set, i,
+                                                   CS_LAGR_STAT_WEIGHT);
+  const cs_real_t w_j = cs_lagr_particles_get_real(p_set, j,
+                                                   CS_LAGR_STAT_WEIGHT);
+  const cs_real_t m_i = cs_lagr_particles_get_real(p_set, i, CS_LAGR_MASS);
+  const cs_real_t m_j = cs_lagr_particles_get_real(p_set, j, CS_LAGR_MASS);
+
+  const cs_real_t w = w_i + w_j;
+  const cs_real_t wm_i = w_i*m_i, wm_j = w_j*m_j;
+  const cs_real_t wm = wm_i + wm_j;
+
+  /* Momentum (mass-weighted velocity) */
+
+  const cs_real_t c_i = (wm > 0) ? wm_i/wm : w_i/w;
+  const cs_real_t c_j = 1. - c_i;
+
+  cs_real_t *v_i = cs_lagr_particles_attr(p_set, i, CS_LAGR_VELOCITY);
+  const cs_real_t *v_j = cs_lagr_particles_attr_const(p_set, j,
+                                                      CS_LAGR_VELOCITY);
+
+  cs_real_t *vs_i = cs_lagr_particles_attr(p_set, i, CS_LAGR_VELOCITY_SEEN);
+  const cs_real_t *vs_j = cs_lagr_particles_attr_const(p_set, j,
+                                                       CS_LAGR_VELOCITY_SEEN);
+
+  for (int k = 0; k < 3; k++) {
+    v_i[k] = c_i*v_i[k] + c_j*v_j[k];
+    vs_i[k] = (w_i*vs_i[k] + w_j*vs_j[k]) / w;
+  }
+
+  /* Thermal energy */
+
+  if (   p_am->count[0][CS_LAGR_TEMPERATURE] > 0
+      && p_am->count[0][CS_LAGR_CP] > 0) {
+
+    const int n_layers = p_am->count[0][CS_LAGR_TEMPERATURE];
+
+    const cs_real_t cp_i = cs_lagr_particles_get_real(p_set, i, CS_LAGR_CP);
+    const cs_real_t cp_j = cs_lagr_particles_get_real(p_set, j, CS_LAGR_CP);
+    const cs_real_t h_i = wm_i*cp_i, h_j = wm_j*cp_j;
+
+    if (h_i + h_j > 0) {
+      cs_real_t *t_i = cs_lagr_particles_attr(p_set, i, CS_LAGR_TEMPERATURE);
+      const cs_real_t *t_j
+        = cs_lagr_particles_attr_const(p_set, j, CS_LAGR_TEMPERATURE);
+      for (int k = 0; k < n_layers; k++)
+        t_i[k] = (h_i*t_i[k] + h_j*t_j[k]) / (h_i + h_j);
+      if (wm > 0)
+        cs_lagr_particles_set_real(p_set, i, CS_LAGR_CP, (h_i + h_j)/wm);
+    }
+
+  }
+
+  if (p_am->count[0][CS_LAGR_FLUID_TEMPERATURE] > 0) {
+    cs_real_t tf
+      = (  w_i*cs_lagr_particles_get_real(p_set, i, CS_LAGR_FLUID_TEMPERATURE)
+         + w_j*cs_lagr_particles_get_real(p_set, j, CS_LAGR_FLUID_TEMPERATURE))
+        / w;
+    cs_lagr_particles_set_real(p_set, i, CS_LAGR_FLUID_TEMPERATURE, tf);
+  }
+
+  /* Residence time */
+
+  cs_real_t r_t
+    = (  w_i*cs_lagr_particles_get_real(p_set, i, CS_LAGR_RESIDENCE_TIME)
+       + w_j*cs_lagr_particles_get_real(p_set, j, CS_LAGR_RESIDENCE_TIME))
+      / w;
+  cs_lagr_particles_set_real(p_set, i, CS_LAGR_RESIDENCE_TIME, r_t);
+
+  /* Mass and diameter (at constant density) */
+
+  const cs_real_t m = wm / w;
+
+  if (m_i > 0) {
+    cs_real_t d_i = cs_lagr_particles_get_real(p_set, i, CS_LAGR_DIAMETER);
+    cs_lagr_particles_set_real(p_set, i, CS_LAGR_DIAMETER,
+                               d_i * cbrt(m / m_i));
+  }
+  cs_lagr_particles_set_real(p_set, i, CS_LAGR_MASS, m);
+
+  cs_lagr_particles_set_real(p_set, i, CS_LAGR_STAT_WEIGHT, w);
+  cs_lagr_particles_set_real(p_set, j, CS_LAGR_STAT_WEIGHT, 0.);
+}
+
+/*----------------------------------------------------------------------------
+ * Merge particles of a cell until their number does not exceed a target.
+ *
+ * parameters:
+ *   p_set    <-> particle set
+ *   n_max    <-- target number of particles
+ *   d_tol    <-- maximum relative diameter difference for merging
+ *   n_keys   <-- number of candidate particles
+ *   keys     <-> candidate particle keys (work array)
+ *   merged   <-> flag for merged (absorbed) particles
+ *
+ * returns:
+ *   number of absorbed particles
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_merge_cell(cs_lagr_particle_set_t  *p_set,
+            cs_lnum_t                n_max,
+            cs_real_t                d_tol,
+            cs_lnum_t                n_keys,
+            _p_key_t                 keys[],
+            char                     merged[])
+{
+  cs_lnum_t n_merged = 0;
+  cs_lnum_t n_cur = n_keys;
+
+  while (n_cur > n_max) {
+
+    /* Order remaining candidates by class and diameter */
+
+    for (cs_lnum_t k = 0; k < n_cur; k++)
+      keys[k].val = cs_lagr_particles_get_real(p_set, keys[k].p_id,
+                                               CS_LAGR_DIAMETER);
+
+    qsort(keys, n_cur, sizeof(_p_key_t), _compare_keys);
+
+    /* Merge neighbors in that order */
+
+    cs_lnum_t n_pass_merged = 0;
+
+    for (cs_lnum_t k = 0; k < n_cur - 1 && n_cur - n_pass_merged > n_max; k++) {
+
+      const _p_key_t *k0 = keys + k, *k1 = keys + k + 1;
+
+      if (   k0->class_id != k1->class_id
+          || k1->val - k0->val > d_tol * k1->val)
+        continue;
+
+      cs_lnum_t i = k0->p_id, j = k1->p_id;
+      if (  cs_lagr_particles_get_real(p_set, j, CS_LAGR_STAT_WEIGHT)
+          > cs_lagr_particles_get_real(p_set, i, CS_LAGR_STAT_WEIGHT)) {
+        i = k1->p_id;
+        j = k0->p_id;
+      }
+
+      _merge_pair(p_set, i, j);
+      merged[j] = 1;
+
+      /* Keep survivor in first position of pair, mark other */
+
+      keys[k].p_id = i;
+      keys[k+1].p_id = -1;
+
+      n_pass_merged++;
+      k++;
+
+    }
+
+    if (n_pass_merged == 0)
+      break;
+
+    /* Remove absorbed particles from candidates */
+
+    cs_lnum_t n_remain = 0;
+    for (cs_lnum_t k = 0; k < n_cur; k++) {
+      if (keys[k].p_id > -1)
+        keys[n_remain++] = keys[k];
+    }
+
+    n_cur = n_remain;
+    n_merged += n_pass_merged;
+
+  }
+
+  return n_merged;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Merge or split particles so that the number of particles in each
+ *        cell remains within the population control bounds.
+ *
+ * Only particles in the flow (i.e. not deposited or otherwise flagged)
+ * are considered. Merging conserves the statistical weight, mass and
+ * momentum (and thermal energy when particle temperature is solved)
+ * of the merged particles; splitting conserves all weighted quantities.
+ *
+ * This function is collective.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_population_control(void)
+{
+  const cs_lagr_population_control_t  *pc = cs_glob_lagr_population_control;
+
+  if (pc->n_cell_max < 1 && pc->n_cell_min < 1)
+    return;
+
+  if (   cs_glob_lagr_model->physical_model == 2
+      || cs_glob_lagr_model->agglomeration == 1
+      || cs_glob_lagr_model->fragmentation == 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Lagrangian particle population control is not compatible\n"
+                "with the coal combustion, agglomeration or fragmentation\n"
+                "models."));
+
+  if (pc->n_cell_max > 0 && pc->n_cell_min >= pc->n_cell_max)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Lagrangian particle population control:\n"
+                "the minimum number of particles per cell (%d) must be\n"
+                "lower than the maximum number of particles per cell (%d)."),
+              (int)pc->n_cell_min, (int)pc->n_cell_max);
+
+  cs_lagr_particle_set_t  *p_set = cs_glob_lagr_particle_set;
+  const cs_lagr_attribute_map_t  *p_am = p_set->p_am;
+  const size_t extents = p_am->extents;
+
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_lnum_t n_particles = p_set->n_particles;
+
+  const bool have_class = (p_am->count[0][CS_LAGR_STAT_CLASS] > 0);
+
+  /* Group particles by cell */
+
+  cs_lnum_t *cell_index;
+  BFT_MALLOC(cell_index, n_cells + 1, cs_lnum_t);
+
+  cs_lagr_particle_set_sort_by_cell(p_set, 0, n_particles,
+                                    n_cells, cell_index);
+
+  cs_lnum_t n_max_keys = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    if (cell_index[c_id+1] - cell_index[c_id] > n_max_keys)
+      n_max_keys = cell_index[c_id+1] - cell_index[c_id];
+  }
+
+  _p_key_t *keys;
+  BFT_MALLOC(keys, n_max_keys, _p_key_t);
+
+  char *merged;
+  BFT_MALLOC(merged, n_particles, char);
+  memset(merged, 0, n_particles);
+
+  cs_lnum_t n_merged = 0;
+  cs_lnum_t n_split = 0, n_split_max = 0;
+  cs_lnum_t *split_ids = NULL;
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+    /* Candidate particles */
+
+    cs_lnum_t n_keys = 0;
+
+    for (cs_lnum_t p_id = cell_index[c_id]; p_id < cell_index[c_id+1]; p_id++) {
+      int p_flag = cs_lagr_particles_get_lnum(p_set, p_id, CS_LAGR_P_FLAG);
+      if (   (p_flag & CS_LAGR_PART_DEPOSITION_FLAGS)
+          || cs_lagr_particles_get_real(p_set, p_id, CS_LAGR_STAT_WEIGHT) <= 0)
+        continue;
+      keys[n_keys].class_id
+        = (have_class) ?
+          cs_lagr_particles_get_lnum(p_set, p_id, CS_LAGR_STAT_CLASS) : 0;
+      keys[n_keys].p_id = p_id;
+      n_keys++;
+    }
+
+    /* Merge particles in overpopulated cells */
+
+    if (pc->n_cell_max > 0 && n_keys > pc->n_cell_max)
+      n_merged += _merge_cell(p_set, pc->n_cell_max, pc->diameter_tol,
+                              n_keys, keys, merged);
+
+    /* Select heaviest particles for splitting in underpopulated cells */
+
+    else if (pc->n_cell_min > 0 && n_keys > 0 && n_keys < pc->n_cell_min) {
+
+      for (cs_lnum_t k = 0; k < n_keys; k++) {
+        keys[k].class_id = 0;
+        keys[k].val = - cs_lagr_particles_get_real(p_set, keys[k].p_id,
+                                                   CS_LAGR_STAT_WEIGHT);
+      }
+
+      qsort(keys, n_keys, sizeof(_p_key_t), _compare_keys);
+
+      cs_lnum_t n_c_split = CS_MIN(pc->n_cell_min - n_keys, n_keys);
+
+      for (cs_lnum_t k = 0; k < n_c_split; k++) {
+        if (-keys[k].val < pc->min_split_weight)
+          break;
+        if (n_split >= n_split_max) {
+          n_split_max = CS_MAX(2*n_split_max, 16);
+          BFT_REALLOC(split_ids, n_split_max, cs_lnum_t);
+        }
+        split_ids[n_split++] = keys[k].p_id;
+      }
+
+    }
+
+  }
+
+  BFT_FREE(keys);
+  BFT_FREE(cell_index);
+
+  /* Split selected particles (new particles appended to the set) */
+
+  if (cs_lagr_particle_set_resize(n_particles + n_split) < 0)
+    n_split = 0;
+
+  for (cs_lnum_t k = 0; k < n_split; k++) {
+
+    cs_lnum_t src_id = split_ids[k];
+    cs_lnum_t dest_id = n_particles + k;
+
+    cs_real_t w = cs_lagr_particles_get_real(p_set, src_id,
+                                             CS_LAGR_STAT_WEIGHT);
+    cs_lagr_particles_set_real(p_set, src_id, CS_LAGR_STAT_WEIGHT, 0.5*w);
+
+    memcpy(p_set->p_buffer + extents*dest_id,
+           p_set->p_buffer + extents*src_id,
+           extents);
+
+    cs_real_t random = -1;
+    cs_random_uniform(1, &random);
+    cs_lagr_particles_set_real(p_set, dest_id, CS_LAGR_RANDOM_VALUE, random);
+
+  }
+
+  BFT_FREE(split_ids);
+
+  /* Remove absorbed particles */
+
+  cs_lnum_t n_total = n_particles + n_split;
+  cs_lnum_t count = 0;
+
+  for (cs_lnum_t p_id = 0; p_id < n_total; p_id++) {
+    if (p_id < n_particles && merged[p_id])
+      continue;
+    if (count < p_id)
+      memcpy(p_set->p_buffer + extents*count,
+             p_set->p_buffer + extents*p_id,
+             extents);
+    count++;
+  }
+
+  BFT_FREE(merged);
+
+  p_set->n_particles = count;
+  p_set->n_part_merged += n_merged;
+
+  /* Split particles are new particles */
+
+  cs_lagr_particle_set_assign_ids(p_set, count - n_split, count);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,95 @@
+#ifndef __CS_LAGR_POPULATION_H__
+#define __CS_LAGR_POPULATION_H__
+
+/*============================================================================
+ * Lagrangian module particle population control
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include "cs_lagr_particle.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*! Parameters of the particle population control */
+/* ---------------------------------------------- */
+
+typedef struct {
+
+  cs_lnum_t   n_cell_max;        /*!< maximum number of particles per cell
+                                      above which particles are merged
+                                      (no merging if 0) */
+  cs_lnum_t   n_cell_min;        /*!< minimum number of particles per cell
+                                      under which particles are split
+                                      (no splitting if 0) */
+  cs_real_t   diameter_tol;      /*!< maximum relative diameter difference
+                                      of two particles for merging */
+  cs_real_t   min_split_weight;  /*!< minimum statistical weight of a
+                                      particle for splitting */
+
+} cs_lagr_population_control_t;
+
+/*============================================================================
+  Global variables
+  ============================================================================*/
+
+extern cs_lagr_population_control_t  *cs_glob_lagr_population_control;
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Merge or split particles so that the number of particles in each
+ *        cell remains within the population control bounds.
+ *
+ * Only particles in the flow (i.e. not deposited or otherwise flagged)
+ * are considered. Merging conserves the statistical weight, mass and
+ * momentum (and thermal energy when particle temperature is solved)
+ * of the merged particles; splitting conserves all weighted quantities.
+ *
+ * This function is collective.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_population_control(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_LAGR_POPULATION_H__ */
@@ -291,6 +291,14 @@ _init_particle_values(cs_lagr_particle_set_t  *particles,
     }
     break;
 
+  case CS_LAGR_ID:
+    {
+      /* Checkpoints from older versions do not contain particle ids */
+      assert(datatype == CS_GNUM_TYPE);
+      cs_lagr_particle_set_assign_ids(particles, 0, n_particles);
+    }
+    break;
+
   case CS_LAGR_TEMPERATURE:
   case CS_LAGR_FLUID_TEMPERATURE:
     {
@@ -424,8 +432,6 @@ cs_lagr_restart_read_particle_data(cs_restart_t  *r)
   cs_datatype_t datatype;
   int  stride, sec_code;
   cs_restart_val_type_t restart_type;
-  unsigned char *vals = NULL;
-  size_t max_size = 0;
 
   char sec_name[128], old_name[128];
 
@@ -503,6 +509,16 @@ cs_lagr_restart_read_particle_data(cs_restart_t  *r)
   /* Loop on all other attributes, handling special cases */
   /*------------------------------------------------------*/
 
+  /* Sections of attributes without special handling which are present
+     with their current name are read together, after this loop */
+
+  int n_sections = 0;
+  char **s_name = NULL;
+  cs_lagr_attribute_t *s_attr = NULL;
+  int *s_comp_id = NULL, *s_stride = NULL;
+  cs_restart_val_type_t *s_type = NULL;
+  void **s_vals = NULL;
+
   for (cs_lagr_attribute_t attr = 0; attr < CS_LAGR_N_ATTRIBUTES; attr++) {
 
     cs_lagr_get_attr_info(p_set, 0, attr,
@@ -529,7 +545,8 @@ cs_lagr_restart_read_particle_data(cs_restart_t  *r)
 
     case CS_LAGR_NEIGHBOR_FACE_ID:
       {
-        cs_lnum_t *face_id = (cs_lnum_t *)vals;
+        cs_lnum_t *face_id = NULL;
+        BFT_MALLOC(face_id, p_set->n_particles, cs_lnum_t);
 
         /* Initialize to default */
 
@@ -616,71 +633,151 @@ cs_lagr_restart_read_particle_data(cs_restart_t  *r)
                              CS_LNUM_TYPE,
                              1,
                              -1,
-                             vals);
+                             face_id);
+
+        BFT_FREE(face_id);
       }
       break;
 
     default:
+      {
+        int n_attr_sections = stride;
 
-      if (size > max_size) {
-        max_size = size;
-        BFT_REALLOC(vals, max_size*n_particles, unsigned char);
-      }
+        if (   attr == CS_LAGR_VELOCITY
+            || attr == CS_LAGR_VELOCITY_SEEN)
+          n_attr_sections = 1;
 
-      int n_sections = stride;
+        const size_t c_size = (n_attr_sections == 1) ? size : size/stride;
 
-      if (   attr == CS_LAGR_VELOCITY
-          || attr == CS_LAGR_VELOCITY_SEEN)
-        n_sections = 1;
+        BFT_REALLOC(s_name, n_sections + n_attr_sections, char *);
+        BFT_REALLOC(s_attr, n_sections + n_attr_sections,
+                    cs_lagr_attribute_t);
+        BFT_REALLOC(s_comp_id, n_sections + n_attr_sections, int);
+        BFT_REALLOC(s_stride, n_sections + n_attr_sections, int);
+        BFT_REALLOC(s_type, n_sections + n_attr_sections,
+                    cs_restart_val_type_t);
+        BFT_REALLOC(s_vals, n_sections + n_attr_sections, void *);
 
-      for (int s_id = 0; s_id < n_sections; s_id++) {
+        for (int c_id = 0; c_id < n_attr_sections; c_id++) {
 
-        int comp_id = (n_sections == 1) ? -1 : s_id;
-        int c_stride = (n_sections == 1) ? stride : 1;
+          int s_id = n_sections;
 
-        _lagr_section_name(attr, comp_id, sec_name);
-        _legacy_section_name(attr, old_name);
+          s_attr[s_id] = attr;
+          s_comp_id[s_id] = (n_attr_sections == 1) ? -1 : c_id;
+          s_stride[s_id] = (n_attr_sections == 1) ? stride : 1;
+          s_type[s_id] = restart_type;
 
-        /* Try to read data */
+          BFT_MALLOC(s_name[s_id], 128, char);
+          _lagr_section_name(attr, s_comp_id[s_id], s_name[s_id]);
 
-        sec_code = cs_restart_read_section_compat(r,
-                                                  sec_name,
-                                                  old_name,
-                                                  particles_location_id,
-                                                  c_stride,
-                                                  restart_type,
-                                                  vals);
+          unsigned char *vals = NULL;
+          BFT_MALLOC(vals, c_size*n_particles, unsigned char);
+          s_vals[s_id] = vals;
 
-        /* Finish setting values */
+          /* Sections not present with their current name (possibly
+             present with a legacy name) are read immediately */
 
-        if (sec_code == CS_RESTART_SUCCESS) {
+          sec_code = cs_restart_check_section(r,
+                                              s_name[s_id],
+                                              particles_location_id,
+                                              s_stride[s_id],
+                                              restart_type);
 
-          if (attr == CS_LAGR_STAT_WEIGHT) {
-            cs_real_t *w = (cs_real_t *)vals;
-            for (cs_lnum_t i = 0; i < p_set->n_particles; i++)
-              p_set->weight += w[i];
-          }
+          if (sec_code == CS_RESTART_SUCCESS)
+            n_sections += 1;
 
-          _set_particle_values(p_set,
-                               attr,
-                               datatype,
-                               stride,
-                               -1,
-                               vals);
+          else {
 
-          retval += 1;
+            _legacy_section_name(attr, old_name);
+
+            sec_code = cs_restart_read_section_compat(r,
+                                                      s_name[s_id],
+                                                      old_name,
+                                                      particles_location_id,
+                                                      s_stride[s_id],
+                                                      restart_type,
+                                                      vals);
+
+            if (sec_code == CS_RESTART_SUCCESS) {
+              _set_particle_values(p_set,
+                                   attr,
+                                   datatype,
+                                   stride,
+                                   s_comp_id[s_id],
+                                   vals);
+              retval += 1;
+            }
+            else
+              _init_particle_values(p_set, attr, s_comp_id[s_id]);
+
+            BFT_FREE(s_name[s_id]);
+            BFT_FREE(s_vals[s_id]);
+
+          }
 
         }
-        else
-          _init_particle_values(p_set, attr, -1);
+      }
+
+    }
+
+  }
+
+  /* Read other sections together, and finish setting values */
+
+  int *s_code = NULL;
+  BFT_MALLOC(s_code, n_sections, int);
 
+  retval += cs_restart_read_sections(r,
+                                     n_sections,
+                                     (const char *const *)s_name,
+                                     particles_location_id,
+                                     s_stride,
+                                     s_type,
+                                     s_vals,
+                                     s_code);
+
+  for (int s_id = 0; s_id < n_sections; s_id++) {
+
+    cs_lagr_attribute_t attr = s_attr[s_id];
+
+    cs_lagr_get_attr_info(p_set, 0, attr,
+                          &extents, &size, &displ, &datatype, &stride);
+
+    if (s_code[s_id] == CS_RESTART_SUCCESS) {
+
+      if (attr == CS_LAGR_STAT_WEIGHT) {
+        cs_real_t *w = (cs_real_t *)(s_vals[s_id]);
+        for (cs_lnum_t i = 0; i < p_set->n_particles; i++)
+          p_set->weight += w[i];
       }
 
+      _set_particle_values(p_set,
+                           attr,
+                           datatype,
+                           stride,
+                           s_comp_id[s_id],
+                           s_vals[s_id]);
+
     }
+    else
+      _init_particle_values(p_set, attr, s_comp_id[s_id]);
+
+    BFT_FREE(s_name[s_id]);
+    BFT_FREE(s_vals[s_id]);
 
   }
 
-  BFT_FREE(vals);
+  BFT_FREE(s_code);
+  BFT_FREE(s_vals);
+  BFT_FREE(s_type);
+  BFT_FREE(s_stride);
+  BFT_FREE(s_comp_id);
+  BFT_FREE(s_attr);
+  BFT_FREE(s_name);
+
+  /* Ensure newly assigned particle ids do not collide with those read */
+
+  cs_lagr_particle_set_sync_ids(p_set);
 
   return retval;
 }
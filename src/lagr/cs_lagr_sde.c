@@ -73,6 +73,14 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*=============================================================================
+ * Local Macro definitions
+ *============================================================================*/
+
+/* Number of particles handled together by structure-of-arrays kernels */
+
+#define _SDE_BLOCK_SIZE 128
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -143,6 +151,308 @@ _add_resuspension_event(cs_lagr_event_set_t     *events,
   events->n_events += 1;
 }
 
+/*----------------------------------------------------------------------------*/
+/*! \brief Integrate 1st order SDEs for a particle in a given direction.
+ *
+ * Brownian motion terms are handled by the caller.
+ *
+ * This function only uses values passed as arguments, so that when inlined
+ * in a loop on particle arrays, that loop may be vectorized.
+ *
+ * \param[in]   dtp    time step
+ * \param[in]   taup   dynamic characteristic time
+ * \param[in]   tlag   lagrangian fluid characteristic time
+ * \param[in]   bx     turbulence characteristics
+ * \param[in]   tci    II*TL+<u> term
+ * \param[in]   force  taup times forces on particle
+ * \param[in]   vp0    particle velocity at previous time
+ * \param[in]   vs0    velocity seen at previous time
+ * \param[in]   g      gaussian random variables
+ * \param[out]  e_aux  exp(-dtp/taup)
+ * \param[out]  dx     displacement (without Brownian motion)
+ * \param[out]  vs     velocity seen
+ * \param[out]  vp     particle velocity (without Brownian motion)
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_sde_1_integrate(cs_real_t        dtp,
+                 cs_real_t        taup,
+                 cs_real_t        tlag,
+                 cs_real_t        bx,
+                 cs_real_t        tci,
+                 cs_real_t        force,
+                 cs_real_t        vp0,
+                 cs_real_t        vs0,
+                 const cs_real_t  g[3],
+                 cs_real_t       *e_aux,
+                 cs_real_t       *dx,
+                 cs_real_t       *vs,
+                 cs_real_t       *vp)
+{
+  cs_real_t aux2, aux3, aux4, aux5, aux6, aux7, aux8;
+  cs_real_t aux9, aux10, aux11;
+  cs_real_t ter1f, ter2f, ter3f;
+  cs_real_t ter1p, ter2p, ter3p, ter4p, ter5p;
+  cs_real_t ter1x, ter2x, ter3x, ter4x, ter5x;
+  cs_real_t p11, p21, p22, p31, p32, p33;
+  cs_real_t omega2, gama2, omegam;
+  cs_real_t grga2, gagam, gaome;
+
+  /* --> (2.2) Calcul des coefficients/termes deterministes */
+  /* ----------------------------------------------------    */
+
+  cs_real_t aux1 = exp(-dtp / taup);
+  aux2 = exp(-dtp / tlag);
+  aux3 = tlag / (tlag - taup);
+  aux4 = tlag / (tlag + taup);
+  aux5 = tlag * (1.0 - aux2);
+  aux6 = cs_math_pow2(bx) * tlag;
+  aux7 = tlag - taup;
+  aux8 = cs_math_pow2(bx) * cs_math_pow2(aux3);
+
+  /* --> trajectory terms */
+  cs_real_t aa = taup * (1.0 - aux1);
+  cs_real_t bb = (aux5 - aa) * aux3;
+  cs_real_t cc = dtp - aa - bb;
+
+  ter1x = aa * vp0;
+  ter2x = bb * vs0;
+  ter3x = cc * tci;
+  ter4x = (dtp - aa) * force;
+
+  /* --> flow-seen velocity terms   */
+  ter1f = vs0 * aux2;
+  ter2f = tci * (1.0 - aux2);
+
+  /* --> termes pour la vitesse des particules     */
+  cs_real_t dd = aux3 * (aux2 - aux1);
+  cs_real_t ee = 1.0 - aux1;
+
+  ter1p = vp0 * aux1;
+  ter2p = vs0 * dd;
+  ter3p = tci * (ee - dd);
+  ter4p = force * ee;
+
+  /* --> integrale sur la vitesse du fluide vu     */
+  gama2  = 0.5 * (1.0 - aux2 * aux2);
+  p11   = sqrt(gama2 * aux6);
+  ter3f = p11 * g[0];
+
+  /* --> integral for the particles velocity  */
+  aux9  = 0.5 * tlag * (1.0 - aux2 * aux2);
+  aux10 = 0.5 * taup * (1.0 - aux1 * aux1);
+  aux11 =   taup * tlag
+          * (1.0 - aux1 * aux2)
+          / (taup + tlag);
+
+  grga2 = (aux9 - 2.0 * aux11 + aux10) * aux8;
+  gagam = (aux9 - aux11) * (aux8 / aux3);
+
+  if (CS_ABS(p11) > cs_math_epzero) {
+
+    p21 = gagam / p11;
+    p22 = grga2 - cs_math_pow2(p21);
+    p22 = sqrt(CS_MAX(0.0, p22));
+
+  }
+  else {
+
+    p21 = 0.0;
+    p22 = 0.0;
+
+  }
+
+  ter5p = p21 * g[0] + p22 * g[1];
+
+  /* --> (2.3) Calcul des coefficients pour les integrales stochastiques :  */
+  /* --> integrale sur la position des particules  */
+  gaome = ( (tlag - taup) * (aux5 - aa)
+            - tlag * aux9
+            - taup * aux10
+            + (tlag + taup) * aux11)
+          * aux8;
+  omegam = aux3 * ( (tlag - taup) * (1.0 - aux2)
+                    - 0.5 * tlag * (1.0 - aux2 * aux2)
+                    + cs_math_pow2(taup) / (tlag + taup) * (1.0 - aux1 * aux2)
+                    ) * aux6;
+  omega2 =   aux7 * (aux7 * dtp - 2.0 * (tlag * aux5 - taup * aa))
+           + 0.5 * tlag * tlag * aux5 * (1.0 + aux2)
+           + 0.5 * taup * taup * aa * (1.0 + aux1)
+           - 2.0 * aux4 * tlag * taup * taup * (1.0 - aux1* aux2);
+  omega2 = aux8 * omega2;
+
+  if (p11 > cs_math_epzero)
+    p31 = omegam / p11;
+  else
+    p31 = 0.0;
+
+  if (p22 > cs_math_epzero)
+    p32 = (gaome - p31 * p21) / p22;
+  else
+    p32 = 0.0;
+
+  p33 = omega2 - cs_math_pow2(p31) - cs_math_pow2(p32);
+  p33 = sqrt(CS_MAX(0.0, p33));
+  ter5x = p31 * g[0] + p32 * g[1] + p33 * g[2];
+
+  *e_aux = aux1;
+
+  *dx = ter1x + ter2x + ter3x + ter4x + ter5x;
+  *vs = ter1f + ter2f + ter3f;
+  *vp = ter1p + ter2p + ter3p + ter4p + ter5p;
+}
+
+/*----------------------------------------------------------------------------*/
+/*! \brief Integration of SDEs by 1st order time scheme for spherical
+ *         particles without Brownian motion.
+ *
+ * Particles are handled by blocks: the attributes used by the integration
+ * are gathered from the particle records to structure-of-arrays buffers,
+ * so the integration loop itself works on contiguous values and may be
+ * vectorized, and only the updated attributes are scattered back.
+ *
+ * Results are the same as those of the general (per-particle) path.
+ *
+ * \param[in]  dtp       time step
+ * \param[in]  taup      dynamic characteristic time
+ * \param[in]  tlag      lagrangian fluid characteristic time
+ * \param[in]  piil      term in integration of UP SDEs
+ * \param[in]  bx        turbulence characteristics
+ * \param[in]  vagaus    gaussian random variables
+ * \param[in]  force_p   taup times forces on particles (m/s)
+ */
+/*------------------------------------------------------------------------------*/
+
+static void
+_lages1_soa(cs_real_t           dtp,
+            const cs_real_t     taup[],
+            const cs_real_3_t   tlag[],
+            const cs_real_3_t   piil[],
+            const cs_real_33_t  bx[],
+            const cs_real_33_t  vagaus[],
+            const cs_real_3_t   force_p[])
+{
+  cs_lagr_particle_set_t  *p_set = cs_glob_lagr_particle_set;
+  const cs_lagr_attribute_map_t  *p_am = p_set->p_am;
+
+  cs_lagr_extra_module_t *extra = cs_get_lagr_extra_module();
+
+  cs_lnum_t nor = cs_glob_lagr_time_step->nor;
+
+  const int _prev_id = (extra->vel->n_time_vals > 1) ? 1 : 0;
+  const cs_real_3_t *cvar_vel
+    = (const cs_real_3_t *)(extra->vel->vals[_prev_id]);
+
+  const cs_lnum_t n_particles = p_set->n_particles;
+  const cs_lnum_t n_blocks
+    = (n_particles + _SDE_BLOCK_SIZE - 1) / _SDE_BLOCK_SIZE;
+
+# pragma omp parallel for if (n_particles > CS_THR_MIN)
+  for (cs_lnum_t b_id = 0; b_id < n_blocks; b_id++) {
+
+    cs_lnum_t p_ids[_SDE_BLOCK_SIZE];
+    cs_real_t tp[_SDE_BLOCK_SIZE];
+    cs_real_t tl[3][_SDE_BLOCK_SIZE], b_x[3][_SDE_BLOCK_SIZE];
+    cs_real_t tci[3][_SDE_BLOCK_SIZE], fp[3][_SDE_BLOCK_SIZE];
+    cs_real_t vp0[3][_SDE_BLOCK_SIZE], vs0[3][_SDE_BLOCK_SIZE];
+    cs_real_t g[3][3][_SDE_BLOCK_SIZE];
+    cs_real_t dx[3][_SDE_BLOCK_SIZE];
+    cs_real_t vs[3][_SDE_BLOCK_SIZE], vp[3][_SDE_BLOCK_SIZE];
+
+    const cs_lnum_t s_id = b_id * _SDE_BLOCK_SIZE;
+    const cs_lnum_t e_id = CS_MIN(s_id + _SDE_BLOCK_SIZE, n_particles);
+
+    /* Gather */
+
+    cs_lnum_t n = 0;
+
+    for (cs_lnum_t ip = s_id; ip < e_id; ip++) {
+
+      unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
+
+      if (cs_lagr_particles_get_flag(p_set, ip, CS_LAGR_PART_FIXED))
+        continue;
+
+      cs_lnum_t cell_id = cs_lagr_particle_get_lnum(particle, p_am,
+                                                    CS_LAGR_CELL_ID);
+      if (cell_id < 0)
+        continue;
+
+      const cs_real_t *old_part_vel
+        = cs_lagr_particle_attr_n(particle, p_am, 1, CS_LAGR_VELOCITY);
+      const cs_real_t *old_part_vel_seen
+        = cs_lagr_particle_attr_n(particle, p_am, 1, CS_LAGR_VELOCITY_SEEN);
+
+      p_ids[n] = ip;
+      tp[n] = taup[ip];
+
+      for (int id = 0; id < 3; id++) {
+        tl[id][n] = tlag[ip][id];
+        b_x[id][n] = bx[ip][id][nor-1];
+        tci[id][n] = piil[ip][id] * tlag[ip][id] + cvar_vel[cell_id][id];
+        fp[id][n] = force_p[ip][id];
+        vp0[id][n] = old_part_vel[id];
+        vs0[id][n] = old_part_vel_seen[id];
+        for (int k = 0; k < 3; k++)
+          g[id][k][n] = vagaus[ip][id][k];
+      }
+
+      n++;
+
+    }
+
+    /* Integrate */
+
+    for (int id = 0; id < 3; id++) {
+
+#     pragma omp simd
+      for (cs_lnum_t j = 0; j < n; j++) {
+        cs_real_t e_aux;
+        cs_real_t _g[3] = {g[id][0][j], g[id][1][j], g[id][2][j]};
+        _sde_1_integrate(dtp,
+                         tp[j],
+                         tl[id][j],
+                         b_x[id][j],
+                         tci[id][j],
+                         fp[id][j],
+                         vp0[id][j],
+                         vs0[id][j],
+                         _g,
+                         &e_aux,
+                         &(dx[id][j]),
+                         &(vs[id][j]),
+                         &(vp[id][j]));
+      }
+
+    }
+
+    /* Scatter */
+
+    for (cs_lnum_t j = 0; j < n; j++) {
+
+      unsigned char *particle = p_set->p_buffer + p_am->extents * p_ids[j];
+
+      const cs_real_t *old_part_coords
+        = cs_lagr_particle_attr_n(particle, p_am, 1, CS_LAGR_COORDS);
+      cs_real_t *part_coords
+        = cs_lagr_particle_attr(particle, p_am, CS_LAGR_COORDS);
+      cs_real_t *part_vel
+        = cs_lagr_particle_attr(particle, p_am, CS_LAGR_VELOCITY);
+      cs_real_t *part_vel_seen
+        = cs_lagr_particle_attr(particle, p_am, CS_LAGR_VELOCITY_SEEN);
+
+      for (int id = 0; id < 3; id++) {
+        part_coords[id] = old_part_coords[id] + dx[id][j];
+        part_vel[id] = vp[id][j];
+        part_vel_seen[id] = vs[id][j];
+      }
+
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*! \brief Integration of SDEs by 1st order time scheme
  *
@@ -179,23 +489,25 @@ _lages1(cs_real_t           dtp,
 
   cs_real_t tkelvi = cs_physical_constants_celsius_to_kelvin;
 
-  cs_real_t aux1, aux2, aux3, aux4, aux5, aux6, aux7, aux8, aux9, aux10, aux11;
-  cs_real_t ter1f, ter2f, ter3f;
-  cs_real_t ter1p, ter2p, ter3p, ter4p, ter5p;
-  cs_real_t ter1x, ter2x, ter3x, ter4x, ter5x;
-  cs_real_t p11, p21, p22, p31, p32, p33;
-  cs_real_t omega2, gama2, omegam;
-  cs_real_t grga2, gagam, gaome;
-  cs_real_t tbrix1, tbrix2, tbriu;
-
   cs_lnum_t nor = cs_glob_lagr_time_step->nor;
 
   const int _prev_id = (extra->vel->n_time_vals > 1) ? 1 : 0;
   const cs_real_3_t *cvar_vel
     = (const cs_real_3_t *)(extra->vel->vals[_prev_id]);
 
-  /* Integrate SDE's over particles */
+  /* Use blocked structure-of-arrays variant when possible */
+
+  if (   cs_glob_lagr_model->shape == 0
+      && cs_glob_lagr_brownian->lamvbr != 1) {
+    _lages1_soa(dtp, taup, tlag, piil, bx, vagaus, force_p);
+    return;
+  }
+
+  /* Integrate SDE's over particles; each particle only updates its own
+     attributes and terbru, and random values are drawn beforehand,
+     so the loop may be threaded. */
 
+# pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
   for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
 
     unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
@@ -329,6 +641,8 @@ _lages1(cs_real_t           dtp,
 
       for (cs_lnum_t id = 0; id < 3; id++) {
 
+        cs_real_t tbrix1, tbrix2, tbriu;
+
         /* --> (2.1) Calcul preliminaires :    */
         /* ----------------------------   */
         /* calcul de II*TL+<u> et [(grad<P>/rhop+g)*tau_p+<Uf>] ?  */
@@ -336,102 +650,24 @@ _lages1(cs_real_t           dtp,
         cs_real_t tci = piil_r[id] * tlag_r[id] + fluid_vel_r[id];
         cs_real_t force = force_p_r[id];
 
-        /* --> (2.2) Calcul des coefficients/termes deterministes */
-        /* ----------------------------------------------------    */
-
-        aux1 = exp(-dtp / taup_r[id]);
-        aux2 = exp(-dtp / tlag_r[id]);
-        aux3 = tlag_r[id] / (tlag_r[id] - taup_r[id]);
-        aux4 = tlag_r[id] / (tlag_r[id] + taup_r[id]);
-        aux5 = tlag_r[id] * (1.0 - aux2);
-        aux6 = cs_math_pow2(bx[ip][id][nor-1]) * tlag_r[id];
-        aux7 = tlag_r[id] - taup_r[id];
-        aux8 = cs_math_pow2(bx[ip][id][nor-1]) * cs_math_pow2(aux3);
-
-        /* --> trajectory terms */
-        cs_real_t aa = taup_r[id] * (1.0 - aux1);
-        cs_real_t bb = (aux5 - aa) * aux3;
-        cs_real_t cc = dtp - aa - bb;
-
-        ter1x = aa * old_part_vel_r[id];
-        ter2x = bb * old_part_vel_seen_r[id];
-        ter3x = cc * tci;
-        ter4x = (dtp - aa) * force;
-
-        /* --> flow-seen velocity terms   */
-        ter1f = old_part_vel_seen_r[id] * aux2;
-        ter2f = tci * (1.0 - aux2);
-
-        /* --> termes pour la vitesse des particules     */
-        cs_real_t dd = aux3 * (aux2 - aux1);
-        cs_real_t ee = 1.0 - aux1;
-
-        ter1p = old_part_vel_r[id] * aux1;
-        ter2p = old_part_vel_seen_r[id] * dd;
-        ter3p = tci * (ee - dd);
-        ter4p = force * ee;
-
-        /* --> integrale sur la vitesse du fluide vu     */
-        gama2  = 0.5 * (1.0 - aux2 * aux2);
-        p11   = sqrt(gama2 * aux6);
-        ter3f = p11 * vagaus[ip][id][0];
-
-        /* --> integral for the particles velocity  */
-        aux9  = 0.5 * tlag_r[id] * (1.0 - aux2 * aux2);
-        aux10 = 0.5 * taup_r[id] * (1.0 - aux1 * aux1);
-        aux11 =   taup_r[id] * tlag_r[id]
-                * (1.0 - aux1 * aux2)
-                / (taup_r[id] + tlag_r[id]);
-
-        grga2 = (aux9 - 2.0 * aux11 + aux10) * aux8;
-        gagam = (aux9 - aux11) * (aux8 / aux3);
-
-        if (CS_ABS(p11) > cs_math_epzero) {
-
-          p21 = gagam / p11;
-          p22 = grga2 - cs_math_pow2(p21);
-          p22 = sqrt(CS_MAX(0.0, p22));
+        /* --> (2.2) Deterministic and stochastic integrals */
 
-        }
-        else {
+        cs_real_t aux1, dx, vs, vp;
 
-          p21 = 0.0;
-          p22 = 0.0;
+        _sde_1_integrate(dtp,
+                         taup_r[id],
+                         tlag_r[id],
+                         bx[ip][id][nor-1],
+                         tci,
+                         force,
+                         old_part_vel_r[id],
+                         old_part_vel_seen_r[id],
+                         vagaus[ip][id],
+                         &aux1,
+                         &dx,
+                         &vs,
+                         &vp);
 
-        }
-
-        ter5p = p21 * vagaus[ip][id][0] + p22 * vagaus[ip][id][1];
-
-        /* --> (2.3) Calcul des coefficients pour les integrales stochastiques :  */
-        /* --> integrale sur la position des particules  */
-        gaome = ( (tlag_r[id] - taup_r[id]) * (aux5 - aa)
-                  - tlag_r[id] * aux9
-                  - taup_r[id] * aux10
-                  + (tlag_r[id] + taup_r[id]) * aux11)
-                * aux8;
-        omegam = aux3 * ( (tlag_r[id] - taup_r[id]) * (1.0 - aux2)
-                          - 0.5 * tlag_r[id] * (1.0 - aux2 * aux2)
-                          + cs_math_pow2(taup_r[id]) / (tlag_r[id] + taup_r[id]) * (1.0 - aux1 * aux2)
-                          ) * aux6;
-        omega2 =   aux7 * (aux7 * dtp - 2.0 * (tlag_r[id] * aux5 - taup_r[id] * aa))
-                 + 0.5 * tlag_r[id] * tlag_r[id] * aux5 * (1.0 + aux2)
-                 + 0.5 * taup_r[id] * taup_r[id] * aa * (1.0 + aux1)
-                 - 2.0 * aux4 * tlag_r[id] * taup_r[id] * taup_r[id] * (1.0 - aux1* aux2);
-        omega2 = aux8 * omega2;
-
-        if (p11 > cs_math_epzero)
-          p31 = omegam / p11;
-        else
-          p31 = 0.0;
-
-        if (p22 > cs_math_epzero)
-          p32 = (gaome - p31 * p21) / p22;
-        else
-          p32 = 0.0;
-
-        p33 = omega2 - cs_math_pow2(p31) - cs_math_pow2(p32);
-        p33 = sqrt(CS_MAX(0.0, p33));
-        ter5x = p31 * vagaus[ip][id][0] + p32 * vagaus[ip][id][1] + p33 * vagaus[ip][id][2];
 
         /* --> (2.3) Calcul des Termes dans le cas du mouvement Brownien :   */
         if (cs_glob_lagr_brownian->lamvbr == 1) {
@@ -521,13 +757,13 @@ _lages1(cs_real_t           dtp,
         /* Finalisation des ecritures */
 
         /* --> trajectory  */
-        displ_r[id] = ter1x + ter2x + ter3x + ter4x + ter5x + tbrix1 + tbrix2;
+        displ_r[id] = dx + tbrix1 + tbrix2;
 
         /* --> flow-seen velocity    */
-        part_vel_seen_r[id] = ter1f + ter2f + ter3f;
+        part_vel_seen_r[id] = vs;
 
         /* --> particles velocity    */
-        part_vel_r[id] = ter1p + ter2p + ter3p + ter4p + ter5p + tbriu;
+        part_vel_r[id] = vp + tbriu;
 
       }
 
@@ -647,15 +883,6 @@ _lages2(cs_real_t           dtp,
         const cs_real_3_t   force_p[],
         cs_real_t          *terbru)
 {
-  cs_real_t  aux0, aux1, aux2, aux3, aux4, aux5, aux6, aux7, aux8, aux9;
-  cs_real_t  aux10, aux11, aux12, aux17, aux18, aux19;
-  cs_real_t  aux20;
-  cs_real_t  ter1, ter2, ter3, ter4, ter5;
-  cs_real_t  sige, tapn, gamma2;
-  cs_real_t  grgam2, gagam;
-  cs_real_t  p11, p21, p22;
-  cs_real_t  tbriu;
-
   /* Particles management */
   cs_lagr_particle_set_t  *p_set = cs_glob_lagr_particle_set;
   const cs_lagr_attribute_map_t  *p_am = p_set->p_am;
@@ -681,6 +908,7 @@ _lages2(cs_real_t           dtp,
   /* --> Compute tau_p*A_p and II*TL+<u> :
    *     -------------------------------------*/
 
+# pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
   for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
 
     if (cs_lagr_particles_get_flag(p_set, ip, CS_LAGR_PART_FIXED))
@@ -710,6 +938,7 @@ _lages2(cs_real_t           dtp,
   if (nor == 1) {
 
     /* --> Sauvegarde de tau_p^n */
+#   pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
     for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
 
       if (cs_lagr_particles_get_flag(p_set, ip, CS_LAGR_PART_FIXED))
@@ -722,6 +951,7 @@ _lages2(cs_real_t           dtp,
     /* --> Sauvegarde couplage   */
     if (cs_glob_lagr_time_scheme->iilagr == CS_LAGR_TWOWAY_COUPLING) {
 
+#     pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
       for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
 
         unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
@@ -729,8 +959,8 @@ _lages2(cs_real_t           dtp,
         if (cs_lagr_particles_get_flag(p_set, ip, CS_LAGR_PART_FIXED))
           continue;
 
-        aux0     = -dtp / taup[ip];
-        aux1     =  exp(aux0);
+        cs_real_t aux0 = -dtp / taup[ip];
+        cs_real_t aux1 =  exp(aux0);
         tsfext[ip] =   taup[ip]
                      * cs_lagr_particle_get_real(particle, p_am, CS_LAGR_MASS)
                      * (-aux1 + (aux1 - 1.0) / aux0);
@@ -740,6 +970,7 @@ _lages2(cs_real_t           dtp,
     }
 
     /* Load terms at t = t_n : */
+#   pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
     for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
 
       unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
@@ -758,23 +989,23 @@ _lages2(cs_real_t           dtp,
 
       for (cs_lnum_t id = 0; id < 3; id++) {
 
-        aux0    =  -dtp / taup[ip];
-        aux1    =  -dtp / tlag[ip][id];
-        aux2    = exp(aux0);
-        aux3    = exp(aux1);
-        aux4    = tlag[ip][id] / (tlag[ip][id] - taup[ip]);
-        aux5    = aux3 - aux2;
+        cs_real_t aux0 =  -dtp / taup[ip];
+        cs_real_t aux1 =  -dtp / tlag[ip][id];
+        cs_real_t aux2 = exp(aux0);
+        cs_real_t aux3 = exp(aux1);
+        cs_real_t aux4 = tlag[ip][id] / (tlag[ip][id] - taup[ip]);
+        cs_real_t aux5 = aux3 - aux2;
 
         pred_part_vel_seen[id] =   0.5 * old_part_vel_seen[id]
                                  * aux3 + auxl[ip * 6 + id + 3]
                                  * (-aux3 + (aux3 - 1.0) / aux1);
 
-        ter1    = 0.5 * old_part_vel[id] * aux2;
-        ter2    = 0.5 * old_part_vel_seen[id] * aux4 * aux5;
-        ter3    =   auxl[ip * 6 + id + 3]
-                  * (  -aux2 + ((tlag[ip][id] + taup[ip]) / dtp) * (1.0 - aux2)
-                     - (1.0 + tlag[ip][id] / dtp) * aux4 * aux5);
-        ter4    = auxl[ip * 6 + id] * (-aux2 + (aux2 - 1.0) / aux0);
+        cs_real_t ter1 = 0.5 * old_part_vel[id] * aux2;
+        cs_real_t ter2 = 0.5 * old_part_vel_seen[id] * aux4 * aux5;
+        cs_real_t ter3 =   auxl[ip * 6 + id + 3]
+                         * (  -aux2 + ((tlag[ip][id] + taup[ip]) / dtp) * (1.0 - aux2)
+                            - (1.0 + tlag[ip][id] / dtp) * aux4 * aux5);
+        cs_real_t ter4 = auxl[ip * 6 + id] * (-aux2 + (aux2 - 1.0) / aux0);
         pred_part_vel[id] = ter1 + ter2 + ter3 + ter4;
 
       }
@@ -801,6 +1032,7 @@ _lages2(cs_real_t           dtp,
 
     /* Compute Us */
 
+#   pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
     for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
 
       unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
@@ -824,20 +1056,25 @@ _lages2(cs_real_t           dtp,
 
       for (cs_lnum_t id = 0; id < 3; id++) {
 
-        aux0    =  -dtp / taup[ip];
-        aux1    =  -dtp / tlag[ip][id];
-        aux2    = exp(aux0);
-        aux3    = exp(aux1);
-        aux4    = tlag[ip][id] / (tlag[ip][id] - taup[ip]);
-        aux5    = aux3 - aux2;
-        aux6    = aux3 * aux3;
-
-        ter1    = 0.5 * old_part_vel_seen[id] * aux3;
-        ter2    = auxl[ip * 6 + id + 3] * (1.0 - (aux3 - 1.0) / aux1);
-        ter3    =  -aux6 + (aux6 - 1.0) / (2.0 * aux1);
-        ter4    = 1.0 - (aux6 - 1.0) / (2.0 * aux1);
-
-        sige    =   (  ter3 * bx[ip][id][0]
+        cs_real_t aux7, aux8, aux9, aux10, aux11, aux12;
+        cs_real_t aux17, aux18, aux19, aux20;
+        cs_real_t ter5, tapn, gamma2, grgam2, gagam;
+        cs_real_t p11, p21, p22, tbriu;
+
+        cs_real_t aux0 =  -dtp / taup[ip];
+        cs_real_t aux1 =  -dtp / tlag[ip][id];
+        cs_real_t aux2 = exp(aux0);
+        cs_real_t aux3 = exp(aux1);
+        cs_real_t aux4 = tlag[ip][id] / (tlag[ip][id] - taup[ip]);
+        cs_real_t aux5 = aux3 - aux2;
+        cs_real_t aux6 = aux3 * aux3;
+
+        cs_real_t ter1 = 0.5 * old_part_vel_seen[id] * aux3;
+        cs_real_t ter2 = auxl[ip * 6 + id + 3] * (1.0 - (aux3 - 1.0) / aux1);
+        cs_real_t ter3 =  -aux6 + (aux6 - 1.0) / (2.0 * aux1);
+        cs_real_t ter4 = 1.0 - (aux6 - 1.0) / (2.0 * aux1);
+
+        cs_real_t sige =   (  ter3 * bx[ip][id][0]
                      + ter4 * bx[ip][id][1] )
                   * (1.0 / (1.0 - aux6));
 
@@ -2642,6 +2879,7 @@ cs_lagr_sde(cs_real_t           dt_p,
 
   if (cs_glob_lagr_time_scheme->idistu == 1) {
     if (cs_glob_lagr_time_step->nor > 1) {
+#     pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
       for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
         unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
         cs_real_t *_v_gauss = cs_lagr_particle_attr(particle, p_am,
@@ -2659,6 +2897,7 @@ cs_lagr_sde(cs_real_t           dt_p,
   }
 
   else {
+#   pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
     for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
       for (cs_lnum_t id = 0; id < 3; id++) {
         for (cs_lnum_t ivf = 0; ivf < 3; ivf++)
@@ -2673,6 +2912,7 @@ cs_lagr_sde(cs_real_t           dt_p,
   if (cs_glob_lagr_brownian->lamvbr == 1) {
     BFT_MALLOC(brgaus, p_set->n_particles*6, cs_real_t);
     if (cs_glob_lagr_time_step->nor > 1) {
+#     pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
       for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
         unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
         cs_real_t *_br_gauss = cs_lagr_particle_attr(particle, p_am,
@@ -2690,6 +2930,7 @@ cs_lagr_sde(cs_real_t           dt_p,
   /* Computation of particle density */
   cs_real_t aa = 6.0 / cs_math_pi;
 
+# pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
   for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
 
     cs_real_t d3 = cs_math_pow3(cs_lagr_particles_get_real(p_set, ip,
@@ -2704,6 +2945,7 @@ cs_lagr_sde(cs_real_t           dt_p,
   cs_real_3_t *force_p;
   BFT_MALLOC(force_p, p_set->n_particles, cs_real_3_t);
 
+# pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
   for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
     force_p[ip][0] = 0.0;
     force_p[ip][1] = 0.0;
@@ -2732,6 +2974,7 @@ cs_lagr_sde(cs_real_t           dt_p,
    *
    * */
   if (cs_glob_lagr_time_scheme->iadded_mass == 0) {
+#   pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
     for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
       unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
       cs_lnum_t cell_id = cs_lagr_particle_get_lnum(particle, p_am,
@@ -2745,6 +2988,7 @@ cs_lagr_sde(cs_real_t           dt_p,
   }
   /* Added-mass term?     */
   else {
+#   pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
     for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
       unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
       cs_lnum_t cell_id = cs_lagr_particle_get_lnum(particle, p_am,
@@ -2813,6 +3057,7 @@ cs_lagr_sde(cs_real_t           dt_p,
     /* Save Gaussian variable if needed */
     if (cs_glob_lagr_time_step->nor == 1) {
 
+#     pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
       for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
         unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
         if (cs_glob_lagr_time_scheme->idistu == 1) {
@@ -2882,6 +3127,7 @@ cs_lagr_sde_attr(cs_lagr_attribute_t   attr,
 
   if (nor == 1) {
 
+#   pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
     for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
 
       unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
@@ -2919,6 +3165,7 @@ cs_lagr_sde_attr(cs_lagr_attribute_t   attr,
   }
   else if (nor == 2) {
 
+#   pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
     for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
 
       if (   cs_lagr_particles_get_flag(p_set, ip, CS_LAGR_PART_FIXED)
@@ -2814,6 +2814,282 @@ _location_attr(int location_id)
   return location_attr;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build a cell -> particles index for particle-based statistics.
+ *
+ * Particles are not moved; a stable counting sort is used, so particles
+ * of a given cell are listed in the same order as in the particle set,
+ * and statistics updated cell by cell are identical to those obtained
+ * with a single loop on particles.
+ *
+ * \param[in]   p_set       particle set
+ * \param[in]   n_cells     number of cells
+ * \param[out]  cell_index  cell -> particles index (size: n_cells+1)
+ * \param[out]  p_ids       particle ids, grouped by cell
+ *                          (size: cell_index[n_cells])
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_particle_cell_index(const cs_lagr_particle_set_t  *p_set,
+                     cs_lnum_t                      n_cells,
+                     cs_lnum_t                    **cell_index,
+                     cs_lnum_t                    **p_ids)
+{
+  const cs_lnum_t n_particles = p_set->n_particles;
+
+  cs_lnum_t *_cell_index, *_p_ids;
+
+  BFT_MALLOC(_cell_index, n_cells + 1, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_cells + 1; i++)
+    _cell_index[i] = 0;
+
+  for (cs_lnum_t i = 0; i < n_particles; i++) {
+    cs_lnum_t cell_id = cs_lagr_particles_get_lnum(p_set, i, CS_LAGR_CELL_ID);
+    if (cell_id >= 0 && cell_id < n_cells)
+      _cell_index[cell_id + 1] += 1;
+  }
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    _cell_index[i+1] += _cell_index[i];
+
+  BFT_MALLOC(_p_ids, _cell_index[n_cells], cs_lnum_t);
+
+  cs_lnum_t *p_count;
+  BFT_MALLOC(p_count, n_cells, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    p_count[i] = _cell_index[i];
+
+  for (cs_lnum_t i = 0; i < n_particles; i++) {
+    cs_lnum_t cell_id = cs_lagr_particles_get_lnum(p_set, i, CS_LAGR_CELL_ID);
+    if (cell_id >= 0 && cell_id < n_cells)
+      _p_ids[p_count[cell_id]++] = i;
+  }
+
+  BFT_FREE(p_count);
+
+  *cell_index = _cell_index;
+  *p_ids = _p_ids;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update all particle-based moments sharing a weight accumulator.
+ *
+ * All moments are updated in a single pass on particles, so the particle
+ * weight and attribute access are shared. Particles being grouped by
+ * cell, cells are distributed among threads, each thread updating only
+ * values relative to its own cells, unless a user-defined particle data
+ * function is used for the weight or one of the moments.
+ *
+ * \param[in]       mwa         associated weight accumulator
+ * \param[in]       n_moments   number of moments to update
+ * \param[in]       moment_ids  ids of moments to update
+ * \param[in]       n_cells     number of cells
+ * \param[in]       cell_index  cell -> particles index
+ * \param[in]       p_ids       particle ids, grouped by cell
+ * \param[in]       dt_val      cell time step values
+ * \param[in]       dt_mult     0 for uniform time step, 1 for local
+ * \param[in, out]  l_wa_sum    weight sum for the current class
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_update_particle_moments(const cs_lagr_moment_wa_t  *mwa,
+                         int                         n_moments,
+                         const int                   moment_ids[],
+                         cs_lnum_t                   n_cells,
+                         const cs_lnum_t             cell_index[],
+                         const cs_lnum_t             p_ids[],
+                         const cs_real_t             dt_val[],
+                         cs_lnum_t                   dt_mult,
+                         cs_real_t         *restrict l_wa_sum)
+{
+  const cs_lagr_particle_set_t *p_set = cs_lagr_get_particle_set();
+  const cs_lagr_attribute_map_t *p_am = p_set->p_am;
+
+  const bool have_class = (p_am->displ[0][CS_LAGR_STAT_CLASS] > 0);
+
+  /* Values and associated means of moments */
+
+  cs_real_t **m_val, **m_mean_val;
+  int *m_attr_id;
+  BFT_MALLOC(m_val, n_moments, cs_real_t *);
+  BFT_MALLOC(m_mean_val, n_moments, cs_real_t *);
+  BFT_MALLOC(m_attr_id, n_moments, int);
+
+  int max_data_dim = 1;
+
+  /* User-defined particle data functions are not required to be
+     thread-safe, so moments using them are updated by a single thread */
+
+  bool threaded = (n_cells > CS_THR_MIN && mwa->p_data_func == NULL);
+
+  for (int i = 0; i < n_moments; i++) {
+    const cs_lagr_moment_t *mt = _lagr_moments + moment_ids[i];
+    if (mt->p_data_func != NULL)
+      threaded = false;
+    m_val[i] = cs_field_by_id(mt->f_id)->val;
+    m_mean_val[i] = NULL;
+    if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
+      assert(mt->l_id > -1);
+      const cs_lagr_moment_t *mt_mean = _lagr_moments + mt->l_id;
+      m_mean_val[i] = cs_field_by_id(mt_mean->f_id)->val;
+    }
+    m_attr_id[i] = cs_lagr_stat_type_to_attr_id(mt->stat_type);
+    if (mt->data_dim > max_data_dim)
+      max_data_dim = mt->data_dim;
+  }
+
+# pragma omp parallel if (threaded)
+  {
+    cs_real_t *pval_buf;
+    BFT_MALLOC(pval_buf, max_data_dim, cs_real_t);
+
+#   pragma omp for
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+
+      for (cs_lnum_t k = cell_index[cell_id]; k < cell_index[cell_id+1]; k++) {
+
+        unsigned char *particle = p_set->p_buffer + p_am->extents * p_ids[k];
+
+        int p_class = 0;
+        if (have_class)
+          p_class = cs_lagr_particle_get_lnum(particle, p_am,
+                                              CS_LAGR_STAT_CLASS);
+
+        if (p_class != mwa->class && mwa->class != 0)
+          continue;
+
+        /* weight associated to current particle */
+
+        cs_real_t p_weight;
+
+        if (mwa->p_data_func == NULL)
+          p_weight = cs_lagr_particle_get_real(particle, p_am,
+                                               CS_LAGR_STAT_WEIGHT);
+        else
+          mwa->p_data_func(mwa->data_input, particle, p_am, &p_weight);
+        p_weight *= dt_val[cell_id*dt_mult];
+
+        /* update weight sum with new particle weight */
+        const cs_real_t wa_sum_n = CS_MAX(p_weight + l_wa_sum[cell_id],
+                                          1e-100);
+
+        for (int i = 0; i < n_moments; i++) {
+
+          const cs_lagr_moment_t *mt = _lagr_moments + moment_ids[i];
+          cs_real_t *restrict val = m_val[i];
+          cs_real_t *restrict mean_val = m_mean_val[i];
+
+          cs_real_t *pval = pval_buf;
+          if (mt->p_data_func == NULL)
+            pval = cs_lagr_particle_attr(particle, p_am, m_attr_id[i]);
+          else
+            mt->p_data_func(mt->data_input, particle, p_am, pval);
+
+          if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
+
+            if (mt->dim == 6) { /* variance-covariance matrix */
+
+              assert(mt->data_dim == 3);
+
+              double delta[3], delta_n[3], r[3], m_n[3];
+
+              for (int l = 0; l < 3; l++) {
+
+                cs_lnum_t jl = cell_id*6 + l;
+                cs_lnum_t jml = cell_id*3 + l;
+                delta[l]   = pval[l] - mean_val[jml];
+                r[l] = delta[l] * (p_weight / wa_sum_n);
+                m_n[l] = mean_val[jml] + r[l];
+                delta_n[l] = pval[l] - m_n[l];
+                val[jl] = (  val[jl]*l_wa_sum[cell_id]
+                           + p_weight*delta[l]*delta_n[l]) / wa_sum_n;
+
+              }
+
+              /* Covariance terms.
+                 Note we could have a symmetric formula using
+                 0.5*(delta[i]*delta_n[j] + delta[j]*delta_n[i])
+                 instead of
+                 delta[i]*delta_n[j]
+                 but unit tests in cs_moment_test.c do not seem to favor
+                 one variant over the other; we use the simplest one.  */
+
+              cs_lnum_t j3 = cell_id*6 + 3,
+                        j4 = cell_id*6 + 4,
+                        j5 = cell_id*6 + 5;
+
+              val[j3] = (  val[j3]*l_wa_sum[cell_id]
+                         + p_weight*delta[0]*delta_n[1]) / wa_sum_n;
+              val[j4] = (  val[j4]*l_wa_sum[cell_id]
+                         + p_weight*delta[1]*delta_n[2]) / wa_sum_n;
+              val[j5] = (  val[j5]*l_wa_sum[cell_id]
+                         + p_weight*delta[0]*delta_n[2]) / wa_sum_n;
+
+              /* update mean value */
+
+              for (cs_lnum_t l = 0; l < 3; l++)
+                mean_val[cell_id*3 + l] += r[l];
+
+            }
+
+            else { /* simple variance */
+
+              const cs_lnum_t dim = mt->dim;
+
+              for (cs_lnum_t l = 0; l < dim; l++) {
+
+                double delta = pval[l] - mean_val[cell_id*dim+l];
+                double r = delta * (p_weight / wa_sum_n);
+                double m_n = mean_val[cell_id*dim+l] + r;
+
+                val[cell_id*dim+l]
+                  = (  val[cell_id*dim+l]*l_wa_sum[cell_id]
+                     + (p_weight*delta*(pval[l]-m_n))) / wa_sum_n;
+
+                /* update mean value */
+
+                mean_val[cell_id*dim+l] += r;
+
+              }
+
+            }
+
+          }
+
+          else if (mt->m_type == CS_LAGR_MOMENT_MEAN) {
+
+            const cs_lnum_t dim = mt->dim;
+
+            for (cs_lnum_t l = 0; l < dim; l++)
+              val[cell_id*dim+l] +=   (pval[l] - val[cell_id*dim+l])
+                                    * p_weight / wa_sum_n;
+
+          } /* End of test if moment is a variance or a mean */
+
+        } /* End of loop on moments */
+
+        /* update local weight associated to current class */
+
+        l_wa_sum[cell_id] += p_weight;
+
+      } /* End of loop on cell particles */
+
+    } /* End of loop on cells */
+
+    BFT_FREE(pval_buf);
+  }
+
+  BFT_FREE(m_attr_id);
+  BFT_FREE(m_mean_val);
+  BFT_FREE(m_val);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Update all particle-based moment and time moment accumulators.
@@ -2827,6 +3103,13 @@ _cs_lagr_stat_update_all(void)
   cs_lagr_particle_set_t *p_set = cs_lagr_get_particle_set();
   const cs_real_t *dt_val = _dt_val();
   cs_lnum_t dt_mult = (cs_glob_time_step->is_local) ? 1 : 0;
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+
+  /* Particle-based moments selection and cell -> particles index
+     (built when first needed) */
+
+  int *p_moment_ids = NULL;
+  cs_lnum_t *cell_index = NULL, *p_ids = NULL;
 
   /* First, update mesh-based statistics */
 
@@ -2862,7 +3145,10 @@ _cs_lagr_stat_update_all(void)
     cs_real_t m_w0[1];
     cs_real_t *restrict m_weight = _compute_current_weight_m(mwa, dt_val, m_w0);
 
-    /* Loop on variances first, then means */
+    /* Loop on variances first, then means; particle-based moments
+       are only selected here, and updated together afterwards */
+
+    int n_p_moments = 0;
 
     for (int m_type = CS_LAGR_MOMENT_VARIANCE;
          m_type >= (int)CS_LAGR_MOMENT_MEAN;
@@ -2878,186 +3164,28 @@ _cs_lagr_stat_update_all(void)
             && mwa->nt_start <= ts->nt_cur
             && mt->nt_cur < ts->nt_cur) {
 
-          int attr_id = cs_lagr_stat_type_to_attr_id(mt->stat_type);
-
           _ensure_init_moment(mt);
 
-          /* Copy weight sum content to a local array
-             for every new moment inside the current class */
-
-          if (m_weight == NULL && l_wa_sum == NULL)
-            BFT_MALLOC(l_wa_sum, n_w_elts, cs_real_t);
-
-          for (cs_lnum_t j = 0; j < n_w_elts; j++)
-            l_wa_sum[j] = g_wa_sum[j];
-
           /* Case where data is particle-based */
           /*-----------------------------------*/
 
           if (mt->m_data_func == NULL) {
 
-            cs_field_t *f = cs_field_by_id(mt->f_id);
-            cs_real_t *restrict val = f->val;
-
-            /* prepare submoment definition */
-
-            cs_lagr_moment_t *mt_mean = NULL;
-            cs_real_t *restrict mean_val = NULL;
-
-            /* Check if lower moment is defined and attached */
+            /* Lower moment of a variance is updated with it */
 
             if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
               assert(mt->l_id > -1);
-              mt_mean = _lagr_moments + mt->l_id;
+              cs_lagr_moment_t *mt_mean = _lagr_moments + mt->l_id;
               _ensure_init_moment(mt_mean);
-
-              cs_field_t *f_mean = cs_field_by_id(mt_mean->f_id);
-              mean_val = f_mean->val;
+              mt_mean->nt_cur = ts->nt_cur;
             }
 
-            cs_real_t *pval = NULL;
-            if (mt->p_data_func != NULL)
-              BFT_MALLOC(pval, mt->data_dim, cs_real_t);
-
-            for (cs_lnum_t part = 0; part < p_set->n_particles; part++) {
-
-              unsigned char *particle
-                = p_set->p_buffer + p_set->p_am->extents * part;
-
-              cs_lnum_t cell_id = cs_lagr_particle_get_lnum(particle, p_set->p_am,
-                                                            CS_LAGR_CELL_ID);
-
-              int p_class = 0;
-              if (p_set->p_am->displ[0][CS_LAGR_STAT_CLASS] > 0)
-                p_class = cs_lagr_particle_get_lnum(particle,
-                                                    p_set->p_am,
-                                                    CS_LAGR_STAT_CLASS);
-
-              if (cell_id >= 0 && (p_class == mt->class || mt->class == 0)) {
-
-                /* weight associated to current particle */
-
-                cs_real_t p_weight;
-
-                if (mwa->p_data_func == NULL)
-                  p_weight = cs_lagr_particle_get_real(particle,
-                                                       p_set->p_am,
-                                                       CS_LAGR_STAT_WEIGHT);
-                else
-                  mwa->p_data_func(mwa->data_input,
-                                   particle,
-                                   p_set->p_am,
-                                   &p_weight);
-                p_weight *= dt_val[cell_id*dt_mult];
-
-                if (mt->p_data_func == NULL)
-                  pval = cs_lagr_particle_attr(particle, p_set->p_am, attr_id);
-                else
-                  mt->p_data_func(mt->data_input, particle, p_set->p_am, pval);
-
-                /* update weight sum with new particle weight */
-                const cs_real_t wa_sum_n = CS_MAX(p_weight + l_wa_sum[cell_id],
-                                                  1e-100);
-
-                if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
-
-                  if (mt->dim == 6) { /* variance-covariance matrix */
-
-                    assert(mt->data_dim == 3);
-
-                    double delta[3], delta_n[3], r[3], m_n[3];
-
-                    for (int l = 0; l < 3; l++) {
-
-                      cs_lnum_t jl = cell_id*6 + l;
-                      cs_lnum_t jml = cell_id*3 + l;
-                      delta[l]   = pval[l] - mean_val[jml];
-                      r[l] = delta[l] * (p_weight / wa_sum_n);
-                      m_n[l] = mean_val[jml] + r[l];
-                      delta_n[l] = pval[l] - m_n[l];
-                      val[jl] = (  val[jl]*l_wa_sum[cell_id]
-                                 + p_weight*delta[l]*delta_n[l]) / wa_sum_n;
-
-                    }
-
-                    /* Covariance terms.
-                       Note we could have a symmetric formula using
-                       0.5*(delta[i]*delta_n[j] + delta[j]*delta_n[i])
-                       instead of
-                       delta[i]*delta_n[j]
-                       but unit tests in cs_moment_test.c do not seem to favor
-                       one variant over the other; we use the simplest one.  */
-
-                    cs_lnum_t j3 = cell_id*6 + 3,
-                              j4 = cell_id*6 + 4,
-                              j5 = cell_id*6 + 5;
-
-                    val[j3] = (  val[j3]*l_wa_sum[cell_id]
-                               + p_weight*delta[0]*delta_n[1]) / wa_sum_n;
-                    val[j4] = (  val[j4]*l_wa_sum[cell_id]
-                               + p_weight*delta[1]*delta_n[2]) / wa_sum_n;
-                    val[j5] = (  val[j5]*l_wa_sum[cell_id]
-                               + p_weight*delta[0]*delta_n[2]) / wa_sum_n;
-
-                    /* update mean value */
-
-                    for (cs_lnum_t l = 0; l < 3; l++)
-                      mean_val[cell_id*3 + l] += r[l];
-
-                  }
-
-                  else { /* simple variance */
-
-                    /* new weight for the cell: weight attached to
-                       current particle (=dt*weight) plus old weight */
-
-                    const cs_lnum_t dim = mt->dim;
-
-                    for (cs_lnum_t l = 0; l < dim; l++) {
-
-                      double delta = pval[l] - mean_val[cell_id*dim+l];
-                      double r = delta * (p_weight / wa_sum_n);
-                      double m_n = mean_val[cell_id*dim+l] + r;
-
-                      val[cell_id*dim+l]
-                        = (  val[cell_id*dim+l]*l_wa_sum[cell_id]
-                           + (p_weight*delta*(pval[l]-m_n))) / wa_sum_n;
-
-                      /* update mean value */
-
-                      mean_val[cell_id*dim+l] += r;
-
-                    }
-
-                  }
-
-                }
-
-                else if (mt->m_type == CS_LAGR_MOMENT_MEAN) {
-
-                  const cs_lnum_t dim = mt->dim;
-
-                  for (cs_lnum_t l = 0; l < dim; l++)
-                    val[cell_id*dim+l] +=   (pval[l] - val[cell_id*dim+l])
-                                          * p_weight / wa_sum_n;
-
-                } /* End of test if moment is a variance or a mean */
-
-                /* update local weight associated to current moment and class */
-
-                l_wa_sum[cell_id] += p_weight;
-
-              } /* End of test if particle is in a cell
-                   and if particle class corresponds to moment class */
-
-            } /* end of loop on particles */
-
-            if (mt->p_data_func != NULL)
-              BFT_FREE(pval);
+            if (p_moment_ids == NULL)
+              BFT_MALLOC(p_moment_ids, _n_lagr_moments, int);
+            p_moment_ids[n_p_moments++] = i;
 
             mt->nt_cur = ts->nt_cur;
-            if (mt->m_type == CS_LAGR_MOMENT_VARIANCE)
-              mt_mean->nt_cur = ts->nt_cur;
+
           }
 
           /* Case where data is mesh-based */
@@ -3075,6 +3203,31 @@ _cs_lagr_stat_update_all(void)
 
     } /* End of loop on moments */
 
+    if (n_p_moments > 0) {
+
+      /* Copy weight sum content to a local array, updated
+         with particle weights as moments are updated */
+
+      BFT_MALLOC(l_wa_sum, n_w_elts, cs_real_t);
+
+      for (cs_lnum_t j = 0; j < n_w_elts; j++)
+        l_wa_sum[j] = g_wa_sum[j];
+
+      if (cell_index == NULL)
+        _particle_cell_index(p_set, n_cells, &cell_index, &p_ids);
+
+      _update_particle_moments(mwa,
+                               n_p_moments,
+                               p_moment_ids,
+                               n_cells,
+                               cell_index,
+                               p_ids,
+                               dt_val,
+                               dt_mult,
+                               l_wa_sum);
+
+    }
+
     /* At end of loop on moments inside a class, update
        global class weight array */
 
@@ -3133,6 +3286,10 @@ _cs_lagr_stat_update_all(void)
     }
 
   } /* End of loop on active weight accumulators */
+
+  BFT_FREE(p_ids);
+  BFT_FREE(cell_index);
+  BFT_FREE(p_moment_ids);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -129,6 +129,9 @@ typedef enum {
  * when the selection function is called, so that value or structure should
  * not be temporary (i.e. local);
  *
+ * Such functions need not be thread-safe: particle moments using them
+ * (for values or weights) are updated by a single thread.
+ *
  * parameters:
  *   input    <-- pointer to optional (untyped) value or structure.
  *   particle <-- pointer to particle data
@@ -2491,12 +2491,14 @@ _exchange_particles(const cs_halo_t         *halo,
  *   mesh      <-- pointer to associated mesh
  *   lag_halo  <-> pointer to particle halo structure to update
  *   particles <-- set of particles to update
+ *   start_id  <-- id of first particle which may need synchronization
  *----------------------------------------------------------------------------*/
 
 static void
 _lagr_halo_count(const cs_mesh_t               *mesh,
                  cs_lagr_halo_t                *lag_halo,
-                 const cs_lagr_particle_set_t  *particles)
+                 const cs_lagr_particle_set_t  *particles,
+                 cs_lnum_t                      start_id)
 {
   cs_lnum_t  i, ghost_id;
 
@@ -2513,7 +2515,7 @@ _lagr_halo_count(const cs_mesh_t               *mesh,
 
   /* Loop on particles to count number of particles to send on each rank */
 
-  for (i = 0; i < particles->n_particles; i++) {
+  for (i = start_id; i < particles->n_particles; i++) {
 
     if (_get_tracking_info(particles, i)->state == CS_LAGR_PART_TO_SYNC_NEXT) {
 
@@ -2558,21 +2560,36 @@ _lagr_halo_count(const cs_mesh_t               *mesh,
 /*----------------------------------------------------------------------------
  * Update particle sets, including halo synchronization.
  *
+ * Particles with an id lower than n_settled have already been compacted
+ * by a previous call during the same displacement stage, and will not
+ * move anymore, so only particles received since are handled. On output,
+ * n_settled is set to the number of particles which have been kept
+ * locally, before those received from other ranks are appended.
+ *
+ * The global reduction determining whether displacement should continue
+ * is started as soon as the local number of particles to send is known,
+ * and completed only after particles have been exchanged, if nonblocking
+ * collectives are available.
+ *
  * parameters:
- *   particles <-> set of particles to update
+ *   particles      <-> set of particles to update
+ *   n_settled      <-> number of settled particles at the start of the set
+ *   settled_weight <-> statistical weight of settled particles
  *
  * returns:
  *   1 if displacement needs to continue, 0 if finished
  *----------------------------------------------------------------------------*/
 
 static int
-_sync_particle_set(cs_lagr_particle_set_t  *particles)
+_sync_particle_set(cs_lagr_particle_set_t  *particles,
+                   cs_lnum_t               *n_settled,
+                   cs_real_t               *settled_weight)
 {
   cs_lnum_t  i, k, tr_id, rank, shift, ghost_id;
   cs_real_t matrix[3][4];
 
   cs_lnum_t  n_recv_particles = 0;
-  cs_lnum_t  particle_count = 0;
+  cs_lnum_t  particle_count = *n_settled;
 
   cs_lnum_t  n_merged_particles = 0;
 
@@ -2582,7 +2599,7 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
   cs_real_t  exit_weight = 0.0;
   cs_real_t  merged_weight = 0.0;
   cs_real_t  fail_weight = 0.0;
-  cs_real_t  tot_weight = 0.0;
+  cs_real_t  tot_weight = *settled_weight;
 
   cs_lagr_track_builder_t  *builder = _particle_track_builder;
   cs_lagr_halo_t  *lag_halo = builder->halo;
@@ -2599,18 +2616,30 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
 
   if (halo != NULL) {
 
-    _lagr_halo_count(mesh, lag_halo, particles);
+    _lagr_halo_count(mesh, lag_halo, particles, *n_settled);
 
     for (i = 0; i < halo->n_c_domains; i++) {
       n_recv_particles += lag_halo->recv_count[i];
+      if (lag_halo->send_count[i] > 0)
+        continue_displacement = 1;
       lag_halo->send_count[i] = 0;
     }
   }
 
+  /* Start global reduction of the continuation flag */
+
+#if defined(HAVE_MPI) && defined(HAVE_MPI_IBARRIER)
+  int g_continue_displacement = 0;
+  MPI_Request  continue_request = MPI_REQUEST_NULL;
+  if (cs_glob_n_ranks > 1)
+    MPI_Iallreduce(&continue_displacement, &g_continue_displacement, 1,
+                   MPI_INT, MPI_MAX, cs_glob_mpi_comm, &continue_request);
+#endif
+
   /* Loop on particles, transferring particles to synchronize to send_buf
      for particle set, and removing particles that otherwise exited the domain */
 
-  for (i = 0; i < particles->n_particles; i++) {
+  for (i = *n_settled; i < particles->n_particles; i++) {
 
     cs_lagr_tracking_state_t cur_part_state
       = _get_tracking_info(particles, i)->state;
@@ -2622,8 +2651,6 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
 
     if (cur_part_state == CS_LAGR_PART_TO_SYNC_NEXT) {
 
-      continue_displacement = 1;
-
       ghost_id =   cs_lagr_particles_get_lnum(particles, i, CS_LAGR_CELL_ID)
                  - halo->n_local_elts;
       rank = lag_halo->rank[ghost_id];
@@ -2800,6 +2827,9 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
   particles->n_particles = particle_count;
   particles->weight = tot_weight;
 
+  *n_settled = particle_count;
+  *settled_weight = tot_weight;
+
   particles->n_part_out += n_exit_particles;
   particles->weight_out += exit_weight;
 
@@ -2814,7 +2844,16 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
   if (halo != NULL)
     _exchange_particles(halo, lag_halo, particles);
 
+  /* Complete global reduction of the continuation flag */
+
+#if defined(HAVE_MPI) && defined(HAVE_MPI_IBARRIER)
+  if (cs_glob_n_ranks > 1) {
+    MPI_Wait(&continue_request, MPI_STATUS_IGNORE);
+    continue_displacement = g_continue_displacement;
+  }
+#else
   cs_parall_max(1, CS_INT_TYPE, &continue_displacement);
+#endif
 
   return continue_displacement;
 }
@@ -2949,74 +2988,22 @@ _initialize_displacement(cs_lagr_particle_set_t  *particles)
 static void
 _finalize_displacement(cs_lagr_particle_set_t  *particles)
 {
-  const cs_lagr_attribute_map_t  *p_am = particles->p_am;
   const cs_lnum_t  n_cells = cs_glob_mesh->n_cells;
 
   const cs_lnum_t n_particles = particles->n_particles;
 
-  cs_lnum_t *cell_idx;
-  unsigned char *swap_buffer;
-  size_t swap_buffer_size = p_am->extents * ((size_t)n_particles);
-
-  BFT_MALLOC(cell_idx, n_cells+1, cs_lnum_t);
-  BFT_MALLOC(swap_buffer, swap_buffer_size, unsigned char);
-
-  /* Cell index (count first) */
-
-  for (cs_lnum_t i = 0; i < n_cells+1; i++)
-    cell_idx[i] = 0;
-
-  /* Copy unordered particle data to buffer */
-
+#if defined(DEBUG) && !defined(NDEBUG)
   for (cs_lnum_t i = 0; i < n_particles; i++) {
-
     cs_lnum_t cur_part_state = _get_tracking_info(particles, i)->state;
-
     assert(   cur_part_state < CS_LAGR_PART_OUT
            && cur_part_state != CS_LAGR_PART_TO_SYNC);
-
-    cs_lnum_t cell_id = cs_lagr_particles_get_lnum(particles, i,
-                                                   CS_LAGR_CELL_ID);
-
-    memcpy(swap_buffer + p_am->extents*i,
-           particles->p_buffer + p_am->extents*i,
-           p_am->extents);
-
-    cell_idx[cell_id+1] += 1;
-
+    assert(cs_lagr_particles_get_lnum(particles, i, CS_LAGR_CELL_ID) > -1);
   }
+#endif
 
-  /* Convert count to index */
-
-  for (cs_lnum_t i = 1; i < n_cells; i++)
-    cell_idx[i+1] += cell_idx[i];
-
-  assert(n_particles == cell_idx[n_cells]);
-
-  /* Now copy particle data and update some statistics */
-
-  const cs_lnum_t p_extents = particles->p_am->extents;
-  const cs_lnum_t cell_num_displ = particles->p_am->displ[0][CS_LAGR_CELL_ID];
-
-  for (cs_lnum_t i = 0; i < n_particles; i++) {
-
-    cs_lnum_t cell_id
-      = *((const cs_lnum_t *)(swap_buffer + p_extents*i + cell_num_displ));
-
-    assert(cell_id > -1);
-
-    cs_lnum_t particle_id = cell_idx[cell_id];
-
-    cell_idx[cell_id] += 1;
-
-    memcpy(particles->p_buffer + p_am->extents*particle_id,
-           swap_buffer + p_am->extents*i,
-           p_am->extents);
-
-  }
+  /* Order particles by cell (data is not moved if already ordered) */
 
-  BFT_FREE(swap_buffer);
-  BFT_FREE(cell_idx);
+  cs_lagr_particle_set_sort_by_cell(particles, 0, n_particles, n_cells, NULL);
 
 #if 0 && defined(DEBUG) && !defined(NDEBUG)
   bft_printf("\n Particle set after %s\n", __func__);
@@ -3083,6 +3070,9 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
   int  displacement_step_id = 0;
   int  continue_displacement = 1;
 
+  cs_lnum_t  n_settled = 0;
+  cs_real_t  settled_weight = 0.;
+
   cs_lagr_particle_set_t  *particles = cs_glob_lagr_particle_set;
   cs_lagr_event_set_t     *events = NULL;
 
@@ -3119,9 +3109,10 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
 
   while (continue_displacement) {
 
-    /* Local propagation */
+    /* Local propagation (particles received from other ranks
+       after the first pass are appended after settled particles) */
 
-    for (cs_lnum_t i = 0; i < particles->n_particles; i++) {
+    for (cs_lnum_t i = n_settled; i < particles->n_particles; i++) {
 
       /* Local copies of the current and previous particles state vectors
          to be used in case of the first pass of _local_propagation fails */
@@ -3151,7 +3142,8 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
     /* Update of the particle set structure. Delete exited particles,
        update for particles which change domain. */
 
-    continue_displacement = _sync_particle_set(particles);
+    continue_displacement
+      = _sync_particle_set(particles, &n_settled, &settled_weight);
 
 #if 0
     bft_printf("\n Particle set after sync\n");
@@ -3165,10 +3157,12 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
 
   } /* End of while (global displacement) */
 
-  /* Deposition sub-model additional loop */
+  /* Deposition sub-model additional loop; each particle only updates
+     its own attributes here, so this may be threaded. */
 
   if (lagr_model->deposition > 0) {
 
+#   pragma omp parallel for if (particles->n_particles > CS_THR_MIN)
     for (cs_lnum_t i = 0; i < particles->n_particles; i++) {
 
       unsigned char *particle = particles->p_buffer + p_am->extents * i;
@@ -0,0 +1,401 @@
+/*============================================================================
+ * Lagrangian module particle trajectory output
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_file.h"
+#include "cs_io.h"
+#include "cs_parall.h"
+#include "cs_time_step.h"
+
+#include "cs_lagr.h"
+#include "cs_lagr_extract.h"
+#include "cs_lagr_particle.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_lagr_trajectory.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_lagr_trajectory.c
+
+  Particle trajectories are appended to a single file of the
+  "postprocessing" directory, using the kernel IO (cs_io) section format.
+  That file is named "particle_trajectories" for an initial run, and
+  "particle_trajectories_<n>" for a run restarted from time step n,
+  so that trajectories output by previous runs are not overwritten.
+
+  Each output time step is written as a chunk of sections:
+  - "particle_trajectory_chunk" (global, 4 values): time step number,
+    number of particles, and minimum and maximum particle id in the chunk
+    (0 and 0 if empty), so that readers looking for given particles may
+    skip chunks based on this header only;
+  - "particle_trajectory_time" (global, 1 value): physical time;
+  - "particle_id", "particle_coords", and one "particle_<attribute>"
+    section per selected attribute, each containing the values of that
+    attribute for all particles of the chunk.
+
+  Values of a given section are written collectively, each rank providing
+  the contiguous block relative to its own particles, in rank order.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static const char  _dir_name[] = "postprocessing";
+static const char  _file_name[] = "particle_trajectories";
+
+/* Output frequency (no output if < 1) */
+
+static int         _output_frequency = 0;
+
+/* Output flag for each particle attribute */
+
+static bool        _attr_output[CS_LAGR_N_ATTRIBUTES];
+static bool        _attr_output_is_set = false;
+
+/* Associated file */
+
+static cs_io_t    *_trajectory_file = NULL;
+
+/*=============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Initialize attribute output flags if not done yet.
+ *----------------------------------------------------------------------------*/
+
+static void
+_init_attr_output(void)
+{
+  if (_attr_output_is_set == false) {
+    for (cs_lagr_attribute_t i = 0; i < CS_LAGR_N_ATTRIBUTES; i++)
+      _attr_output[i] = false;
+    _attr_output_is_set = true;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Open trajectory output file.
+ *
+ * For a restarted computation, the file name is suffixed with the
+ * restart time step number, so as not to overwrite trajectories
+ * of previous runs.
+ *----------------------------------------------------------------------------*/
+
+static void
+_open_file(void)
+{
+  cs_file_access_t  method;
+  char *name = NULL;
+  int nt_prev = cs_glob_time_step->nt_prev;
+
+  if (cs_file_mkdir_default(_dir_name) != 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("The %s directory cannot be created"), _dir_name);
+
+  BFT_MALLOC(name, strlen(_dir_name) + strlen(_file_name) + 2 + 12, char);
+  if (nt_prev > 0)
+    sprintf(name, "%s/%s_%d", _dir_name, _file_name, nt_prev);
+  else
+    sprintf(name, "%s/%s", _dir_name, _file_name);
+
+#if defined(HAVE_MPI)
+  {
+    MPI_Info  hints;
+    MPI_Comm  block_comm, comm;
+    cs_file_get_default_access(CS_FILE_MODE_WRITE, &method, &hints);
+    cs_file_get_default_comm(NULL, NULL, &block_comm, &comm);
+    _trajectory_file = cs_io_initialize(name,
+                                        "Particle trajectories, R0",
+                                        CS_IO_MODE_WRITE,
+                                        method,
+                                        CS_IO_ECHO_OPEN_CLOSE,
+                                        hints,
+                                        block_comm,
+                                        comm);
+  }
+#else
+  {
+    cs_file_get_default_access(CS_FILE_MODE_WRITE, &method);
+    _trajectory_file = cs_io_initialize(name,
+                                        "Particle trajectories, R0",
+                                        CS_IO_MODE_WRITE,
+                                        method,
+                                        CS_IO_ECHO_OPEN_CLOSE);
+  }
+#endif
+
+  BFT_FREE(name);
+}
+
+/*----------------------------------------------------------------------------
+ * Write values of a given particle attribute as a trajectory section.
+ *
+ * parameters:
+ *   particles <-- associated particle set
+ *   attr      <-- attribute to output
+ *   n_g_parts <-- global number of particles
+ *   range     <-- global particle number range for this rank
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_attr(const cs_lagr_particle_set_t  *particles,
+            cs_lagr_attribute_t            attr,
+            cs_gnum_t                      n_g_parts,
+            const cs_gnum_t                range[2])
+{
+  size_t  extents, size;
+  ptrdiff_t  displ;
+  cs_datatype_t  datatype;
+  int  stride;
+
+  cs_lagr_get_attr_info(particles, 0, attr,
+                        &extents, &size, &displ, &datatype, &stride);
+
+  if (stride == 0)
+    return;
+
+  const cs_lnum_t n_particles = particles->n_particles;
+
+  char sec_name[64];
+  snprintf(sec_name, 63, "particle_%s", cs_lagr_attribute_name[attr]);
+  sec_name[63] = '\0';
+
+  unsigned char *vals;
+  BFT_MALLOC(vals, n_particles*size, unsigned char);
+
+  cs_lagr_get_particle_values(particles,
+                              attr,
+                              datatype,
+                              stride,
+                              -1,
+                              n_particles,
+                              NULL,
+                              vals);
+
+  cs_io_write_block_buffer(sec_name,
+                           n_g_parts,
+                           range[0],
+                           range[1],
+                           0,
+                           0,
+                           stride,
+                           datatype,
+                           vals,
+                           _trajectory_file);
+
+  BFT_FREE(vals);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the output frequency of particle trajectories.
+ *
+ * \param[in]  n  output every n time steps, or never if n < 1
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_trajectory_set_frequency(int  n)
+{
+  _output_frequency = n;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate trajectory output of a given particle
+ *        attribute.
+ *
+ * Particle ids and coordinates are always output.
+ *
+ * \param[in]  attr_id  associated attribute id
+ * \param[in]  active   true if output is required, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_trajectory_set_attr(cs_lagr_attribute_t  attr_id,
+                            bool                 active)
+{
+  _init_attr_output();
+
+  cs_lagr_particle_attr_in_range(attr_id);
+
+  _attr_output[attr_id] = active;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Append particle trajectory data for the current time step,
+ *        if output is active at this time step.
+ *
+ * \param[in]  ts  associated time step structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_trajectory_write(const cs_time_step_t  *ts)
+{
+  const cs_lagr_particle_set_t  *p_set = cs_glob_lagr_particle_set;
+
+  if (_output_frequency < 1 || p_set == NULL)
+    return;
+
+  if (ts->nt_cur % _output_frequency != 0)
+    return;
+
+  _init_attr_output();
+
+  if (_trajectory_file == NULL)
+    _open_file();
+
+  const cs_lnum_t n_particles = p_set->n_particles;
+
+  /* Global particle numbering range (in rank order) and id bounds */
+
+  cs_gnum_t n_g_parts = n_particles;
+  cs_gnum_t range[2] = {1, n_particles + 1};
+  cs_gnum_t id_min = ~((cs_gnum_t)0);
+  cs_gnum_t id_max = 0;
+
+  cs_gnum_t *p_id;
+  BFT_MALLOC(p_id, n_particles, cs_gnum_t);
+
+  for (cs_lnum_t i = 0; i < n_particles; i++) {
+    p_id[i] = cs_lagr_particles_get_gnum(p_set, i, CS_LAGR_ID);
+    if (p_id[i] < id_min)
+      id_min = p_id[i];
+    if (p_id[i] > id_max)
+      id_max = p_id[i];
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_gnum_t l_count = n_particles;
+    MPI_Scan(&l_count, range + 1, 1, CS_MPI_GNUM, MPI_SUM, cs_glob_mpi_comm);
+    range[1] += 1;
+    range[0] = range[1] - l_count;
+    cs_parall_counter(&n_g_parts, 1);
+    cs_parall_min(1, CS_GNUM_TYPE, &id_min);
+    cs_parall_max(1, CS_GNUM_TYPE, &id_max);
+  }
+#endif
+
+  if (n_g_parts == 0)
+    id_min = 0;
+
+  /* Chunk header */
+
+  cs_gnum_t chunk_info[4] = {ts->nt_cur, n_g_parts, id_min, id_max};
+  cs_real_t t_cur = ts->t_cur;
+
+  cs_io_write_global("particle_trajectory_chunk", 4, 0, 0, 1,
+                     CS_GNUM_TYPE, chunk_info, _trajectory_file);
+
+  cs_io_write_global("particle_trajectory_time", 1, 0, 0, 1,
+                     CS_REAL_TYPE, &t_cur, _trajectory_file);
+
+  /* Particle data */
+
+  cs_io_write_block_buffer("particle_id",
+                           n_g_parts,
+                           range[0],
+                           range[1],
+                           0,
+                           0,
+                           1,
+                           CS_GNUM_TYPE,
+                           p_id,
+                           _trajectory_file);
+
+  BFT_FREE(p_id);
+
+  _write_attr(p_set, CS_LAGR_COORDS, n_g_parts, range);
+
+  for (cs_lagr_attribute_t attr = 0; attr < CS_LAGR_N_ATTRIBUTES; attr++) {
+    if (   _attr_output[attr] == false
+        || attr == CS_LAGR_COORDS || attr == CS_LAGR_ID)
+      continue;
+    _write_attr(p_set, attr, n_g_parts, range);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Close particle trajectory output.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_trajectory_finalize(void)
+{
+  if (_trajectory_file != NULL)
+    cs_io_finalize(&_trajectory_file);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,109 @@
+#ifndef __CS_LAGR_TRAJECTORY_H__
+#define __CS_LAGR_TRAJECTORY_H__
+
+/*============================================================================
+ * Lagrangian module particle trajectory output
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include "cs_base.h"
+#include "cs_time_step.h"
+
+#include "cs_lagr_particle.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*============================================================================
+  Global variables
+  ============================================================================*/
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the output frequency of particle trajectories.
+ *
+ * \param[in]  n  output every n time steps, or never if n < 1
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_trajectory_set_frequency(int  n);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate trajectory output of a given particle
+ *        attribute.
+ *
+ * Particle ids and coordinates are always output.
+ *
+ * \param[in]  attr_id  associated attribute id
+ * \param[in]  active   true if output is required, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_trajectory_set_attr(cs_lagr_attribute_t  attr_id,
+                            bool                 active);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Append particle trajectory data for the current time step,
+ *        if output is active at this time step.
+ *
+ * \param[in]  ts  associated time step structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_trajectory_write(const cs_time_step_t  *ts);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Close particle trajectory output.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_trajectory_finalize(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_LAGR_TRAJECTORY_H__ */
@@ -391,6 +391,7 @@ _check_equiv(const cs_join_edges_t  *edges,
     cs_lnum_t  v1e2_id = edges->def[2*e2_id]-1;
     cs_lnum_t  v2e2_id = edges->def[2*e2_id+1]-1;
 
+#   pragma omp atomic
     _n_inter_tolerance_warnings++;
 
     if (verbosity > 3) {
@@ -3459,10 +3460,8 @@ cs_join_intersect_edges(cs_join_param_t         param,
                         cs_join_inter_set_t   **inter_set)
 {
   cs_lnum_t  i, j, k;
-  double  abs_e1[2], abs_e2[2];
 
   cs_join_type_t  join_type = CS_JOIN_TYPE_CONFORMING;
-  cs_lnum_t  n_inter = 0;
   cs_lnum_t  n_inter_detected = 0, n_real_inter = 0, n_trivial_inter = 0;
   cs_gnum_t  n_g_inter[3] = {0, 0, 0};
   cs_join_inter_set_t  *_inter_set = NULL;
@@ -3492,17 +3491,37 @@ cs_join_intersect_edges(cs_join_param_t         param,
   _inter_set = cs_join_inter_set_create(50);
   _vtx_eset = cs_join_eset_create(30);
 
-  /* Loop on edges */
+  /* Compute intersections for all couples of edges first; this is the
+     most expensive part, and is done in parallel when possible (debug
+     logging is not thread-safe). Results are then added to the
+     intersection and equivalence sets in the same order as in serial,
+     so the result does not depend on the number of threads. */
+
+  const cs_lnum_t  n_couples = edge_edge_vis->index[edge_edge_vis->n_elts];
+
+  short int  *couple_n_inter = NULL;
+  double  *couple_abs = NULL;
+
+  BFT_MALLOC(couple_n_inter, n_couples, short int);
+  BFT_MALLOC(couple_abs, n_couples*4, double);
 
+# pragma omp parallel for schedule(dynamic, 64) \
+          if (param.verbosity < 4 && edge_edge_vis->n_elts > CS_THR_MIN)
   for (i = 0; i < edge_edge_vis->n_elts; i++) {
 
     int  e1 = edge_edge_vis->g_elts[i]; /* This is a local number */
 
-    for (j = edge_edge_vis->index[i]; j < edge_edge_vis->index[i+1]; j++) {
+    for (cs_lnum_t c_id = edge_edge_vis->index[i];
+         c_id < edge_edge_vis->index[i+1];
+         c_id++) {
 
-      int  e2 = edge_edge_vis->g_list[j]; /* This is a local number */
+      int  e2 = edge_edge_vis->g_list[c_id]; /* This is a local number */
       int  e1_id = (e1 < e2 ? e1 - 1 : e2 - 1);
       int  e2_id = (e1 < e2 ? e2 - 1 : e1 - 1);
+      int  n_inter = 0;
+
+      double  *abs_e1 = couple_abs + 4*c_id;
+      double  *abs_e2 = couple_abs + 4*c_id + 2;
 
       assert(e1 != e2);
 
@@ -3530,6 +3549,28 @@ cs_join_intersect_edges(cs_join_param_t         param,
                                 logfile,
                                 &n_inter);
 
+      couple_n_inter[c_id] = n_inter;
+
+    }
+
+  }
+
+  /* Loop on edges */
+
+  for (i = 0; i < edge_edge_vis->n_elts; i++) {
+
+    int  e1 = edge_edge_vis->g_elts[i]; /* This is a local number */
+
+    for (j = edge_edge_vis->index[i]; j < edge_edge_vis->index[i+1]; j++) {
+
+      int  e2 = edge_edge_vis->g_list[j]; /* This is a local number */
+      int  e1_id = (e1 < e2 ? e1 - 1 : e2 - 1);
+      int  e2_id = (e1 < e2 ? e2 - 1 : e1 - 1);
+      int  n_inter = couple_n_inter[j];
+
+      const double  *abs_e1 = couple_abs + 4*j;
+      const double  *abs_e2 = couple_abs + 4*j + 2;
+
       n_inter_detected += n_inter;
 
 #if 0 && defined(DEBUG) && !defined(NDEBUG)
@@ -3592,6 +3633,9 @@ cs_join_intersect_edges(cs_join_param_t         param,
 
   } /* End of loop on elements in intersection list */
 
+  BFT_FREE(couple_n_inter);
+  BFT_FREE(couple_abs);
+
   n_real_inter = n_inter_detected - n_trivial_inter;
 
   if (n_inter_detected == 0)
@@ -3713,6 +3757,7 @@ cs_join_intersect_faces(const cs_join_param_t   param,
 
   /* Define each bounding box for the selected faces */
 
+# pragma omp parallel for if (join_mesh->n_faces > CS_THR_MIN)
   for (i = 0; i < join_mesh->n_faces; i++)
     _get_face_extents(join_mesh->face_vtx_idx[i],
                       join_mesh->face_vtx_idx[i+1],
@@ -3828,6 +3873,8 @@ cs_join_intersect_face_to_edge(const cs_join_mesh_t   *mesh,
   for (i = 0; i < mesh->n_faces; i++)
     count[i] = 0;
 
+# pragma omp parallel for private(j, edge_num, shift) \
+          if (mesh->n_faces > CS_THR_MIN)
   for (i = 0; i < mesh->n_faces; i++) {
 
     cs_lnum_t  start = mesh->face_vtx_idx[i];
@@ -3858,6 +3905,7 @@ cs_join_intersect_face_to_edge(const cs_join_mesh_t   *mesh,
   /* Transform numbering in face_visib to match numbering
      in the current cs_join_mesh_t structure */
 
+# pragma omp parallel for private(j) if (face_visib->n_elts > CS_THR_MIN)
   for (i = 0; i < face_visib->n_elts; i++) {
 
     cs_lnum_t  face_id = cs_search_g_binary(mesh->n_faces,
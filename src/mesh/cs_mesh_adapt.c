@@ -0,0 +1,642 @@
+/*============================================================================
+ * Field-driven mesh adaptation.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_error.h"
+#include "bft_printf.h"
+
+#include "cs_field.h"
+#include "cs_file.h"
+#include "cs_halo.h"
+#include "cs_mesh.h"
+#include "cs_mesh_coarsen.h"
+#include "cs_mesh_location.h"
+#include "cs_mesh_quantities.h"
+#include "cs_mesh_refine.h"
+#include "cs_mesh_save.h"
+#include "cs_parall.h"
+#include "cs_partition.h"
+#include "cs_restart.h"
+#include "cs_restart_map.h"
+#include "cs_time_step.h"
+
+/*----------------------------------------------------------------------------
+ * Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_mesh_adapt.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_mesh_adapt.c
+        Field-driven mesh adaptation.
+
+  Every given number of time steps, the jump of a cell-based field across
+  each interior face, relative to the global range of that field, is used
+  as a refinement indicator. Cells whose maximum adjacent jump exceeds a
+  refinement threshold are flagged for refinement, and previously refined
+  cells whose jump is below a coarsening threshold are flagged for
+  coarsening. Flags are saved with the checkpoint, as "mesh_adapt.csc".
+
+  When restarting, the flagged cells of the restart mesh are coarsened,
+  then refined, the mesh is repartitioned, and restart data is mapped to
+  the new mesh by \ref cs_restart_map_build, using the volume-weighted
+  average of merged cells for coarsened cells. The mesh is never adapted
+  within the time loop of a running computation.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/* Directory name separator
+   (historically, '/' for Unix/Linux, '\' for Windows, ':' for Mac
+   but '/' should work for all on modern systems) */
+
+#define DIR_SEPARATOR '/'
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static char    *_adapt_field_name = NULL;
+static int      _adapt_interval = 0;
+static double   _adapt_refine_threshold = 0.1;
+static double   _adapt_coarsen_threshold = -1;
+static int      _adapt_max_level = 1;
+static bool     _adapt_stop = false;
+
+static const char _adapt_file_name[] = "mesh_adapt.csc";
+static const char _adapt_section_name[] = "cell_adapt_flag";
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Compute the refinement level of each cell, based on the refinement
+ * generation of its interior faces.
+ *
+ * parameters:
+ *   m         <-- pointer to mesh structure
+ *   c_r_level --> refinement level of each cell
+ *----------------------------------------------------------------------------*/
+
+static void
+_cell_r_level(const cs_mesh_t  *m,
+              int               c_r_level[])
+{
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+
+  for (cs_lnum_t i = 0; i < m->n_cells_with_ghosts; i++)
+    c_r_level[i] = 0;
+
+  if (m->i_face_r_gen == NULL)
+    return;
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_i_faces; f_id++) {
+    for (cs_lnum_t i = 0; i < 2; i++) {
+      cs_lnum_t c_id = i_face_cells[f_id][i];
+      if (m->i_face_r_gen[f_id] > c_r_level[c_id])
+        c_r_level[c_id] = m->i_face_r_gen[f_id];
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Flag cells for refinement or coarsening based on the relative jump
+ * of a field across interior faces.
+ *
+ * parameters:
+ *   m         <-- pointer to mesh structure
+ *   f         <-> field used as indicator (ghost values are synchronized)
+ *   cell_flag --> 1 for refinement, -1 for coarsening, 0 otherwise
+ *   n_flagged --> global number of cells flagged for refinement
+ *                 and coarsening
+ *----------------------------------------------------------------------------*/
+
+static void
+_flag_cells(const cs_mesh_t  *m,
+            cs_field_t       *f,
+            int               cell_flag[],
+            cs_gnum_t         n_flagged[2])
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+
+  const int dim = f->dim;
+  cs_real_t *val = f->val;
+
+  if (m->halo != NULL)
+    cs_halo_sync_var_strided(m->halo, CS_HALO_STANDARD, val, dim);
+
+  /* Global range of field (max over components) */
+
+  cs_real_t v_min[9], v_max[9];
+
+  for (int k = 0; k < dim; k++) {
+    v_min[k] = HUGE_VAL;
+    v_max[k] = -HUGE_VAL;
+  }
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    for (int k = 0; k < dim; k++) {
+      cs_real_t v = val[i*dim + k];
+      if (v < v_min[k])
+        v_min[k] = v;
+      if (v > v_max[k])
+        v_max[k] = v;
+    }
+  }
+
+  cs_parall_min(dim, CS_REAL_TYPE, v_min);
+  cs_parall_max(dim, CS_REAL_TYPE, v_max);
+
+  cs_real_t v_range = 0;
+  for (int k = 0; k < dim; k++)
+    v_range = CS_MAX(v_range, v_max[k] - v_min[k]);
+
+  /* Maximum jump across adjacent faces */
+
+  cs_real_t *c_jump;
+  BFT_MALLOC(c_jump, n_cells_ext, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_cells_ext; i++)
+    c_jump[i] = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_i_faces; f_id++) {
+    cs_lnum_t c_id0 = i_face_cells[f_id][0];
+    cs_lnum_t c_id1 = i_face_cells[f_id][1];
+    cs_real_t jump = 0;
+    for (int k = 0; k < dim; k++)
+      jump = CS_MAX(jump, fabs(val[c_id0*dim + k] - val[c_id1*dim + k]));
+    c_jump[c_id0] = CS_MAX(c_jump[c_id0], jump);
+    c_jump[c_id1] = CS_MAX(c_jump[c_id1], jump);
+  }
+
+  /* Flag cells based on relative jump and current level */
+
+  int *c_r_level;
+  BFT_MALLOC(c_r_level, n_cells_ext, int);
+
+  _cell_r_level(m, c_r_level);
+
+  n_flagged[0] = 0;
+  n_flagged[1] = 0;
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    cs_real_t r_jump = (v_range > 0) ? c_jump[i] / v_range : 0;
+    cell_flag[i] = 0;
+    if (   r_jump > _adapt_refine_threshold
+        && c_r_level[i] < _adapt_max_level) {
+      cell_flag[i] = 1;
+      n_flagged[0] += 1;
+    }
+    else if (   r_jump < _adapt_coarsen_threshold
+             && c_r_level[i] > 0) {
+      cell_flag[i] = -1;
+      n_flagged[1] += 1;
+    }
+  }
+
+  BFT_FREE(c_r_level);
+  BFT_FREE(c_jump);
+
+  cs_parall_counter(n_flagged, 2);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define field-driven mesh adaptation options.
+ *
+ * When active, the jump of the given field across interior faces is
+ * evaluated every given number of time steps. Cells for which the
+ * maximum jump across their faces, relative to the global range of the
+ * field, exceeds the refinement threshold are flagged for refinement
+ * (unless they already reached the maximum refinement level), and
+ * refined cells for which it is below the coarsening threshold are flagged
+ * for coarsening. Flags are saved as "checkpoint/mesh_adapt.csc".
+ *
+ * The mesh is adapted when restarting from that checkpoint: flagged cells
+ * are coarsened, then refined, the mesh is repartitioned, and fields are
+ * transferred to the new mesh through restart file mapping. If required,
+ * the computation is stopped (with a final checkpoint) as soon as cells
+ * are flagged, so as to be restarted on the adapted mesh.
+ *
+ * Restart file mapping is P0: each new cell takes the value of the
+ * restart mesh cell containing its center, so refined cells inherit
+ * their parent's value. For cells merged by coarsening, real values of
+ * the former cells are first replaced by their volume-weighted average,
+ * so the merged cell receives that average.
+ *
+ * Adaptation is only applied at restart: the mesh is not refined,
+ * coarsened or rebalanced within the time loop of a running computation.
+ *
+ * \param[in]  field_name         name of cell-based field used as indicator
+ *                                (NULL to deactivate, the default)
+ * \param[in]  interval           number of time steps between indicator
+ *                                evaluations
+ * \param[in]  refine_threshold   relative jump above which cells are refined
+ * \param[in]  coarsen_threshold  relative jump below which cells are
+ *                                coarsened (< 0 for no coarsening)
+ * \param[in]  max_level          maximum refinement level
+ * \param[in]  stop               if true, stop the computation once cells
+ *                                are flagged for adaptation
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_set_indicator(const char  *field_name,
+                            int          interval,
+                            double       refine_threshold,
+                            double       coarsen_threshold,
+                            int          max_level,
+                            bool         stop)
+{
+  BFT_FREE(_adapt_field_name);
+
+  if (field_name != NULL) {
+    size_t l = strlen(field_name);
+    BFT_MALLOC(_adapt_field_name, l + 1, char);
+    strcpy(_adapt_field_name, field_name);
+  }
+
+  _adapt_interval = CS_MAX(interval, 0);
+  _adapt_refine_threshold = refine_threshold;
+  _adapt_coarsen_threshold = coarsen_threshold;
+  _adapt_max_level = CS_MIN(max_level, 127);
+  _adapt_stop = stop;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Evaluate the adaptation indicator, and save flagged cells
+ *        for restart if required.
+ *
+ * This function should be called once per time step; it does nothing
+ * unless mesh adaptation is active (see \ref cs_mesh_adapt_set_indicator).
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_check(void)
+{
+  if (_adapt_interval < 1 || _adapt_field_name == NULL)
+    return;
+
+  const cs_time_step_t *ts = cs_glob_time_step;
+
+  if (   ts->nt_cur <= ts->nt_prev
+      || (ts->nt_cur - ts->nt_prev) % _adapt_interval != 0)
+    return;
+
+  cs_field_t *f = cs_field_by_name_try(_adapt_field_name);
+
+  if (f == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Mesh adaptation indicator field \"%s\" is not defined."),
+              _adapt_field_name);
+
+  if (f->location_id != CS_MESH_LOCATION_CELLS)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Mesh adaptation indicator field \"%s\"\n"
+                "is not defined on cells."), _adapt_field_name);
+
+  if (f->dim > 9)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Mesh adaptation indicator field \"%s\"\n"
+                "has dimension %d (at most 9 handled)."),
+              _adapt_field_name, f->dim);
+
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  int *cell_flag;
+  BFT_MALLOC(cell_flag, m->n_cells, int);
+
+  cs_gnum_t n_flagged[2];
+
+  _flag_cells(m, f, cell_flag, n_flagged);
+
+  bft_printf(_("\n Mesh adaptation indicator based on \"%s\":\n"
+               "   cells flagged for refinement:  %llu\n"
+               "   cells flagged for coarsening:  %llu\n"),
+             _adapt_field_name,
+             (unsigned long long)n_flagged[0],
+             (unsigned long long)n_flagged[1]);
+
+  if (n_flagged[0] + n_flagged[1] > 0) {
+
+    cs_restart_t *r = cs_restart_create(_adapt_file_name,
+                                        NULL,
+                                        CS_RESTART_MODE_WRITE);
+
+    cs_restart_write_section(r,
+                             _adapt_section_name,
+                             CS_MESH_LOCATION_CELLS,
+                             1,
+                             CS_TYPE_cs_int_t,
+                             cell_flag);
+
+    cs_restart_destroy(&r);
+
+    bft_printf(_(" Mesh adaptation flags saved for restart.\n"));
+
+    if (_adapt_stop) {
+      bft_printf(_(" Stopping computation so as to restart"
+                   " on the adapted mesh.\n"));
+      cs_time_step_define_nt_max(ts->nt_cur);
+    }
+
+  }
+
+  /* Flags saved at a previous evaluation are not up to date anymore */
+
+  else if (cs_glob_rank_id < 1) {
+    char path[64];
+    sprintf(path, "checkpoint%c%s", DIR_SEPARATOR, _adapt_file_name);
+    if (cs_file_isreg(path))
+      cs_file_remove(path);
+  }
+
+  BFT_FREE(cell_flag);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if a mesh adaptation saved by a previous computation
+ *        is pending.
+ *
+ * \return  true if a "restart/mesh_adapt.csc" file is present
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_adapt_is_pending(void)
+{
+  int pending = 0;
+
+  if (cs_glob_rank_id < 1) {
+    char path[64];
+    sprintf(path, "restart%c%s", DIR_SEPARATOR, _adapt_file_name);
+    if (cs_file_isreg(path))
+      pending = 1;
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Bcast(&pending, 1, MPI_INT, 0, cs_glob_mpi_comm);
+#endif
+
+  return (pending) ? true : false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Apply mesh adaptation saved by a previous computation.
+ *
+ * Cells flagged for coarsening are merged first, then cells flagged for
+ * refinement are refined. Partitioning of the adapted mesh is then forced,
+ * and restart files are mapped to the adapted mesh.
+ *
+ * This function should be called during preprocessing, once the mesh
+ * matching the restart files has been read, and its halo built.
+ *
+ * \param[in, out]  m  pointer to mesh structure (read from restart)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_apply(cs_mesh_t  *m)
+{
+  if (cs_mesh_adapt_is_pending() == false)
+    return;
+
+  assert(m == cs_glob_mesh);
+
+  cs_lnum_t n_cells = m->n_cells;
+
+  int *cell_flag;
+  BFT_MALLOC(cell_flag, n_cells, int);
+
+  cs_restart_t *r = cs_restart_create(_adapt_file_name,
+                                      NULL,
+                                      CS_RESTART_MODE_READ);
+
+  int retcode = cs_restart_read_section(r,
+                                        _adapt_section_name,
+                                        CS_MESH_LOCATION_CELLS,
+                                        1,
+                                        CS_TYPE_cs_int_t,
+                                        cell_flag);
+
+  cs_restart_destroy(&r);
+
+  if (retcode != CS_RESTART_SUCCESS) {
+    bft_printf(_("\n Mesh adaptation flags in \"restart%c%s\" do not match"
+                 " the mesh;\n ignored.\n"),
+               DIR_SEPARATOR, _adapt_file_name);
+    BFT_FREE(cell_flag);
+    return;
+  }
+
+  /* Restart data will be mapped from the current mesh;
+     save it unless it is already available with the restart data */
+
+  const char restart_mesh[] = "restart/mesh_input.csm";
+  const char adapt_mesh[] = "mesh_adapt_input.csm";
+
+  int have_restart_mesh = 0;
+  if (cs_glob_rank_id < 1)
+    have_restart_mesh = cs_file_isreg(restart_mesh);
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Bcast(&have_restart_mesh, 1, MPI_INT, 0, cs_glob_mpi_comm);
+#endif
+
+  if (have_restart_mesh)
+    cs_restart_map_set_mesh_input(restart_mesh);
+  else {
+    cs_mesh_save(m, NULL, NULL, adapt_mesh);
+    cs_restart_map_set_mesh_input(adapt_mesh);
+  }
+
+  /* Refine or coarsen flagged cells */
+
+  cs_gnum_t n_flagged[2] = {0, 0};
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    if (cell_flag[i] > 0)
+      n_flagged[0] += 1;
+    else if (cell_flag[i] < 0)
+      n_flagged[1] += 1;
+  }
+
+  cs_parall_counter(n_flagged, 2);
+
+  /* Coarsen first, so that faces added by refinement are not considered
+     when determining which cells may be merged; cells flagged for
+     refinement are never merged, so their flags are simply transferred
+     to the coarsened mesh's numbering. */
+
+  if (n_flagged[1] > 0) {
+
+    bft_printf(_("\n Coarsening %llu cells flagged for mesh adaptation.\n"),
+               (unsigned long long)n_flagged[1]);
+
+    int *c_flag;
+    BFT_MALLOC(c_flag, n_cells, int);
+
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      c_flag[i] = (cell_flag[i] < 0) ? 1 : 0;
+
+    /* Save numbering and volumes of cells before merging */
+
+    cs_gnum_t n_g_cells_ini = m->n_g_cells;
+    cs_gnum_t *c_gnum_ini = NULL;
+    if (m->global_cell_num != NULL) {
+      BFT_MALLOC(c_gnum_ini, n_cells, cs_gnum_t);
+      memcpy(c_gnum_ini, m->global_cell_num, n_cells*sizeof(cs_gnum_t));
+    }
+
+    cs_real_t *c_vol_ini = cs_mesh_quantities_cell_volume(m);
+
+    cs_lnum_t *c_o2n = NULL;
+    cs_mesh_coarsen_simple_renum(m, c_flag, &c_o2n);
+
+    /* Values of merged cells are averaged when mapping restart data;
+       each group of merged cells is numbered by the resulting cell */
+
+    cs_gnum_t *c_group;
+    BFT_MALLOC(c_group, n_cells, cs_gnum_t);
+
+    for (cs_lnum_t i = 0; i < n_cells; i++) {
+      if (c_flag[i] == 0)
+        c_group[i] = 0;
+      else if (m->global_cell_num != NULL)
+        c_group[i] = m->global_cell_num[c_o2n[i]];
+      else
+        c_group[i] = c_o2n[i] + 1;
+    }
+
+    cs_restart_map_set_cell_groups(n_g_cells_ini,
+                                   n_cells,
+                                   c_gnum_ini,
+                                   c_group,
+                                   c_vol_ini);
+
+    BFT_FREE(c_group);
+    BFT_FREE(c_vol_ini);
+    BFT_FREE(c_gnum_ini);
+    BFT_FREE(c_flag);
+
+    int *r_flag;
+    BFT_MALLOC(r_flag, m->n_cells, int);
+
+    for (cs_lnum_t i = 0; i < m->n_cells; i++)
+      r_flag[i] = 0;
+
+    for (cs_lnum_t i = 0; i < n_cells; i++) {
+      if (cell_flag[i] > 0)
+        r_flag[c_o2n[i]] = 1;
+    }
+
+    BFT_FREE(c_o2n);
+    BFT_FREE(cell_flag);
+
+    cell_flag = r_flag;
+    n_cells = m->n_cells;
+
+  }
+
+  if (n_flagged[0] > 0) {
+
+    bft_printf(_("\n Refining %llu cells flagged for mesh adaptation.\n"),
+               (unsigned long long)n_flagged[0]);
+
+    cs_lnum_t n_sel = 0;
+    cs_lnum_t *sel_cells;
+    BFT_MALLOC(sel_cells, n_cells, cs_lnum_t);
+
+    for (cs_lnum_t i = 0; i < n_cells; i++) {
+      if (cell_flag[i] > 0)
+        sel_cells[n_sel++] = i;
+    }
+
+    cs_mesh_refine_simple_selected(m, false, n_sel, sel_cells);
+
+    BFT_FREE(sel_cells);
+
+  }
+
+  BFT_FREE(cell_flag);
+
+  /* Rebalance adapted mesh */
+
+  cs_partition_set_preprocess(true);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,123 @@
+#ifndef __CS_MESH_ADAPT_H__
+#define __CS_MESH_ADAPT_H__
+
+/*============================================================================
+ * Field-driven mesh adaptation.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_base.h"
+#include "cs_mesh.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define field-driven mesh adaptation options.
+ *
+ * The mesh is adapted when restarting, not within the time loop.
+ * Values are transferred to the adapted mesh through P0 restart file
+ * mapping, except that a coarsened cell receives the volume-weighted
+ * average of the values of its former children.
+ *
+ * \param[in]  field_name         name of cell-based field used as indicator
+ *                                (NULL to deactivate, the default)
+ * \param[in]  interval           number of time steps between indicator
+ *                                evaluations
+ * \param[in]  refine_threshold   relative jump above which cells are refined
+ * \param[in]  coarsen_threshold  relative jump below which cells are
+ *                                coarsened (< 0 for no coarsening)
+ * \param[in]  max_level          maximum refinement level
+ * \param[in]  stop               if true, stop the computation once cells
+ *                                are flagged for adaptation
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_set_indicator(const char  *field_name,
+                            int          interval,
+                            double       refine_threshold,
+                            double       coarsen_threshold,
+                            int          max_level,
+                            bool         stop);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Evaluate the adaptation indicator, and save flagged cells
+ *        for restart if required.
+ *
+ * This function should be called once per time step; it does nothing
+ * unless mesh adaptation is active (see \ref cs_mesh_adapt_set_indicator).
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_check(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if a mesh adaptation saved by a previous computation
+ *        is pending.
+ *
+ * \return  true if a "restart/mesh_adapt.csc" file is present
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_adapt_is_pending(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Apply mesh adaptation saved by a previous computation.
+ *
+ * \param[in, out]  m  pointer to mesh structure (read from restart)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_apply(cs_mesh_t  *m);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MESH_ADAPT_H__ */
@@ -0,0 +1,1342 @@
+/*============================================================================
+ * Save and restore a fully preprocessed, partitioned and renumbered mesh
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_file.h"
+#include "cs_halo.h"
+#include "cs_interface.h"
+#include "cs_internal_coupling.h"
+#include "cs_io.h"
+#include "cs_join.h"
+#include "cs_mesh.h"
+#include "cs_mesh_builder.h"
+#include "cs_mesh_warping.h"
+#include "cs_numbering.h"
+#include "cs_partition.h"
+#include "cs_preprocessor_data.h"
+#include "cs_timer.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_mesh_cache.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Type Definitions
+ *============================================================================*/
+
+/* Local dimensions saved for each rank; numbering values are saved
+   in the same order as in _numbering_names, with _N_NUMBERING_DIMS
+   values for each numbering. */
+
+typedef enum {
+
+  _N_CELLS,
+  _N_I_FACES,
+  _N_B_FACES,
+  _N_VERTICES,
+  _I_FACE_VTX_CONNECT_SIZE,
+  _B_FACE_VTX_CONNECT_SIZE,
+  _N_GHOST_CELLS,
+  _HALO_TYPE,
+  _HAVE_HALO,
+  _HALO_N_C_DOMAINS,
+  _HALO_N_SEND_ELTS_STD,
+  _HALO_N_SEND_ELTS_EXT,
+  _HALO_N_ELTS_STD,
+  _HALO_N_ELTS_EXT,
+  _ARRAY_FLAGS,
+  _CELL_CELLS_SIZE,
+  _GCELL_VTX_SIZE,
+  _N_GROUPS,
+  _GROUP_NAMES_SIZE,
+  _N_FAMILIES,
+  _N_MAX_FAMILY_ITEMS,
+  _N_G_FREE_FACES,
+  _N_THREADS,
+  _NUMBERING,
+  _N_NUMBERING_DIMS = 6,
+  _N_DIMS = _NUMBERING + 4*_N_NUMBERING_DIMS
+
+} _dim_id_t;
+
+/* Flags for optional arrays */
+
+#define _CELL_GNUM      (1 << 0)
+#define _I_FACE_GNUM    (1 << 1)
+#define _B_FACE_GNUM    (1 << 2)
+#define _VTX_GNUM       (1 << 3)
+#define _CELL_FAMILY    (1 << 4)
+#define _I_FACE_FAMILY  (1 << 5)
+#define _B_FACE_FAMILY  (1 << 6)
+#define _I_FACE_R_GEN   (1 << 7)
+#define _CELL_CELLS     (1 << 8)
+#define _GCELL_VTX      (1 << 9)
+
+/* Signature of mesh input and preprocessing options, used to check
+   that the cache matches the current computation. Mesh dimensions are
+   those read from the mesh input headers (so interior and boundary
+   faces are not distinguished yet). */
+
+typedef enum {
+
+  _SIG_N_G_CELLS,
+  _SIG_N_G_FACES,
+  _SIG_N_G_VERTICES,
+  _SIG_N_G_FACE_CONNECT_SIZE,
+  _SIG_INPUT_FILES,
+  _SIG_OPTIONS,
+  _N_SIG
+
+} _sig_id_t;
+
+/* 64-bit FNV-1a hash parameters */
+
+#define _HASH_INIT   14695981039346656037ULL
+#define _HASH_PRIME  1099511628211ULL
+
+/* Size of an optional array based on its flag */
+
+#define _OPT_SIZE(flags, flag, n) (((flags) & (flag)) ? (cs_gnum_t)(n) : 0)
+
+/* Directory name separator
+   (historically, '/' for Unix/Linux, '\' for Windows, ':' for Mac
+   but '/' should work for all on modern systems) */
+
+#define DIR_SEPARATOR '/'
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static bool _read_cache = false;
+static bool _write_cache = false;
+
+static bool _have_signature = false;
+static uint64_t _signature[_N_SIG];
+
+static const char _cache_dir_w[] = "checkpoint";
+static const char _cache_dir_r[] = "restart";
+static const char _cache_name[] = "mesh_cache.csc";
+static const char _magic_string[] = "Mesh cache, R0";
+
+static const char *_numbering_names[] = {"numbering:cells",
+                                         "numbering:i_faces",
+                                         "numbering:b_faces",
+                                         "numbering:vertices"};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Return cache file path for a given directory.
+ *
+ * parameters:
+ *   dir <-- directory name
+ *
+ * returns:
+ *   pointer to newly allocated path
+ *----------------------------------------------------------------------------*/
+
+static char *
+_cache_path(const char  *dir)
+{
+  char *path;
+
+  BFT_MALLOC(path, strlen(dir) + strlen(_cache_name) + 2, char);
+  sprintf(path, "%s%c%s", dir, DIR_SEPARATOR, _cache_name);
+
+  return path;
+}
+
+/*----------------------------------------------------------------------------
+ * Check if the mesh contains features not handled by the mesh cache.
+ *
+ * parameters:
+ *   mesh <-- pointer to mesh structure
+ *
+ * returns:
+ *   true if the mesh cache may be used, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_mesh_is_cacheable(const cs_mesh_t  *mesh)
+{
+  bool retval = true;
+
+  if (mesh->n_init_perio > 0) {
+    bft_printf(_("\n Mesh cache not used: periodicity is not handled.\n"));
+    retval = false;
+  }
+  else if (cs_internal_coupling_n_couplings() > 0) {
+    bft_printf(_("\n Mesh cache not used: internal coupling "
+                 "is not handled.\n"));
+    retval = false;
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Update a 64-bit FNV-1a hash with a given byte sequence.
+ *
+ * parameters:
+ *   h    <-- current hash value
+ *   data <-- pointer to data
+ *   size <-- data size, in bytes
+ *
+ * returns:
+ *   updated hash value
+ *----------------------------------------------------------------------------*/
+
+static uint64_t
+_hash_update(uint64_t     h,
+             const void  *data,
+             size_t       size)
+{
+  const unsigned char *p = data;
+
+  for (size_t i = 0; i < size; i++) {
+    h ^= p[i];
+    h *= _HASH_PRIME;
+  }
+
+  return h;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the signature of the mesh input and preprocessing options.
+ *
+ * The signature includes the dimensions read from mesh input headers,
+ * the size, modification time and transformation matrix of each input
+ * file, and mesh joining, face warping and partitioning options.
+ * Mesh modifications defined in user functions cannot be checked.
+ *
+ * parameters:
+ *   mesh <-- pointer to mesh structure (with input header data)
+ *   mb   <-- pointer to mesh builder structure (with input header data)
+ *----------------------------------------------------------------------------*/
+
+static void
+_compute_signature(const cs_mesh_t          *mesh,
+                   const cs_mesh_builder_t  *mb)
+{
+  for (int i = 0; i < _N_SIG; i++)
+    _signature[i] = 0;
+
+  _signature[_SIG_N_G_CELLS] = mesh->n_g_cells;
+  _signature[_SIG_N_G_VERTICES] = mesh->n_g_vertices;
+  if (mb != NULL) {
+    _signature[_SIG_N_G_FACES] = mb->n_g_faces;
+    _signature[_SIG_N_G_FACE_CONNECT_SIZE] = mb->n_g_face_connect_size;
+  }
+
+  /* Mesh input files (checked on rank 0 only) */
+
+  uint64_t h = _HASH_INIT;
+
+  if (cs_glob_rank_id < 1) {
+    const char *name = NULL;
+    const double *matrix = NULL;
+    for (int i = 0;
+         (name = cs_preprocessor_data_get_file_info(i, &matrix)) != NULL;
+         i++) {
+      cs_file_off_t f_size = cs_file_size(name);
+      double f_mtime = cs_file_mtime(name);
+      h = _hash_update(h, &f_size, sizeof(cs_file_off_t));
+      h = _hash_update(h, &f_mtime, sizeof(double));
+      if (matrix != NULL)
+        h = _hash_update(h, matrix, 12*sizeof(double));
+    }
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Bcast(&h, sizeof(uint64_t), MPI_BYTE, 0, cs_glob_mpi_comm);
+#endif
+
+  _signature[_SIG_INPUT_FILES] = h;
+
+  /* Preprocessing options */
+
+  h = _HASH_INIT;
+
+  for (int j_id = 0; j_id < cs_glob_n_joinings; j_id++) {
+    const cs_join_t *join = cs_glob_join_array[j_id];
+    const cs_join_param_t *p = &(join->param);
+    const int i_vals[] = {p->perio_type, p->tree_max_level,
+                          p->tree_n_max_boxes, p->n_max_equiv_breaks,
+                          p->tcm, p->icm, p->max_sub_faces};
+    const float f_vals[] = {p->tree_max_box_ratio,
+                            p->tree_max_box_ratio_distrib,
+                            p->fraction, p->plane,
+                            p->merge_tol_coef, p->pre_merge_factor};
+    if (join->criteria != NULL)
+      h = _hash_update(h, join->criteria, strlen(join->criteria) + 1);
+    h = _hash_update(h, i_vals, sizeof(i_vals));
+    h = _hash_update(h, f_vals, sizeof(f_vals));
+    h = _hash_update(h, p->perio_matrix, sizeof(p->perio_matrix));
+  }
+
+  {
+    double  cwf_threshold = -1.0;
+    int  cwf_post = 0;
+    cs_mesh_warping_get_defaults(&cwf_threshold, &cwf_post);
+    h = _hash_update(h, &cwf_threshold, sizeof(double));
+  }
+
+  {
+    int rank_step = 1;
+    int algorithm = cs_partition_get_algorithm(CS_PARTITION_MAIN,
+                                               &rank_step,
+                                               NULL);
+    h = _hash_update(h, &algorithm, sizeof(int));
+    h = _hash_update(h, &rank_step, sizeof(int));
+  }
+
+  _signature[_SIG_OPTIONS] = h;
+
+  _have_signature = true;
+}
+
+/*----------------------------------------------------------------------------
+ * Add the cache file used, and the partitioning read from the restart
+ * directory if present, to the checkpoint directory, so that they are
+ * also available for a subsequent restart.
+ *
+ * parameters:
+ *   path      <-- path to cache file used, or NULL
+ *   part_path <-- path to partitioning file in restart directory
+ *----------------------------------------------------------------------------*/
+
+static void
+_checkpoint_cache(const char  *path,
+                  const char  *part_path)
+{
+  if (cs_glob_rank_id > 0)
+    return;
+
+  if (path == NULL && cs_file_isreg(part_path) == 0)
+    return;
+
+  if (cs_file_mkdir_default(_cache_dir_w) != 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("The %s directory cannot be created"), _cache_dir_w);
+
+  const char *src[2] = {path, part_path};
+  char *dest[2] = {NULL, NULL};
+
+  if (path != NULL)
+    dest[0] = _cache_path(_cache_dir_w);
+
+  if (cs_file_isreg(part_path)) {
+    const char *name = part_path + strlen(_cache_dir_r) + 1;
+    BFT_MALLOC(dest[1], strlen(_cache_dir_w) + strlen(name) + 2, char);
+    sprintf(dest[1], "%s%c%s", _cache_dir_w, DIR_SEPARATOR, name);
+  }
+
+  for (int i = 0; i < 2; i++) {
+    if (dest[i] == NULL)
+      continue;
+    if (cs_file_link_or_copy(src[i], dest[i]) != 0) {
+      cs_base_warn(__FILE__, __LINE__);
+      bft_printf(_("Failure linking or copying %s to %s.\n"),
+                 src[i], dest[i]);
+    }
+    BFT_FREE(dest[i]);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the range of a rank's values in a rank-ordered section.
+ *
+ * parameters:
+ *   n_local <-- local number of values
+ *   range   --> global number of first and past-the-end local values
+ *
+ * returns:
+ *   global number of values
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_rank_range(cs_gnum_t  n_local,
+            cs_gnum_t  range[2])
+{
+  cs_gnum_t n_g = n_local;
+
+  range[0] = 1;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_gnum_t n_end = 0;
+    MPI_Scan(&n_local, &n_end, 1, CS_MPI_GNUM, MPI_SUM, cs_glob_mpi_comm);
+    range[0] = n_end - n_local + 1;
+    MPI_Allreduce(&n_local, &n_g, 1, CS_MPI_GNUM, MPI_SUM, cs_glob_mpi_comm);
+  }
+#endif
+
+  range[1] = range[0] + n_local;
+
+  return n_g;
+}
+
+/*----------------------------------------------------------------------------
+ * Write a rank-ordered section, each rank providing its local values.
+ *
+ * Sections with no values on any rank are not written. Sections are
+ * associated with location 1 (i.e. ranks), so that character arrays
+ * are not handled as strings when read.
+ *
+ * parameters:
+ *   sec_name <-- section name
+ *   n_local  <-- local number of values
+ *   elt_type <-- element type
+ *   elts     <-- local values
+ *   outp     <-> output kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_section(const char     *sec_name,
+               cs_gnum_t       n_local,
+               cs_datatype_t   elt_type,
+               const void     *elts,
+               cs_io_t        *outp)
+{
+  cs_gnum_t range[2];
+  cs_gnum_t n_g = _rank_range(n_local, range);
+
+  if (n_g > 0)
+    cs_io_write_block(sec_name,
+                      n_g,
+                      range[0],
+                      range[1],
+                      1, /* location_id */
+                      0, /* index_id */
+                      1, /* n_location_vals */
+                      elt_type,
+                      elts,
+                      outp);
+}
+
+/*----------------------------------------------------------------------------
+ * Position the cache file at a given section.
+ *
+ * parameters:
+ *   sec_name <-- section name
+ *   elt_type <-- type of values expected
+ *   header   --> section header
+ *   inp      <-> input kernel IO structure
+ *
+ * returns:
+ *   true if the section was found, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_seek_section(const char           *sec_name,
+              cs_datatype_t         elt_type,
+              cs_io_sec_header_t   *header,
+              cs_io_t              *inp)
+{
+  size_t n_secs = cs_io_get_index_size(inp);
+
+  for (size_t id = 0; id < n_secs; id++) {
+    if (strcmp(cs_io_get_indexed_sec_name(inp, id), sec_name) == 0) {
+      *header = cs_io_get_indexed_sec_header(inp, id);
+      cs_io_set_indexed_position(inp, header, id);
+      header->elt_type = elt_type;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/*----------------------------------------------------------------------------
+ * Read a rank-ordered section, each rank reading its local values.
+ *
+ * parameters:
+ *   sec_name <-- section name
+ *   n_local  <-- local number of values
+ *   elt_type <-- element type
+ *   elts     --> local values
+ *   inp      <-> input kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_section(const char     *sec_name,
+              cs_gnum_t       n_local,
+              cs_datatype_t   elt_type,
+              void           *elts,
+              cs_io_t        *inp)
+{
+  cs_io_sec_header_t header;
+  cs_gnum_t range[2];
+  cs_gnum_t n_g = _rank_range(n_local, range);
+
+  if (n_g == 0)
+    return;
+
+  if (   _seek_section(sec_name, elt_type, &header, inp) == false
+      || (cs_gnum_t)(header.n_vals) != n_g)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Mesh cache file \"%s\":\n"
+                "section \"%s\" is missing or does not have the expected "
+                "size."),
+              cs_io_get_name(inp), sec_name);
+
+  cs_io_read_block(&header, range[0], range[1], elts, inp);
+}
+
+/*----------------------------------------------------------------------------
+ * Read a global section, allocating the matching array.
+ *
+ * parameters:
+ *   sec_name  <-- section name
+ *   n_vals    <-- number of values
+ *   elt_type  <-- element type
+ *   elt_size  <-- element size
+ *   inp       <-> input kernel IO structure
+ *
+ * returns:
+ *   pointer to allocated array, or NULL if n_vals = 0
+ *----------------------------------------------------------------------------*/
+
+static void *
+_read_global_section(const char     *sec_name,
+                     cs_gnum_t       n_vals,
+                     cs_datatype_t   elt_type,
+                     size_t          elt_size,
+                     cs_io_t        *inp)
+{
+  cs_io_sec_header_t header;
+  unsigned char *elts = NULL;
+
+  if (n_vals == 0)
+    return NULL;
+
+  if (   _seek_section(sec_name, elt_type, &header, inp) == false
+      || (cs_gnum_t)(header.n_vals) != n_vals)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Mesh cache file \"%s\":\n"
+                "section \"%s\" is missing or does not have the expected "
+                "size."),
+              cs_io_get_name(inp), sec_name);
+
+  /* Character arrays are null-terminated on read */
+
+  BFT_MALLOC(elts, (n_vals + 1)*elt_size, unsigned char);
+  cs_io_read_global(&header, elts, inp);
+
+  return elts;
+}
+
+/*----------------------------------------------------------------------------
+ * Open the cache file.
+ *
+ * parameters:
+ *   path <-- file path
+ *   mode <-- read or write mode
+ *
+ * returns:
+ *   pointer to kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+static cs_io_t *
+_open_cache(const char    *path,
+            cs_io_mode_t   mode)
+{
+  cs_io_t *cio = NULL;
+  cs_file_access_t  method;
+  const long echo = CS_IO_ECHO_OPEN_CLOSE;
+  const cs_file_mode_t f_mode
+    = (mode == CS_IO_MODE_READ) ? CS_FILE_MODE_READ : CS_FILE_MODE_WRITE;
+
+#if defined(HAVE_MPI)
+
+  int  block_rank_step = 1, block_min_size = 0;
+  MPI_Info  hints;
+  MPI_Comm  block_comm, comm;
+
+  cs_file_get_default_comm(&block_rank_step, &block_min_size,
+                           &block_comm, &comm);
+
+  assert(comm == cs_glob_mpi_comm || comm == MPI_COMM_NULL);
+
+  cs_file_get_default_access(f_mode, &method, &hints);
+
+  if (mode == CS_IO_MODE_READ)
+    cio = cs_io_initialize_with_index(path, _magic_string, method, echo,
+                                      hints, block_comm, comm);
+  else
+    cio = cs_io_initialize(path, _magic_string, mode, method, echo,
+                           hints, block_comm, comm);
+
+#else
+
+  cs_file_get_default_access(f_mode, &method);
+
+  if (mode == CS_IO_MODE_READ)
+    cio = cs_io_initialize_with_index(path, _magic_string, method, echo);
+  else
+    cio = cs_io_initialize(path, _magic_string, mode, method, echo);
+
+#endif
+
+  return cio;
+}
+
+/*----------------------------------------------------------------------------
+ * Restore a numbering structure from saved dimensions and group index.
+ *
+ * parameters:
+ *   dims <-- saved numbering dimensions
+ *   name <-- section name for group index
+ *   inp  <-> input kernel IO structure
+ *
+ * returns:
+ *   pointer to numbering structure
+ *----------------------------------------------------------------------------*/
+
+static cs_numbering_t *
+_read_numbering(const cs_gnum_t   dims[],
+                const char       *name,
+                cs_io_t          *inp)
+{
+  cs_numbering_t *numbering = NULL;
+
+  BFT_MALLOC(numbering, 1, cs_numbering_t);
+
+  numbering->type = (cs_numbering_type_t)dims[0];
+  numbering->vector_size = dims[1];
+  numbering->n_threads = dims[2];
+  numbering->n_groups = dims[3];
+  numbering->n_no_adj_halo_groups = dims[4];
+  numbering->n_no_adj_halo_elts = dims[5];
+
+  cs_lnum_t n_vals = numbering->n_threads * numbering->n_groups * 2;
+
+  BFT_MALLOC(numbering->group_index, n_vals, cs_lnum_t);
+  _read_section(name, n_vals, CS_LNUM_TYPE, numbering->group_index, inp);
+
+  return numbering;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Set mesh cache mode.
+ *
+ * When writing is enabled, the local mesh of each rank is saved to
+ * "checkpoint/mesh_cache.csc" once it has been partitioned, joined,
+ * and renumbered, with its halo and numbering metadata. When reading is
+ * enabled and "mesh_cache.csc" is present in the execution directory
+ * (or in the "restart" directory) and was written with the same number
+ * of ranks for the same mesh input and preprocessing options, that file
+ * is used instead of reading, preprocessing, partitioning and renumbering
+ * the mesh; if writing is also enabled, the cache used is then linked
+ * (or copied) to "checkpoint/mesh_cache.csc". A cache is ignored when
+ * "restart/domain_number_<n_ranks>" is at least as recent, so that a
+ * partitioning balanced by cs_partition_check_restart_balance() is applied.
+ *
+ * The mesh input files (size and modification time), mesh dimensions,
+ * mesh joining, face warping and partitioning options are checked, but
+ * mesh modifications defined in user functions or through the GUI
+ * are not, so the cache should be removed when these are changed.
+ *
+ * Both modes are disabled by default. This function should be called
+ * before the mesh is read, i.e. in cs_user_partition().
+ *
+ * parameters:
+ *   read  <-- true to restore the mesh from the cache if possible
+ *   write <-- true to save the mesh to the cache
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_cache_set_mode(bool  read,
+                       bool  write)
+{
+  _read_cache = read;
+  _write_cache = write;
+}
+
+/*----------------------------------------------------------------------------
+ * Query mesh cache mode.
+ *
+ * parameters:
+ *   read  --> true if the mesh is restored from the cache if possible,
+ *             or NULL
+ *   write --> true if the mesh is saved to the cache, or NULL
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_cache_get_mode(bool  *read,
+                       bool  *write)
+{
+  if (read != NULL)
+    *read = _read_cache;
+  if (write != NULL)
+    *write = _write_cache;
+}
+
+/*----------------------------------------------------------------------------
+ * Save a preprocessed, partitioned and renumbered mesh to the mesh cache.
+ *
+ * Nothing is done if writing is not enabled or if the mesh uses
+ * periodicity or internal coupling, which are not handled by the cache.
+ * The signature of the mesh input and preprocessing options is also
+ * required, so cs_mesh_cache_read must have been called first.
+ *
+ * This function is collective.
+ *
+ * parameters:
+ *   mesh <-- pointer to mesh structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_cache_write(const cs_mesh_t  *mesh)
+{
+  if (_write_cache == false || _mesh_is_cacheable(mesh) == false)
+    return;
+
+  if (_have_signature == false) {
+    bft_printf(_("\n Mesh cache not written: "
+                 "mesh input signature not available.\n"));
+    return;
+  }
+
+  double t0 = cs_timer_wtime();
+
+  const cs_datatype_t gnum_type
+    = (sizeof(cs_gnum_t) == 8) ? CS_UINT64 : CS_UINT32;
+  const cs_datatype_t int_type
+    = (sizeof(int) == 8) ? CS_INT64 : CS_INT32;
+
+  const cs_halo_t *halo = mesh->halo;
+  const cs_numbering_t *numbering[4] = {mesh->cell_numbering,
+                                        mesh->i_face_numbering,
+                                        mesh->b_face_numbering,
+                                        mesh->vtx_numbering};
+
+  /* Local dimensions */
+
+  cs_gnum_t dims[_N_DIMS];
+
+  for (int i = 0; i < _N_DIMS; i++)
+    dims[i] = 0;
+
+  dims[_N_CELLS] = mesh->n_cells;
+  dims[_N_I_FACES] = mesh->n_i_faces;
+  dims[_N_B_FACES] = mesh->n_b_faces;
+  dims[_N_VERTICES] = mesh->n_vertices;
+  dims[_I_FACE_VTX_CONNECT_SIZE] = mesh->i_face_vtx_connect_size;
+  dims[_B_FACE_VTX_CONNECT_SIZE] = mesh->b_face_vtx_connect_size;
+  dims[_N_GHOST_CELLS] = mesh->n_ghost_cells;
+  dims[_HALO_TYPE] = mesh->halo_type;
+  if (halo != NULL) {
+    dims[_HAVE_HALO] = 1;
+    dims[_HALO_N_C_DOMAINS] = halo->n_c_domains;
+    dims[_HALO_N_SEND_ELTS_STD] = halo->n_send_elts[0];
+    dims[_HALO_N_SEND_ELTS_EXT] = halo->n_send_elts[1];
+    dims[_HALO_N_ELTS_STD] = halo->n_elts[0];
+    dims[_HALO_N_ELTS_EXT] = halo->n_elts[1];
+  }
+
+  const void *opt_arrays[] = {mesh->global_cell_num,
+                              mesh->global_i_face_num,
+                              mesh->global_b_face_num,
+                              mesh->global_vtx_num,
+                              mesh->cell_family,
+                              mesh->i_face_family,
+                              mesh->b_face_family,
+                              mesh->i_face_r_gen,
+                              mesh->cell_cells_idx,
+                              mesh->gcell_vtx_idx};
+
+  for (int i = 0; i < 10; i++) {
+    if (opt_arrays[i] != NULL)
+      dims[_ARRAY_FLAGS] |= (1 << i);
+  }
+  if (mesh->cell_cells_idx != NULL)
+    dims[_CELL_CELLS_SIZE] = mesh->cell_cells_idx[mesh->n_cells];
+  if (mesh->gcell_vtx_idx != NULL)
+    dims[_GCELL_VTX_SIZE] = mesh->gcell_vtx_idx[mesh->n_ghost_cells];
+  dims[_N_GROUPS] = mesh->n_groups;
+  if (mesh->n_groups > 0)
+    dims[_GROUP_NAMES_SIZE] = mesh->group_idx[mesh->n_groups];
+  dims[_N_FAMILIES] = mesh->n_families;
+  dims[_N_MAX_FAMILY_ITEMS] = mesh->n_max_family_items;
+  dims[_N_G_FREE_FACES] = mesh->n_g_free_faces;
+  dims[_N_THREADS] = cs_glob_n_threads;
+
+  for (int i = 0; i < 4; i++) {
+    const cs_numbering_t *n = numbering[i];
+    cs_gnum_t *n_dims = dims + _NUMBERING + i*_N_NUMBERING_DIMS;
+    n_dims[0] = n->type;
+    n_dims[1] = n->vector_size;
+    n_dims[2] = n->n_threads;
+    n_dims[3] = n->n_groups;
+    n_dims[4] = n->n_no_adj_halo_groups;
+    n_dims[5] = n->n_no_adj_halo_elts;
+  }
+
+  /* Open file */
+
+  if (cs_file_mkdir_default(_cache_dir_w) != 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("The %s directory cannot be created"), _cache_dir_w);
+
+  char *path = _cache_path(_cache_dir_w);
+
+  cs_io_t *outp = _open_cache(path, CS_IO_MODE_WRITE);
+
+  BFT_FREE(path);
+
+  /* Dimensions, groups and families */
+
+  _write_section("mesh_cache:dimensions", _N_DIMS, gnum_type, dims, outp);
+
+  cs_io_write_global("mesh_cache:signature", _N_SIG, 0, 0, 1,
+                     CS_UINT64, _signature, outp);
+
+  if (mesh->n_groups > 0) {
+    cs_io_write_global("groups:index", mesh->n_groups + 1, 0, 0, 1,
+                       int_type, mesh->group_idx, outp);
+    cs_io_write_global("groups:names", mesh->group_idx[mesh->n_groups],
+                       0, 0, 1, CS_CHAR, mesh->group, outp);
+  }
+
+  if (mesh->n_families * mesh->n_max_family_items > 0)
+    cs_io_write_global("families:items",
+                       mesh->n_families * mesh->n_max_family_items, 0, 0, 1,
+                       int_type, mesh->family_item, outp);
+
+  /* Connectivity, numbering and families */
+
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_i_faces = mesh->n_i_faces;
+  const cs_lnum_t n_b_faces = mesh->n_b_faces;
+  const cs_lnum_t n_vertices = mesh->n_vertices;
+  const cs_gnum_t flags = dims[_ARRAY_FLAGS];
+
+  _write_section("cells:global_num",
+                 _OPT_SIZE(flags, _CELL_GNUM, n_cells), gnum_type,
+                 mesh->global_cell_num, outp);
+  _write_section("cells:family",
+                 _OPT_SIZE(flags, _CELL_FAMILY, n_cells), int_type,
+                 mesh->cell_family, outp);
+
+  _write_section("i_faces:cells", n_i_faces*2, CS_LNUM_TYPE,
+                 mesh->i_face_cells, outp);
+  _write_section("i_faces:vertices_index", n_i_faces + 1, CS_LNUM_TYPE,
+                 mesh->i_face_vtx_idx, outp);
+  _write_section("i_faces:vertices", mesh->i_face_vtx_connect_size,
+                 CS_LNUM_TYPE, mesh->i_face_vtx_lst, outp);
+  _write_section("i_faces:global_num",
+                 _OPT_SIZE(flags, _I_FACE_GNUM, n_i_faces), gnum_type,
+                 mesh->global_i_face_num, outp);
+  _write_section("i_faces:family",
+                 _OPT_SIZE(flags, _I_FACE_FAMILY, n_i_faces), int_type,
+                 mesh->i_face_family, outp);
+  _write_section("i_faces:refinement_generation",
+                 _OPT_SIZE(flags, _I_FACE_R_GEN, n_i_faces), CS_CHAR,
+                 mesh->i_face_r_gen, outp);
+
+  _write_section("b_faces:cells", n_b_faces, CS_LNUM_TYPE,
+                 mesh->b_face_cells, outp);
+  _write_section("b_faces:vertices_index", n_b_faces + 1, CS_LNUM_TYPE,
+                 mesh->b_face_vtx_idx, outp);
+  _write_section("b_faces:vertices", mesh->b_face_vtx_connect_size,
+                 CS_LNUM_TYPE, mesh->b_face_vtx_lst, outp);
+  _write_section("b_faces:global_num",
+                 _OPT_SIZE(flags, _B_FACE_GNUM, n_b_faces), gnum_type,
+                 mesh->global_b_face_num, outp);
+  _write_section("b_faces:family",
+                 _OPT_SIZE(flags, _B_FACE_FAMILY, n_b_faces), int_type,
+                 mesh->b_face_family, outp);
+
+  _write_section("vertices:coords", n_vertices*3, CS_REAL_TYPE,
+                 mesh->vtx_coord, outp);
+  _write_section("vertices:global_num",
+                 _OPT_SIZE(flags, _VTX_GNUM, n_vertices), gnum_type,
+                 mesh->global_vtx_num, outp);
+
+  /* Extended neighborhood */
+
+  _write_section("cells:cell_cells_index",
+                 _OPT_SIZE(flags, _CELL_CELLS, n_cells + 1), CS_LNUM_TYPE,
+                 mesh->cell_cells_idx, outp);
+  _write_section("cells:cell_cells", dims[_CELL_CELLS_SIZE], CS_LNUM_TYPE,
+                 mesh->cell_cells_lst, outp);
+  _write_section("ghost_cells:vertices_index",
+                 _OPT_SIZE(flags, _GCELL_VTX, mesh->n_ghost_cells + 1),
+                 CS_LNUM_TYPE, mesh->gcell_vtx_idx, outp);
+  _write_section("ghost_cells:vertices", dims[_GCELL_VTX_SIZE],
+                 CS_LNUM_TYPE, mesh->gcell_vtx_lst, outp);
+
+  /* Halo */
+
+  if (halo != NULL) {
+    _write_section("halo:c_domain_rank", halo->n_c_domains, int_type,
+                   halo->c_domain_rank, outp);
+    _write_section("halo:send_index", 2*halo->n_c_domains + 1, CS_LNUM_TYPE,
+                   halo->send_index, outp);
+    _write_section("halo:send_list", halo->n_send_elts[1], CS_LNUM_TYPE,
+                   halo->send_list, outp);
+    _write_section("halo:index", 2*halo->n_c_domains + 1, CS_LNUM_TYPE,
+                   halo->index, outp);
+  }
+
+  /* Numbering */
+
+  for (int i = 0; i < 4; i++)
+    _write_section(_numbering_names[i],
+                   numbering[i]->n_threads * numbering[i]->n_groups * 2,
+                   CS_LNUM_TYPE, numbering[i]->group_index, outp);
+
+  cs_io_finalize(&outp);
+
+  bft_printf(_("\n Mesh cache written (%.3g s)\n"),
+             cs_timer_wtime() - t0);
+}
+
+/*----------------------------------------------------------------------------
+ * Restore a preprocessed, partitioned and renumbered mesh from the
+ * mesh cache.
+ *
+ * The mesh is expected to contain only the metadata read from the mesh
+ * input headers, which are used (with input file information and
+ * preprocessing options) to define the signature saved with the cache.
+ * If reading is not enabled, no usable cache is found, or the cache does
+ * not match the current mesh input, preprocessing options, number of
+ * ranks, threads or halo type, the mesh is unchanged and false is
+ * returned, so the mesh should be built in the usual manner.
+ *
+ * On success, halo, numbering and interface structures are also rebuilt,
+ * and auxiliary mesh values are updated.
+ *
+ * This function is collective.
+ *
+ * parameters:
+ *   mesh      <-> pointer to mesh structure
+ *   mb        <-- pointer to mesh builder structure (with header data)
+ *   halo_type <-- required halo type
+ *
+ * returns:
+ *   true if the mesh was restored from the cache, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_cache_read(cs_mesh_t                *mesh,
+                   const cs_mesh_builder_t  *mb,
+                   cs_halo_type_t            halo_type)
+{
+  if (_read_cache || _write_cache)
+    _compute_signature(mesh, mb);
+
+  if (_read_cache == false)
+    return false;
+
+  /* Look for cache in execution directory first, then in restart
+     directory */
+
+  int location = 0;
+  char *path = _cache_path(_cache_dir_r);
+
+  char part_path[64];
+  snprintf(part_path, 64, "%s%cdomain_number_%d",
+           _cache_dir_r, DIR_SEPARATOR, cs_glob_n_ranks);
+  part_path[63] = '\0';
+
+  if (cs_glob_rank_id < 1) {
+    if (cs_file_isreg(_cache_name))
+      location = 1;
+    else if (cs_file_isreg(path))
+      location = 2;
+
+    /* A partitioning saved with the checkpoint of a previous run
+       (based on measured loads) has priority over an older cache */
+
+    if (location > 0 && cs_glob_n_ranks > 1 && cs_file_isreg(part_path)) {
+      const char *c_path = (location == 1) ? _cache_name : path;
+      if (cs_file_mtime(part_path) >= cs_file_mtime(c_path))
+        location = -1;
+    }
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_rank_id >= 0)
+    MPI_Bcast(&location, 1, MPI_INT, 0, cs_glob_mpi_comm);
+#endif
+
+  if (location == 1)
+    strcpy(path, _cache_name);
+
+  else if (location == 0) {
+    bft_printf(_("\n Mesh cache file \"%s\" not present.\n"), _cache_name);
+    BFT_FREE(path);
+    return false;
+  }
+
+  else if (location < 0) {
+    bft_printf(_("\n Mesh cache not used: partitioning file \"%s\"\n"
+                 " is more recent.\n"), part_path);
+    BFT_FREE(path);
+    return false;
+  }
+
+  if (_mesh_is_cacheable(mesh) == false) {
+    BFT_FREE(path);
+    return false;
+  }
+
+  double t0 = cs_timer_wtime();
+
+  const cs_datatype_t gnum_type
+    = (sizeof(cs_gnum_t) == 8) ? CS_UINT64 : CS_UINT32;
+  const cs_datatype_t int_type
+    = (sizeof(int) == 8) ? CS_INT64 : CS_INT32;
+
+  cs_io_t *inp = _open_cache(path, CS_IO_MODE_READ);
+
+  /* Check compatibility with current run */
+
+  cs_io_sec_header_t header;
+  cs_gnum_t dims[_N_DIMS];
+
+  if (_seek_section("mesh_cache:dimensions", gnum_type, &header, inp)
+      == false)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Mesh cache file \"%s\" has no dimensions section."),
+              cs_io_get_name(inp));
+
+  if ((cs_gnum_t)(header.n_vals) != (cs_gnum_t)cs_glob_n_ranks*_N_DIMS) {
+    bft_printf(_("\n Mesh cache not used: it was written for %llu ranks.\n"),
+               (unsigned long long)(header.n_vals / _N_DIMS));
+    cs_io_finalize(&inp);
+    BFT_FREE(path);
+    return false;
+  }
+
+  /* Check mesh input and preprocessing options */
+
+  {
+    uint64_t sig[_N_SIG];
+    int match = 0;
+
+    if (   _seek_section("mesh_cache:signature", CS_UINT64, &header, inp)
+        && header.n_vals == _N_SIG) {
+      cs_io_read_global(&header, sig, inp);
+      match = 1;
+      for (int i = 0; i < _N_SIG; i++) {
+        if (sig[i] != _signature[i])
+          match = 0;
+      }
+    }
+
+    if (match == 0) {
+      bft_printf(_("\n Mesh cache not used: it does not match the current "
+                   "mesh input\n or preprocessing options.\n"));
+      cs_io_finalize(&inp);
+      BFT_FREE(path);
+      return false;
+    }
+  }
+
+  _read_section("mesh_cache:dimensions", _N_DIMS, gnum_type, dims, inp);
+
+  if (dims[_HALO_TYPE] != (cs_gnum_t)halo_type) {
+    bft_printf(_("\n Mesh cache not used: halo type differs.\n"));
+    cs_io_finalize(&inp);
+    BFT_FREE(path);
+    return false;
+  }
+
+  if (dims[_N_THREADS] != (cs_gnum_t)cs_glob_n_threads) {
+    bft_printf(_("\n Mesh cache not used: it was written for %d threads.\n"),
+               (int)dims[_N_THREADS]);
+    cs_io_finalize(&inp);
+    BFT_FREE(path);
+    return false;
+  }
+
+  /* Dimensions */
+
+  const cs_lnum_t n_cells = dims[_N_CELLS];
+  const cs_lnum_t n_i_faces = dims[_N_I_FACES];
+  const cs_lnum_t n_b_faces = dims[_N_B_FACES];
+  const cs_lnum_t n_vertices = dims[_N_VERTICES];
+
+  mesh->n_cells = n_cells;
+  mesh->n_i_faces = n_i_faces;
+  mesh->n_b_faces = n_b_faces;
+  mesh->n_vertices = n_vertices;
+  mesh->i_face_vtx_connect_size = dims[_I_FACE_VTX_CONNECT_SIZE];
+  mesh->b_face_vtx_connect_size = dims[_B_FACE_VTX_CONNECT_SIZE];
+  mesh->n_ghost_cells = dims[_N_GHOST_CELLS];
+  mesh->n_cells_with_ghosts = n_cells + mesh->n_ghost_cells;
+  mesh->halo_type = halo_type;
+  mesh->n_g_free_faces = dims[_N_G_FREE_FACES];
+
+  /* Groups and families (replacing those read from mesh headers) */
+
+  BFT_FREE(mesh->group_idx);
+  BFT_FREE(mesh->group);
+  BFT_FREE(mesh->family_item);
+
+  mesh->n_groups = dims[_N_GROUPS];
+  mesh->n_families = dims[_N_FAMILIES];
+  mesh->n_max_family_items = dims[_N_MAX_FAMILY_ITEMS];
+
+  if (mesh->n_groups > 0) {
+    mesh->group_idx = _read_global_section("groups:index",
+                                           mesh->n_groups + 1,
+                                           int_type, sizeof(int), inp);
+    mesh->group = _read_global_section("groups:names",
+                                       dims[_GROUP_NAMES_SIZE],
+                                       CS_CHAR, 1, inp);
+  }
+
+  mesh->family_item
+    = _read_global_section("families:items",
+                           mesh->n_families * mesh->n_max_family_items,
+                           int_type, sizeof(int), inp);
+
+  /* Connectivity, numbering and families */
+
+  const cs_gnum_t flags = dims[_ARRAY_FLAGS];
+
+  if (flags & _CELL_GNUM)
+    BFT_MALLOC(mesh->global_cell_num, n_cells, cs_gnum_t);
+  if (flags & _CELL_FAMILY)
+    BFT_MALLOC(mesh->cell_family, mesh->n_cells_with_ghosts, int);
+
+  _read_section("cells:global_num",
+                _OPT_SIZE(flags, _CELL_GNUM, n_cells), gnum_type,
+                mesh->global_cell_num, inp);
+  _read_section("cells:family",
+                _OPT_SIZE(flags, _CELL_FAMILY, n_cells), int_type,
+                mesh->cell_family, inp);
+
+  BFT_MALLOC(mesh->i_face_cells, n_i_faces, cs_lnum_2_t);
+  BFT_MALLOC(mesh->i_face_vtx_idx, n_i_faces + 1, cs_lnum_t);
+  BFT_MALLOC(mesh->i_face_vtx_lst, mesh->i_face_vtx_connect_size, cs_lnum_t);
+  if (flags & _I_FACE_GNUM)
+    BFT_MALLOC(mesh->global_i_face_num, n_i_faces, cs_gnum_t);
+  if (flags & _I_FACE_FAMILY)
+    BFT_MALLOC(mesh->i_face_family, n_i_faces, int);
+  if (flags & _I_FACE_R_GEN)
+    BFT_MALLOC(mesh->i_face_r_gen, n_i_faces, char);
+
+  _read_section("i_faces:cells", n_i_faces*2, CS_LNUM_TYPE,
+                mesh->i_face_cells, inp);
+  _read_section("i_faces:vertices_index", n_i_faces + 1, CS_LNUM_TYPE,
+                mesh->i_face_vtx_idx, inp);
+  _read_section("i_faces:vertices", mesh->i_face_vtx_connect_size,
+                CS_LNUM_TYPE, mesh->i_face_vtx_lst, inp);
+  _read_section("i_faces:global_num",
+                _OPT_SIZE(flags, _I_FACE_GNUM, n_i_faces), gnum_type,
+                mesh->global_i_face_num, inp);
+  _read_section("i_faces:family",
+                _OPT_SIZE(flags, _I_FACE_FAMILY, n_i_faces), int_type,
+                mesh->i_face_family, inp);
+  _read_section("i_faces:refinement_generation",
+                _OPT_SIZE(flags, _I_FACE_R_GEN, n_i_faces), CS_CHAR,
+                mesh->i_face_r_gen, inp);
+
+  BFT_MALLOC(mesh->b_face_cells, n_b_faces, cs_lnum_t);
+  BFT_MALLOC(mesh->b_face_vtx_idx, n_b_faces + 1, cs_lnum_t);
+  BFT_MALLOC(mesh->b_face_vtx_lst, mesh->b_face_vtx_connect_size, cs_lnum_t);
+  if (flags & _B_FACE_GNUM)
+    BFT_MALLOC(mesh->global_b_face_num, n_b_faces, cs_gnum_t);
+  if (flags & _B_FACE_FAMILY)
+    BFT_MALLOC(mesh->b_face_family, n_b_faces, int);
+
+  _read_section("b_faces:cells", n_b_faces, CS_LNUM_TYPE,
+                mesh->b_face_cells, inp);
+  _read_section("b_faces:vertices_index", n_b_faces + 1, CS_LNUM_TYPE,
+                mesh->b_face_vtx_idx, inp);
+  _read_section("b_faces:vertices", mesh->b_face_vtx_connect_size,
+                CS_LNUM_TYPE, mesh->b_face_vtx_lst, inp);
+  _read_section("b_faces:global_num",
+                _OPT_SIZE(flags, _B_FACE_GNUM, n_b_faces), gnum_type,
+                mesh->global_b_face_num, inp);
+  _read_section("b_faces:family",
+                _OPT_SIZE(flags, _B_FACE_FAMILY, n_b_faces), int_type,
+                mesh->b_face_family, inp);
+
+  BFT_MALLOC(mesh->vtx_coord, n_vertices*3, cs_real_t);
+  if (flags & _VTX_GNUM)
+    BFT_MALLOC(mesh->global_vtx_num, n_vertices, cs_gnum_t);
+
+  _read_section("vertices:coords", n_vertices*3, CS_REAL_TYPE,
+                mesh->vtx_coord, inp);
+  _read_section("vertices:global_num",
+                _OPT_SIZE(flags, _VTX_GNUM, n_vertices), gnum_type,
+                mesh->global_vtx_num, inp);
+
+  /* Extended neighborhood */
+
+  if (flags & _CELL_CELLS) {
+    BFT_MALLOC(mesh->cell_cells_idx, n_cells + 1, cs_lnum_t);
+    BFT_MALLOC(mesh->cell_cells_lst, dims[_CELL_CELLS_SIZE], cs_lnum_t);
+  }
+  _read_section("cells:cell_cells_index",
+                _OPT_SIZE(flags, _CELL_CELLS, n_cells + 1), CS_LNUM_TYPE,
+                mesh->cell_cells_idx, inp);
+  _read_section("cells:cell_cells", dims[_CELL_CELLS_SIZE], CS_LNUM_TYPE,
+                mesh->cell_cells_lst, inp);
+
+  if (flags & _GCELL_VTX) {
+    BFT_MALLOC(mesh->gcell_vtx_idx, mesh->n_ghost_cells + 1, cs_lnum_t);
+    BFT_MALLOC(mesh->gcell_vtx_lst, dims[_GCELL_VTX_SIZE], cs_lnum_t);
+  }
+  _read_section("ghost_cells:vertices_index",
+                _OPT_SIZE(flags, _GCELL_VTX, mesh->n_ghost_cells + 1),
+                CS_LNUM_TYPE, mesh->gcell_vtx_idx, inp);
+  _read_section("ghost_cells:vertices", dims[_GCELL_VTX_SIZE],
+                CS_LNUM_TYPE, mesh->gcell_vtx_lst, inp);
+
+  /* Halo; the halo is present on all ranks or none, as it is built
+     whenever the mesh is distributed or periodic. */
+
+  if (dims[_HAVE_HALO]) {
+
+    cs_halo_t ref;
+    int n_c_domains = dims[_HALO_N_C_DOMAINS];
+
+    memset(&ref, 0, sizeof(cs_halo_t));
+    ref.n_c_domains = n_c_domains;
+    BFT_MALLOC(ref.c_domain_rank, n_c_domains, int);
+
+    _read_section("halo:c_domain_rank", n_c_domains, int_type,
+                  ref.c_domain_rank, inp);
+
+    cs_halo_t *halo = cs_halo_create_from_ref(&ref);
+
+    BFT_FREE(ref.c_domain_rank);
+
+    halo->n_local_elts = n_cells;
+    halo->n_send_elts[0] = dims[_HALO_N_SEND_ELTS_STD];
+    halo->n_send_elts[1] = dims[_HALO_N_SEND_ELTS_EXT];
+    halo->n_elts[0] = dims[_HALO_N_ELTS_STD];
+    halo->n_elts[1] = dims[_HALO_N_ELTS_EXT];
+
+    BFT_MALLOC(halo->send_list, halo->n_send_elts[1], cs_lnum_t);
+
+    _read_section("halo:send_index", 2*n_c_domains + 1, CS_LNUM_TYPE,
+                  halo->send_index, inp);
+    _read_section("halo:send_list", halo->n_send_elts[1], CS_LNUM_TYPE,
+                  halo->send_list, inp);
+    _read_section("halo:index", 2*n_c_domains + 1, CS_LNUM_TYPE,
+                  halo->index, inp);
+
+    cs_halo_update_buffers(halo);
+
+    mesh->halo = halo;
+  }
+
+  /* Numbering */
+
+  cs_numbering_t **numbering[4] = {&(mesh->cell_numbering),
+                                   &(mesh->i_face_numbering),
+                                   &(mesh->b_face_numbering),
+                                   &(mesh->vtx_numbering)};
+
+  for (int i = 0; i < 4; i++) {
+    cs_numbering_destroy(numbering[i]);
+    *(numbering[i]) = _read_numbering(dims + _NUMBERING + i*_N_NUMBERING_DIMS,
+                                      _numbering_names[i],
+                                      inp);
+  }
+
+  cs_io_finalize(&inp);
+
+  /* Vertex interfaces are rebuilt rather than saved, as they
+     only depend on the global vertex numbering. */
+
+  if (mesh->n_domains > 1)
+    mesh->vtx_interfaces = cs_interface_set_create(n_vertices,
+                                                   NULL,
+                                                   mesh->global_vtx_num,
+                                                   NULL,
+                                                   0,
+                                                   NULL,
+                                                   NULL,
+                                                   NULL);
+
+  cs_mesh_update_auxiliary(mesh);
+
+  /* Make cache (and the partitioning it is based on) available
+     for a subsequent restart */
+
+  _checkpoint_cache((_write_cache) ? path : NULL, part_path);
+
+  BFT_FREE(path);
+
+  bft_printf(_("\n Mesh restored from cache (%.3g s)\n"),
+             cs_timer_wtime() - t0);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,154 @@
+#ifndef __CS_MESH_CACHE_H__
+#define __CS_MESH_CACHE_H__
+
+/*============================================================================
+ * Save and restore a fully preprocessed, partitioned and renumbered mesh
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_base.h"
+#include "cs_halo.h"
+#include "cs_mesh.h"
+#include "cs_mesh_builder.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Set mesh cache mode.
+ *
+ * When writing is enabled, the local mesh of each rank is saved to
+ * "checkpoint/mesh_cache.csc" once it has been partitioned, joined,
+ * and renumbered, with its halo and numbering metadata. When reading is
+ * enabled and "mesh_cache.csc" is present in the execution directory
+ * (or in the "restart" directory) and was written with the same number
+ * of ranks for the same mesh input and preprocessing options, that file
+ * is used instead of reading, preprocessing, partitioning and renumbering
+ * the mesh; if writing is also enabled, the cache used is then linked
+ * (or copied) to "checkpoint/mesh_cache.csc". A cache is ignored when
+ * "restart/domain_number_<n_ranks>" is at least as recent, so that a
+ * partitioning balanced by cs_partition_check_restart_balance() is applied.
+ *
+ * The mesh input files (size and modification time), mesh dimensions,
+ * mesh joining, face warping and partitioning options are checked, but
+ * mesh modifications defined in user functions or through the GUI
+ * are not, so the cache should be removed when these are changed.
+ *
+ * Both modes are disabled by default. This function should be called
+ * before the mesh is read, i.e. in cs_user_partition().
+ *
+ * parameters:
+ *   read  <-- true to restore the mesh from the cache if possible
+ *   write <-- true to save the mesh to the cache
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_cache_set_mode(bool  read,
+                       bool  write);
+
+/*----------------------------------------------------------------------------
+ * Query mesh cache mode.
+ *
+ * parameters:
+ *   read  --> true if the mesh is restored from the cache if possible,
+ *             or NULL
+ *   write --> true if the mesh is saved to the cache, or NULL
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_cache_get_mode(bool  *read,
+                       bool  *write);
+
+/*----------------------------------------------------------------------------
+ * Save a preprocessed, partitioned and renumbered mesh to the mesh cache.
+ *
+ * Nothing is done if writing is not enabled or if the mesh uses
+ * periodicity or internal coupling, which are not handled by the cache.
+ * The signature of the mesh input and preprocessing options is also
+ * required, so cs_mesh_cache_read must have been called first.
+ *
+ * This function is collective.
+ *
+ * parameters:
+ *   mesh <-- pointer to mesh structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_cache_write(const cs_mesh_t  *mesh);
+
+/*----------------------------------------------------------------------------
+ * Restore a preprocessed, partitioned and renumbered mesh from the
+ * mesh cache.
+ *
+ * The mesh is expected to contain only the metadata read from the mesh
+ * input headers, which are used (with input file information and
+ * preprocessing options) to define the signature saved with the cache.
+ * If reading is not enabled, no usable cache is found, or the cache does
+ * not match the current mesh input, preprocessing options, number of
+ * ranks, threads or halo type, the mesh is unchanged and false is
+ * returned, so the mesh should be built in the usual manner.
+ *
+ * On success, halo, numbering and interface structures are also rebuilt,
+ * and auxiliary mesh values are updated.
+ *
+ * This function is collective.
+ *
+ * parameters:
+ *   mesh      <-> pointer to mesh structure
+ *   mb        <-- pointer to mesh builder structure (with header data)
+ *   halo_type <-- required halo type
+ *
+ * returns:
+ *   true if the mesh was restored from the cache, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_cache_read(cs_mesh_t                *mesh,
+                   const cs_mesh_builder_t  *mb,
+                   cs_halo_type_t            halo_type);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MESH_CACHE_H__ */
@@ -0,0 +1,795 @@
+/*============================================================================
+ * Direct parallel reading of CGNS mesh files
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * CGNS library headers
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_CGNS)
+#include <cgnslib.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_block_dist.h"
+#include "cs_file.h"
+#include "cs_mesh_gmsh.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_mesh_cgns.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+#if defined(HAVE_CGNS)
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+#define CS_CGNS_NAME_SIZE      32      /* Maximum CGNS name length */
+
+/* Compatibility with different CGNS library versions */
+
+#if !defined(CGNS_ENUMV)
+#define CGNS_ENUMV(e) e
+#endif
+
+#if !defined(CGNS_ENUMT)
+#define CGNS_ENUMT(e) e
+#endif
+
+#if CGNS_VERSION < 3100
+#define cgsize_t int
+#endif
+
+/*=============================================================================
+ * Local Type Definitions
+ *============================================================================*/
+
+/* Element section */
+
+typedef struct {
+
+  int                         zone;       /* CGNS zone index */
+  int                         section;    /* CGNS section index */
+  CGNS_ENUMT(ElementType_t)   type;       /* CGNS element type */
+  cgsize_t                    start;      /* First element number in zone */
+  cs_gnum_t                   n_elts;     /* Number of elements */
+  cs_gnum_t                   vtx_shift;  /* Vertex numbering shift of zone */
+  int                         family;     /* Associated family (1 to n) */
+
+} _cgns_section_t;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Raise an error for a failed CGNS library call.
+ *
+ * parameters:
+ *   path <-- mesh file path
+ *----------------------------------------------------------------------------*/
+
+static void
+_cgns_error(const char  *path)
+{
+  bft_error(__FILE__, __LINE__, 0,
+            _("CGNS error reading file \"%s\":\n%s"),
+            path, cg_get_error());
+}
+
+/*----------------------------------------------------------------------------
+ * Return the dimension of elements of a given CGNS type.
+ *
+ * parameters:
+ *   type <-- CGNS element type
+ *
+ * returns:
+ *   2 or 3 for handled surface and volume elements, 0 for ignored
+ *   elements, -1 for unhandled elements
+ *----------------------------------------------------------------------------*/
+
+static int
+_elt_dim(CGNS_ENUMT(ElementType_t)  type)
+{
+  int dim = -1;
+
+  switch(type) {
+  case CGNS_ENUMV(NODE):
+  case CGNS_ENUMV(BAR_2):
+    dim = 0;
+    break;
+  case CGNS_ENUMV(TRI_3):
+  case CGNS_ENUMV(QUAD_4):
+    dim = 2;
+    break;
+  case CGNS_ENUMV(TETRA_4):
+  case CGNS_ENUMV(PYRA_5):
+  case CGNS_ENUMV(PENTA_6):
+  case CGNS_ENUMV(HEXA_8):
+    dim = 3;
+    break;
+  default:
+    dim = -1;
+  }
+
+  return dim;
+}
+
+/*----------------------------------------------------------------------------
+ * Read zone and element section metadata, and define groups and group
+ * classes from element section names.
+ *
+ * A group is defined for each distinct element section name, and a group
+ * class for each group; the first group class has no groups.
+ *
+ * parameters:
+ *   path               <-- mesh file path
+ *   fn                 <-- CGNS file index
+ *   base               <-- CGNS base index
+ *   n_g_vertices       --> global number of vertices
+ *   n_zones            --> number of zones
+ *   zone_n_vtx         --> number of vertices of each zone
+ *   n_sections         --> number of handled element sections
+ *   sections           --> handled element sections
+ *   n_groups           --> number of groups
+ *   group_name         --> group names
+ *   n_families         --> number of group classes
+ *   n_max_family_items --> maximum number of groups per group class
+ *   family_item        --> group ids of each group class
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_metadata(const char        *path,
+               int                fn,
+               int                base,
+               cs_gnum_t         *n_g_vertices,
+               int               *n_zones,
+               cs_gnum_t        **zone_n_vtx,
+               int               *n_sections,
+               _cgns_section_t  **sections,
+               int               *n_groups,
+               char            ***group_name,
+               int               *n_families,
+               int               *n_max_family_items,
+               int              **family_item)
+{
+  char name[CS_CGNS_NAME_SIZE + 1];
+  int _n_zones = 0, _n_sections = 0, _n_groups = 0;
+
+  if (cg_nzones(fn, base, &_n_zones) != CG_OK)
+    _cgns_error(path);
+
+  cs_gnum_t _n_g_vertices = 0;
+  cs_gnum_t *_zone_n_vtx = NULL;
+  _cgns_section_t *_sections = NULL;
+  char **_group_name = NULL;
+
+  BFT_MALLOC(_zone_n_vtx, _n_zones, cs_gnum_t);
+
+  for (int z_id = 0; z_id < _n_zones; z_id++) {
+
+    const int zone = z_id + 1;
+    CGNS_ENUMT(ZoneType_t) z_type;
+    cgsize_t z_size[3];
+    int z_n_sections = 0;
+
+    if (cg_zone_type(fn, base, zone, &z_type) != CG_OK)
+      _cgns_error(path);
+
+    if (z_type != CGNS_ENUMV(Unstructured))
+      bft_error(__FILE__, __LINE__, 0,
+                _("CGNS file \"%s\" contains a structured zone;\n"
+                  "only unstructured zones are handled."),
+                path);
+
+    if (   cg_zone_read(fn, base, zone, name, z_size) != CG_OK
+        || cg_nsections(fn, base, zone, &z_n_sections) != CG_OK)
+      _cgns_error(path);
+
+    _zone_n_vtx[z_id] = z_size[0];
+
+    BFT_REALLOC(_sections, _n_sections + z_n_sections, _cgns_section_t);
+
+    for (int s_id = 0; s_id < z_n_sections; s_id++) {
+
+      _cgns_section_t *s = _sections + _n_sections;
+      cgsize_t start, end;
+      int n_bndry, parent_flag;
+
+      if (cg_section_read(fn, base, zone, s_id + 1, name, &(s->type),
+                          &start, &end, &n_bndry, &parent_flag) != CG_OK)
+        _cgns_error(path);
+
+      if (s->type != CGNS_ENUMV(MIXED)) {
+        int dim = _elt_dim(s->type);
+        if (dim < 0)
+          bft_error(__FILE__, __LINE__, 0,
+                    _("CGNS file \"%s\": section \"%s\" contains elements\n"
+                      "of unhandled type %d; only linear surface and volume\n"
+                      "elements are handled."),
+                    path, name, (int)(s->type));
+        else if (dim == 0)
+          continue;
+      }
+
+      s->zone = zone;
+      s->section = s_id + 1;
+      s->start = start;
+      s->n_elts = end - start + 1;
+      s->vtx_shift = _n_g_vertices;
+
+      /* Section names define groups */
+
+      int g_id = 0;
+      while (g_id < _n_groups && strcmp(_group_name[g_id], name) != 0)
+        g_id++;
+
+      if (g_id == _n_groups) {
+        BFT_REALLOC(_group_name, _n_groups + 1, char *);
+        BFT_MALLOC(_group_name[_n_groups], strlen(name) + 1, char);
+        strcpy(_group_name[_n_groups], name);
+        _n_groups++;
+      }
+
+      s->family = g_id + 2;
+
+      _n_sections++;
+
+    }
+
+    _n_g_vertices += _zone_n_vtx[z_id];
+
+  }
+
+  /* Group classes (class 1 has no group, class i + 1 has group i) */
+
+  int *_family_item = NULL;
+  BFT_MALLOC(_family_item, _n_groups + 1, int);
+
+  for (int i = 0; i < _n_groups + 1; i++)
+    _family_item[i] = i;
+
+  *n_g_vertices = _n_g_vertices;
+  *n_zones = _n_zones;
+  *zone_n_vtx = _zone_n_vtx;
+  *n_sections = _n_sections;
+  *sections = _sections;
+  *n_groups = _n_groups;
+  *group_name = _group_name;
+  *n_families = _n_groups + 1;
+  *n_max_family_items = (_n_groups > 0) ? 1 : 0;
+  *family_item = _family_item;
+}
+
+/*----------------------------------------------------------------------------
+ * Read a block of vertices from all zones.
+ *
+ * Vertices of successive zones are numbered contiguously, and each rank
+ * reads a block of that numbering.
+ *
+ * parameters:
+ *   path          <-- mesh file path
+ *   fn            <-- CGNS file index
+ *   base          <-- CGNS base index
+ *   n_zones       <-- number of zones
+ *   zone_n_vtx    <-- number of vertices of each zone
+ *   n_g_vertices  <-- global number of vertices
+ *   n_vertices    --> number of local vertices
+ *   vertex_gnum   --> global numbers of local vertices
+ *   vertex_coords --> coordinates of local vertices
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_vertices(const char        *path,
+               int                fn,
+               int                base,
+               int                n_zones,
+               const cs_gnum_t    zone_n_vtx[],
+               cs_gnum_t          n_g_vertices,
+               cs_lnum_t         *n_vertices,
+               cs_gnum_t        **vertex_gnum,
+               cs_real_t        **vertex_coords)
+{
+  const char *coord_name[3] = {"CoordinateX", "CoordinateY", "CoordinateZ"};
+
+  cs_block_dist_info_t bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                                        cs_glob_n_ranks,
+                                                        1,
+                                                        0,
+                                                        n_g_vertices);
+
+  const cs_gnum_t s_id = bi.gnum_range[0] - 1;
+  const cs_gnum_t e_id = bi.gnum_range[1] - 1;
+  const cs_lnum_t _n_vertices = e_id - s_id;
+
+  cs_gnum_t *_vertex_gnum;
+  cs_real_t *_vertex_coords;
+  double *buf;
+
+  BFT_MALLOC(_vertex_gnum, _n_vertices, cs_gnum_t);
+  BFT_MALLOC(_vertex_coords, _n_vertices*3, cs_real_t);
+  BFT_MALLOC(buf, _n_vertices, double);
+
+  cs_gnum_t pos = 0;
+
+  for (int z_id = 0; z_id < n_zones; z_id++) {
+
+    cs_gnum_t i0 = (s_id > pos) ? s_id - pos : 0;
+    cs_gnum_t i1 = (e_id > pos) ? e_id - pos : 0;
+    if (i0 > zone_n_vtx[z_id])
+      i0 = zone_n_vtx[z_id];
+    if (i1 > zone_n_vtx[z_id])
+      i1 = zone_n_vtx[z_id];
+
+    if (i1 > i0) {
+
+      const cs_lnum_t shift = pos + i0 - s_id;
+      const cs_lnum_t n_read = i1 - i0;
+      cgsize_t r_min = i0 + 1, r_max = i1;
+
+      for (int j = 0; j < 3; j++) {
+        if (cg_coord_read(fn, base, z_id + 1, coord_name[j],
+                          CGNS_ENUMV(RealDouble), &r_min, &r_max,
+                          buf) != CG_OK)
+          _cgns_error(path);
+        for (cs_lnum_t i = 0; i < n_read; i++)
+          _vertex_coords[(shift + i)*3 + j] = buf[i];
+      }
+
+      for (cs_lnum_t i = 0; i < n_read; i++)
+        _vertex_gnum[shift + i] = pos + i0 + i + 1;
+
+    }
+
+    pos += zone_n_vtx[z_id];
+
+  }
+
+  BFT_FREE(buf);
+
+  *n_vertices = _n_vertices;
+  *vertex_gnum = _vertex_gnum;
+  *vertex_coords = _vertex_coords;
+}
+
+/*----------------------------------------------------------------------------
+ * Append an element to local cells or boundary elements.
+ *
+ * parameters:
+ *   type      <-- CGNS element type
+ *   vtx       <-- element vertices (zone numbering)
+ *   vtx_shift <-- vertex numbering shift of zone
+ *   family    <-- element family
+ *   n_cells   <-> number of local cells
+ *   c_n_vtx   <-> number of vertices of local cells
+ *   c_vtx     <-> vertices of local cells (stride 8)
+ *   c_family  <-> family of local cells
+ *   n_b_elts  <-> number of local boundary elements
+ *   b_n_vtx   <-> number of vertices of local boundary elements
+ *   b_vtx     <-> vertices of local boundary elements (stride 8)
+ *   b_family  <-> family of local boundary elements
+ *----------------------------------------------------------------------------*/
+
+static void
+_append_element(CGNS_ENUMT(ElementType_t)   type,
+                const cgsize_t              vtx[],
+                cs_gnum_t                   vtx_shift,
+                int                         family,
+                cs_lnum_t                  *n_cells,
+                short int                   c_n_vtx[],
+                cs_gnum_t                   c_vtx[],
+                int                         c_family[],
+                cs_lnum_t                  *n_b_elts,
+                short int                   b_n_vtx[],
+                cs_gnum_t                   b_vtx[],
+                int                         b_family[])
+{
+  const int dim = _elt_dim(type);
+  int n_vtx = 0;
+
+  if (dim < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("CGNS mixed element section contains elements\n"
+                "of unhandled type %d; only linear surface and volume\n"
+                "elements are handled."),
+              (int)type);
+  else if (dim == 0)
+    return;
+
+  cg_npe(type, &n_vtx);
+
+  if (dim == 3) {
+    cs_lnum_t i = *n_cells;
+    c_n_vtx[i] = n_vtx;
+    for (int j = 0; j < n_vtx; j++)
+      c_vtx[i*8 + j] = vtx[j] + vtx_shift;
+    c_family[i] = family;
+    *n_cells += 1;
+  }
+  else {
+    cs_lnum_t i = *n_b_elts;
+    b_n_vtx[i] = n_vtx;
+    for (int j = 0; j < n_vtx; j++)
+      b_vtx[i*8 + j] = vtx[j] + vtx_shift;
+    b_family[i] = family;
+    *n_b_elts += 1;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Read a block of elements from all handled element sections.
+ *
+ * Elements of successive sections are numbered contiguously, and each rank
+ * reads a block of that numbering; volume and surface elements are then
+ * separated, keeping their file order.
+ *
+ * parameters:
+ *   path       <-- mesh file path
+ *   fn         <-- CGNS file index
+ *   base       <-- CGNS base index
+ *   n_sections <-- number of handled element sections
+ *   sections   <-- handled element sections
+ *   n_cells    --> number of local cells
+ *   c_n_vtx    --> number of vertices of local cells
+ *   c_vtx      --> vertices of local cells (stride 8)
+ *   c_family   --> family of local cells
+ *   n_b_elts   --> number of local boundary elements
+ *   b_n_vtx    --> number of vertices of local boundary elements
+ *   b_vtx      --> vertices of local boundary elements (stride 8)
+ *   b_family   --> family of local boundary elements
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_elements(const char              *path,
+               int                      fn,
+               int                      base,
+               int                      n_sections,
+               const _cgns_section_t    sections[],
+               cs_lnum_t               *n_cells,
+               short int              **c_n_vtx,
+               cs_gnum_t              **c_vtx,
+               int                    **c_family,
+               cs_lnum_t               *n_b_elts,
+               short int              **b_n_vtx,
+               cs_gnum_t              **b_vtx,
+               int                    **b_family)
+{
+  cs_gnum_t n_g_elts = 0;
+
+  for (int i = 0; i < n_sections; i++)
+    n_g_elts += sections[i].n_elts;
+
+  cs_block_dist_info_t bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                                        cs_glob_n_ranks,
+                                                        1,
+                                                        0,
+                                                        n_g_elts);
+
+  const cs_gnum_t s_id = bi.gnum_range[0] - 1;
+  const cs_gnum_t e_id = bi.gnum_range[1] - 1;
+  const cs_lnum_t n_elts = e_id - s_id;
+
+  cs_lnum_t _n_cells = 0, _n_b_elts = 0;
+  short int *_c_n_vtx, *_b_n_vtx;
+  cs_gnum_t *_c_vtx, *_b_vtx;
+  int *_c_family, *_b_family;
+
+  BFT_MALLOC(_c_n_vtx, n_elts, short int);
+  BFT_MALLOC(_c_vtx, n_elts*8, cs_gnum_t);
+  BFT_MALLOC(_c_family, n_elts, int);
+  BFT_MALLOC(_b_n_vtx, n_elts, short int);
+  BFT_MALLOC(_b_vtx, n_elts*8, cs_gnum_t);
+  BFT_MALLOC(_b_family, n_elts, int);
+
+  cgsize_t *buf = NULL, *offsets = NULL;
+  cs_gnum_t pos = 0;
+
+  for (int i = 0; i < n_sections; i++) {
+
+    const _cgns_section_t *s = sections + i;
+
+    cs_gnum_t i0 = (s_id > pos) ? s_id - pos : 0;
+    cs_gnum_t i1 = (e_id > pos) ? e_id - pos : 0;
+    if (i0 > s->n_elts)
+      i0 = s->n_elts;
+    if (i1 > s->n_elts)
+      i1 = s->n_elts;
+
+    pos += s->n_elts;
+
+    if (i1 <= i0)
+      continue;
+
+    const cs_lnum_t n_read = i1 - i0;
+    const cgsize_t r_start = s->start + i0;
+    const cgsize_t r_end = s->start + i1 - 1;
+
+    if (s->type == CGNS_ENUMV(MIXED)) {
+
+      /* Each element's connectivity is preceded by its type */
+
+      cgsize_t buf_size = 0;
+
+      if (cg_ElementPartialSize(fn, base, s->zone, s->section,
+                                r_start, r_end, &buf_size) != CG_OK)
+        _cgns_error(path);
+
+      BFT_REALLOC(buf, buf_size, cgsize_t);
+      BFT_REALLOC(offsets, n_read + 1, cgsize_t);
+
+#if CGNS_VERSION >= 3400
+      if (cg_poly_elements_partial_read(fn, base, s->zone, s->section,
+                                        r_start, r_end, buf, offsets,
+                                        NULL) != CG_OK)
+        _cgns_error(path);
+#else
+      if (cg_elements_partial_read(fn, base, s->zone, s->section,
+                                   r_start, r_end, buf, NULL) != CG_OK)
+        _cgns_error(path);
+      offsets[0] = 0;
+      for (cs_lnum_t j = 0; j < n_read; j++) {
+        int n_vtx = 0;
+        cg_npe((CGNS_ENUMT(ElementType_t))buf[offsets[j]], &n_vtx);
+        offsets[j+1] = offsets[j] + 1 + n_vtx;
+      }
+#endif
+
+      for (cs_lnum_t j = 0; j < n_read; j++)
+        _append_element((CGNS_ENUMT(ElementType_t))buf[offsets[j]],
+                        buf + offsets[j] + 1,
+                        s->vtx_shift,
+                        s->family,
+                        &_n_cells, _c_n_vtx, _c_vtx, _c_family,
+                        &_n_b_elts, _b_n_vtx, _b_vtx, _b_family);
+
+    }
+    else {
+
+      int n_vtx = 0;
+      cg_npe(s->type, &n_vtx);
+
+      BFT_REALLOC(buf, n_read*n_vtx, cgsize_t);
+
+      if (cg_elements_partial_read(fn, base, s->zone, s->section,
+                                   r_start, r_end, buf, NULL) != CG_OK)
+        _cgns_error(path);
+
+      for (cs_lnum_t j = 0; j < n_read; j++)
+        _append_element(s->type,
+                        buf + j*n_vtx,
+                        s->vtx_shift,
+                        s->family,
+                        &_n_cells, _c_n_vtx, _c_vtx, _c_family,
+                        &_n_b_elts, _b_n_vtx, _b_vtx, _b_family);
+
+    }
+
+  }
+
+  BFT_FREE(offsets);
+  BFT_FREE(buf);
+
+  BFT_REALLOC(_c_n_vtx, _n_cells, short int);
+  BFT_REALLOC(_c_vtx, _n_cells*8, cs_gnum_t);
+  BFT_REALLOC(_c_family, _n_cells, int);
+  BFT_REALLOC(_b_n_vtx, _n_b_elts, short int);
+  BFT_REALLOC(_b_vtx, _n_b_elts*8, cs_gnum_t);
+  BFT_REALLOC(_b_family, _n_b_elts, int);
+
+  *n_cells = _n_cells;
+  *c_n_vtx = _c_n_vtx;
+  *c_vtx = _c_vtx;
+  *c_family = _c_family;
+  *n_b_elts = _n_b_elts;
+  *b_n_vtx = _b_n_vtx;
+  *b_vtx = _b_vtx;
+  *b_family = _b_family;
+}
+
+#endif /* defined(HAVE_CGNS) */
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Check if a mesh file should be read as a CGNS file.
+ *
+ * parameters:
+ *   path <-- mesh file path
+ *
+ * returns:
+ *   true if the file has a ".cgns" extension, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_cgns_is_cgns_file(const char  *path)
+{
+  return (cs_file_endswith(path, ".cgns")) ? true : false;
+}
+
+/*----------------------------------------------------------------------------
+ * Read an unstructured CGNS mesh file and build its faces.
+ *
+ * Only the first base of the file is read; all its zones must be
+ * unstructured, and are appended to one another (zone connectivity is not
+ * used, so zones may be joined afterwards if needed). Each rank reads
+ * a block of the zone vertices and a block of the linear volume and surface
+ * element sections, using partial reads of the CGNS library. Each element
+ * section defines a group with the section's name.
+ *
+ * The mesh data is returned in the element-based reader structure shared
+ * with the Gmsh reader, so faces are built and transferred to the mesh
+ * builder in the same manner.
+ *
+ * This function is collective.
+ *
+ * parameters:
+ *   path <-- mesh file path
+ *
+ * returns:
+ *   pointer to mesh reader structure
+ *----------------------------------------------------------------------------*/
+
+cs_mesh_gmsh_t *
+cs_mesh_cgns_read(const char  *path)
+{
+#if defined(HAVE_CGNS)
+
+  int fn = -1, n_bases = 0, cell_dim = 0, phys_dim = 0;
+  char base_name[CS_CGNS_NAME_SIZE + 1];
+  const int base = 1;
+
+  if (cg_open(path, CG_MODE_READ, &fn) != CG_OK)
+    _cgns_error(path);
+
+  if (cg_nbases(fn, &n_bases) != CG_OK)
+    _cgns_error(path);
+
+  if (n_bases < 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("CGNS file \"%s\" does not contain any base."), path);
+
+  if (cg_base_read(fn, base, base_name, &cell_dim, &phys_dim) != CG_OK)
+    _cgns_error(path);
+
+  if (n_bases > 1)
+    bft_printf(_("   CGNS file contains %d bases; only base \"%s\""
+                 " is read.\n"), n_bases, base_name);
+
+  if (cell_dim != 3)
+    bft_error(__FILE__, __LINE__, 0,
+              _("CGNS file \"%s\": base \"%s\" has cell dimension %d;\n"
+                "only volume meshes are handled."),
+              path, base_name, cell_dim);
+
+  /* Metadata, groups and group classes */
+
+  cs_gnum_t n_g_vertices = 0;
+  cs_gnum_t *zone_n_vtx = NULL;
+  int n_zones = 0, n_sections = 0;
+  _cgns_section_t *sections = NULL;
+
+  int n_groups = 0, n_families = 0, n_max_family_items = 0;
+  char **group_name = NULL;
+  int *family_item = NULL;
+
+  _read_metadata(path, fn, base,
+                 &n_g_vertices, &n_zones, &zone_n_vtx,
+                 &n_sections, &sections,
+                 &n_groups, &group_name,
+                 &n_families, &n_max_family_items, &family_item);
+
+  /* Vertices */
+
+  cs_lnum_t n_vertices = 0;
+  cs_gnum_t *vertex_gnum = NULL;
+  cs_real_t *vertex_coords = NULL;
+
+  _read_vertices(path, fn, base, n_zones, zone_n_vtx, n_g_vertices,
+                 &n_vertices, &vertex_gnum, &vertex_coords);
+
+  /* Cells and boundary elements */
+
+  cs_lnum_t n_cells = 0, n_b_elts = 0;
+  short int *cell_n_vtx = NULL, *b_n_vtx = NULL;
+  cs_gnum_t *cell_vtx = NULL, *b_vtx = NULL;
+  int *cell_family = NULL, *b_family = NULL;
+
+  _read_elements(path, fn, base, n_sections, sections,
+                 &n_cells, &cell_n_vtx, &cell_vtx, &cell_family,
+                 &n_b_elts, &b_n_vtx, &b_vtx, &b_family);
+
+  if (cg_close(fn) != CG_OK)
+    _cgns_error(path);
+
+  BFT_FREE(sections);
+  BFT_FREE(zone_n_vtx);
+
+  /* Faces */
+
+  return cs_mesh_gmsh_create_from_elements(n_g_vertices,
+                                           n_vertices,
+                                           vertex_gnum,
+                                           vertex_coords,
+                                           n_cells,
+                                           cell_n_vtx,
+                                           cell_vtx,
+                                           cell_family,
+                                           n_b_elts,
+                                           b_n_vtx,
+                                           b_vtx,
+                                           b_family,
+                                           n_groups,
+                                           group_name,
+                                           n_families,
+                                           n_max_family_items,
+                                           family_item);
+
+#else
+
+  bft_error(__FILE__, __LINE__, 0,
+            _("Mesh file \"%s\" cannot be read:\n"
+              "Code_Saturne was built without CGNS support."),
+            path);
+
+  return NULL;
+
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
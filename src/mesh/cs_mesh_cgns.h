@@ -0,0 +1,98 @@
+#ifndef __CS_MESH_CGNS_H__
+#define __CS_MESH_CGNS_H__
+
+/*============================================================================
+ * Direct parallel reading of CGNS mesh files
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_base.h"
+#include "cs_mesh_gmsh.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Check if a mesh file should be read as a CGNS file.
+ *
+ * parameters:
+ *   path <-- mesh file path
+ *
+ * returns:
+ *   true if the file has a ".cgns" extension, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_cgns_is_cgns_file(const char  *path);
+
+/*----------------------------------------------------------------------------
+ * Read an unstructured CGNS mesh file and build its faces.
+ *
+ * Only the first base of the file is read; all its zones must be
+ * unstructured, and are appended to one another (zone connectivity is not
+ * used, so zones may be joined afterwards if needed). Each rank reads
+ * a block of the zone vertices and a block of the linear volume and surface
+ * element sections, using partial reads of the CGNS library. Each element
+ * section defines a group with the section's name.
+ *
+ * The mesh data is returned in the element-based reader structure shared
+ * with the Gmsh reader, so faces are built and transferred to the mesh
+ * builder in the same manner.
+ *
+ * This function is collective.
+ *
+ * parameters:
+ *   path <-- mesh file path
+ *
+ * returns:
+ *   pointer to mesh reader structure
+ *----------------------------------------------------------------------------*/
+
+cs_mesh_gmsh_t *
+cs_mesh_cgns_read(const char  *path);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MESH_CGNS_H__ */
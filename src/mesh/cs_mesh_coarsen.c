@@ -710,6 +710,32 @@ _build_merged_face(cs_lnum_t                    n_faces,
 void
 cs_mesh_coarsen_simple(cs_mesh_t  *m,
                        const int   cell_flag[])
+{
+  cs_mesh_coarsen_simple_renum(m, cell_flag, NULL);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Coarsen flagged mesh cells, and return the associated cell
+ *        renumbering.
+ *
+ * Cells which are not merged keep their relative order, so arrays defined
+ * on the cells of the initial mesh may be transferred to the coarsened mesh.
+ *
+ * The caller is responsible for freeing the returned renumbering array.
+ *
+ * \param[in, out]  m           mesh
+ * \param[in]       cell_flag   subdivision type for each cell
+ *                              (0: none; 1: isotropic)
+ * \param[out]      c_o2n       old to new cell ids (size: initial number
+ *                              of cells), or NULL if not needed
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_coarsen_simple_renum(cs_mesh_t   *m,
+                             const int    cell_flag[],
+                             cs_lnum_t  **c_o2n)
 {
   /* Timers:
      0: total
@@ -756,12 +782,15 @@ cs_mesh_coarsen_simple(cs_mesh_t  *m,
 
   /* Determine cells that should be merged */
 
-  cs_lnum_t  *c_o2n = NULL;
-  cs_lnum_t  n_c_new = _cell_equiv(m, cell_flag, &c_o2n);
+  cs_lnum_t  *_c_o2n = NULL;
+  cs_lnum_t  n_c_new = _cell_equiv(m, cell_flag, &_c_o2n);
 
-  _merge_cells(m, n_c_new, c_o2n);
+  _merge_cells(m, n_c_new, _c_o2n);
 
-  BFT_FREE(c_o2n);
+  if (c_o2n != NULL)
+    *c_o2n = _c_o2n;
+  else
+    BFT_FREE(_c_o2n);
 
   m->modified = CS_MAX(m->modified, 1);
 
@@ -64,6 +64,29 @@ void
 cs_mesh_coarsen_simple(cs_mesh_t  *m,
                        const int   cell_flag[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Coarsen flagged mesh cells, and return the associated cell
+ *        renumbering.
+ *
+ * Cells which are not merged keep their relative order, so arrays defined
+ * on the cells of the initial mesh may be transferred to the coarsened mesh.
+ *
+ * The caller is responsible for freeing the returned renumbering array.
+ *
+ * \param[in, out]  m           mesh
+ * \param[in]       cell_flag   subdivision type for each cell
+ *                              (0: none; 1: isotropic)
+ * \param[out]      c_o2n       old to new cell ids (size: initial number
+ *                              of cells), or NULL if not needed
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_coarsen_simple_renum(cs_mesh_t   *m,
+                             const int    cell_flag[],
+                             cs_lnum_t  **c_o2n);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Coarsen selected mesh cells.
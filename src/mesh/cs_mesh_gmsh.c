@@ -0,0 +1,1992 @@
+/*============================================================================
+ * Direct parallel reading of Gmsh mesh files
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <ctype.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_all_to_all.h"
+#include "cs_block_dist.h"
+#include "cs_file.h"
+#include "cs_mesh_builder.h"
+#include "cs_order.h"
+#include "cs_parall.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_mesh_gmsh.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/* Strides of face building and face definition records */
+
+#define _FACE_REC_SIZE  7   /* n_vtx, vtx[4], cell, family */
+#define _FACE_DEF_SIZE  9   /* gnum, cells[2], family, n_vtx, vtx[4] */
+
+/* Maximum size of ASCII files read in parallel (as every rank parses
+   the whole file, larger files should be converted to binary) */
+
+#define _ASCII_PARALLEL_SIZE_MAX  (64 << 20)
+
+/*=============================================================================
+ * Local Type Definitions
+ *============================================================================*/
+
+/* Gmsh file access */
+
+typedef struct {
+
+  FILE        *f;             /* Associated stdio file */
+  const char  *name;          /* File name */
+  bool         binary;        /* Binary or ASCII file */
+  bool         swap_endian;   /* Swap bytes of binary data */
+
+  size_t       line_size;     /* Size of line buffer */
+  char        *line;          /* Line buffer */
+
+} _gmsh_file_t;
+
+/* Elementary entity of dimension 2 or 3 */
+
+typedef struct {
+
+  int   dim;                  /* Entity dimension */
+  int   tag;                  /* Entity tag */
+  int   n_phys;               /* Number of associated physical tags */
+  int   phys_start;           /* Start of physical tags in shared array */
+  int   family;               /* Associated family (1 to n) */
+
+} _gmsh_entity_t;
+
+/* Physical group name */
+
+typedef struct {
+
+  int    dim;                 /* Physical group dimension */
+  int    tag;                 /* Physical group tag */
+  char  *name;                /* Physical group name */
+
+} _gmsh_phys_name_t;
+
+/* Element block */
+
+typedef struct {
+
+  int            dim;         /* Entity dimension */
+  int            tag;         /* Entity tag */
+  int            type;        /* Gmsh element type */
+  int            n_vtx;       /* Number of vertices per element */
+  cs_gnum_t      n_elts;      /* Number of elements */
+  cs_file_off_t  offset;      /* Offset of element data in file */
+
+} _gmsh_elt_block_t;
+
+/* Gmsh mesh reader structure */
+
+struct _cs_mesh_gmsh_t {
+
+  /* Global dimensions */
+
+  cs_gnum_t     n_g_cells;
+  cs_gnum_t     n_g_faces;
+  cs_gnum_t     n_g_vertices;
+  cs_gnum_t     n_g_face_connect_size;
+
+  /* Groups and group classes */
+
+  int           n_groups;
+  char        **group_name;
+
+  int           n_families;
+  int           n_max_family_items;
+  int          *family_item;
+
+  /* Locally read or built data (natural distribution) */
+
+  cs_lnum_t     n_cells;
+  cs_gnum_t    *cells;           /* cell global number and family */
+
+  cs_lnum_t     n_faces;
+  cs_gnum_t    *faces;           /* face definitions (_FACE_DEF_SIZE) */
+
+  cs_lnum_t     n_vertices;
+  cs_gnum_t    *vertex_gnum;
+  cs_real_t    *vertex_coords;
+
+};
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Number of vertices of Gmsh element types, up to type 19 */
+
+static const int  _gmsh_type_n_vtx[20] = {0, 2, 3, 4, 4, 8, 6, 5, 3, 6,
+                                          9, 10, 27, 18, 14, 1, 8, 20, 15, 13};
+
+/* Outward-oriented faces of tetrahedra, pyramids, prisms and hexahedra,
+   using Gmsh vertex numbering (number of vertices, then vertices) */
+
+static const int  _cell_n_faces[4] = {4, 5, 5, 6};
+
+static const int  _cell_faces[4][6][5] = {{{3, 0, 2, 1, 0},
+                                           {3, 0, 1, 3, 0},
+                                           {3, 1, 2, 3, 0},
+                                           {3, 2, 0, 3, 0},
+                                           {0, 0, 0, 0, 0},
+                                           {0, 0, 0, 0, 0}},
+                                          {{4, 0, 3, 2, 1},
+                                           {3, 0, 1, 4, 0},
+                                           {3, 1, 2, 4, 0},
+                                           {3, 2, 3, 4, 0},
+                                           {3, 3, 0, 4, 0},
+                                           {0, 0, 0, 0, 0}},
+                                          {{3, 0, 2, 1, 0},
+                                           {3, 3, 4, 5, 0},
+                                           {4, 0, 1, 4, 3},
+                                           {4, 1, 2, 5, 4},
+                                           {4, 2, 0, 3, 5},
+                                           {0, 0, 0, 0, 0}},
+                                          {{4, 0, 3, 2, 1},
+                                           {4, 4, 5, 6, 7},
+                                           {4, 0, 1, 5, 4},
+                                           {4, 1, 2, 6, 5},
+                                           {4, 2, 3, 7, 6},
+                                           {4, 3, 0, 4, 7}}};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Raise an error for a failed read.
+ *
+ * parameters:
+ *   gf <-- pointer to Gmsh file structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_error(const _gmsh_file_t  *gf)
+{
+  if (feof(gf->f))
+    bft_error(__FILE__, __LINE__, 0,
+              _("Premature end of Gmsh file \"%s\"."), gf->name);
+  else
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error reading Gmsh file \"%s\"."), gf->name);
+}
+
+/*----------------------------------------------------------------------------
+ * Swap bytes of binary data.
+ *
+ * parameters:
+ *   buf  <-> data buffer
+ *   size <-- size of each value
+ *   n    <-- number of values
+ *----------------------------------------------------------------------------*/
+
+static void
+_swap_endian(void    *buf,
+             size_t   size,
+             size_t   n)
+{
+  unsigned char *p = buf;
+
+  for (size_t i = 0; i < n; i++) {
+    unsigned char *v = p + i*size;
+    for (size_t j = 0; j < size/2; j++) {
+      unsigned char tmp = v[j];
+      v[j] = v[size - 1 - j];
+      v[size - 1 - j] = tmp;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Return the current position in a Gmsh file.
+ *
+ * parameters:
+ *   gf <-- pointer to Gmsh file structure
+ *----------------------------------------------------------------------------*/
+
+static cs_file_off_t
+_tell(_gmsh_file_t  *gf)
+{
+#if (SIZEOF_LONG < 8) && defined(HAVE_FSEEKO) && (_FILE_OFFSET_BITS == 64)
+  return ftello(gf->f);
+#else
+  return ftell(gf->f);
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Set the position in a Gmsh file.
+ *
+ * parameters:
+ *   gf     <-- pointer to Gmsh file structure
+ *   offset <-- file offset
+ *   whence <-- SEEK_SET or SEEK_CUR
+ *----------------------------------------------------------------------------*/
+
+static void
+_seek(_gmsh_file_t   *gf,
+      cs_file_off_t   offset,
+      int             whence)
+{
+#if (SIZEOF_LONG < 8) && defined(HAVE_FSEEKO) && (_FILE_OFFSET_BITS == 64)
+  int retval = fseeko(gf->f, (off_t)offset, whence);
+#else
+  int retval = fseek(gf->f, (long)offset, whence);
+#endif
+
+  if (retval != 0)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error setting position in file \"%s\":\n\n  %s"),
+              gf->name, strerror(errno));
+}
+
+/*----------------------------------------------------------------------------
+ * Read a text line from a Gmsh file, removing trailing whitespace.
+ *
+ * parameters:
+ *   gf <-> pointer to Gmsh file structure
+ *
+ * returns:
+ *   pointer to line buffer, or NULL at end of file
+ *----------------------------------------------------------------------------*/
+
+static char *
+_read_line(_gmsh_file_t  *gf)
+{
+  size_t l = 0;
+  bool read = false;
+
+  if (gf->line_size == 0) {
+    gf->line_size = 256;
+    BFT_MALLOC(gf->line, gf->line_size, char);
+  }
+
+  gf->line[0] = '\0';
+
+  while (fgets(gf->line + l, gf->line_size - l, gf->f) != NULL) {
+    read = true;
+    l += strlen(gf->line + l);
+    if (l > 0 && gf->line[l-1] == '\n')
+      break;
+    if (l + 1 >= gf->line_size) {
+      gf->line_size *= 2;
+      BFT_REALLOC(gf->line, gf->line_size, char);
+    }
+  }
+
+  if (read == false)
+    return NULL;
+
+  while (l > 0 && isspace(gf->line[l-1]))
+    gf->line[--l] = '\0';
+
+  return gf->line;
+}
+
+/*----------------------------------------------------------------------------
+ * Skip lines of a Gmsh file up to a given section end marker.
+ *
+ * parameters:
+ *   gf      <-> pointer to Gmsh file structure
+ *   end_tag <-- section end marker
+ *----------------------------------------------------------------------------*/
+
+static void
+_skip_to_end(_gmsh_file_t  *gf,
+             const char    *end_tag)
+{
+  const char *s;
+
+  while ((s = _read_line(gf)) != NULL) {
+    if (strcmp(s, end_tag) == 0)
+      return;
+  }
+
+  bft_error(__FILE__, __LINE__, 0,
+            _("Section end marker \"%s\" not found in Gmsh file \"%s\"."),
+            end_tag, gf->name);
+}
+
+/*----------------------------------------------------------------------------
+ * Read size_t values (64-bit unsigned integers) from a Gmsh file.
+ *
+ * parameters:
+ *   gf <-> pointer to Gmsh file structure
+ *   n  <-- number of values
+ *   v  --> read values
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_u64(_gmsh_file_t  *gf,
+          size_t         n,
+          uint64_t       v[])
+{
+  if (gf->binary) {
+    if (fread(v, sizeof(uint64_t), n, gf->f) != n)
+      _read_error(gf);
+    if (gf->swap_endian)
+      _swap_endian(v, sizeof(uint64_t), n);
+  }
+  else {
+    for (size_t i = 0; i < n; i++) {
+      unsigned long long u;
+      if (fscanf(gf->f, "%llu", &u) != 1)
+        _read_error(gf);
+      v[i] = u;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Read int (32-bit integer) values from a Gmsh file.
+ *
+ * parameters:
+ *   gf <-> pointer to Gmsh file structure
+ *   n  <-- number of values
+ *   v  --> read values
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_int(_gmsh_file_t  *gf,
+          size_t         n,
+          int            v[])
+{
+  if (gf->binary) {
+    int32_t v32;
+    for (size_t i = 0; i < n; i++) {
+      if (fread(&v32, sizeof(int32_t), 1, gf->f) != 1)
+        _read_error(gf);
+      if (gf->swap_endian)
+        _swap_endian(&v32, sizeof(int32_t), 1);
+      v[i] = v32;
+    }
+  }
+  else {
+    for (size_t i = 0; i < n; i++) {
+      if (fscanf(gf->f, "%d", v + i) != 1)
+        _read_error(gf);
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Read double values from a Gmsh file.
+ *
+ * parameters:
+ *   gf <-> pointer to Gmsh file structure
+ *   n  <-- number of values
+ *   v  --> read values
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_double(_gmsh_file_t  *gf,
+             size_t         n,
+             double         v[])
+{
+  if (gf->binary) {
+    if (fread(v, sizeof(double), n, gf->f) != n)
+      _read_error(gf);
+    if (gf->swap_endian)
+      _swap_endian(v, sizeof(double), n);
+  }
+  else {
+    for (size_t i = 0; i < n; i++) {
+      if (fscanf(gf->f, "%lf", v + i) != 1)
+        _read_error(gf);
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Skip values of a Gmsh file.
+ *
+ * parameters:
+ *   gf   <-> pointer to Gmsh file structure
+ *   n    <-- number of values
+ *   size <-- size of each value in binary files
+ *----------------------------------------------------------------------------*/
+
+static void
+_skip_values(_gmsh_file_t  *gf,
+             size_t         n,
+             size_t         size)
+{
+  if (n == 0)
+    return;
+
+  if (gf->binary)
+    _seek(gf, (cs_file_off_t)(n*size), SEEK_CUR);
+  else {
+    for (size_t i = 0; i < n; i++) {
+      if (fscanf(gf->f, "%*s") != 0)
+        _read_error(gf);
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Read the $MeshFormat section of a Gmsh file.
+ *
+ * parameters:
+ *   gf <-> pointer to Gmsh file structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_format(_gmsh_file_t  *gf)
+{
+  double version = 0;
+  int file_type = 0, data_size = 0;
+
+  const char *s = _read_line(gf);
+
+  if (s == NULL || sscanf(s, "%lf %d %d", &version, &file_type, &data_size) != 3)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Incorrect $MeshFormat section in Gmsh file \"%s\"."),
+              gf->name);
+
+  if (version < 4.05 || version >= 5)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Gmsh file \"%s\" has format version %g.\n"
+                "Only version 4.1 is read directly; older versions\n"
+                "should be converted by the Preprocessor."),
+              gf->name, version);
+
+  if (data_size != sizeof(uint64_t))
+    bft_error(__FILE__, __LINE__, 0,
+              _("Gmsh file \"%s\" has a data size of %d\n"
+                "(only %d is handled)."),
+              gf->name, data_size, (int)sizeof(uint64_t));
+
+  gf->binary = (file_type == 1) ? true : false;
+
+  if (gf->binary) {
+    int32_t one = 0;
+    if (fread(&one, sizeof(int32_t), 1, gf->f) != 1)
+      _read_error(gf);
+    if (one != 1) {
+      _swap_endian(&one, sizeof(int32_t), 1);
+      if (one != 1)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("Unable to determine byte ordering of Gmsh file \"%s\"."),
+                  gf->name);
+      gf->swap_endian = true;
+    }
+  }
+
+  _skip_to_end(gf, "$EndMeshFormat");
+}
+
+/*----------------------------------------------------------------------------
+ * Read the $PhysicalNames section of a Gmsh file (always ASCII).
+ *
+ * parameters:
+ *   gf          <-> pointer to Gmsh file structure
+ *   n_names     <-> number of physical names
+ *   phys_names  <-> physical names
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_physical_names(_gmsh_file_t        *gf,
+                     int                 *n_names,
+                     _gmsh_phys_name_t  **phys_names)
+{
+  int n = 0;
+  const char *s = _read_line(gf);
+
+  if (s == NULL || sscanf(s, "%d", &n) != 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Incorrect $PhysicalNames section in Gmsh file \"%s\"."),
+              gf->name);
+
+  BFT_REALLOC(*phys_names, *n_names + n, _gmsh_phys_name_t);
+
+  for (int i = 0; i < n; i++) {
+
+    _gmsh_phys_name_t *pn = *phys_names + *n_names + i;
+    int l = 0;
+
+    s = _read_line(gf);
+    if (s == NULL || sscanf(s, "%d %d %n", &(pn->dim), &(pn->tag), &l) < 2)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Incorrect $PhysicalNames section in Gmsh file \"%s\"."),
+                gf->name);
+
+    const char *name = s + l;
+    size_t name_len = strlen(name);
+    if (name_len >= 2 && name[0] == '"' && name[name_len-1] == '"') {
+      name += 1;
+      name_len -= 2;
+    }
+
+    BFT_MALLOC(pn->name, name_len + 1, char);
+    memcpy(pn->name, name, name_len);
+    pn->name[name_len] = '\0';
+
+  }
+
+  *n_names += n;
+
+  _skip_to_end(gf, "$EndPhysicalNames");
+}
+
+/*----------------------------------------------------------------------------
+ * Compare elementary entities (for qsort and bsearch).
+ *----------------------------------------------------------------------------*/
+
+static int
+_compare_entities(const void  *x,
+                  const void  *y)
+{
+  const _gmsh_entity_t *e0 = x, *e1 = y;
+
+  if (e0->dim != e1->dim)
+    return (e0->dim < e1->dim) ? -1 : 1;
+  if (e0->tag != e1->tag)
+    return (e0->tag < e1->tag) ? -1 : 1;
+
+  return 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Read the $Entities section of a Gmsh file.
+ *
+ * Only surfaces and volumes are kept; entities are sorted by
+ * dimension and tag.
+ *
+ * parameters:
+ *   gf         <-> pointer to Gmsh file structure
+ *   n_entities --> number of surface and volume entities
+ *   entities   --> surface and volume entities
+ *   phys_tags  --> physical tags of entities
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_entities(_gmsh_file_t     *gf,
+               int              *n_entities,
+               _gmsh_entity_t  **entities,
+               int             **phys_tags)
+{
+  uint64_t n_ent[4], n_phys, n_bound;
+  double bbox[6];
+  int tag;
+
+  int n_phys_tags = 0;
+  int *_phys_tags = NULL;
+  _gmsh_entity_t *_entities = NULL;
+
+  _read_u64(gf, 4, n_ent);
+
+  BFT_MALLOC(_entities, n_ent[2] + n_ent[3], _gmsh_entity_t);
+
+  /* Points */
+
+  for (uint64_t i = 0; i < n_ent[0]; i++) {
+    _read_int(gf, 1, &tag);
+    _read_double(gf, 3, bbox);
+    _read_u64(gf, 1, &n_phys);
+    _skip_values(gf, n_phys, sizeof(int32_t));
+  }
+
+  /* Curves, surfaces and volumes */
+
+  int n_kept = 0;
+
+  for (int dim = 1; dim < 4; dim++) {
+
+    for (uint64_t i = 0; i < n_ent[dim]; i++) {
+
+      _read_int(gf, 1, &tag);
+      _read_double(gf, 6, bbox);
+      _read_u64(gf, 1, &n_phys);
+
+      if (dim > 1) {
+        _gmsh_entity_t *e = _entities + n_kept;
+        e->dim = dim;
+        e->tag = tag;
+        e->n_phys = n_phys;
+        e->phys_start = n_phys_tags;
+        e->family = 1;
+        BFT_REALLOC(_phys_tags, n_phys_tags + n_phys, int);
+        _read_int(gf, n_phys, _phys_tags + n_phys_tags);
+        n_phys_tags += n_phys;
+        n_kept++;
+      }
+      else
+        _skip_values(gf, n_phys, sizeof(int32_t));
+
+      _read_u64(gf, 1, &n_bound);
+      _skip_values(gf, n_bound, sizeof(int32_t));
+
+    }
+
+  }
+
+  qsort(_entities, n_kept, sizeof(_gmsh_entity_t), _compare_entities);
+
+  _skip_to_end(gf, "$EndEntities");
+
+  *n_entities = n_kept;
+  *entities = _entities;
+  *phys_tags = _phys_tags;
+}
+
+/*----------------------------------------------------------------------------
+ * Read the $Nodes section of a Gmsh file.
+ *
+ * Each rank keeps a block of the nodes, in file order (other nodes are
+ * skipped by seeking in binary files, but parsed in ASCII files).
+ * Node tags must be contiguous, and are used as vertex global numbers.
+ *
+ * parameters:
+ *   gf <-> pointer to Gmsh file structure
+ *   gm <-> pointer to Gmsh mesh reader structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_nodes(_gmsh_file_t    *gf,
+            cs_mesh_gmsh_t  *gm)
+{
+  uint64_t header[4];
+
+  _read_u64(gf, 4, header);
+
+  const uint64_t n_blocks = header[0];
+  const uint64_t n_g_nodes = header[1];
+
+  if (n_g_nodes > 0 && (header[2] != 1 || header[3] != n_g_nodes))
+    bft_error(__FILE__, __LINE__, 0,
+              _("Gmsh file \"%s\" has non-contiguous node tags\n"
+                "(%llu nodes, tags %llu to %llu); renumber the mesh\n"
+                "before reading it."),
+              gf->name, (unsigned long long)n_g_nodes,
+              (unsigned long long)header[2], (unsigned long long)header[3]);
+
+  cs_block_dist_info_t bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                                        cs_glob_n_ranks,
+                                                        1,
+                                                        0,
+                                                        n_g_nodes);
+
+  const uint64_t s_id = bi.gnum_range[0] - 1;
+  const uint64_t e_id = bi.gnum_range[1] - 1;
+
+  gm->n_g_vertices = n_g_nodes;
+  gm->n_vertices = e_id - s_id;
+
+  BFT_MALLOC(gm->vertex_gnum, gm->n_vertices, cs_gnum_t);
+  BFT_MALLOC(gm->vertex_coords, gm->n_vertices*3, cs_real_t);
+
+  uint64_t *tag_buf = NULL;
+  double *coo_buf = NULL;
+  size_t buf_size = 0;
+
+  uint64_t pos = 0;
+
+  for (uint64_t b_id = 0; b_id < n_blocks; b_id++) {
+
+    int b_header[3];
+    uint64_t n_b_nodes;
+
+    _read_int(gf, 3, b_header);
+    _read_u64(gf, 1, &n_b_nodes);
+
+    /* Parametric coordinates follow x, y, z if present */
+
+    const size_t n_coo = 3 + ((b_header[2] != 0) ? b_header[0] : 0);
+
+    /* Range of block nodes read on this rank */
+
+    uint64_t i0 = (s_id > pos) ? s_id - pos : 0;
+    uint64_t i1 = (e_id > pos) ? e_id - pos : 0;
+    if (i0 > n_b_nodes)
+      i0 = n_b_nodes;
+    if (i1 > n_b_nodes)
+      i1 = n_b_nodes;
+
+    const size_t n_read = i1 - i0;
+
+    if (n_read > buf_size) {
+      buf_size = n_read;
+      BFT_REALLOC(tag_buf, buf_size, uint64_t);
+      BFT_REALLOC(coo_buf, buf_size*n_coo, double);
+    }
+    else if (n_coo > 3)
+      BFT_REALLOC(coo_buf, buf_size*n_coo, double);
+
+    _skip_values(gf, i0, sizeof(uint64_t));
+    _read_u64(gf, n_read, tag_buf);
+    _skip_values(gf, n_b_nodes - i1, sizeof(uint64_t));
+
+    _skip_values(gf, i0*n_coo, sizeof(double));
+    _read_double(gf, n_read*n_coo, coo_buf);
+    _skip_values(gf, (n_b_nodes - i1)*n_coo, sizeof(double));
+
+    const cs_lnum_t shift = pos + i0 - s_id;
+
+    for (size_t i = 0; i < n_read; i++) {
+      gm->vertex_gnum[shift + i] = tag_buf[i];
+      for (int j = 0; j < 3; j++)
+        gm->vertex_coords[(shift + i)*3 + j] = coo_buf[i*n_coo + j];
+    }
+
+    pos += n_b_nodes;
+
+  }
+
+  BFT_FREE(coo_buf);
+  BFT_FREE(tag_buf);
+
+  if (pos != n_g_nodes)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Incorrect $Nodes section in Gmsh file \"%s\"."),
+              gf->name);
+
+  _skip_to_end(gf, "$EndNodes");
+}
+
+/*----------------------------------------------------------------------------
+ * Scan the $Elements section of a Gmsh file, recording element blocks.
+ *
+ * parameters:
+ *   gf       <-> pointer to Gmsh file structure
+ *   n_blocks --> number of element blocks
+ *   blocks   --> element block descriptions
+ *----------------------------------------------------------------------------*/
+
+static void
+_scan_elements(_gmsh_file_t        *gf,
+               int                 *n_blocks,
+               _gmsh_elt_block_t  **blocks)
+{
+  uint64_t header[4];
+
+  _read_u64(gf, 4, header);
+
+  _gmsh_elt_block_t *_blocks = NULL;
+  BFT_MALLOC(_blocks, header[0], _gmsh_elt_block_t);
+
+  for (uint64_t b_id = 0; b_id < header[0]; b_id++) {
+
+    _gmsh_elt_block_t *b = _blocks + b_id;
+    int b_header[3];
+    uint64_t n_b_elts;
+
+    _read_int(gf, 3, b_header);
+    _read_u64(gf, 1, &n_b_elts);
+
+    b->dim = b_header[0];
+    b->tag = b_header[1];
+    b->type = b_header[2];
+    b->n_elts = n_b_elts;
+    b->offset = _tell(gf);
+
+    if (b->type > 0 && b->type < 20)
+      b->n_vtx = _gmsh_type_n_vtx[b->type];
+    else
+      bft_error(__FILE__, __LINE__, 0,
+                _("Gmsh file \"%s\" contains elements of unhandled type %d."),
+                gf->name, b->type);
+
+    /* Only linear surface and volume elements are handled */
+
+    if (   (b->dim == 2 && b->type != 2 && b->type != 3)
+        || (b->dim == 3 && (b->type < 4 || b->type > 7)))
+      bft_error(__FILE__, __LINE__, 0,
+                _("Gmsh file \"%s\" contains elements of type %d;\n"
+                  "only linear surface and volume elements are handled."),
+                gf->name, b->type);
+
+    _skip_values(gf, n_b_elts*(1 + b->n_vtx), sizeof(uint64_t));
+
+  }
+
+  _skip_to_end(gf, "$EndElements");
+
+  *n_blocks = header[0];
+  *blocks = _blocks;
+}
+
+/*----------------------------------------------------------------------------
+ * Return the family associated with an elementary entity.
+ *
+ * parameters:
+ *   n_entities <-- number of entities
+ *   entities   <-- entities, sorted by dimension and tag
+ *   dim        <-- entity dimension
+ *   tag        <-- entity tag
+ *
+ * returns:
+ *   family (1 to n), 1 being the default family
+ *----------------------------------------------------------------------------*/
+
+static int
+_entity_family(int                    n_entities,
+               const _gmsh_entity_t  *entities,
+               int                    dim,
+               int                    tag)
+{
+  _gmsh_entity_t key = {.dim = dim, .tag = tag};
+
+  const _gmsh_entity_t *e = bsearch(&key, entities, n_entities,
+                                    sizeof(_gmsh_entity_t),
+                                    _compare_entities);
+
+  return (e != NULL) ? e->family : 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Define groups and group classes from physical groups.
+ *
+ * A group is defined for each physical group of dimension 2 or 3,
+ * and a group class for each entity belonging to physical groups;
+ * the first group class has no groups, and is used for elements
+ * not belonging to any physical group.
+ *
+ * parameters:
+ *   gm           <-> pointer to Gmsh mesh reader structure
+ *   n_entities   <-- number of entities
+ *   entities     <-> entities (family defined here)
+ *   phys_tags    <-- physical tags of entities
+ *   n_phys_names <-- number of physical names
+ *   phys_names   <-- physical names
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_groups(cs_mesh_gmsh_t           *gm,
+               int                       n_entities,
+               _gmsh_entity_t           *entities,
+               const int                 phys_tags[],
+               int                       n_phys_names,
+               const _gmsh_phys_name_t   phys_names[])
+{
+  /* Unique (dimension, physical tag) couples define groups */
+
+  int n_couples = 0;
+  _gmsh_entity_t *groups = NULL;
+
+  for (int i = 0; i < n_entities; i++)
+    n_couples += entities[i].n_phys;
+
+  BFT_MALLOC(groups, n_couples, _gmsh_entity_t);
+
+  n_couples = 0;
+  for (int i = 0; i < n_entities; i++) {
+    for (int j = 0; j < entities[i].n_phys; j++) {
+      groups[n_couples].dim = entities[i].dim;
+      groups[n_couples].tag = phys_tags[entities[i].phys_start + j];
+      n_couples++;
+    }
+  }
+
+  qsort(groups, n_couples, sizeof(_gmsh_entity_t), _compare_entities);
+
+  int n_groups = 0;
+  for (int i = 0; i < n_couples; i++) {
+    if (n_groups == 0 || _compare_entities(groups + i, groups + n_groups - 1))
+      groups[n_groups++] = groups[i];
+  }
+
+  gm->n_groups = n_groups;
+  BFT_MALLOC(gm->group_name, n_groups, char *);
+
+  for (int i = 0; i < n_groups; i++) {
+    const char *name = NULL;
+    for (int j = 0; j < n_phys_names; j++) {
+      if (   phys_names[j].dim == groups[i].dim
+          && phys_names[j].tag == groups[i].tag)
+        name = phys_names[j].name;
+    }
+    if (name != NULL) {
+      BFT_MALLOC(gm->group_name[i], strlen(name) + 1, char);
+      strcpy(gm->group_name[i], name);
+    }
+    else {
+      BFT_MALLOC(gm->group_name[i], 16, char);
+      snprintf(gm->group_name[i], 16, "%d", groups[i].tag);
+    }
+    groups[i].family = i + 1;
+  }
+
+  /* Group classes */
+
+  int n_families = 1, n_max_family_items = 0;
+
+  for (int i = 0; i < n_entities; i++) {
+    if (entities[i].n_phys > 0) {
+      entities[i].family = ++n_families;
+      n_max_family_items = CS_MAX(n_max_family_items, entities[i].n_phys);
+    }
+    else
+      entities[i].family = 1;
+  }
+
+  gm->n_families = n_families;
+  gm->n_max_family_items = n_max_family_items;
+  BFT_MALLOC(gm->family_item, n_families*n_max_family_items, int);
+
+  for (int i = 0; i < n_families*n_max_family_items; i++)
+    gm->family_item[i] = 0;
+
+  for (int i = 0; i < n_entities; i++) {
+    const _gmsh_entity_t *e = entities + i;
+    if (e->n_phys == 0)
+      continue;
+    for (int j = 0; j < e->n_phys; j++) {
+      gm->family_item[n_families*j + e->family - 1]
+        = _entity_family(n_groups, groups,
+                         e->dim, phys_tags[e->phys_start + j]);
+    }
+  }
+
+  BFT_FREE(groups);
+}
+
+/*----------------------------------------------------------------------------
+ * Read local blocks of elements of a given dimension.
+ *
+ * Elements of the given dimension are numbered in file order, and
+ * each rank reads a block of that numbering.
+ *
+ * parameters:
+ *   gf         <-> pointer to Gmsh file structure
+ *   dim        <-- dimension of elements read
+ *   n_blocks   <-- number of element blocks
+ *   blocks     <-- element block descriptions
+ *   n_entities <-- number of entities
+ *   entities   <-- entities, sorted by dimension and tag
+ *   n_g_elts   --> global number of elements of given dimension
+ *   gnum_s     --> global number of first local element
+ *   n_elts     --> number of local elements
+ *   elt_n_vtx  --> number of vertices of local elements
+ *   elt_vtx    --> vertices of local elements (stride 8)
+ *   elt_family --> family of local elements
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_elements(_gmsh_file_t             *gf,
+               int                       dim,
+               int                       n_blocks,
+               const _gmsh_elt_block_t   blocks[],
+               int                       n_entities,
+               const _gmsh_entity_t      entities[],
+               cs_gnum_t                *n_g_elts,
+               cs_gnum_t                *gnum_s,
+               cs_lnum_t                *n_elts,
+               short int               **elt_n_vtx,
+               cs_gnum_t               **elt_vtx,
+               int                     **elt_family)
+{
+  cs_gnum_t _n_g_elts = 0;
+
+  for (int b_id = 0; b_id < n_blocks; b_id++) {
+    if (blocks[b_id].dim == dim)
+      _n_g_elts += blocks[b_id].n_elts;
+  }
+
+  cs_block_dist_info_t bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                                        cs_glob_n_ranks,
+                                                        1,
+                                                        0,
+                                                        _n_g_elts);
+
+  const cs_gnum_t s_id = bi.gnum_range[0] - 1;
+  const cs_gnum_t e_id = bi.gnum_range[1] - 1;
+  const cs_lnum_t _n_elts = e_id - s_id;
+
+  short int *_elt_n_vtx;
+  cs_gnum_t *_elt_vtx;
+  int *_elt_family;
+
+  BFT_MALLOC(_elt_n_vtx, _n_elts, short int);
+  BFT_MALLOC(_elt_vtx, _n_elts*8, cs_gnum_t);
+  BFT_MALLOC(_elt_family, _n_elts, int);
+
+  uint64_t buf[9];
+
+  cs_gnum_t pos = 0;
+
+  for (int b_id = 0; b_id < n_blocks; b_id++) {
+
+    const _gmsh_elt_block_t *b = blocks + b_id;
+
+    if (b->dim != dim)
+      continue;
+
+    cs_gnum_t i0 = (s_id > pos) ? s_id - pos : 0;
+    cs_gnum_t i1 = (e_id > pos) ? e_id - pos : 0;
+    if (i0 > b->n_elts)
+      i0 = b->n_elts;
+    if (i1 > b->n_elts)
+      i1 = b->n_elts;
+
+    if (i1 > i0) {
+
+      const int family = _entity_family(n_entities, entities, b->dim, b->tag);
+
+      _seek(gf, b->offset, SEEK_SET);
+      _skip_values(gf, i0*(1 + b->n_vtx), sizeof(uint64_t));
+
+      for (cs_gnum_t i = i0; i < i1; i++) {
+        cs_lnum_t elt_id = pos + i - s_id;
+        _read_u64(gf, 1 + b->n_vtx, buf);
+        _elt_n_vtx[elt_id] = b->n_vtx;
+        for (int j = 0; j < b->n_vtx; j++)
+          _elt_vtx[elt_id*8 + j] = buf[j+1];
+        _elt_family[elt_id] = family;
+      }
+
+    }
+
+    pos += b->n_elts;
+
+  }
+
+  *n_g_elts = _n_g_elts;
+  *gnum_s = s_id + 1;
+  *n_elts = _n_elts;
+  *elt_n_vtx = _elt_n_vtx;
+  *elt_vtx = _elt_vtx;
+  *elt_family = _elt_family;
+}
+
+/*----------------------------------------------------------------------------
+ * Build faces from local cells and boundary elements.
+ *
+ * Cell faces and boundary elements are sent to the rank owning their
+ * smallest vertex in a block distribution of vertices, where matching
+ * faces are found by sorting their vertex lists.
+ *
+ * parameters:
+ *   gm         <-> pointer to Gmsh mesh reader structure
+ *   cell_n_vtx <-- number of vertices of local cells
+ *   cell_vtx   <-- vertices of local cells (stride 8)
+ *   n_b_elts   <-- number of local boundary elements
+ *   b_n_vtx    <-- number of vertices of local boundary elements
+ *   b_vtx      <-- vertices of local boundary elements (stride 8)
+ *   b_family   <-- family of local boundary elements
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_faces(cs_mesh_gmsh_t   *gm,
+             const short int   cell_n_vtx[],
+             const cs_gnum_t   cell_vtx[],
+             cs_lnum_t         n_b_elts,
+             const short int   b_n_vtx[],
+             const cs_gnum_t   b_vtx[],
+             const int         b_family[])
+{
+  const int stride = _FACE_REC_SIZE;
+
+  /* Build face records */
+
+  cs_lnum_t n_recs = n_b_elts;
+
+  for (cs_lnum_t i = 0; i < gm->n_cells; i++) {
+    int c_type = (cell_n_vtx[i] == 8) ? 3 : cell_n_vtx[i] - 4;
+    n_recs += _cell_n_faces[c_type];
+  }
+
+  cs_gnum_t *recs, *min_vtx;
+  BFT_MALLOC(recs, n_recs*stride, cs_gnum_t);
+  BFT_MALLOC(min_vtx, n_recs, cs_gnum_t);
+
+  cs_lnum_t r_id = 0;
+
+  for (cs_lnum_t i = 0; i < gm->n_cells; i++) {
+    const cs_gnum_t *c_vtx = cell_vtx + i*8;
+    int c_type = (cell_n_vtx[i] == 8) ? 3 : cell_n_vtx[i] - 4;
+    for (int j = 0; j < _cell_n_faces[c_type]; j++) {
+      const int *f_def = _cell_faces[c_type][j];
+      cs_gnum_t *r = recs + r_id*stride;
+      r[0] = f_def[0];
+      r[4] = 0;
+      for (int k = 0; k < f_def[0]; k++)
+        r[k+1] = c_vtx[f_def[k+1]];
+      r[5] = gm->cells[i*2];
+      r[6] = 0;
+      r_id++;
+    }
+  }
+
+  for (cs_lnum_t i = 0; i < n_b_elts; i++) {
+    cs_gnum_t *r = recs + r_id*stride;
+    r[0] = b_n_vtx[i];
+    r[4] = 0;
+    for (int k = 0; k < b_n_vtx[i]; k++)
+      r[k+1] = b_vtx[i*8 + k];
+    r[5] = 0;
+    r[6] = b_family[i];
+    r_id++;
+  }
+
+  for (cs_lnum_t i = 0; i < n_recs; i++) {
+    const cs_gnum_t *r = recs + i*stride;
+    min_vtx[i] = r[1];
+    for (cs_gnum_t k = 1; k < r[0]; k++)
+      min_vtx[i] = CS_MIN(min_vtx[i], r[k+1]);
+  }
+
+  /* Send records to the ranks owning their smallest vertex */
+
+  cs_lnum_t n_recv = n_recs;
+  cs_gnum_t *recv = recs;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_block_dist_info_t vtx_bi
+      = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                    cs_glob_n_ranks,
+                                    1,
+                                    0,
+                                    gm->n_g_vertices);
+
+    cs_all_to_all_t *d
+      = cs_all_to_all_create_from_block(n_recs,
+                                        0, /* flags */
+                                        min_vtx,
+                                        vtx_bi,
+                                        cs_glob_mpi_comm);
+
+    recv = cs_all_to_all_copy_array(d,
+                                    CS_GNUM_TYPE,
+                                    stride,
+                                    false, /* reverse */
+                                    recs,
+                                    NULL);
+
+    n_recv = cs_all_to_all_n_elts_dest(d);
+
+    cs_all_to_all_destroy(&d);
+
+    BFT_FREE(recs);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  BFT_FREE(min_vtx);
+
+  /* Order records by sorted vertex lists */
+
+  cs_gnum_t *keys;
+  cs_lnum_t *order;
+  BFT_MALLOC(keys, n_recv*4, cs_gnum_t);
+  BFT_MALLOC(order, n_recv, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_recv; i++) {
+    const cs_gnum_t *r = recv + i*stride;
+    cs_gnum_t *k = keys + i*4;
+    cs_lnum_t n_vtx = r[0];
+    for (cs_lnum_t j = 0; j < 4; j++)
+      k[j] = (j < n_vtx) ? r[j+1] : 0;
+    for (cs_lnum_t j = 1; j < n_vtx; j++) {
+      cs_gnum_t v = k[j];
+      cs_lnum_t l = j;
+      while (l > 0 && k[l-1] > v) {
+        k[l] = k[l-1];
+        l--;
+      }
+      k[l] = v;
+    }
+  }
+
+  cs_order_gnum_allocated_s(NULL, keys, 4, order, n_recv);
+
+  /* Match faces */
+
+  cs_lnum_t n_faces = 0;
+  cs_gnum_t *faces;
+  BFT_MALLOC(faces, n_recv*_FACE_DEF_SIZE, cs_gnum_t);
+
+  cs_lnum_t s_id = 0;
+
+  while (s_id < n_recv) {
+
+    const cs_gnum_t *k0 = keys + order[s_id]*4;
+    cs_lnum_t e_id = s_id + 1;
+    while (e_id < n_recv) {
+      const cs_gnum_t *k1 = keys + order[e_id]*4;
+      if (k0[0] != k1[0] || k0[1] != k1[1] || k0[2] != k1[2] || k0[3] != k1[3])
+        break;
+      e_id++;
+    }
+
+    const cs_gnum_t *c_rec[2] = {NULL, NULL};
+    cs_gnum_t family = 1;
+    int n_cells = 0;
+
+    for (cs_lnum_t i = s_id; i < e_id; i++) {
+      const cs_gnum_t *r = recv + order[i]*stride;
+      if (r[5] > 0) {
+        if (n_cells < 2)
+          c_rec[n_cells] = r;
+        n_cells++;
+      }
+      else
+        family = r[6];
+    }
+
+    if (n_cells > 2)
+      bft_error(__FILE__, __LINE__, 0,
+                _("A face is shared by %d cells in the Gmsh mesh\n"
+                  "(non-conforming or duplicate elements)."),
+                n_cells);
+
+    if (n_cells > 0) {
+
+      cs_gnum_t c_num[2] = {c_rec[0][5], 0};
+
+      if (n_cells == 2) {
+        if (c_rec[1][5] < c_rec[0][5]) {
+          const cs_gnum_t *tmp = c_rec[0];
+          c_rec[0] = c_rec[1];
+          c_rec[1] = tmp;
+        }
+        c_num[0] = c_rec[0][5];
+        c_num[1] = c_rec[1][5];
+      }
+
+      cs_gnum_t *f = faces + n_faces*_FACE_DEF_SIZE;
+      f[0] = n_faces;
+      f[1] = c_num[0];
+      f[2] = c_num[1];
+      f[3] = family;
+      f[4] = c_rec[0][0];
+      for (int j = 0; j < 4; j++)
+        f[5+j] = c_rec[0][j+1];
+
+      n_faces++;
+
+    }
+
+    s_id = e_id;
+
+  }
+
+  BFT_FREE(order);
+  BFT_FREE(keys);
+  BFT_FREE(recv);
+
+  BFT_REALLOC(faces, n_faces*_FACE_DEF_SIZE, cs_gnum_t);
+
+  /* Global numbering follows the rank order (and thus the smallest
+     vertex of each face), then the local order */
+
+  cs_gnum_t gnum_shift = 0;
+  cs_gnum_t n_g_faces = n_faces;
+  cs_gnum_t n_g_face_connect_size = 0;
+
+  for (cs_lnum_t i = 0; i < n_faces; i++)
+    n_g_face_connect_size += faces[i*_FACE_DEF_SIZE + 4];
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_gnum_t l_count = n_faces;
+    MPI_Scan(&l_count, &gnum_shift, 1, CS_MPI_GNUM, MPI_SUM, cs_glob_mpi_comm);
+    gnum_shift -= l_count;
+    cs_parall_counter(&n_g_faces, 1);
+    cs_parall_counter(&n_g_face_connect_size, 1);
+  }
+#endif
+
+  for (cs_lnum_t i = 0; i < n_faces; i++)
+    faces[i*_FACE_DEF_SIZE] += gnum_shift + 1;
+
+  gm->n_faces = n_faces;
+  gm->faces = faces;
+  gm->n_g_faces = n_g_faces;
+  gm->n_g_face_connect_size = n_g_face_connect_size;
+}
+
+/*----------------------------------------------------------------------------
+ * Define cells and build faces from local elements.
+ *
+ * Element arrays are freed by this function.
+ *
+ * parameters:
+ *   gm          <-> pointer to Gmsh mesh reader structure
+ *   cell_gnum_s <-- global number of first local cell
+ *   cell_n_vtx  <-> number of vertices of local cells
+ *   cell_vtx    <-> vertices of local cells (stride 8)
+ *   cell_family <-> family of local cells
+ *   n_b_elts    <-- number of local boundary elements
+ *   b_n_vtx     <-> number of vertices of local boundary elements
+ *   b_vtx       <-> vertices of local boundary elements (stride 8)
+ *   b_family    <-> family of local boundary elements
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_cells_and_faces(cs_mesh_gmsh_t   *gm,
+                       cs_gnum_t         cell_gnum_s,
+                       short int       **cell_n_vtx,
+                       cs_gnum_t       **cell_vtx,
+                       int             **cell_family,
+                       cs_lnum_t         n_b_elts,
+                       short int       **b_n_vtx,
+                       cs_gnum_t       **b_vtx,
+                       int             **b_family)
+{
+  BFT_MALLOC(gm->cells, gm->n_cells*2, cs_gnum_t);
+
+  for (cs_lnum_t i = 0; i < gm->n_cells; i++) {
+    gm->cells[i*2] = cell_gnum_s + i;
+    gm->cells[i*2 + 1] = (*cell_family)[i];
+  }
+
+  BFT_FREE(*cell_family);
+
+  _build_faces(gm, *cell_n_vtx, *cell_vtx,
+               n_b_elts, *b_n_vtx, *b_vtx, *b_family);
+
+  BFT_FREE(*b_family);
+  BFT_FREE(*b_vtx);
+  BFT_FREE(*b_n_vtx);
+  BFT_FREE(*cell_vtx);
+  BFT_FREE(*cell_n_vtx);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Check if a mesh file should be read as a Gmsh file.
+ *
+ * parameters:
+ *   path <-- mesh file path
+ *
+ * returns:
+ *   true if the file has a ".msh" extension, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_gmsh_is_gmsh_file(const char  *path)
+{
+  return (cs_file_endswith(path, ".msh")) ? true : false;
+}
+
+/*----------------------------------------------------------------------------
+ * Read a Gmsh (format 4.1, ASCII or binary) mesh file and build its faces.
+ *
+ * Each rank opens the file and keeps only its block of the file's nodes,
+ * volume elements, and surface elements. In binary files, data outside
+ * that block is skipped by seeking. ASCII files cannot be skipped through,
+ * so they are parsed entirely by every rank; when running on several
+ * ranks, ASCII files larger than 64 MiB are rejected, and should be
+ * converted to binary.
+ * Faces are then built in parallel, using a distribution based on their
+ * vertices, so that the resulting face numbering does not depend on the
+ * number of ranks.
+ *
+ * This function is collective.
+ *
+ * parameters:
+ *   path <-- mesh file path
+ *
+ * returns:
+ *   pointer to Gmsh mesh reader structure
+ *----------------------------------------------------------------------------*/
+
+cs_mesh_gmsh_t *
+cs_mesh_gmsh_read(const char  *path)
+{
+  _gmsh_file_t gf = {.f = NULL,
+                     .name = path,
+                     .binary = false,
+                     .swap_endian = false,
+                     .line_size = 0,
+                     .line = NULL};
+
+  gf.f = fopen(path, "rb");
+
+  if (gf.f == NULL)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error opening file \"%s\":\n\n  %s"), path, strerror(errno));
+
+  cs_mesh_gmsh_t *gm;
+  BFT_MALLOC(gm, 1, cs_mesh_gmsh_t);
+  memset(gm, 0, sizeof(cs_mesh_gmsh_t));
+
+  int n_entities = 0, n_phys_names = 0, n_blocks = 0;
+  int *phys_tags = NULL;
+  _gmsh_entity_t *entities = NULL;
+  _gmsh_phys_name_t *phys_names = NULL;
+  _gmsh_elt_block_t *blocks = NULL;
+
+  bool have_format = false, have_nodes = false, have_elements = false;
+
+  /* Loop on sections */
+
+  const char *s;
+
+  while ((s = _read_line(&gf)) != NULL) {
+
+    if (s[0] != '$')
+      continue;
+
+    if (strcmp(s, "$MeshFormat") == 0) {
+      _read_format(&gf);
+      have_format = true;
+      if (   gf.binary == false && cs_glob_n_ranks > 1
+          && cs_file_size(path) > _ASCII_PARALLEL_SIZE_MAX)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("Gmsh file \"%s\" is an ASCII file of %llu bytes.\n"
+                    "ASCII files are parsed entirely by every rank, so only\n"
+                    "files up to %llu bytes are read in parallel; convert\n"
+                    "this file to the binary format (for example using\n"
+                    "\"gmsh %s -save -bin -format msh41 -o <new_file>\")."),
+                  path, (unsigned long long)cs_file_size(path),
+                  (unsigned long long)_ASCII_PARALLEL_SIZE_MAX, path);
+    }
+    else if (have_format == false)
+      bft_error(__FILE__, __LINE__, 0,
+                _("File \"%s\" does not start with a $MeshFormat section."),
+                path);
+    else if (strcmp(s, "$PhysicalNames") == 0)
+      _read_physical_names(&gf, &n_phys_names, &phys_names);
+    else if (strcmp(s, "$Entities") == 0)
+      _read_entities(&gf, &n_entities, &entities, &phys_tags);
+    else if (strcmp(s, "$PartitionedEntities") == 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Partitioned Gmsh file \"%s\" is not handled."), path);
+    else if (strcmp(s, "$Nodes") == 0) {
+      _read_nodes(&gf, gm);
+      have_nodes = true;
+    }
+    else if (strcmp(s, "$Elements") == 0) {
+      _scan_elements(&gf, &n_blocks, &blocks);
+      have_elements = true;
+    }
+    else {
+      char *end_tag;
+      BFT_MALLOC(end_tag, strlen(s) + 4, char);
+      sprintf(end_tag, "$End%s", s + 1);
+      _skip_to_end(&gf, end_tag);
+      BFT_FREE(end_tag);
+    }
+
+  }
+
+  if (have_nodes == false || have_elements == false)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Gmsh file \"%s\" does not contain nodes and elements."),
+              path);
+
+  /* Groups and group classes */
+
+  _define_groups(gm, n_entities, entities, phys_tags,
+                 n_phys_names, phys_names);
+
+  /* Cells and boundary elements */
+
+  cs_gnum_t cell_gnum_s = 0, b_gnum_s = 0, n_g_b_elts = 0;
+  cs_lnum_t n_b_elts = 0;
+  short int *cell_n_vtx = NULL, *b_n_vtx = NULL;
+  cs_gnum_t *cell_vtx = NULL, *b_vtx = NULL;
+  int *cell_family = NULL, *b_family = NULL;
+
+  _read_elements(&gf, 3, n_blocks, blocks, n_entities, entities,
+                 &(gm->n_g_cells), &cell_gnum_s, &(gm->n_cells),
+                 &cell_n_vtx, &cell_vtx, &cell_family);
+
+  _read_elements(&gf, 2, n_blocks, blocks, n_entities, entities,
+                 &n_g_b_elts, &b_gnum_s, &n_b_elts,
+                 &b_n_vtx, &b_vtx, &b_family);
+
+  fclose(gf.f);
+  BFT_FREE(gf.line);
+
+  /* Cells and faces */
+
+  _build_cells_and_faces(gm, cell_gnum_s,
+                         &cell_n_vtx, &cell_vtx, &cell_family,
+                         n_b_elts, &b_n_vtx, &b_vtx, &b_family);
+
+  /* Free temporary data */
+
+  BFT_FREE(blocks);
+  for (int i = 0; i < n_phys_names; i++)
+    BFT_FREE(phys_names[i].name);
+  BFT_FREE(phys_names);
+  BFT_FREE(phys_tags);
+  BFT_FREE(entities);
+
+  return gm;
+}
+
+/*----------------------------------------------------------------------------
+ * Create a mesh reader structure from elements read by another reader,
+ * and build its faces.
+ *
+ * Element vertices follow the Gmsh (and CGNS) local numbering of linear
+ * tetrahedra, pyramids, prisms and hexahedra, and cells are numbered
+ * in rank order. Groups and group classes are defined as described for
+ * cs_mesh_gmsh_get_group_classes().
+ *
+ * Ownership of all arrays is transferred to this function; vertex and
+ * group arrays are kept in the returned structure, and others are freed.
+ *
+ * This function is collective.
+ *
+ * parameters:
+ *   n_g_vertices       <-- global number of vertices
+ *   n_vertices         <-- number of local vertices
+ *   vertex_gnum        <-- global numbers of local vertices
+ *   vertex_coords      <-- coordinates of local vertices
+ *   n_cells            <-- number of local cells
+ *   cell_n_vtx         <-- number of vertices of local cells
+ *   cell_vtx           <-- vertices of local cells (stride 8)
+ *   cell_family        <-- family of local cells
+ *   n_b_elts           <-- number of local boundary elements
+ *   b_n_vtx            <-- number of vertices of local boundary elements
+ *   b_vtx              <-- vertices of local boundary elements (stride 8)
+ *   b_family           <-- family of local boundary elements
+ *   n_groups           <-- number of groups
+ *   group_name         <-- group names
+ *   n_families         <-- number of group classes
+ *   n_max_family_items <-- maximum number of groups per group class
+ *   family_item        <-- group ids of each group class
+ *
+ * returns:
+ *   pointer to mesh reader structure
+ *----------------------------------------------------------------------------*/
+
+cs_mesh_gmsh_t *
+cs_mesh_gmsh_create_from_elements(cs_gnum_t    n_g_vertices,
+                                  cs_lnum_t    n_vertices,
+                                  cs_gnum_t   *vertex_gnum,
+                                  cs_real_t   *vertex_coords,
+                                  cs_lnum_t    n_cells,
+                                  short int   *cell_n_vtx,
+                                  cs_gnum_t   *cell_vtx,
+                                  int         *cell_family,
+                                  cs_lnum_t    n_b_elts,
+                                  short int   *b_n_vtx,
+                                  cs_gnum_t   *b_vtx,
+                                  int         *b_family,
+                                  int          n_groups,
+                                  char       **group_name,
+                                  int          n_families,
+                                  int          n_max_family_items,
+                                  int         *family_item)
+{
+  cs_mesh_gmsh_t *gm;
+  BFT_MALLOC(gm, 1, cs_mesh_gmsh_t);
+  memset(gm, 0, sizeof(cs_mesh_gmsh_t));
+
+  gm->n_g_vertices = n_g_vertices;
+  gm->n_vertices = n_vertices;
+  gm->vertex_gnum = vertex_gnum;
+  gm->vertex_coords = vertex_coords;
+
+  gm->n_groups = n_groups;
+  gm->group_name = group_name;
+  gm->n_families = n_families;
+  gm->n_max_family_items = n_max_family_items;
+  gm->family_item = family_item;
+
+  /* Cells are numbered in rank order */
+
+  cs_gnum_t cell_gnum_s = 1;
+
+  gm->n_cells = n_cells;
+  gm->n_g_cells = n_cells;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_gnum_t l_count = n_cells;
+    MPI_Scan(&l_count, &cell_gnum_s, 1, CS_MPI_GNUM, MPI_SUM,
+             cs_glob_mpi_comm);
+    cell_gnum_s += 1 - l_count;
+    cs_parall_counter(&(gm->n_g_cells), 1);
+  }
+#endif
+
+  _build_cells_and_faces(gm, cell_gnum_s,
+                         &cell_n_vtx, &cell_vtx, &cell_family,
+                         n_b_elts, &b_n_vtx, &b_vtx, &b_family);
+
+  return gm;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a Gmsh mesh reader structure.
+ *
+ * parameters:
+ *   gm <-> pointer to Gmsh mesh reader structure pointer
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_gmsh_destroy(cs_mesh_gmsh_t  **gm)
+{
+  cs_mesh_gmsh_t *_gm = *gm;
+
+  if (_gm == NULL)
+    return;
+
+  for (int i = 0; i < _gm->n_groups; i++)
+    BFT_FREE(_gm->group_name[i]);
+  BFT_FREE(_gm->group_name);
+  BFT_FREE(_gm->family_item);
+
+  BFT_FREE(_gm->cells);
+  BFT_FREE(_gm->faces);
+  BFT_FREE(_gm->vertex_gnum);
+  BFT_FREE(_gm->vertex_coords);
+
+  BFT_FREE(*gm);
+}
+
+/*----------------------------------------------------------------------------
+ * Get global dimensions of a mesh read from a Gmsh file.
+ *
+ * parameters:
+ *   gm                    <-- pointer to Gmsh mesh reader structure
+ *   n_g_cells             --> global number of cells
+ *   n_g_faces             --> global number of faces
+ *   n_g_vertices          --> global number of vertices
+ *   n_g_face_connect_size --> global size of face -> vertices connectivity
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_gmsh_get_dimensions(const cs_mesh_gmsh_t  *gm,
+                            cs_gnum_t             *n_g_cells,
+                            cs_gnum_t             *n_g_faces,
+                            cs_gnum_t             *n_g_vertices,
+                            cs_gnum_t             *n_g_face_connect_size)
+{
+  *n_g_cells = gm->n_g_cells;
+  *n_g_faces = gm->n_g_faces;
+  *n_g_vertices = gm->n_g_vertices;
+  *n_g_face_connect_size = gm->n_g_face_connect_size;
+}
+
+/*----------------------------------------------------------------------------
+ * Get group classes of a mesh read from a Gmsh file.
+ *
+ * Groups are defined by Gmsh physical groups of dimension 2 and 3, and
+ * a group class is defined for each elementary entity belonging to at
+ * least one physical group; group class 1 has no groups, and is used
+ * for elements not belonging to any physical group. The group ids
+ * (1 to n) of group class i are
+ * given by family_item[n_families*j + i], for j < n_max_family_items,
+ * with 0 used for padding.
+ *
+ * parameters:
+ *   gm                 <-- pointer to Gmsh mesh reader structure
+ *   n_groups           --> number of groups
+ *   group_name         --> group names
+ *   n_families         --> number of group classes
+ *   n_max_family_items --> maximum number of groups per group class
+ *   family_item        --> group ids of each group class
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_gmsh_get_group_classes(const cs_mesh_gmsh_t    *gm,
+                               int                     *n_groups,
+                               const char *const      **group_name,
+                               int                     *n_families,
+                               int                     *n_max_family_items,
+                               const int              **family_item)
+{
+  *n_groups = gm->n_groups;
+  *group_name = (const char *const *)(gm->group_name);
+  *n_families = gm->n_families;
+  *n_max_family_items = gm->n_max_family_items;
+  *family_item = gm->family_item;
+}
+
+/*----------------------------------------------------------------------------
+ * Transfer mesh data read from a Gmsh file to a mesh builder.
+ *
+ * Data is sent to the ranks owning the matching blocks of the mesh builder,
+ * and appended to data read from previous files, whose global element
+ * counts are given by the shift arguments.
+ *
+ * This function is collective.
+ *
+ * parameters:
+ *   gm                 <-- pointer to Gmsh mesh reader structure
+ *   mb                 <-> pointer to mesh builder structure
+ *   n_g_cells_shift    <-- number of cells in previous files
+ *   n_g_faces_shift    <-- number of faces in previous files
+ *   n_g_vertices_shift <-- number of vertices in previous files
+ *   gc_id_shift        <-- number of group classes in previous files
+ *   n_elts             --> number of cells, faces, face -> vertices
+ *                          connectivity values, and vertices added locally
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_gmsh_to_builder(const cs_mesh_gmsh_t  *gm,
+                        cs_mesh_builder_t     *mb,
+                        cs_gnum_t              n_g_cells_shift,
+                        cs_gnum_t              n_g_faces_shift,
+                        cs_gnum_t              n_g_vertices_shift,
+                        int                    gc_id_shift,
+                        cs_lnum_t              n_elts[4])
+{
+  const int f_stride = _FACE_DEF_SIZE;
+
+  /* Shifted data to send */
+
+  cs_gnum_t *cells, *faces, *vtx_gnum;
+  cs_real_t *vtx_coords = gm->vertex_coords;
+
+  BFT_MALLOC(cells, gm->n_cells*2, cs_gnum_t);
+  BFT_MALLOC(faces, gm->n_faces*f_stride, cs_gnum_t);
+  BFT_MALLOC(vtx_gnum, gm->n_vertices, cs_gnum_t);
+
+  for (cs_lnum_t i = 0; i < gm->n_cells; i++) {
+    cells[i*2] = gm->cells[i*2] + n_g_cells_shift;
+    cells[i*2+1] = gm->cells[i*2+1];
+    if (cells[i*2+1] > 0)
+      cells[i*2+1] += gc_id_shift;
+  }
+
+  for (cs_lnum_t i = 0; i < gm->n_faces; i++) {
+    const cs_gnum_t *f_src = gm->faces + i*f_stride;
+    cs_gnum_t *f = faces + i*f_stride;
+    f[0] = f_src[0] + n_g_faces_shift;
+    for (int j = 1; j < 3; j++)
+      f[j] = (f_src[j] > 0) ? f_src[j] + n_g_cells_shift : 0;
+    f[3] = f_src[3] + gc_id_shift;
+    f[4] = f_src[4];
+    for (int j = 5; j < f_stride; j++)
+      f[j] = (f_src[j] > 0) ? f_src[j] + n_g_vertices_shift : 0;
+  }
+
+  for (cs_lnum_t i = 0; i < gm->n_vertices; i++)
+    vtx_gnum[i] = gm->vertex_gnum[i] + n_g_vertices_shift;
+
+  cs_lnum_t n_cells = gm->n_cells;
+  cs_lnum_t n_faces = gm->n_faces;
+  cs_lnum_t n_vertices = gm->n_vertices;
+
+  /* Send data to the ranks owning the matching mesh builder blocks */
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_gnum_t *recv_gnum;
+    cs_real_t *recv_coords;
+
+    /* Cells (global numbers are interleaved with group class ids,
+       so a separate array is needed for destination ranks) */
+
+    cs_gnum_t *cell_gnum;
+    BFT_MALLOC(cell_gnum, n_cells, cs_gnum_t);
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      cell_gnum[i] = cells[i*2];
+
+    cs_all_to_all_t *d
+      = cs_all_to_all_create_from_block(n_cells, 0, cell_gnum, mb->cell_bi,
+                                        cs_glob_mpi_comm);
+    recv_gnum = cs_all_to_all_copy_array(d, CS_GNUM_TYPE, 2, false,
+                                         cells, NULL);
+    n_cells = cs_all_to_all_n_elts_dest(d);
+    cs_all_to_all_destroy(&d);
+
+    BFT_FREE(cell_gnum);
+    BFT_FREE(cells);
+    cells = recv_gnum;
+
+    /* Faces */
+
+    cs_gnum_t *face_gnum;
+    BFT_MALLOC(face_gnum, n_faces, cs_gnum_t);
+    for (cs_lnum_t i = 0; i < n_faces; i++)
+      face_gnum[i] = faces[i*f_stride];
+
+    d = cs_all_to_all_create_from_block(n_faces, 0, face_gnum, mb->face_bi,
+                                        cs_glob_mpi_comm);
+    recv_gnum = cs_all_to_all_copy_array(d, CS_GNUM_TYPE, f_stride, false,
+                                         faces, NULL);
+    n_faces = cs_all_to_all_n_elts_dest(d);
+    cs_all_to_all_destroy(&d);
+
+    BFT_FREE(face_gnum);
+    BFT_FREE(faces);
+    faces = recv_gnum;
+
+    /* Vertices */
+
+    d = cs_all_to_all_create_from_block(n_vertices, 0, vtx_gnum,
+                                        mb->vertex_bi, cs_glob_mpi_comm);
+    recv_gnum = cs_all_to_all_copy_array(d, CS_GNUM_TYPE, 1, false,
+                                         vtx_gnum, NULL);
+    recv_coords = cs_all_to_all_copy_array(d, CS_REAL_TYPE, 3, false,
+                                           vtx_coords, NULL);
+    n_vertices = cs_all_to_all_n_elts_dest(d);
+    cs_all_to_all_destroy(&d);
+
+    BFT_FREE(vtx_gnum);
+    vtx_gnum = recv_gnum;
+    vtx_coords = recv_coords;
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Cells */
+
+  const cs_gnum_t *c_range = mb->cell_bi.gnum_range;
+
+  if (mb->cell_gc_id == NULL) {
+    cs_lnum_t n = (c_range[1] > c_range[0]) ? c_range[1] - c_range[0] : 0;
+    BFT_MALLOC(mb->cell_gc_id, n, int);
+    for (cs_lnum_t i = 0; i < n; i++)
+      mb->cell_gc_id[i] = 0;
+  }
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    mb->cell_gc_id[cells[i*2] - c_range[0]] = cells[i*2 + 1];
+
+  /* Faces */
+
+  const cs_gnum_t *f_range = mb->face_bi.gnum_range;
+  const cs_lnum_t n_b_faces
+    = (f_range[1] > f_range[0]) ? f_range[1] - f_range[0] : 0;
+
+  if (mb->face_cells == NULL)
+    BFT_MALLOC(mb->face_cells, n_b_faces*2, cs_gnum_t);
+
+  if (mb->face_gc_id == NULL) {
+    BFT_MALLOC(mb->face_gc_id, n_b_faces, int);
+    for (cs_lnum_t i = 0; i < n_b_faces; i++)
+      mb->face_gc_id[i] = 0;
+  }
+
+  if (mb->face_vertices_idx == NULL) {
+    BFT_MALLOC(mb->face_vertices_idx, n_b_faces + 1, cs_lnum_t);
+    mb->face_vertices_idx[0] = 0;
+  }
+
+  /* Local range of faces from this file */
+
+  cs_lnum_t f_s_id = 0;
+  if (n_g_faces_shift + 1 > f_range[0])
+    f_s_id = CS_MIN(n_g_faces_shift + 1 - f_range[0], (cs_gnum_t)n_b_faces);
+
+  cs_lnum_t *face_vertices_idx = mb->face_vertices_idx;
+
+  for (cs_lnum_t i = 0; i < n_faces; i++) {
+    const cs_gnum_t *f = faces + i*f_stride;
+    cs_lnum_t f_id = f[0] - f_range[0];
+    mb->face_cells[f_id*2] = f[1];
+    mb->face_cells[f_id*2 + 1] = f[2];
+    mb->face_gc_id[f_id] = f[3];
+    face_vertices_idx[f_id + 1] = f[4];
+  }
+
+  for (cs_lnum_t i = f_s_id; i < f_s_id + n_faces; i++)
+    face_vertices_idx[i+1] += face_vertices_idx[i];
+
+  cs_lnum_t n_face_connect = face_vertices_idx[f_s_id + n_faces]
+                             - face_vertices_idx[f_s_id];
+
+  BFT_REALLOC(mb->face_vertices,
+              face_vertices_idx[f_s_id + n_faces],
+              cs_gnum_t);
+
+  for (cs_lnum_t i = 0; i < n_faces; i++) {
+    const cs_gnum_t *f = faces + i*f_stride;
+    cs_lnum_t f_id = f[0] - f_range[0];
+    cs_gnum_t *f_vtx = mb->face_vertices + face_vertices_idx[f_id];
+    for (cs_gnum_t j = 0; j < f[4]; j++)
+      f_vtx[j] = f[5+j];
+  }
+
+  /* Vertices */
+
+  const cs_gnum_t *v_range = mb->vertex_bi.gnum_range;
+
+  if (mb->vertex_coords == NULL) {
+    cs_lnum_t n = (v_range[1] > v_range[0]) ? v_range[1] - v_range[0] : 0;
+    BFT_MALLOC(mb->vertex_coords, n*3, cs_real_t);
+  }
+
+  for (cs_lnum_t i = 0; i < n_vertices; i++) {
+    cs_lnum_t v_id = vtx_gnum[i] - v_range[0];
+    for (int j = 0; j < 3; j++)
+      mb->vertex_coords[v_id*3 + j] = vtx_coords[i*3 + j];
+  }
+
+  /* Free temporary data */
+
+  if (vtx_coords != gm->vertex_coords)
+    BFT_FREE(vtx_coords);
+  BFT_FREE(vtx_gnum);
+  BFT_FREE(faces);
+  BFT_FREE(cells);
+
+  n_elts[0] = n_cells;
+  n_elts[1] = n_faces;
+  n_elts[2] = n_face_connect;
+  n_elts[3] = n_vertices;
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,242 @@
+#ifndef __CS_MESH_GMSH_H__
+#define __CS_MESH_GMSH_H__
+
+/*============================================================================
+ * Direct parallel reading of Gmsh mesh files
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_base.h"
+#include "cs_mesh_builder.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Opaque Gmsh mesh reader structure */
+
+typedef struct _cs_mesh_gmsh_t  cs_mesh_gmsh_t;
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Check if a mesh file should be read as a Gmsh file.
+ *
+ * parameters:
+ *   path <-- mesh file path
+ *
+ * returns:
+ *   true if the file has a ".msh" extension, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_gmsh_is_gmsh_file(const char  *path);
+
+/*----------------------------------------------------------------------------
+ * Read a Gmsh (format 4.1, ASCII or binary) mesh file and build its faces.
+ *
+ * Each rank opens the file and keeps only its block of the file's nodes,
+ * volume elements, and surface elements. In binary files, data outside
+ * that block is skipped by seeking. ASCII files cannot be skipped through,
+ * so they are parsed entirely by every rank; when running on several
+ * ranks, ASCII files larger than 64 MiB are rejected, and should be
+ * converted to binary.
+ * Faces are then built in parallel, using a distribution based on their
+ * vertices, so that the resulting face numbering does not depend on the
+ * number of ranks.
+ *
+ * This function is collective.
+ *
+ * parameters:
+ *   path <-- mesh file path
+ *
+ * returns:
+ *   pointer to Gmsh mesh reader structure
+ *----------------------------------------------------------------------------*/
+
+cs_mesh_gmsh_t *
+cs_mesh_gmsh_read(const char  *path);
+
+/*----------------------------------------------------------------------------
+ * Create a mesh reader structure from elements read by another reader,
+ * and build its faces.
+ *
+ * Element vertices follow the Gmsh (and CGNS) local numbering of linear
+ * tetrahedra, pyramids, prisms and hexahedra, and cells are numbered
+ * in rank order. Groups and group classes are defined as described for
+ * cs_mesh_gmsh_get_group_classes().
+ *
+ * Ownership of all arrays is transferred to this function; vertex and
+ * group arrays are kept in the returned structure, and others are freed.
+ *
+ * This function is collective.
+ *
+ * parameters:
+ *   n_g_vertices       <-- global number of vertices
+ *   n_vertices         <-- number of local vertices
+ *   vertex_gnum        <-- global numbers of local vertices
+ *   vertex_coords      <-- coordinates of local vertices
+ *   n_cells            <-- number of local cells
+ *   cell_n_vtx         <-- number of vertices of local cells
+ *   cell_vtx           <-- vertices of local cells (stride 8)
+ *   cell_family        <-- family of local cells
+ *   n_b_elts           <-- number of local boundary elements
+ *   b_n_vtx            <-- number of vertices of local boundary elements
+ *   b_vtx              <-- vertices of local boundary elements (stride 8)
+ *   b_family           <-- family of local boundary elements
+ *   n_groups           <-- number of groups
+ *   group_name         <-- group names
+ *   n_families         <-- number of group classes
+ *   n_max_family_items <-- maximum number of groups per group class
+ *   family_item        <-- group ids of each group class
+ *
+ * returns:
+ *   pointer to mesh reader structure
+ *----------------------------------------------------------------------------*/
+
+cs_mesh_gmsh_t *
+cs_mesh_gmsh_create_from_elements(cs_gnum_t    n_g_vertices,
+                                  cs_lnum_t    n_vertices,
+                                  cs_gnum_t   *vertex_gnum,
+                                  cs_real_t   *vertex_coords,
+                                  cs_lnum_t    n_cells,
+                                  short int   *cell_n_vtx,
+                                  cs_gnum_t   *cell_vtx,
+                                  int         *cell_family,
+                                  cs_lnum_t    n_b_elts,
+                                  short int   *b_n_vtx,
+                                  cs_gnum_t   *b_vtx,
+                                  int         *b_family,
+                                  int          n_groups,
+                                  char       **group_name,
+                                  int          n_families,
+                                  int          n_max_family_items,
+                                  int         *family_item);
+
+/*----------------------------------------------------------------------------
+ * Destroy a Gmsh mesh reader structure.
+ *
+ * parameters:
+ *   gm <-> pointer to Gmsh mesh reader structure pointer
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_gmsh_destroy(cs_mesh_gmsh_t  **gm);
+
+/*----------------------------------------------------------------------------
+ * Get global dimensions of a mesh read from a Gmsh file.
+ *
+ * parameters:
+ *   gm                    <-- pointer to Gmsh mesh reader structure
+ *   n_g_cells             --> global number of cells
+ *   n_g_faces             --> global number of faces
+ *   n_g_vertices          --> global number of vertices
+ *   n_g_face_connect_size --> global size of face -> vertices connectivity
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_gmsh_get_dimensions(const cs_mesh_gmsh_t  *gm,
+                            cs_gnum_t             *n_g_cells,
+                            cs_gnum_t             *n_g_faces,
+                            cs_gnum_t             *n_g_vertices,
+                            cs_gnum_t             *n_g_face_connect_size);
+
+/*----------------------------------------------------------------------------
+ * Get group classes of a mesh read from a Gmsh file.
+ *
+ * Groups are defined by Gmsh physical groups of dimension 2 and 3, and
+ * a group class is defined for each elementary entity belonging to at
+ * least one physical group; group class 1 has no groups, and is used
+ * for elements not belonging to any physical group. The group ids
+ * (1 to n) of group class i are
+ * given by family_item[n_families*j + i], for j < n_max_family_items,
+ * with 0 used for padding.
+ *
+ * parameters:
+ *   gm                 <-- pointer to Gmsh mesh reader structure
+ *   n_groups           --> number of groups
+ *   group_name         --> group names
+ *   n_families         --> number of group classes
+ *   n_max_family_items --> maximum number of groups per group class
+ *   family_item        --> group ids of each group class
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_gmsh_get_group_classes(const cs_mesh_gmsh_t    *gm,
+                               int                     *n_groups,
+                               const char *const      **group_name,
+                               int                     *n_families,
+                               int                     *n_max_family_items,
+                               const int              **family_item);
+
+/*----------------------------------------------------------------------------
+ * Transfer mesh data read from a Gmsh file to a mesh builder.
+ *
+ * Data is sent to the ranks owning the matching blocks of the mesh builder,
+ * and appended to data read from previous files, whose global element
+ * counts are given by the shift arguments.
+ *
+ * This function is collective.
+ *
+ * parameters:
+ *   gm                 <-- pointer to Gmsh mesh reader structure
+ *   mb                 <-> pointer to mesh builder structure
+ *   n_g_cells_shift    <-- number of cells in previous files
+ *   n_g_faces_shift    <-- number of faces in previous files
+ *   n_g_vertices_shift <-- number of vertices in previous files
+ *   gc_id_shift        <-- number of group classes in previous files
+ *   n_elts             --> number of cells, faces, face -> vertices
+ *                          connectivity values, and vertices added locally
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_gmsh_to_builder(const cs_mesh_gmsh_t  *gm,
+                        cs_mesh_builder_t     *mb,
+                        cs_gnum_t              n_g_cells_shift,
+                        cs_gnum_t              n_g_faces_shift,
+                        cs_gnum_t              n_g_vertices_shift,
+                        int                    gc_id_shift,
+                        cs_lnum_t              n_elts[4]);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MESH_GMSH_H__ */
@@ -41,16 +41,20 @@
 #include "cs_join_update.h"
 #include "cs_join_util.h"
 #include "cs_mesh.h"
+#include "cs_mesh_adapt.h"
 #include "cs_mesh_adjacencies.h"
 #include "cs_mesh_bad_cells.h"
 #include "cs_mesh_boundary.h"
 #include "cs_mesh_boundary_layer.h"
 #include "cs_mesh_builder.h"
+#include "cs_mesh_cache.h"
+#include "cs_mesh_cgns.h"
 #include "cs_mesh_coarsen.h"
 #include "cs_mesh_coherency.h"
 #include "cs_mesh_connect.h"
 #include "cs_mesh_extrude.h"
 #include "cs_mesh_from_builder.h"
+#include "cs_mesh_gmsh.h"
 #include "cs_mesh_group.h"
 #include "cs_mesh_halo.h"
 #include "cs_mesh_location.h"
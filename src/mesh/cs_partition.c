@@ -93,12 +93,17 @@ extern "C" {
 #include "cs_block_dist.h"
 #include "cs_block_to_part.h"
 #include "cs_file.h"
+#include "cs_halo.h"
 #include "cs_io.h"
 #include "cs_log.h"
 #include "cs_mesh.h"
 #include "cs_mesh_builder.h"
+#include "cs_mesh_quantities.h"
 #include "cs_order.h"
+#include "cs_parall.h"
 #include "cs_part_to_block.h"
+#include "cs_renumber.h"
+#include "cs_time_step.h"
 #include "cs_timer.h"
 
 /*----------------------------------------------------------------------------
@@ -186,6 +191,28 @@ BEGIN_C_DECLS
 
 typedef double  _vtx_coords_t[3];
 
+/* Cell adjacency graph for partition refinement */
+
+typedef struct {
+
+  cs_gnum_t         start_cell;      /* first global cell number of block */
+  cs_lnum_t         n_cells;         /* number of cells in local block */
+  cs_lnum_t         n_ghosts;        /* number of adjacent cells outside
+                                        local block */
+
+  cs_lnum_t        *cell_idx;        /* cell -> cells index */
+  cs_lnum_t        *cell_neighbors;  /* cell -> cells adjacency (local id,
+                                        or n_cells + ghost cell id) */
+
+#if defined(HAVE_MPI)
+  cs_all_to_all_t  *d;               /* distributor for ghost cell values */
+  cs_lnum_t         n_recv;          /* number of values sent to others */
+  cs_gnum_t        *recv_gnum;       /* global numbers of values sent */
+  int              *send_buf;        /* buffer for values sent */
+#endif
+
+} _refine_graph_t;
+
 /*============================================================================
  * Public function prototypes
  *============================================================================*/
@@ -210,6 +237,19 @@ static int                       *_part_extra_partitions_list = NULL;
 
 static bool                       _part_uniform_sfc_block_size = false;
 
+static int                        _part_sfc_refine_n_passes = 0;
+static double                     _part_sfc_refine_tolerance = 0.05;
+static bool                       _part_hierarchical = false;
+static cs_lnum_t                  _part_thread_block_size = 0;
+
+static int                        _part_balance_interval = 0;
+static double                     _part_balance_threshold = 0.2;
+static bool                       _part_balance_stop = false;
+static int                        _part_balance_n_steps = -1;
+static cs_timer_t                 _part_balance_t_ref;
+static double                     _part_balance_wait_ref = 0;
+static cs_partition_cell_work_t  *_part_balance_cell_work = NULL;
+
 #if defined(WIN32) || defined(_WIN32)
 static const char _dir_separator = '\\';
 #else
@@ -267,6 +307,83 @@ _init_reduced_communicator(int  part_step)
   return part_comm;
 }
 
+/*----------------------------------------------------------------------------
+ * Determine the compute node of each rank.
+ *
+ * Nodes are numbered in increasing order of their lowest rank.
+ *
+ * parameters:
+ *   n_nodes --> number of compute nodes
+ *
+ * returns:
+ *   compute node id of each rank (size: cs_glob_n_ranks)
+ *----------------------------------------------------------------------------*/
+
+static int *
+_rank_node_ids(int  *n_nodes)
+{
+  int rank_id = cs_glob_rank_id, node_leader = cs_glob_rank_id;
+  int *rank_node, *leader_node;
+
+  const int n_ranks = cs_glob_n_ranks;
+
+  /* Determine lowest rank on the same node */
+
+#if defined(MPI_VERSION) && (MPI_VERSION >= 3)
+
+  MPI_Comm node_comm;
+
+  MPI_Comm_split_type(cs_glob_mpi_comm, MPI_COMM_TYPE_SHARED, rank_id,
+                      MPI_INFO_NULL, &node_comm);
+  MPI_Allreduce(&rank_id, &node_leader, 1, MPI_INT, MPI_MIN, node_comm);
+  MPI_Comm_free(&node_comm);
+
+#else
+
+  int name_len;
+  char name[MPI_MAX_PROCESSOR_NAME], *names;
+
+  memset(name, 0, MPI_MAX_PROCESSOR_NAME);
+  MPI_Get_processor_name(name, &name_len);
+
+  BFT_MALLOC(names, MPI_MAX_PROCESSOR_NAME*n_ranks, char);
+
+  MPI_Allgather(name, MPI_MAX_PROCESSOR_NAME, MPI_CHAR,
+                names, MPI_MAX_PROCESSOR_NAME, MPI_CHAR, cs_glob_mpi_comm);
+
+  for (int i = 0; i < n_ranks; i++) {
+    if (strncmp(name, names + i*MPI_MAX_PROCESSOR_NAME,
+                MPI_MAX_PROCESSOR_NAME) == 0) {
+      node_leader = i;
+      break;
+    }
+  }
+
+  BFT_FREE(names);
+
+#endif
+
+  BFT_MALLOC(rank_node, n_ranks, int);
+  BFT_MALLOC(leader_node, n_ranks, int);
+
+  MPI_Allgather(&node_leader, 1, MPI_INT, rank_node, 1, MPI_INT,
+                cs_glob_mpi_comm);
+
+  /* Leader ranks are lower than or equal to the ranks they represent */
+
+  *n_nodes = 0;
+
+  for (int i = 0; i < n_ranks; i++) {
+    if (rank_node[i] == i)
+      leader_node[i] = (*n_nodes)++;
+    rank_node[i] = leader_node[rank_node[i]];
+  }
+
+  BFT_FREE(leader_node);
+
+  return rank_node;
+}
+
 #endif /* defined(HAVE_MPI) */
 
 /*----------------------------------------------------------------------------
@@ -1056,19 +1173,733 @@ _cell_rank_by_sfc(cs_gnum_t                 n_g_cells,
 
   }
 
-  cell_io_num = fvm_io_num_destroy(cell_io_num);
+  cell_io_num = fvm_io_num_destroy(cell_io_num);
+
+  end_time = cs_timer_time();
+  dt = cs_timer_diff(&start_time, &end_time);
+
+  if (sfc_type < FVM_IO_NUM_SFC_HILBERT_BOX)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("  Morton (Z) curve:           %.3g s\n"),
+                  (double)(dt.wall_nsec)/1.e9);
+  else
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("  Peano-Hilbert curve:        %.3g s\n"),
+                  (double)(dt.wall_nsec)/1.e9);
+}
+
+/*----------------------------------------------------------------------------
+ * Build local cell -> cells adjacency for partition refinement.
+ *
+ * Cells are those of the mesh builder's cell block. Neighbors belonging
+ * to the same block are referenced by their local id, and others by
+ * n_cells + their id in the ordered list of "ghost" cells.
+ *
+ * parameters:
+ *   mb             <-- pointer to mesh builder structure
+ *   n_ghosts       --> number of adjacent cells outside local block
+ *   ghost_gnum     --> global numbers of adjacent cells outside local block
+ *   cell_idx       --> cell -> cells index
+ *   cell_neighbors --> cell -> cells adjacency
+ *----------------------------------------------------------------------------*/
+
+static void
+_refine_cell_cells(const cs_mesh_builder_t   *mb,
+                   cs_lnum_t                 *n_ghosts,
+                   cs_gnum_t                **ghost_gnum,
+                   cs_lnum_t                **cell_idx,
+                   cs_lnum_t                **cell_neighbors)
+{
+  cs_lnum_t i, j;
+
+  cs_lnum_t n_faces = 0, _n_ghosts = 0;
+  cs_gnum_t *face_cells = mb->face_cells;
+  cs_gnum_t *nbr_gnum = NULL, *_ghost_gnum = NULL;
+  cs_lnum_t *_cell_idx = NULL, *_cell_neighbors = NULL;
+
+  const cs_gnum_t start_cell = mb->cell_bi.gnum_range[0];
+  const cs_lnum_t n_cells = mb->cell_bi.gnum_range[1] - start_cell;
+
+  /* Distribute faces to ranks owning adjacent cells */
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_all_to_all_t
+      *d = cs_block_to_part_create_by_adj_s(cs_glob_mpi_comm,
+                                            mb->face_bi,
+                                            mb->cell_bi,
+                                            2,
+                                            mb->face_cells,
+                                            NULL,
+                                            NULL,
+                                            &n_faces,
+                                            NULL);
+
+    BFT_MALLOC(face_cells, n_faces*2, cs_gnum_t);
+
+    cs_all_to_all_copy_array(d,
+                             CS_GNUM_TYPE,
+                             2,
+                             true,  /* reverse */
+                             mb->face_cells,
+                             face_cells);
+
+    cs_all_to_all_destroy(&d);
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (cs_glob_n_ranks == 1)
+    n_faces = mb->n_g_faces;
+
+  /* Count and build adjacency using global numbers */
+
+  BFT_MALLOC(_cell_idx, n_cells + 1, cs_lnum_t);
+
+  for (i = 0; i < n_cells + 1; i++)
+    _cell_idx[i] = 0;
+
+  for (i = 0; i < n_faces; i++) {
+    cs_gnum_t c_num[2] = {face_cells[i*2], face_cells[i*2 + 1]};
+    if (c_num[0] == 0 || c_num[1] == 0 || c_num[0] == c_num[1])
+      continue;
+    for (j = 0; j < 2; j++) {
+      if (c_num[j] >= start_cell && c_num[j] - start_cell < (cs_gnum_t)n_cells)
+        _cell_idx[c_num[j] - start_cell + 1] += 1;
+    }
+  }
+
+  for (i = 0; i < n_cells; i++)
+    _cell_idx[i+1] += _cell_idx[i];
+
+  BFT_MALLOC(nbr_gnum, _cell_idx[n_cells], cs_gnum_t);
+  BFT_MALLOC(_ghost_gnum, _cell_idx[n_cells], cs_gnum_t);
+
+  for (i = 0; i < n_faces; i++) {
+    cs_gnum_t c_num[2] = {face_cells[i*2], face_cells[i*2 + 1]};
+    if (c_num[0] == 0 || c_num[1] == 0 || c_num[0] == c_num[1])
+      continue;
+    for (j = 0; j < 2; j++) {
+      cs_gnum_t c_nbr = c_num[(j+1)%2];
+      if (c_num[j] >= start_cell && c_num[j] - start_cell < (cs_gnum_t)n_cells) {
+        cs_lnum_t c_id = c_num[j] - start_cell;
+        nbr_gnum[_cell_idx[c_id]] = c_nbr;
+        _cell_idx[c_id] += 1;
+        if (c_nbr < start_cell || c_nbr - start_cell >= (cs_gnum_t)n_cells)
+          _ghost_gnum[_n_ghosts++] = c_nbr;
+      }
+    }
+  }
+
+  for (i = n_cells; i > 0; i--)
+    _cell_idx[i] = _cell_idx[i-1];
+  _cell_idx[0] = 0;
+
+  if (face_cells != mb->face_cells)
+    BFT_FREE(face_cells);
+
+  /* Order and compact ghost cell numbers */
+
+  if (_n_ghosts > 0) {
+
+    cs_lnum_t *order = cs_order_gnum(NULL, _ghost_gnum, _n_ghosts);
+    cs_gnum_t *tmp_gnum;
+
+    BFT_MALLOC(tmp_gnum, _n_ghosts, cs_gnum_t);
+
+    j = 0;
+    for (i = 0; i < _n_ghosts; i++) {
+      cs_gnum_t g = _ghost_gnum[order[i]];
+      if (j == 0 || g != tmp_gnum[j-1])
+        tmp_gnum[j++] = g;
+    }
+    _n_ghosts = j;
+
+    BFT_FREE(order);
+    BFT_FREE(_ghost_gnum);
+
+    _ghost_gnum = tmp_gnum;
+  }
+
+  BFT_REALLOC(_ghost_gnum, _n_ghosts, cs_gnum_t);
+
+  /* Switch to local adjacency */
+
+  BFT_MALLOC(_cell_neighbors, _cell_idx[n_cells], cs_lnum_t);
+
+  for (i = 0; i < _cell_idx[n_cells]; i++) {
+    cs_gnum_t g = nbr_gnum[i];
+    if (g >= start_cell && g - start_cell < (cs_gnum_t)n_cells)
+      _cell_neighbors[i] = g - start_cell;
+    else {
+      cs_lnum_t start_id = 0, end_id = _n_ghosts;
+      while (start_id < end_id) {
+        cs_lnum_t mid_id = start_id + (end_id - start_id)/2;
+        if (_ghost_gnum[mid_id] < g)
+          start_id = mid_id + 1;
+        else
+          end_id = mid_id;
+      }
+      assert(start_id < _n_ghosts && _ghost_gnum[start_id] == g);
+      _cell_neighbors[i] = n_cells + start_id;
+    }
+  }
+
+  BFT_FREE(nbr_gnum);
+
+  *n_ghosts = _n_ghosts;
+  *ghost_gnum = _ghost_gnum;
+  *cell_idx = _cell_idx;
+  *cell_neighbors = _cell_neighbors;
+}
+
+/*----------------------------------------------------------------------------
+ * Build cell adjacency graph for partition refinement.
+ *
+ * parameters:
+ *   mb <-- pointer to mesh builder structure
+ *
+ * returns:
+ *   pointer to new graph structure
+ *----------------------------------------------------------------------------*/
+
+static _refine_graph_t *
+_refine_graph_create(const cs_mesh_builder_t  *mb)
+{
+  cs_gnum_t *ghost_gnum = NULL;
+
+  _refine_graph_t *g;
+
+  BFT_MALLOC(g, 1, _refine_graph_t);
+
+  g->start_cell = mb->cell_bi.gnum_range[0];
+  g->n_cells = mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0];
+
+  _refine_cell_cells(mb,
+                     &(g->n_ghosts),
+                     &ghost_gnum,
+                     &(g->cell_idx),
+                     &(g->cell_neighbors));
+
+#if defined(HAVE_MPI)
+
+  g->d = NULL;
+  g->n_recv = 0;
+  g->recv_gnum = NULL;
+  g->send_buf = NULL;
+
+  if (cs_glob_n_ranks > 1) {
+
+    g->d = cs_all_to_all_create_from_block(g->n_ghosts,
+                                           0, /* flags */
+                                           ghost_gnum,
+                                           mb->cell_bi,
+                                           cs_glob_mpi_comm);
+
+    g->recv_gnum = cs_all_to_all_copy_array(g->d,
+                                            CS_GNUM_TYPE,
+                                            1,
+                                            false, /* reverse */
+                                            ghost_gnum,
+                                            NULL);
+
+    g->n_recv = cs_all_to_all_n_elts_dest(g->d);
+
+    BFT_MALLOC(g->send_buf, g->n_recv, int);
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  BFT_FREE(ghost_gnum);
+
+  return g;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy cell adjacency graph for partition refinement.
+ *
+ * parameters:
+ *   g <-> pointer to graph structure pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_refine_graph_destroy(_refine_graph_t  **g)
+{
+  _refine_graph_t *_g = *g;
+
+#if defined(HAVE_MPI)
+  if (_g->d != NULL) {
+    BFT_FREE(_g->send_buf);
+    BFT_FREE(_g->recv_gnum);
+    cs_all_to_all_destroy(&(_g->d));
+  }
+#endif
+
+  BFT_FREE(_g->cell_neighbors);
+  BFT_FREE(_g->cell_idx);
+
+  BFT_FREE(*g);
+}
+
+/*----------------------------------------------------------------------------
+ * Update values of ghost cells of a partition refinement graph.
+ *
+ * parameters:
+ *   g   <-> pointer to graph structure
+ *   val <-> values for local cells, followed by those of ghost cells
+ *----------------------------------------------------------------------------*/
+
+static void
+_refine_graph_sync(_refine_graph_t  *g,
+                   int               val[])
+{
+#if defined(HAVE_MPI)
+  if (g->d != NULL) {
+    for (cs_lnum_t i = 0; i < g->n_recv; i++)
+      g->send_buf[i] = val[g->recv_gnum[i] - g->start_cell];
+    cs_all_to_all_copy_array(g->d,
+                             CS_INT_TYPE,
+                             1,
+                             true, /* reverse */
+                             g->send_buf,
+                             val + g->n_cells);
+  }
+#else
+  CS_UNUSED(g);
+  CS_UNUSED(val);
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the global number of interior faces on partition boundaries.
+ *
+ * parameters:
+ *   g    <-- pointer to graph structure
+ *   part <-- partition of local and ghost cells
+ *
+ * returns:
+ *   global number of interior faces separating 2 partitions
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_refine_edge_cut(const _refine_graph_t  *g,
+                 const int               part[])
+{
+  cs_gnum_t n_cut[2] = {0, 0};
+
+  for (cs_lnum_t i = 0; i < g->n_cells; i++) {
+    for (cs_lnum_t j = g->cell_idx[i]; j < g->cell_idx[i+1]; j++) {
+      cs_lnum_t k = g->cell_neighbors[j];
+      if (part[k] != part[i]) {
+        if (k < g->n_cells)
+          n_cut[0] += 1; /* counted from both sides */
+        else
+          n_cut[1] += 1; /* counted once on each rank */
+      }
+    }
+  }
+
+  cs_parall_counter(n_cut, 2);
+
+  return n_cut[0]/2 + n_cut[1]/2;
+}
+
+/*----------------------------------------------------------------------------
+ * Refine a partitioning using boundary Kernighan-Lin /
+ * Fiduccia-Mattheyses type passes.
+ *
+ * At each pass, cells adjacent to another partition are moved to the
+ * partition to which they have the most faces, if this reduces the number
+ * of faces on partition boundaries, or does not change it and improves
+ * load balance. To avoid oscillations in parallel, moves are only allowed
+ * from lower to higher partitions on even passes, and from higher to
+ * lower partitions on odd passes. Moves are accepted in order of
+ * decreasing gain, as long as partition sizes remain within the
+ * imbalance tolerance.
+ *
+ * The target size of each partition is proportional to its weight.
+ * If partition groups are given, cells may only move between partitions
+ * of the same group.
+ *
+ * parameters:
+ *   g           <-- pointer to graph structure
+ *   n_g_cells   <-- global number of cells
+ *   n_parts     <-- number of partitions
+ *   part_weight <-- weight of each partition, or NULL for uniform weights
+ *   part_group  <-- group of each partition, or NULL
+ *   part        <-> partition of local and ghost cells (0 to n-1)
+ *   n_cut       --> global number of faces on partition boundaries,
+ *                   before and after refinement
+ *
+ * returns:
+ *   number of passes done
+ *----------------------------------------------------------------------------*/
+
+static int
+_refine_partition(_refine_graph_t  *g,
+                  cs_gnum_t         n_g_cells,
+                  int               n_parts,
+                  const int         part_weight[],
+                  const int         part_group[],
+                  int               part[],
+                  cs_gnum_t         n_cut[2])
+{
+  cs_lnum_t i, j;
+
+  int n_passes = 0;
+
+  const cs_lnum_t n_cells = g->n_cells;
+  const cs_lnum_t *cell_idx = g->cell_idx;
+  const cs_lnum_t *cell_neighbors = g->cell_neighbors;
+
+  /* Work arrays */
+
+  cs_gnum_t *part_size, *max_size, *min_size, *n_g_in, *n_g_out;
+  cs_lnum_t *n_in, *n_out;
+  double *part_inv_w;
+  cs_lnum_t *cand_cell, *cand_part;
+  cs_lnum_t *order;
+  cs_gnum_t *cand_key;
+
+  BFT_MALLOC(part_size, n_parts, cs_gnum_t);
+  BFT_MALLOC(max_size, n_parts, cs_gnum_t);
+  BFT_MALLOC(min_size, n_parts, cs_gnum_t);
+  BFT_MALLOC(n_g_in, n_parts, cs_gnum_t);
+  BFT_MALLOC(n_g_out, n_parts, cs_gnum_t);
+  BFT_MALLOC(n_in, n_parts, cs_lnum_t);
+  BFT_MALLOC(n_out, n_parts, cs_lnum_t);
+  BFT_MALLOC(part_inv_w, n_parts, double);
+
+  BFT_MALLOC(cand_cell, n_cells, cs_lnum_t);
+  BFT_MALLOC(cand_part, n_cells, cs_lnum_t);
+  BFT_MALLOC(cand_key, n_cells*2, cs_gnum_t);
+  BFT_MALLOC(order, n_cells, cs_lnum_t);
+
+  /* Allowed partition sizes */
+
+  {
+    double w_tot = 0;
+    for (int p = 0; p < n_parts; p++)
+      w_tot += (part_weight != NULL) ? part_weight[p] : 1;
+
+    for (int p = 0; p < n_parts; p++) {
+      double w = (part_weight != NULL) ? part_weight[p] : 1;
+      double target = (double)n_g_cells * w / w_tot;
+      max_size[p] = target * (1. + _part_sfc_refine_tolerance);
+      min_size[p] = target * (1. - _part_sfc_refine_tolerance);
+      if ((double)max_size[p] < target)
+        max_size[p] += 1;
+      if (min_size[p] < 1)
+        min_size[p] = 1;
+      part_inv_w[p] = 1. / w;
+    }
+  }
+
+  _refine_graph_sync(g, part);
+
+  n_cut[0] = _refine_edge_cut(g, part);
+  n_cut[1] = n_cut[0];
+
+  int n_idle = 0;
+
+  for (int pass_id = 0;
+       pass_id < _part_sfc_refine_n_passes && n_idle < 2;
+       pass_id++) {
+
+    const int up = (pass_id % 2 == 0) ? 1 : 0;
+
+    /* Current partition sizes */
+
+    for (int p = 0; p < n_parts; p++) {
+      part_size[p] = 0;
+      n_in[p] = 0;
+      n_out[p] = 0;
+    }
+
+    for (i = 0; i < n_cells; i++)
+      part_size[part[i]] += 1;
+
+    cs_parall_counter(part_size, n_parts);
+
+    /* Select candidate cells and their best target partition */
+
+    cs_lnum_t n_cand = 0, max_gain = 0;
+
+    for (i = 0; i < n_cells; i++) {
+
+      const int p = part[i];
+      cs_lnum_t n_p = 0;
+
+      for (j = cell_idx[i]; j < cell_idx[i+1]; j++) {
+        if (part[cell_neighbors[j]] == p)
+          n_p++;
+      }
+
+      if (n_p == cell_idx[i+1] - cell_idx[i])
+        continue;
+
+      int q_best = -1;
+      cs_lnum_t gain_best = 0;
+
+      for (j = cell_idx[i]; j < cell_idx[i+1]; j++) {
+        const int q = part[cell_neighbors[j]];
+        if (q == p || (q > p) != up || q == q_best)
+          continue;
+        if (part_group != NULL && part_group[q] != part_group[p])
+          continue;
+        cs_lnum_t n_q = 0;
+        for (cs_lnum_t k = cell_idx[i]; k < cell_idx[i+1]; k++) {
+          if (part[cell_neighbors[k]] == q)
+            n_q++;
+        }
+        cs_lnum_t gain = n_q - n_p;
+        if (q_best < 0 || gain > gain_best || (gain == gain_best && q < q_best)) {
+          q_best = q;
+          gain_best = gain;
+        }
+      }
+
+      if (q_best < 0 || gain_best < 0)
+        continue;
+      if (   gain_best == 0
+          &&    part_size[p] * part_inv_w[p]
+             <= (part_size[q_best] + 1) * part_inv_w[q_best])
+        continue;
+
+      cand_cell[n_cand] = i;
+      cand_part[n_cand] = q_best;
+      cand_key[n_cand*2] = gain_best;
+      cand_key[n_cand*2 + 1] = i;
+      if (gain_best > max_gain)
+        max_gain = gain_best;
+      n_in[q_best] += 1;
+      n_out[p] += 1;
+      n_cand++;
+    }
+
+    /* Local quotas ensuring global sizes remain in allowed range */
+
+    for (int p = 0; p < n_parts; p++) {
+      n_g_in[p] = n_in[p];
+      n_g_out[p] = n_out[p];
+    }
+
+    cs_parall_counter(n_g_in, n_parts);
+    cs_parall_counter(n_g_out, n_parts);
+
+    for (int p = 0; p < n_parts; p++) {
+      cs_gnum_t cap_in = (max_size[p] > part_size[p]) ?
+        max_size[p] - part_size[p] : 0;
+      cs_gnum_t cap_out = (part_size[p] > min_size[p]) ?
+        part_size[p] - min_size[p] : 0;
+      if (n_g_in[p] > cap_in)
+        n_in[p] = ((double)n_in[p] * (double)cap_in) / (double)n_g_in[p];
+      if (n_g_out[p] > cap_out)
+        n_out[p] = ((double)n_out[p] * (double)cap_out) / (double)n_g_out[p];
+    }
+
+    /* Accept moves by decreasing gain, then increasing cell number */
+
+    for (j = 0; j < n_cand; j++)
+      cand_key[j*2] = max_gain - cand_key[j*2];
+
+    cs_order_gnum_allocated_s(NULL, cand_key, 2, order, n_cand);
+
+    cs_gnum_t n_moved = 0;
+
+    for (j = 0; j < n_cand; j++) {
+      cs_lnum_t k = order[j];
+      i = cand_cell[k];
+      const int p = part[i], q = cand_part[k];
+      if (n_in[q] > 0 && n_out[p] > 0) {
+        n_in[q] -= 1;
+        n_out[p] -= 1;
+        part[i] = q;
+        cand_part[k] = p;
+        n_moved++;
+      }
+      else
+        cand_part[k] = -1;
+    }
+
+    cs_parall_counter(&n_moved, 1);
+
+    n_passes++;
+
+    if (n_moved == 0) {
+      n_idle++;
+      continue;
+    }
+    n_idle = 0;
+
+    _refine_graph_sync(g, part);
+
+    /* Simultaneous moves of adjacent cells may make gains obsolete;
+       revert the last pass and stop if it did not improve the cut */
+
+    cs_gnum_t n_cut_new = _refine_edge_cut(g, part);
+
+    if (n_cut_new > n_cut[1]) {
+      for (j = 0; j < n_cand; j++) {
+        if (cand_part[j] > -1)
+          part[cand_cell[j]] = cand_part[j];
+      }
+      _refine_graph_sync(g, part);
+      break;
+    }
+
+    n_cut[1] = n_cut_new;
+  }
+
+  BFT_FREE(order);
+  BFT_FREE(cand_key);
+  BFT_FREE(cand_part);
+  BFT_FREE(cand_cell);
+
+  BFT_FREE(part_inv_w);
+  BFT_FREE(n_out);
+  BFT_FREE(n_in);
+  BFT_FREE(n_g_out);
+  BFT_FREE(n_g_in);
+  BFT_FREE(min_size);
+  BFT_FREE(max_size);
+  BFT_FREE(part_size);
+
+  return n_passes;
+}
+
+/*----------------------------------------------------------------------------
+ * Refine a space-filling curve partitioning.
+ *
+ * If the compute node of each partition is given, partitions are first
+ * refined at the node level, then at the rank level within each node.
+ *
+ * parameters:
+ *   n_g_cells   <-- global number of cells
+ *   n_parts     <-- number of partitions
+ *   mb          <-- pointer to mesh builder helper structure
+ *   n_nodes     <-- number of compute nodes
+ *   part_node   <-- compute node id of each partition, or NULL
+ *   cell_part   <-> cell partition (0 to n-1 numbering)
+ *----------------------------------------------------------------------------*/
+
+static void
+_refine_sfc_partition(cs_gnum_t                 n_g_cells,
+                      int                       n_parts,
+                      const cs_mesh_builder_t  *mb,
+                      int                       n_nodes,
+                      const int                 part_node[],
+                      int                       cell_part[])
+{
+  cs_timer_t  start_time, end_time;
+  cs_timer_counter_t dt;
+
+  int n_passes = 0;
+  cs_gnum_t n_cut[2] = {0, 0};
+
+  start_time = cs_timer_time();
+
+  _refine_graph_t *g = _refine_graph_create(mb);
+
+  const cs_lnum_t n_cells = g->n_cells;
+
+  /* Partition of local cells, followed by that of ghost cells */
+
+  int *part;
+  BFT_MALLOC(part, n_cells + g->n_ghosts, int);
+
+  memcpy(part, cell_part, n_cells*sizeof(int));
+
+  _refine_graph_sync(g, part);
+
+  /* Node level */
+
+  if (part_node != NULL && n_nodes > 1) {
+
+    int *node_part, *node_n_parts, *node_first_part;
+
+    BFT_MALLOC(node_part, n_cells + g->n_ghosts, int);
+    BFT_MALLOC(node_n_parts, n_nodes, int);
+    BFT_MALLOC(node_first_part, n_nodes, int);
+
+    for (int k = 0; k < n_nodes; k++) {
+      node_n_parts[k] = 0;
+      node_first_part[k] = -1;
+    }
+    for (int p = 0; p < n_parts; p++) {
+      node_n_parts[part_node[p]] += 1;
+      if (node_first_part[part_node[p]] < 0)
+        node_first_part[part_node[p]] = p;
+    }
+
+    for (cs_lnum_t i = 0; i < n_cells + g->n_ghosts; i++)
+      node_part[i] = part_node[part[i]];
+
+    n_passes = _refine_partition(g,
+                                 n_g_cells,
+                                 n_nodes,
+                                 node_n_parts,
+                                 NULL,
+                                 node_part,
+                                 n_cut);
+
+    /* Cells moved to another node join the partition of an adjacent
+       cell on that node if possible */
+
+    for (cs_lnum_t i = 0; i < n_cells; i++) {
+      const int k = node_part[i];
+      if (part_node[part[i]] == k)
+        continue;
+      int p_new = -1;
+      for (cs_lnum_t j = g->cell_idx[i]; j < g->cell_idx[i+1]; j++) {
+        int q = part[g->cell_neighbors[j]];
+        if (part_node[q] == k && (p_new < 0 || q < p_new))
+          p_new = q;
+      }
+      part[i] = (p_new > -1) ? p_new : node_first_part[k];
+    }
+
+    BFT_FREE(node_first_part);
+    BFT_FREE(node_n_parts);
+    BFT_FREE(node_part);
+
+    bft_printf(_("\n Partition boundary refinement between nodes"
+                 " (%d passes):\n"
+                 "   interior faces on node boundaries: %llu -> %llu\n"),
+               n_passes,
+               (unsigned long long)n_cut[0], (unsigned long long)n_cut[1]);
+
+  }
+
+  /* Rank level (within each node if applicable) */
+
+  n_passes = _refine_partition(g,
+                               n_g_cells,
+                               n_parts,
+                               NULL,
+                               (n_nodes > 1) ? part_node : NULL,
+                               part,
+                               n_cut);
+
+  _refine_graph_destroy(&g);
+
+  memcpy(cell_part, part, n_cells*sizeof(int));
+
+  BFT_FREE(part);
 
   end_time = cs_timer_time();
   dt = cs_timer_diff(&start_time, &end_time);
 
-  if (sfc_type < FVM_IO_NUM_SFC_HILBERT_BOX)
-    cs_log_printf(CS_LOG_PERFORMANCE,
-                  _("  Morton (Z) curve:           %.3g s\n"),
-                  (double)(dt.wall_nsec)/1.e9);
-  else
-    cs_log_printf(CS_LOG_PERFORMANCE,
-                  _("  Peano-Hilbert curve:        %.3g s\n"),
-                  (double)(dt.wall_nsec)/1.e9);
+  bft_printf(_("\n Partition boundary refinement (%d passes):\n"
+               "   interior faces on partition boundaries: %llu -> %llu\n"),
+             n_passes,
+             (unsigned long long)n_cut[0], (unsigned long long)n_cut[1]);
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("  boundary refinement:        %.3g s\n"),
+                (double)(dt.wall_nsec)/1.e9);
 }
 
 #if defined(HAVE_MPI)
@@ -2317,6 +3148,7 @@ _distribute_output(const cs_mesh_builder_t   *mb,
  * Write output file.
  *
  * parameters:
+ *   dir         <-- output directory
  *   n_g_cells   <-- global number of cells
  *   cell_range  <-- first and past-the-last cell numbers for this rank
  *   n_ranks     <-- number of ranks corresonding to output file
@@ -2324,10 +3156,11 @@ _distribute_output(const cs_mesh_builder_t   *mb,
  *----------------------------------------------------------------------------*/
 
 static void
-_write_output(cs_gnum_t  n_g_cells,
-              cs_gnum_t  cell_range[2],
-              int        n_ranks,
-              const int  domain_rank[])
+_write_output(const char  *dir,
+              cs_gnum_t    n_g_cells,
+              cs_gnum_t    cell_range[2],
+              int          n_ranks,
+              const int    domain_rank[])
 {
   size_t i;
   int n_ranks_size;
@@ -2338,7 +3171,6 @@ _write_output(cs_gnum_t  n_g_cells,
   cs_datatype_t datatype_gnum = CS_DATATYPE_NULL;
   cs_datatype_t datatype_int = CS_DATATYPE_NULL;
 
-  const char dir[] = "partition_output";
   const char magic_string[] = "Domain partitioning, R0";
 
   if (sizeof(int) == 4)
@@ -2485,17 +3317,30 @@ _read_cell_rank(cs_mesh_t          *mesh,
   if (n_ranks == 1)
     return;
 
+  /* A partitioning balanced based on measured loads and saved with
+     the checkpoint of a previous run has priority */
+
+  int dir_id = 0;
+
+  for (dir_id = 0; dir_id < 2; dir_id++) {
+
+    const char *dir = (dir_id == 0) ? "restart" : "partition_input";
+
 #if (__STDC_VERSION__ < 199901L)
-  sprintf(file_name,
-          "partition_input%cdomain_number_%d",
-          _dir_separator, cs_glob_n_ranks);
+    sprintf(file_name,
+            "%s%cdomain_number_%d",
+            dir, _dir_separator, cs_glob_n_ranks);
 #else
-  snprintf(file_name, 64,
-           "partition_input%cdomain_number_%d",
-           _dir_separator, cs_glob_n_ranks);
+    snprintf(file_name, 64,
+             "%s%cdomain_number_%d",
+             dir, _dir_separator, cs_glob_n_ranks);
 #endif
-  file_name[63] = '\0'; /* Just in case; processor counts would need to be
-                           in the exa-range for this to be necessary. */
+    file_name[63] = '\0'; /* Just in case; processor counts would need to be
+                             in the exa-range for this to be necessary. */
+
+    if (cs_file_isreg(file_name))
+      break;
+  }
 
   /* Test if file exists */
 
@@ -2621,8 +3466,304 @@ _read_cell_rank(cs_mesh_t          *mesh,
 
   if (rank_pp_in != NULL)
     cs_io_finalize(&rank_pp_in);
+
+  /* Keep a partitioning read from the restart directory in the checkpoint,
+     so that it is also used by subsequent restarts */
+
+  if (dir_id == 0 && mb->have_cell_rank && cs_glob_rank_id < 1) {
+
+    char c_file_name[64];
+
+    snprintf(c_file_name, 64,
+             "checkpoint%cdomain_number_%d",
+             _dir_separator, cs_glob_n_ranks);
+    c_file_name[63] = '\0';
+
+    if (   cs_file_mkdir_default("checkpoint") != 0
+        || cs_file_link_or_copy(file_name, c_file_name) != 0) {
+      cs_base_warn(__FILE__, __LINE__);
+      bft_printf(_("Failure linking or copying %s to %s.\n"),
+                 file_name, c_file_name);
+    }
+
+  }
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Distribute the measured load of the local rank among its cells.
+ *
+ * If a cell work function is defined, the costs of a cell and of a unit
+ * of additional work are estimated by a least-squares fit of the loads
+ * of all ranks; otherwise, the load is distributed uniformly.
+ *
+ * parameters:
+ *   mesh        <-- pointer to mesh structure
+ *   local_load  <-- measured load of local rank
+ *   cell_weight --> weight of each local cell
+ *----------------------------------------------------------------------------*/
+
+static void
+_cell_loads(const cs_mesh_t  *mesh,
+            double            local_load,
+            double            cell_weight[])
+{
+  const cs_lnum_t n_cells = mesh->n_cells;
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    cell_weight[i] = 1.;
+
+  if (_part_balance_cell_work != NULL) {
+
+    double *c_work;
+    BFT_MALLOC(c_work, n_cells, double);
+
+    _part_balance_cell_work(mesh, c_work);
+
+    double n_c = n_cells, n_w = 0;
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      n_w += c_work[i];
+
+    /* Normal equations of load = a.n_cells + b.work over ranks */
+
+    double s[5] = {n_c*n_c, n_c*n_w, n_w*n_w,
+                   local_load*n_c, local_load*n_w};
+
+    MPI_Allreduce(MPI_IN_PLACE, s, 5, MPI_DOUBLE, MPI_SUM, cs_glob_mpi_comm);
+
+    double det = s[0]*s[2] - s[1]*s[1];
+
+    if (det > 1e-12*s[0]*s[2]) {
+      double a = (s[3]*s[2] - s[4]*s[1]) / det;
+      double b = (s[0]*s[4] - s[1]*s[3]) / det;
+      if (a > 0 && b > 0) {
+        double w_ratio = b / a;
+        bft_printf(_(" Estimated cost of a unit of cell work relative to"
+                     " a cell: %g\n"), w_ratio);
+        for (cs_lnum_t i = 0; i < n_cells; i++)
+          cell_weight[i] += w_ratio*c_work[i];
+      }
+    }
+
+    BFT_FREE(c_work);
+
+  }
+
+  /* Scale so that weights match the measured load of the local rank */
+
+  double w_sum = 0;
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    w_sum += cell_weight[i];
+
+  double scale = (w_sum > 0) ? local_load / w_sum : 0;
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    cell_weight[i] *= scale;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute and save a partitioning of the current mesh balancing
+ * measured loads.
+ *
+ * Cells are ordered along a Hilbert curve, which is split in portions
+ * of equal cumulative weight. The resulting partitioning is written to
+ * the checkpoint directory, so as to be used when restarting.
+ *
+ * parameters:
+ *   mesh        <-- pointer to mesh structure
+ *   cell_cen    <-- cell centers
+ *   cell_weight <-- weight of each local cell
+ *
+ * returns:
+ *   expected relative imbalance of the new partitioning
+ *----------------------------------------------------------------------------*/
+
+static double
+_balance_partition(const cs_mesh_t  *mesh,
+                   const cs_real_t   cell_cen[],
+                   const double      cell_weight[])
+{
+  cs_lnum_t i, j;
+
+  const int n_ranks = cs_glob_n_ranks;
+  const cs_lnum_t n_cells = mesh->n_cells;
+
+  cs_block_dist_info_t bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                                        n_ranks,
+                                                        1,
+                                                        0,
+                                                        mesh->n_g_cells);
+
+  /* Order cells along space-filling curve */
+
+  fvm_io_num_t *sfc_io_num
+    = fvm_io_num_create_from_sfc((const cs_coord_t *)cell_cen,
+                                 3,
+                                 n_cells,
+                                 FVM_IO_NUM_SFC_HILBERT_BOX);
+
+  const cs_gnum_t *sfc_num = fvm_io_num_get_global_num(sfc_io_num);
+
+  /* Send weights to blocks based on position along curve */
+
+  cs_all_to_all_t *d = cs_all_to_all_create_from_block(n_cells,
+                                                       0, /* flags */
+                                                       sfc_num,
+                                                       bi,
+                                                       cs_glob_mpi_comm);
+
+  cs_gnum_t *b_sfc_num = cs_all_to_all_copy_array(d,
+                                                  CS_GNUM_TYPE,
+                                                  1,
+                                                  false, /* reverse */
+                                                  sfc_num,
+                                                  NULL);
+
+  double *b_weight = cs_all_to_all_copy_array(d,
+                                              CS_DOUBLE,
+                                              1,
+                                              false, /* reverse */
+                                              cell_weight,
+                                              NULL);
+
+  cs_lnum_t n_recv = cs_all_to_all_n_elts_dest(d);
+
+  sfc_io_num = fvm_io_num_destroy(sfc_io_num);
+
+  /* Split curve based on cumulative weights */
+
+  double w_sum = 0, w_shift = 0, w_tot = 0;
+
+  for (j = 0; j < n_recv; j++)
+    w_sum += b_weight[j];
+
+  MPI_Exscan(&w_sum, &w_shift, 1, MPI_DOUBLE, MPI_SUM, cs_glob_mpi_comm);
+  MPI_Allreduce(&w_sum, &w_tot, 1, MPI_DOUBLE, MPI_SUM, cs_glob_mpi_comm);
+
+  if (cs_glob_rank_id == 0)
+    w_shift = 0; /* MPI_Exscan result undefined on rank 0 */
+
+  cs_lnum_t *order = cs_order_gnum(NULL, b_sfc_num, n_recv);
+
+  int *b_part;
+  BFT_MALLOC(b_part, n_recv, int);
+
+  for (j = 0; j < n_recv; j++) {
+    cs_lnum_t k = order[j];
+    double w_mid = w_shift + 0.5*b_weight[k];
+    int p = (w_tot > 0) ? w_mid / w_tot * n_ranks : 0;
+    b_part[k] = CS_MIN(p, n_ranks - 1);
+    w_shift += b_weight[k];
+  }
+
+  BFT_FREE(order);
+  BFT_FREE(b_weight);
+  BFT_FREE(b_sfc_num);
+
+  int *c_part;
+  BFT_MALLOC(c_part, n_cells, int);
+
+  cs_all_to_all_copy_array(d,
+                           CS_INT_TYPE,
+                           1,
+                           true, /* reverse */
+                           b_part,
+                           c_part);
+
+  cs_all_to_all_destroy(&d);
+
+  BFT_FREE(b_part);
+
+  /* Expected loads */
+
+  double *part_w, w_max = 0;
+  BFT_MALLOC(part_w, n_ranks, double);
+
+  for (int p = 0; p < n_ranks; p++)
+    part_w[p] = 0;
+  for (i = 0; i < n_cells; i++)
+    part_w[c_part[i]] += cell_weight[i];
+
+  cs_parall_sum(n_ranks, CS_DOUBLE, part_w);
+
+  for (int p = 0; p < n_ranks; p++)
+    w_max = CS_MAX(w_max, part_w[p]);
+
+  BFT_FREE(part_w);
+
+  /* Distribute partitioning to blocks based on global cell numbers */
+
+  d = cs_all_to_all_create_from_block(n_cells,
+                                      0, /* flags */
+                                      mesh->global_cell_num,
+                                      bi,
+                                      cs_glob_mpi_comm);
+
+  cs_gnum_t *b_cell_num = cs_all_to_all_copy_array(d,
+                                                   CS_GNUM_TYPE,
+                                                   1,
+                                                   false, /* reverse */
+                                                   mesh->global_cell_num,
+                                                   NULL);
+
+  int *b_cell_part = cs_all_to_all_copy_array(d,
+                                              CS_INT_TYPE,
+                                              1,
+                                              false, /* reverse */
+                                              c_part,
+                                              NULL);
+
+  n_recv = cs_all_to_all_n_elts_dest(d);
+
+  cs_all_to_all_destroy(&d);
+
+  BFT_FREE(c_part);
+
+  int *domain_rank;
+  BFT_MALLOC(domain_rank, bi.gnum_range[1] - bi.gnum_range[0], int);
+
+  for (j = 0; j < n_recv; j++)
+    domain_rank[b_cell_num[j] - bi.gnum_range[0]] = b_cell_part[j];
+
+  BFT_FREE(b_cell_part);
+  BFT_FREE(b_cell_num);
+
+  /* The checkpoint partitioning may be linked to the one read at restart,
+     which must not be overwritten */
+
+  if (cs_glob_rank_id < 1) {
+    char part_path[64];
+    snprintf(part_path, 64, "checkpoint%cdomain_number_%d",
+             _dir_separator, n_ranks);
+    part_path[63] = '\0';
+    if (cs_file_isreg(part_path))
+      cs_file_remove(part_path);
+  }
+  MPI_Barrier(cs_glob_mpi_comm);
+
+  _write_output("checkpoint",
+                mesh->n_g_cells,
+                bi.gnum_range,
+                n_ranks,
+                domain_rank);
+
+  BFT_FREE(domain_rank);
+
+  /* A mesh cache saved with the checkpoint uses the previous
+     partitioning, and must not be used when restarting */
+
+  if (cs_glob_rank_id < 1) {
+    char cache_path[64];
+    sprintf(cache_path, "checkpoint%cmesh_cache.csc", _dir_separator);
+    if (cs_file_isreg(cache_path))
+      cs_file_remove(cache_path);
+  }
+
+  return (w_tot > 0) ? w_max / (w_tot / n_ranks) - 1. : 0.;
 }
 
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------*
  * Define a naive partitioning by blocks.
  *
@@ -2928,6 +4069,33 @@ cs_partition_set_algorithm(cs_partition_stage_t      stage,
   _part_ignore_perio[stage] = ignore_perio;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Query algorithm for domain partitioning.
+ *
+ * \param[in]   stage         associated partitioning stage
+ * \param[out]  rank_step     if > 1, partitioning done on at most
+ *                            n_ranks / rank_step processes, or NULL
+ * \param[out]  ignore_perio  if true, periodicity information is ignored,
+ *                            or NULL
+ *
+ * \return  partitioning algorithm choice
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_partition_algorithm_t
+cs_partition_get_algorithm(cs_partition_stage_t   stage,
+                           int                   *rank_step,
+                           bool                  *ignore_perio)
+{
+  if (rank_step != NULL)
+    *rank_step = _part_rank_step[stage];
+  if (ignore_perio != NULL)
+    *ignore_perio = _part_ignore_perio[stage];
+
+  return _part_algorithm[stage];
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set partitioning write to file option.
@@ -3056,6 +4224,262 @@ cs_partition_add_partitions(int  n_extra_partitions,
            sizeof(int)*n_extra_partitions);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set refinement options for space-filling curve partitionings.
+ *
+ * When a number of passes is defined, partitionings based on a Morton
+ * or Hilbert space-filling curve are refined by moving cells adjacent
+ * to other partitions so as to reduce the number of faces on partition
+ * boundaries (and thus halo sizes), while keeping the number of cells
+ * of each partition within the given tolerance of the mean.
+ *
+ * This does not require an external graph partitioning library.
+ *
+ * \param[in]  n_passes   maximum number of refinement passes
+ *                        (0 for no refinement, the default)
+ * \param[in]  tolerance  allowed relative imbalance of cell counts
+ *                        (0.05 by default)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_sfc_refinement(int     n_passes,
+                                double  tolerance)
+{
+  _part_sfc_refine_n_passes = CS_MAX(n_passes, 0);
+  _part_sfc_refine_tolerance = CS_MAX(tolerance, 0.);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set hierarchical (node-aware) partitioning options.
+ *
+ * When node-aware partitioning is active, space-filling curve
+ * partitionings assign consecutive portions of the curve to ranks
+ * ordered by compute node, so that the mesh is first split across nodes,
+ * then across the ranks of each node, whatever the placement of ranks
+ * on nodes. If boundary refinement is also active (see
+ * \ref cs_partition_set_sfc_refinement), faces between nodes are reduced
+ * first, then moves between ranks are restricted to ranks of the
+ * same node, so most halo exchanges remain intra-node.
+ *
+ * When a thread block size is given, cells of each rank are also
+ * renumbered along a Hilbert curve (unless another cell renumbering
+ * algorithm has already been selected), so that consecutive blocks of
+ * cells form compact sub-partitions, and the minimum face subset sizes
+ * for threads are set to that size.
+ *
+ * \param[in]  node_aware         true to partition first across compute
+ *                                nodes, then across ranks of each node
+ * \param[in]  thread_block_size  number of cells of sub-partitions for
+ *                                threads, or 0 to keep the current
+ *                                renumbering options
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_hierarchical(bool       node_aware,
+                              cs_lnum_t  thread_block_size)
+{
+  _part_hierarchical = node_aware;
+  _part_thread_block_size = CS_MAX(thread_block_size, 0);
+
+  if (_part_thread_block_size > 0) {
+
+    bool halo_adjacent_cells_last, halo_adjacent_faces_last;
+    cs_renumber_ordering_t i_faces_base_ordering;
+    cs_renumber_cells_type_t cells_pre_numbering, cells_numbering;
+    cs_renumber_i_faces_type_t i_faces_numbering;
+    cs_renumber_b_faces_type_t b_faces_numbering;
+    cs_renumber_vertices_type_t vertices_numbering;
+
+    cs_renumber_get_algorithm(&halo_adjacent_cells_last,
+                              &halo_adjacent_faces_last,
+                              &i_faces_base_ordering,
+                              &cells_pre_numbering,
+                              &cells_numbering,
+                              &i_faces_numbering,
+                              &b_faces_numbering,
+                              &vertices_numbering);
+
+    if (cells_numbering == CS_RENUMBER_CELLS_NONE)
+      cells_numbering = CS_RENUMBER_CELLS_HILBERT;
+
+    cs_renumber_set_algorithm(halo_adjacent_cells_last,
+                              halo_adjacent_faces_last,
+                              i_faces_base_ordering,
+                              cells_pre_numbering,
+                              cells_numbering,
+                              i_faces_numbering,
+                              b_faces_numbering,
+                              vertices_numbering);
+
+    cs_renumber_set_min_subset_size(_part_thread_block_size,
+                                    _part_thread_block_size);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set restart-time load balancing options.
+ *
+ * When active, the load of each rank is measured every given number of
+ * time steps, as the elapsed time minus the time spent waiting for halo
+ * synchronization and global reductions. If the relative imbalance
+ * exceeds the given threshold, a new partitioning balancing the measured
+ * loads is computed, and saved as "checkpoint/domain_number_<n_ranks>",
+ * so that it is used when restarting the computation with the same
+ * number of ranks (a mesh cache saved in the same checkpoint is removed,
+ * as it is based on the previous partitioning). A partitioning read from
+ * the "restart" directory is also linked (or copied) to the checkpoint,
+ * so that it remains in use for subsequent restarts.
+ *
+ * The current run keeps its partitioning: there is no in-run migration.
+ * Mesh entities and fields are migrated to their new owners only when
+ * restarting, by the restart mechanism, whose files are independent of
+ * the partitioning. If required, the computation is stopped (with a final
+ * checkpoint) as soon as a new partitioning is saved, so as to be
+ * restarted with it.
+ *
+ * \param[in]  interval   number of time steps between load checks
+ *                        (0 to deactivate, the default)
+ * \param[in]  threshold  relative imbalance (max/mean - 1) above which
+ *                        a new partitioning is computed (0.2 by default)
+ * \param[in]  stop       if true, stop the computation once a new
+ *                        partitioning is saved
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_restart_balance(int     interval,
+                                 double  threshold,
+                                 bool    stop)
+{
+  _part_balance_interval = CS_MAX(interval, 0);
+  _part_balance_threshold = threshold;
+  _part_balance_stop = stop;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define a function providing additional work of each cell, used to
+ *        distribute measured loads among cells for restart-time load
+ *        balancing.
+ *
+ * By default, the measured load of a rank is distributed uniformly among
+ * its cells. When a function is defined, the relative costs of a cell and
+ * of a unit of additional work are estimated by a least-squares fit of the
+ * measured loads of all ranks, and the load of each rank is distributed
+ * among its cells based on their additional work.
+ *
+ * \param[in]  func  pointer to cell work function, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_balance_cell_work(cs_partition_cell_work_t  *func)
+{
+  _part_balance_cell_work = func;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check load balance, and save a balanced partitioning for restart
+ *        if required.
+ *
+ * This function should be called once per time step; it does nothing
+ * unless restart-time load balancing is active
+ * (see \ref cs_partition_set_restart_balance).
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_check_restart_balance(void)
+{
+  if (_part_balance_interval < 1 || cs_glob_n_ranks < 2)
+    return;
+
+#if defined(HAVE_MPI)
+
+  const cs_time_step_t *ts = cs_glob_time_step;
+
+  cs_timer_t t_cur = cs_timer_time();
+  double wait_cur =   cs_halo_get_sync_wait_time()
+                    + cs_parall_get_reduce_wait_time();
+
+  /* Reference time and counters at first call */
+
+  if (_part_balance_n_steps < 0) {
+    _part_balance_n_steps = 0;
+    _part_balance_t_ref = t_cur;
+    _part_balance_wait_ref = wait_cur;
+    return;
+  }
+
+  _part_balance_n_steps += 1;
+
+  if (_part_balance_n_steps < _part_balance_interval)
+    return;
+
+  cs_timer_counter_t dt = cs_timer_diff(&_part_balance_t_ref, &t_cur);
+
+  double local_load = dt.wall_nsec*1e-9 - (wait_cur - _part_balance_wait_ref);
+  double load[2] = {local_load, local_load};
+
+  int n_steps = _part_balance_n_steps;
+
+  _part_balance_n_steps = 0;
+  _part_balance_t_ref = t_cur;
+  _part_balance_wait_ref = wait_cur;
+
+  if (ts->nt_max > -1 && ts->nt_cur >= ts->nt_max)
+    return;
+
+  /* Reductions are timed, so that their wait is excluded from the next
+     interval's load (the reference times were updated above) */
+
+  cs_parall_max(1, CS_DOUBLE, load);
+  cs_parall_sum(1, CS_DOUBLE, load + 1);
+
+  double l_mean = load[1] / cs_glob_n_ranks;
+  double imbalance = (l_mean > 0) ? load[0]/l_mean - 1. : 0.;
+
+  bft_printf(_("\n Load imbalance over the last %d time steps: %.1f %%\n"),
+             n_steps, imbalance*100.);
+
+  if (imbalance <= _part_balance_threshold)
+    return;
+
+  /* Distribute local load among cells */
+
+  const cs_mesh_t *mesh = cs_glob_mesh;
+
+  double *cell_weight;
+  BFT_MALLOC(cell_weight, mesh->n_cells, double);
+
+  _cell_loads(mesh, local_load, cell_weight);
+
+  double new_imbalance
+    = _balance_partition(mesh,
+                         cs_glob_mesh_quantities->cell_cen,
+                         cell_weight);
+
+  BFT_FREE(cell_weight);
+
+  bft_printf(_(" Balanced partitioning saved for restart"
+               " (expected imbalance: %.1f %%).\n"),
+             new_imbalance*100.);
+
+  if (_part_balance_stop) {
+    bft_printf(_(" Stopping computation so as to restart"
+                 " with the balanced partitioning.\n"));
+    cs_time_step_define_nt_max(ts->nt_cur);
+  }
+
+#endif /* defined(HAVE_MPI) */
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Partition mesh based on current options.
@@ -3228,7 +4652,8 @@ cs_partition(cs_mesh_t             *mesh,
         _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part);
 
         if (write_output || i < n_extra_partitions)
-          _write_output(mesh->n_g_cells,
+          _write_output("partition_output",
+                        mesh->n_g_cells,
                         mb->cell_bi.gnum_range,
                         n_ranks,
                         cell_part);
@@ -3274,7 +4699,8 @@ cs_partition(cs_mesh_t             *mesh,
         _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part);
 
         if (write_output || i < n_extra_partitions)
-          _write_output(mesh->n_g_cells,
+          _write_output("partition_output",
+                        mesh->n_g_cells,
                         mb->cell_bi.gnum_range,
                         n_ranks,
                         cell_part);
@@ -3355,7 +4781,8 @@ cs_partition(cs_mesh_t             *mesh,
         _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part);
 
         if (write_output || i < n_extra_partitions)
-          _write_output(mesh->n_g_cells,
+          _write_output("partition_output",
+                        mesh->n_g_cells,
                         mb->cell_bi.gnum_range,
                         n_ranks,
                         cell_part);
@@ -3401,7 +4828,8 @@ cs_partition(cs_mesh_t             *mesh,
         _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part);
 
         if (write_output || i < n_extra_partitions)
-          _write_output(mesh->n_g_cells,
+          _write_output("partition_output",
+                        mesh->n_g_cells,
                         mb->cell_bi.gnum_range,
                         n_ranks,
                         cell_part);
@@ -3420,8 +4848,36 @@ cs_partition(cs_mesh_t             *mesh,
     int i;
     fvm_io_num_sfc_t sfc_type = _algorithm - CS_PARTITION_SFC_MORTON_BOX;
 
+    int n_nodes = 1;
+    int *rank_node = NULL, *slot_rank = NULL;
+
     BFT_MALLOC(cell_part, n_cells, int);
 
+    /* For node-aware partitioning, consecutive portions of the curve
+       are assigned to ranks ordered by compute node */
+
+#if defined(HAVE_MPI)
+    if (_part_hierarchical && cs_glob_n_ranks > 1) {
+      rank_node = _rank_node_ids(&n_nodes);
+      bft_printf(_("\n Node-aware partitioning: %d compute nodes.\n"),
+                 n_nodes);
+      if (n_nodes > 1) {
+        int *node_shift;
+        BFT_MALLOC(node_shift, n_nodes + 1, int);
+        BFT_MALLOC(slot_rank, cs_glob_n_ranks, int);
+        for (int k = 0; k < n_nodes + 1; k++)
+          node_shift[k] = 0;
+        for (int r = 0; r < cs_glob_n_ranks; r++)
+          node_shift[rank_node[r] + 1] += 1;
+        for (int k = 0; k < n_nodes; k++)
+          node_shift[k+1] += node_shift[k];
+        for (int r = 0; r < cs_glob_n_ranks; r++)
+          slot_rank[node_shift[rank_node[r]]++] = r;
+        BFT_FREE(node_shift);
+      }
+    }
+#endif
+
     for (i = 0; i < n_extra_partitions + 1; i++) {
 
       int  n_ranks = cs_glob_n_ranks;
@@ -3448,15 +4904,37 @@ cs_partition(cs_mesh_t             *mesh,
       _cell_rank_by_sfc(mesh->n_g_cells, n_ranks, mb, sfc_type, cell_part);
 #endif
 
+      /* Node-aware partitioning only applies to the current rank count */
+
+      const int *part_node = NULL;
+
+      if (slot_rank != NULL && n_ranks == cs_glob_n_ranks) {
+        for (cs_lnum_t j = 0; j < n_cells; j++)
+          cell_part[j] = slot_rank[cell_part[j]];
+        part_node = rank_node;
+      }
+
+      if (_part_sfc_refine_n_passes > 0)
+        _refine_sfc_partition(mesh->n_g_cells,
+                              n_ranks,
+                              mb,
+                              (part_node != NULL) ? n_nodes : 1,
+                              part_node,
+                              cell_part);
+
       _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part);
 
       if (write_output || i < n_extra_partitions)
-        _write_output(mesh->n_g_cells,
+        _write_output("partition_output",
+                      mesh->n_g_cells,
                       mb->cell_bi.gnum_range,
                       n_ranks,
                       cell_part);
     }
 
+    BFT_FREE(slot_rank);
+    BFT_FREE(rank_node);
+
   }
 
   /* Naive partitioner */
@@ -115,6 +115,19 @@ typedef enum {
 
 } cs_partition_algorithm_t;
 
+/*----------------------------------------------------------------------------
+ * Function pointer for additional work of each cell used for dynamic
+ * load balancing (such as the number of particles in each cell).
+ *
+ * parameters:
+ *   mesh      <-- pointer to mesh structure
+ *   cell_work --> additional work count of each cell
+ *----------------------------------------------------------------------------*/
+
+typedef void
+(cs_partition_cell_work_t) (const cs_mesh_t  *mesh,
+                            double            cell_work[]);
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -150,6 +163,24 @@ cs_partition_set_algorithm(cs_partition_stage_t      stage,
                            int                       rank_step,
                            bool                      ignore_perio);
 
+/*----------------------------------------------------------------------------
+ * Query algorithm for domain partitioning for a given partitioning stage.
+ *
+ * parameters:
+ *   stage        <-- associated partitioning stage
+ *   rank_step    --> if > 1, partitioning done on at most
+ *                    n_ranks / rank_step processes, or NULL
+ *   ignore_perio --> if true, periodicity information is ignored, or NULL
+ *
+ * returns:
+ *   partitioning algorithm choice
+ *----------------------------------------------------------------------------*/
+
+cs_partition_algorithm_t
+cs_partition_get_algorithm(cs_partition_stage_t   stage,
+                           int                   *rank_step,
+                           bool                  *ignore_perio);
+
 /*----------------------------------------------------------------------------
  * Set partitioning write to file option.
  *
@@ -224,6 +255,121 @@ void
 cs_partition_add_partitions(int  n_extra_partitions,
                             int  extra_partitions_list[]);
 
+/*----------------------------------------------------------------------------
+ * Set refinement options for space-filling curve partitionings.
+ *
+ * When a number of passes is defined, partitionings based on a Morton
+ * or Hilbert space-filling curve are refined by moving cells adjacent
+ * to other partitions so as to reduce the number of faces on partition
+ * boundaries (and thus halo sizes), while keeping the number of cells
+ * of each partition within the given tolerance of the mean.
+ *
+ * This does not require an external graph partitioning library.
+ *
+ * parameters:
+ *   n_passes  <-- maximum number of refinement passes
+ *                 (0 for no refinement, the default)
+ *   tolerance <-- allowed relative imbalance of cell counts
+ *                 (0.05 by default)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_sfc_refinement(int     n_passes,
+                                double  tolerance);
+
+/*----------------------------------------------------------------------------
+ * Set hierarchical (node-aware) partitioning options.
+ *
+ * When node-aware partitioning is active, space-filling curve
+ * partitionings assign consecutive portions of the curve to ranks
+ * ordered by compute node, so that the mesh is first split across nodes,
+ * then across the ranks of each node, whatever the placement of ranks
+ * on nodes. If boundary refinement is also active (see
+ * cs_partition_set_sfc_refinement), faces between nodes are reduced
+ * first, then moves between ranks are restricted to ranks of the
+ * same node, so most halo exchanges remain intra-node.
+ *
+ * When a thread block size is given, cells of each rank are also
+ * renumbered along a Hilbert curve (unless another cell renumbering
+ * algorithm has already been selected), so that consecutive blocks of
+ * cells form compact sub-partitions, and the minimum face subset sizes
+ * for threads are set to that size.
+ *
+ * parameters:
+ *   node_aware        <-- true to partition first across compute nodes,
+ *                         then across ranks of each node
+ *   thread_block_size <-- number of cells of sub-partitions for threads,
+ *                         or 0 to keep the current renumbering options
+ *----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_hierarchical(bool       node_aware,
+                              cs_lnum_t  thread_block_size);
+
+/*----------------------------------------------------------------------------
+ * Set restart-time load balancing options.
+ *
+ * When active, the load of each rank is measured every given number of
+ * time steps, as the elapsed time minus the time spent waiting for halo
+ * synchronization and global reductions. If the relative imbalance
+ * exceeds the given threshold, a new partitioning balancing the measured
+ * loads is computed, and saved as "checkpoint/domain_number_<n_ranks>",
+ * so that it is used when restarting the computation with the same
+ * number of ranks (a mesh cache saved in the same checkpoint is removed,
+ * as it is based on the previous partitioning). A partitioning read from
+ * the "restart" directory is also linked (or copied) to the checkpoint,
+ * so that it remains in use for subsequent restarts.
+ *
+ * The current run keeps its partitioning: there is no in-run migration.
+ * Mesh entities and fields are migrated to their new owners only when
+ * restarting, by the restart mechanism, whose files are independent of
+ * the partitioning. If required, the computation is stopped (with a final
+ * checkpoint) as soon as a new partitioning is saved, so as to be
+ * restarted with it.
+ *
+ * parameters:
+ *   interval  <-- number of time steps between load checks
+ *                 (0 to deactivate, the default)
+ *   threshold <-- relative imbalance (max/mean - 1) above which
+ *                 a new partitioning is computed (0.2 by default)
+ *   stop      <-- if true, stop the computation once a new
+ *                 partitioning is saved
+ *----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_restart_balance(int     interval,
+                                 double  threshold,
+                                 bool    stop);
+
+/*----------------------------------------------------------------------------
+ * Define a function providing additional work of each cell, used to
+ * distribute measured loads among cells for restart-time load balancing.
+ *
+ * By default, the measured load of a rank is distributed uniformly among
+ * its cells. When a function is defined, the relative costs of a cell and
+ * of a unit of additional work are estimated by a least-squares fit of the
+ * measured loads of all ranks, and the load of each rank is distributed
+ * among its cells based on their additional work.
+ *
+ * parameters:
+ *   func <-- pointer to cell work function, or NULL
+ *----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_balance_cell_work(cs_partition_cell_work_t  *func);
+
+/*----------------------------------------------------------------------------
+ * Check load balance, and save a balanced partitioning for restart
+ * if required.
+ *
+ * This function should be called once per time step; it does nothing
+ * unless restart-time load balancing is active
+ * (see cs_partition_set_restart_balance).
+ *----------------------------------------------------------------------------*/
+
+void
+cs_partition_check_restart_balance(void);
+
 /*----------------------------------------------------------------------------
  * Compute partitioning for a given mesh.
  *
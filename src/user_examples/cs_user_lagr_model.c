@@ -782,6 +782,16 @@ cs_user_lagr_model(void)
   cs_lagr_post_set_attr(CS_LAGR_STAT_CLASS, true);
 
   /*! [boundary_statistics] */
+
+  /*! [trajectory] */
+
+  /* Particle trajectory output (ids and coordinates are always output)
+   * ================================================================== */
+
+  cs_lagr_trajectory_set_frequency(10);
+  cs_lagr_trajectory_set_attr(CS_LAGR_VELOCITY, true);
+
+  /*! [trajectory] */
 }
 
 /*----------------------------------------------------------------------------*/
@@ -322,6 +322,23 @@ cs_user_parameters(cs_domain_t *domain)
 
   /*! [duration] */
 
+  /*! [param_mesh_adapt] */
+
+  /* Adaptive mesh refinement: every 20 time steps, flag cells where the
+     jump of the "k" field across a face exceeds 10 % of its range for
+     refinement (up to 2 levels), and refined cells where it is below 1 %
+     for coarsening; stop once cells are flagged, so that the computation
+     may be restarted on the adapted mesh. */
+
+  cs_mesh_adapt_set_indicator("k",
+                              20,     /* interval */
+                              0.1,    /* refine_threshold */
+                              0.01,   /* coarsen_threshold */
+                              2,      /* max_level */
+                              true);  /* stop */
+
+  /*! [param_mesh_adapt] */
+
   /* Example: set options for Stokes solving */
   /*-----------------------------------------*/
 
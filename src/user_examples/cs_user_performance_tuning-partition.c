@@ -145,6 +145,53 @@ cs_user_partition(void)
   }
   /*! [performance_tuning_partition_4] */
 
+  /*! [performance_tuning_partition_5] */
+  {
+    /* Example: save the partitioned and renumbered mesh to
+     * checkpoint/mesh_cache.csc, and restore it from mesh_cache.csc
+     * (or restart/mesh_cache.csc) in subsequent runs using the same
+     * number of ranks and threads, skipping mesh preprocessing,
+     * partitioning and renumbering. */
+
+    cs_mesh_cache_set_mode(true,   /* read */
+                           true);  /* write */
+  }
+  /*! [performance_tuning_partition_5] */
+
+  /*! [performance_tuning_partition_6] */
+  {
+    /* Example: refine space-filling curve partitionings so as to
+     * reduce halo sizes, using at most 10 passes and allowing
+     * 5% imbalance of cell counts between partitions. */
+
+    cs_partition_set_sfc_refinement(10,     /* n_passes */
+                                    0.05);  /* tolerance */
+  }
+  /*! [performance_tuning_partition_6] */
+
+  /*! [performance_tuning_partition_7] */
+  {
+    /* Example: partition across compute nodes first, then across ranks
+     * of each node, and renumber cells of each rank into blocks of
+     * 2048 cells for threads. */
+
+    cs_partition_set_hierarchical(true,   /* node_aware */
+                                  2048);  /* thread_block_size */
+  }
+  /*! [performance_tuning_partition_7] */
+
+  /*! [performance_tuning_partition_8] */
+  {
+    /* Example: check load balance every 10 time steps; if the imbalance
+     * exceeds 20 %, save a balanced partitioning with the checkpoint
+     * and stop, so the computation may be restarted with it. */
+
+    cs_partition_set_restart_balance(10,     /* interval */
+                                     0.2,    /* threshold */
+                                     true);  /* stop */
+  }
+  /*! [performance_tuning_partition_8] */
+
 }
 
 /*----------------------------------------------------------------------------*/
@@ -0,0 +1,294 @@
+/*============================================================================
+ * Unit test for cs_mesh_cgns.c;
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <cgnslib.h>
+
+#include <bft_error.h>
+#include <bft_mem.h>
+#include <bft_printf.h>
+
+#include "cs_base.h"
+#include "cs_mesh_cgns.h"
+#include "cs_mesh_gmsh.h"
+
+/*---------------------------------------------------------------------------*/
+
+/* Compatibility with different CGNS library versions */
+
+#if !defined(CGNS_ENUMV)
+#define CGNS_ENUMV(e) e
+#endif
+
+#if CGNS_VERSION < 3100
+#define cgsize_t int
+#endif
+
+/*---------------------------------------------------------------------------*/
+
+/* Two hexahedra sharing a face, with an "inlet" boundary section,
+   a "walls" boundary section using the mixed element type, and
+   a "fluid" volume section */
+
+static const double  _vtx_coords[3][12]
+  = {{0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2},
+     {0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 1},
+     {0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1}};
+
+static const cgsize_t  _hex_vtx[16] = {1, 2, 5, 4, 7, 8, 11, 10,
+                                       2, 3, 6, 5, 8, 9, 12, 11};
+
+static const cgsize_t  _inlet_vtx[4] = {1, 4, 10, 7};
+
+static const cgsize_t  _walls_vtx[10]
+  = {CGNS_ENUMV(QUAD_4), 1, 2, 5, 4,
+     CGNS_ENUMV(QUAD_4), 2, 3, 6, 5};
+
+/*----------------------------------------------------------------------------
+ * Print message on standard output
+ *----------------------------------------------------------------------------*/
+
+static int _bft_printf_proxy
+(
+ const char     *const format,
+       va_list         arg_ptr
+)
+{
+  static FILE *f = NULL;
+
+  if (f == NULL) {
+    char filename[64];
+    int rank = 0;
+#if defined(HAVE_MPI)
+    if (cs_glob_mpi_comm != MPI_COMM_NULL)
+      MPI_Comm_rank(cs_glob_mpi_comm, &rank);
+#endif
+    sprintf (filename, "cs_mesh_cgns_test_out.%d", rank);
+    f = fopen(filename, "w");
+    assert(f != NULL);
+  }
+
+  return vfprintf(f, format, arg_ptr);
+}
+
+/*----------------------------------------------------------------------------
+ * Write the test mesh to a CGNS file.
+ *
+ * parameters:
+ *   path <-- mesh file path
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_test_file(const char  *path)
+{
+  const char *coord_name[3] = {"CoordinateX", "CoordinateY", "CoordinateZ"};
+
+  int fn, base, zone, coord, section;
+  int retval = CG_OK;
+  cgsize_t z_size[3] = {12, 2, 0};
+
+  if (cg_open(path, CG_MODE_WRITE, &fn) != CG_OK)
+    bft_error(__FILE__, __LINE__, 0,
+              "CGNS error writing file \"%s\":\n%s", path, cg_get_error());
+
+  retval += cg_base_write(fn, "Base", 3, 3, &base);
+  retval += cg_zone_write(fn, base, "Zone", z_size,
+                          CGNS_ENUMV(Unstructured), &zone);
+
+  for (int i = 0; i < 3; i++)
+    retval += cg_coord_write(fn, base, zone, CGNS_ENUMV(RealDouble),
+                             coord_name[i], _vtx_coords[i], &coord);
+
+  retval += cg_section_write(fn, base, zone, "fluid", CGNS_ENUMV(HEXA_8),
+                             1, 2, 0, _hex_vtx, &section);
+  retval += cg_section_write(fn, base, zone, "inlet", CGNS_ENUMV(QUAD_4),
+                             3, 3, 0, _inlet_vtx, &section);
+
+#if CGNS_VERSION >= 3400
+  {
+    const cgsize_t offsets[3] = {0, 5, 10};
+    retval += cg_poly_section_write(fn, base, zone, "walls",
+                                    CGNS_ENUMV(MIXED), 4, 5, 0,
+                                    _walls_vtx, offsets, &section);
+  }
+#else
+  retval += cg_section_write(fn, base, zone, "walls", CGNS_ENUMV(MIXED),
+                             4, 5, 0, _walls_vtx, &section);
+#endif
+
+  retval += cg_close(fn);
+
+  if (retval != CG_OK)
+    bft_error(__FILE__, __LINE__, 0,
+              "CGNS error writing file \"%s\":\n%s", path, cg_get_error());
+}
+
+/*----------------------------------------------------------------------------
+ * Check dimensions and groups of a mesh reader structure.
+ *
+ * parameters:
+ *   gm    <-- pointer to mesh reader structure
+ *   label <-- test label
+ *
+ * returns:
+ *   number of errors
+ *----------------------------------------------------------------------------*/
+
+static int
+_check_mesh(const cs_mesh_gmsh_t  *gm,
+            const char            *label)
+{
+  const char *ref_names[3] = {"fluid", "inlet", "walls"};
+
+  int n_errors = 0;
+  cs_gnum_t n_g_cells, n_g_faces, n_g_vertices, n_g_face_connect_size;
+
+  cs_mesh_gmsh_get_dimensions(gm,
+                              &n_g_cells,
+                              &n_g_faces,
+                              &n_g_vertices,
+                              &n_g_face_connect_size);
+
+  bft_printf("%s:\n"
+             "  cells:              %llu\n"
+             "  faces:              %llu\n"
+             "  vertices:           %llu\n"
+             "  face connectivity:  %llu\n",
+             label,
+             (unsigned long long)n_g_cells,
+             (unsigned long long)n_g_faces,
+             (unsigned long long)n_g_vertices,
+             (unsigned long long)n_g_face_connect_size);
+
+  if (   n_g_cells != 2 || n_g_faces != 11 || n_g_vertices != 12
+      || n_g_face_connect_size != 44) {
+    fprintf(stderr, "%s: incorrect mesh dimensions.\n", label);
+    n_errors++;
+  }
+
+  int n_groups, n_families, n_max_family_items;
+  const char *const *group_name;
+  const int *family_item;
+
+  cs_mesh_gmsh_get_group_classes(gm,
+                                 &n_groups,
+                                 &group_name,
+                                 &n_families,
+                                 &n_max_family_items,
+                                 &family_item);
+
+  bft_printf("  groups:            ");
+  for (int i = 0; i < n_groups; i++)
+    bft_printf(" \"%s\"", group_name[i]);
+  bft_printf("\n  group classes:      %d\n\n", n_families);
+
+  if (n_groups != 3 || n_families != 4) {
+    fprintf(stderr, "%s: incorrect groups or group classes.\n", label);
+    n_errors++;
+  }
+  else {
+    for (int i = 0; i < 3; i++) {
+      if (strcmp(group_name[i], ref_names[i]) != 0) {
+        fprintf(stderr, "%s: group %d is \"%s\" instead of \"%s\".\n",
+                label, i, group_name[i], ref_names[i]);
+        n_errors++;
+      }
+    }
+  }
+
+  return n_errors;
+}
+
+/*---------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  char mem_trace_name[32];
+  int rank = 0;
+  int n_errors = 0;
+
+#if defined(HAVE_MPI)
+
+  /* Initialization */
+
+  cs_base_mpi_init(&argc, &argv);
+
+  if (cs_glob_mpi_comm != MPI_COMM_NULL)
+    MPI_Comm_rank(cs_glob_mpi_comm, &rank);
+
+#endif /* (HAVE_MPI) */
+
+  bft_printf_proxy_set(_bft_printf_proxy);
+
+  sprintf(mem_trace_name, "cs_mesh_cgns_test_mem.%d", rank);
+  bft_mem_init(mem_trace_name);
+
+  /* Write test file */
+
+  if (rank == 0)
+    _write_test_file("cs_mesh_cgns_test.cgns");
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Barrier(cs_glob_mpi_comm);
+#endif
+
+  /* Read CGNS file */
+
+  if (cs_mesh_cgns_is_cgns_file("cs_mesh_cgns_test.cgns") == false) {
+    fprintf(stderr, "CGNS file not recognized.\n");
+    n_errors++;
+  }
+
+  cs_mesh_gmsh_t *gm = cs_mesh_cgns_read("cs_mesh_cgns_test.cgns");
+
+  n_errors += _check_mesh(gm, "CGNS file");
+
+  cs_mesh_gmsh_destroy(&gm);
+
+  bft_mem_end();
+
+#if defined(HAVE_MPI)
+  {
+    int mpi_flag;
+    MPI_Initialized(&mpi_flag);
+    if (mpi_flag != 0)
+      MPI_Finalize();
+  }
+#endif
+
+  if (n_errors > 0)
+    exit(EXIT_FAILURE);
+
+  exit (EXIT_SUCCESS);
+}
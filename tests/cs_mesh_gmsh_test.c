@@ -0,0 +1,347 @@
+/*============================================================================
+ * Unit test for cs_mesh_gmsh.c;
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <bft_error.h>
+#include <bft_mem.h>
+#include <bft_printf.h>
+
+#include "cs_base.h"
+#include "cs_mesh_gmsh.h"
+
+/*---------------------------------------------------------------------------*/
+
+/* Two hexahedra sharing a face, with an "inlet" and a partial "walls"
+   boundary, and a "fluid" volume group */
+
+static const char *_gmsh_test_file =
+  "$MeshFormat\n"
+  "4.1 0 8\n"
+  "$EndMeshFormat\n"
+  "$PhysicalNames\n"
+  "3\n"
+  "2 1 \"inlet\"\n"
+  "2 2 \"walls\"\n"
+  "3 3 \"fluid\"\n"
+  "$EndPhysicalNames\n"
+  "$Entities\n"
+  "0 0 2 1\n"
+  "1 0 0 0 0 1 1 1 1 0\n"
+  "2 0 0 0 2 1 0 1 2 0\n"
+  "1 0 0 0 2 1 1 1 3 0\n"
+  "$EndEntities\n"
+  "$Nodes\n"
+  "1 12 1 12\n"
+  "3 1 0 12\n"
+  "1\n2\n3\n4\n5\n6\n7\n8\n9\n10\n11\n12\n"
+  "0 0 0\n1 0 0\n2 0 0\n0 1 0\n1 1 0\n2 1 0\n"
+  "0 0 1\n1 0 1\n2 0 1\n0 1 1\n1 1 1\n2 1 1\n"
+  "$EndNodes\n"
+  "$Elements\n"
+  "3 5 1 5\n"
+  "2 1 3 1\n"
+  "1 1 4 10 7\n"
+  "2 2 3 2\n"
+  "2 1 2 5 4\n"
+  "3 2 3 6 5\n"
+  "3 1 5 2\n"
+  "4 1 2 5 4 7 8 11 10\n"
+  "5 2 3 6 5 8 9 12 11\n"
+  "$EndElements\n";
+
+static const int  _hex_vtx[2][8] = {{1, 2, 5, 4, 7, 8, 11, 10},
+                                    {2, 3, 6, 5, 8, 9, 12, 11}};
+
+/*----------------------------------------------------------------------------
+ * Print message on standard output
+ *----------------------------------------------------------------------------*/
+
+static int _bft_printf_proxy
+(
+ const char     *const format,
+       va_list         arg_ptr
+)
+{
+  static FILE *f = NULL;
+
+  if (f == NULL) {
+    char filename[64];
+    int rank = 0;
+#if defined(HAVE_MPI)
+    if (cs_glob_mpi_comm != MPI_COMM_NULL)
+      MPI_Comm_rank(cs_glob_mpi_comm, &rank);
+#endif
+    sprintf (filename, "cs_mesh_gmsh_test_out.%d", rank);
+    f = fopen(filename, "w");
+    assert(f != NULL);
+  }
+
+  return vfprintf(f, format, arg_ptr);
+}
+
+/*----------------------------------------------------------------------------
+ * Check dimensions and groups of a mesh reader structure.
+ *
+ * parameters:
+ *   gm    <-- pointer to mesh reader structure
+ *   label <-- test label
+ *
+ * returns:
+ *   number of errors
+ *----------------------------------------------------------------------------*/
+
+static int
+_check_mesh(const cs_mesh_gmsh_t  *gm,
+            const char            *label)
+{
+  const char *ref_names[3] = {"inlet", "walls", "fluid"};
+
+  int n_errors = 0;
+  cs_gnum_t n_g_cells, n_g_faces, n_g_vertices, n_g_face_connect_size;
+
+  cs_mesh_gmsh_get_dimensions(gm,
+                              &n_g_cells,
+                              &n_g_faces,
+                              &n_g_vertices,
+                              &n_g_face_connect_size);
+
+  bft_printf("%s:\n"
+             "  cells:              %llu\n"
+             "  faces:              %llu\n"
+             "  vertices:           %llu\n"
+             "  face connectivity:  %llu\n",
+             label,
+             (unsigned long long)n_g_cells,
+             (unsigned long long)n_g_faces,
+             (unsigned long long)n_g_vertices,
+             (unsigned long long)n_g_face_connect_size);
+
+  if (   n_g_cells != 2 || n_g_faces != 11 || n_g_vertices != 12
+      || n_g_face_connect_size != 44) {
+    fprintf(stderr, "%s: incorrect mesh dimensions.\n", label);
+    n_errors++;
+  }
+
+  int n_groups, n_families, n_max_family_items;
+  const char *const *group_name;
+  const int *family_item;
+
+  cs_mesh_gmsh_get_group_classes(gm,
+                                 &n_groups,
+                                 &group_name,
+                                 &n_families,
+                                 &n_max_family_items,
+                                 &family_item);
+
+  bft_printf("  groups:            ");
+  for (int i = 0; i < n_groups; i++)
+    bft_printf(" \"%s\"", group_name[i]);
+  bft_printf("\n  group classes:      %d\n\n", n_families);
+
+  if (n_groups != 3 || n_families != 4) {
+    fprintf(stderr, "%s: incorrect groups or group classes.\n", label);
+    n_errors++;
+  }
+  else {
+    for (int i = 0; i < 3; i++) {
+      if (strcmp(group_name[i], ref_names[i]) != 0) {
+        fprintf(stderr, "%s: group %d is \"%s\" instead of \"%s\".\n",
+                label, i, group_name[i], ref_names[i]);
+        n_errors++;
+      }
+    }
+  }
+
+  return n_errors;
+}
+
+/*----------------------------------------------------------------------------
+ * Build the test mesh from elements, as done by other element-based readers.
+ *
+ * All elements are defined on rank 0.
+ *
+ * returns:
+ *   pointer to mesh reader structure
+ *----------------------------------------------------------------------------*/
+
+static cs_mesh_gmsh_t *
+_mesh_from_elements(void)
+{
+  const char *names[3] = {"inlet", "walls", "fluid"};
+  const int b_vtx_def[3][4] = {{1, 4, 10, 7}, {1, 2, 5, 4}, {2, 3, 6, 5}};
+  const int b_family_def[3] = {2, 3, 3};
+
+  cs_lnum_t n_vertices = 0, n_cells = 0, n_b_elts = 0;
+
+  if (cs_glob_rank_id < 1) {
+    n_vertices = 12;
+    n_cells = 2;
+    n_b_elts = 3;
+  }
+
+  cs_gnum_t *vertex_gnum, *cell_vtx, *b_vtx;
+  cs_real_t *vertex_coords;
+  short int *cell_n_vtx, *b_n_vtx;
+  int *cell_family, *b_family, *family_item;
+  char **group_name;
+
+  BFT_MALLOC(vertex_gnum, n_vertices, cs_gnum_t);
+  BFT_MALLOC(vertex_coords, n_vertices*3, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_vertices; i++) {
+    vertex_gnum[i] = i + 1;
+    vertex_coords[i*3] = i%3;
+    vertex_coords[i*3 + 1] = (i/3)%2;
+    vertex_coords[i*3 + 2] = i/6;
+  }
+
+  BFT_MALLOC(cell_n_vtx, n_cells, short int);
+  BFT_MALLOC(cell_vtx, n_cells*8, cs_gnum_t);
+  BFT_MALLOC(cell_family, n_cells, int);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    cell_n_vtx[i] = 8;
+    for (int j = 0; j < 8; j++)
+      cell_vtx[i*8 + j] = _hex_vtx[i][j];
+    cell_family[i] = 4;
+  }
+
+  BFT_MALLOC(b_n_vtx, n_b_elts, short int);
+  BFT_MALLOC(b_vtx, n_b_elts*8, cs_gnum_t);
+  BFT_MALLOC(b_family, n_b_elts, int);
+
+  for (cs_lnum_t i = 0; i < n_b_elts; i++) {
+    b_n_vtx[i] = 4;
+    for (int j = 0; j < 4; j++)
+      b_vtx[i*8 + j] = b_vtx_def[i][j];
+    b_family[i] = b_family_def[i];
+  }
+
+  BFT_MALLOC(group_name, 3, char *);
+  for (int i = 0; i < 3; i++) {
+    BFT_MALLOC(group_name[i], strlen(names[i]) + 1, char);
+    strcpy(group_name[i], names[i]);
+  }
+
+  BFT_MALLOC(family_item, 4, int);
+  for (int i = 0; i < 4; i++)
+    family_item[i] = i;
+
+  return cs_mesh_gmsh_create_from_elements(12,
+                                           n_vertices,
+                                           vertex_gnum,
+                                           vertex_coords,
+                                           n_cells,
+                                           cell_n_vtx,
+                                           cell_vtx,
+                                           cell_family,
+                                           n_b_elts,
+                                           b_n_vtx,
+                                           b_vtx,
+                                           b_family,
+                                           3,
+                                           group_name,
+                                           4,
+                                           1,
+                                           family_item);
+}
+
+/*---------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  char mem_trace_name[32];
+  int rank = 0;
+  int n_errors = 0;
+
+#if defined(HAVE_MPI)
+
+  /* Initialization */
+
+  cs_base_mpi_init(&argc, &argv);
+
+  if (cs_glob_mpi_comm != MPI_COMM_NULL)
+    MPI_Comm_rank(cs_glob_mpi_comm, &rank);
+
+#endif /* (HAVE_MPI) */
+
+  bft_printf_proxy_set(_bft_printf_proxy);
+
+  sprintf(mem_trace_name, "cs_mesh_gmsh_test_mem.%d", rank);
+  bft_mem_init(mem_trace_name);
+
+  /* Write test file */
+
+  if (rank == 0) {
+    FILE *f = fopen("cs_mesh_gmsh_test.msh", "w");
+    fputs(_gmsh_test_file, f);
+    fclose(f);
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Barrier(cs_glob_mpi_comm);
+#endif
+
+  /* Read Gmsh file */
+
+  cs_mesh_gmsh_t *gm = cs_mesh_gmsh_read("cs_mesh_gmsh_test.msh");
+
+  n_errors += _check_mesh(gm, "Gmsh file");
+
+  cs_mesh_gmsh_destroy(&gm);
+
+  /* Build the same mesh from elements */
+
+  gm = _mesh_from_elements();
+
+  n_errors += _check_mesh(gm, "Elements");
+
+  cs_mesh_gmsh_destroy(&gm);
+
+  bft_mem_end();
+
+#if defined(HAVE_MPI)
+  {
+    int mpi_flag;
+    MPI_Initialized(&mpi_flag);
+    if (mpi_flag != 0)
+      MPI_Finalize();
+  }
+#endif
+
+  if (n_errors > 0)
+    exit(EXIT_FAILURE);
+
+  exit (EXIT_SUCCESS);
+}
@@ -0,0 +1,542 @@
+/*============================================================================
+ * Unit test for cs_order.c and cs_sort.c radix and merge sorts;
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <assert.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <bft_error.h>
+#include <bft_mem.h>
+#include <bft_printf.h>
+
+#include "cs_order.h"
+#include "cs_sort.h"
+
+/*---------------------------------------------------------------------------*/
+
+/*
+  Threshold above which cs_order.c uses radix or merge sort instead of
+  heap sort (variable when compiled with _CS_UNIT_ORDER_TEST); setting
+  it to SIZE_MAX allows building heap sort reference orderings.
+*/
+
+extern size_t  cs_order_parallel_min;
+
+/* Function indicating if entities i1 and i2 are equal */
+
+typedef bool
+(_is_equal_t) (cs_lnum_t    i1,
+               cs_lnum_t    i2,
+               const void  *input);
+
+/* Test array description */
+
+typedef struct {
+
+  cs_lnum_t         n_ent;    /* number of entities */
+  size_t            stride;   /* stride for strided arrays */
+  const cs_lnum_t  *index;    /* index for indexed arrays */
+  const cs_gnum_t  *g_num;    /* global number values */
+  const cs_lnum_t  *l_num;    /* local number values */
+  const cs_real_t  *val;      /* real values */
+
+} _test_array_t;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Stop the code in case of error
+ *----------------------------------------------------------------------------*/
+
+static void
+_bft_error_handler(const char  *filename,
+                   int          line_num,
+                   int          sys_err_code,
+                   const char  *format,
+                   va_list      arg_ptr)
+{
+  CS_UNUSED(filename);
+  CS_UNUSED(line_num);
+
+  bft_printf_flush();
+
+  if (sys_err_code != 0)
+    fprintf(stderr, "\nSystem error: %s\n", strerror(sys_err_code));
+
+  vfprintf(stderr, format, arg_ptr);
+}
+
+/*----------------------------------------------------------------------------
+ * Return a pseudo-random number in [0, n[, using a simple linear
+ * congruential generator so that tests are reproducible.
+ *
+ * parameters:
+ *   seed <-> generator state
+ *   n    <-- range of values
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_random(uint64_t   *seed,
+        cs_gnum_t   n)
+{
+  *seed = *seed * 6364136223846793005ULL + 1442695040888963407ULL;
+
+  return (*seed >> 11) % n;
+}
+
+/*----------------------------------------------------------------------------
+ * Comparison of ids for qsort.
+ *----------------------------------------------------------------------------*/
+
+static int
+_compare_ids(const void  *x,
+             const void  *y)
+{
+  cs_lnum_t i1 = *(const cs_lnum_t *)x, i2 = *(const cs_lnum_t *)y;
+
+  return (i1 > i2) - (i1 < i2);
+}
+
+/*----------------------------------------------------------------------------
+ * Equality functions for the different array types.
+ *----------------------------------------------------------------------------*/
+
+static bool
+_gnum_is_equal_s(cs_lnum_t    i1,
+                 cs_lnum_t    i2,
+                 const void  *input)
+{
+  const _test_array_t *a = input;
+
+  for (size_t j = 0; j < a->stride; j++) {
+    if (a->g_num[i1*a->stride + j] != a->g_num[i2*a->stride + j])
+      return false;
+  }
+
+  return true;
+}
+
+static bool
+_lnum_is_equal_s(cs_lnum_t    i1,
+                 cs_lnum_t    i2,
+                 const void  *input)
+{
+  const _test_array_t *a = input;
+
+  for (size_t j = 0; j < a->stride; j++) {
+    if (a->l_num[i1*a->stride + j] != a->l_num[i2*a->stride + j])
+      return false;
+  }
+
+  return true;
+}
+
+static bool
+_gnum_is_equal_i(cs_lnum_t    i1,
+                 cs_lnum_t    i2,
+                 const void  *input)
+{
+  const _test_array_t *a = input;
+
+  cs_lnum_t n1 = a->index[i1+1] - a->index[i1];
+  cs_lnum_t n2 = a->index[i2+1] - a->index[i2];
+
+  if (n1 != n2)
+    return false;
+
+  for (cs_lnum_t j = 0; j < n1; j++) {
+    if (a->g_num[a->index[i1] + j] != a->g_num[a->index[i2] + j])
+      return false;
+  }
+
+  return true;
+}
+
+static bool
+_real_is_equal(cs_lnum_t    i1,
+               cs_lnum_t    i2,
+               const void  *input)
+{
+  const _test_array_t *a = input;
+
+  return !(a->val[i1] < a->val[i2] || a->val[i1] > a->val[i2]);
+}
+
+/*----------------------------------------------------------------------------
+ * Place equal entities of an ordering in increasing id order.
+ *
+ * Heap sort is not stable, while radix and merge sorts are; the
+ * resulting ordering should thus be identical to that of the latter.
+ *
+ * parameters:
+ *   order    <-> ordering
+ *   is_equal <-- equality function
+ *   input    <-- input for equality function
+ *----------------------------------------------------------------------------*/
+
+static void
+_stabilize(cs_lnum_t            order[],
+           _is_equal_t         *is_equal,
+           const _test_array_t *input)
+{
+  cs_lnum_t s_id = 0;
+
+  while (s_id < input->n_ent) {
+    cs_lnum_t e_id = s_id + 1;
+    while (   e_id < input->n_ent
+           && is_equal(order[s_id], order[e_id], input))
+      e_id++;
+    if (e_id - s_id > 1)
+      qsort(order + s_id, e_id - s_id, sizeof(cs_lnum_t), _compare_ids);
+    s_id = e_id;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compare an ordering to the reference, and log the result.
+ *
+ * Below the radix and merge sort threshold, the tested ordering is also
+ * based on heap sort, so it is stabilized before comparison.
+ *
+ * parameters:
+ *   name      <-- name of tested function
+ *   order     <-> tested ordering
+ *   order_ref <-- reference ordering
+ *   is_equal  <-- equality function, or NULL if no stabilization is needed
+ *   input     <-- input for equality function
+ *
+ * returns:
+ *   1 in case of error, 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+static int
+_check_order(const char           *name,
+             cs_lnum_t             order[],
+             const cs_lnum_t       order_ref[],
+             _is_equal_t          *is_equal,
+             const _test_array_t  *input)
+{
+  const cs_lnum_t n_ent = input->n_ent;
+
+  if (is_equal != NULL && (size_t)n_ent <= cs_order_parallel_min)
+    _stabilize(order, is_equal, input);
+
+  for (cs_lnum_t i = 0; i < n_ent; i++) {
+    if (order[i] != order_ref[i]) {
+      bft_printf("  %-28s n = %8d: error at position %d (%d, expected %d)\n",
+                 name, (int)n_ent, (int)i, (int)order[i], (int)order_ref[i]);
+      return 1;
+    }
+  }
+
+  bft_printf("  %-28s n = %8d: ok\n", name, (int)n_ent);
+
+  return 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Test orderings and sorts of a given size.
+ *
+ * parameters:
+ *   n_ent   <-- number of entities
+ *   n_keys  <-- number of distinct key values (controls duplicates)
+ *   seed    <-> random number generator state
+ *
+ * returns:
+ *   number of errors
+ *----------------------------------------------------------------------------*/
+
+static int
+_test_size(cs_lnum_t   n_ent,
+           cs_gnum_t   n_keys,
+           uint64_t   *seed)
+{
+  const size_t stride = 3;
+  const size_t parallel_min = cs_order_parallel_min;
+
+  int n_errors = 0;
+
+  cs_lnum_t *order, *order_ref, *index, *list;
+  cs_gnum_t *g_num, *g_num_s, *g_num_i, *keys;
+  cs_lnum_t *l_num, *l_num_s;
+  cs_real_t *val;
+
+  BFT_MALLOC(order, n_ent, cs_lnum_t);
+  BFT_MALLOC(order_ref, n_ent, cs_lnum_t);
+  BFT_MALLOC(list, n_ent, cs_lnum_t);
+  BFT_MALLOC(index, n_ent + 1, cs_lnum_t);
+  BFT_MALLOC(g_num, n_ent, cs_gnum_t);
+  BFT_MALLOC(g_num_s, n_ent*stride, cs_gnum_t);
+  BFT_MALLOC(keys, n_ent, cs_gnum_t);
+  BFT_MALLOC(l_num, n_ent, cs_lnum_t);
+  BFT_MALLOC(l_num_s, n_ent*stride, cs_lnum_t);
+  BFT_MALLOC(val, n_ent, cs_real_t);
+
+  /* Build test arrays; global numbers are spread over high bytes,
+     and local numbers include negative values. Indexed entities
+     have 1 to 4 values, so some are prefixes of others. */
+
+  const cs_gnum_t g_shift = ((cs_gnum_t)1) << 40;
+
+  index[0] = 0;
+  for (cs_lnum_t i = 0; i < n_ent; i++) {
+    cs_gnum_t k = _random(seed, n_keys);
+    g_num[i] = k*g_shift + k;
+    l_num[i] = (cs_lnum_t)k - (cs_lnum_t)(n_keys/2);
+    val[i] = 0.25*((double)k - (double)(n_keys/2));
+    for (size_t j = 0; j < stride; j++) {
+      g_num_s[i*stride + j] = _random(seed, 2) * g_shift + _random(seed, 4);
+      l_num_s[i*stride + j] = (cs_lnum_t)_random(seed, 5) - 2;
+    }
+    index[i+1] = index[i] + 1 + _random(seed, 4);
+    list[i] = n_ent - i;
+  }
+
+  BFT_MALLOC(g_num_i, index[n_ent], cs_gnum_t);
+  for (cs_lnum_t i = 0; i < index[n_ent]; i++)
+    g_num_i[i] = _random(seed, 3);
+
+  /* Global numbers */
+
+  {
+    _test_array_t a = {.n_ent = n_ent, .stride = 1, .index = NULL,
+                       .g_num = g_num, .l_num = NULL, .val = NULL};
+
+    cs_order_parallel_min = SIZE_MAX;
+    cs_order_gnum_allocated(NULL, g_num, order_ref, n_ent);
+    _stabilize(order_ref, _gnum_is_equal_s, &a);
+
+    cs_order_parallel_min = parallel_min;
+    cs_order_gnum_allocated(NULL, g_num, order, n_ent);
+    n_errors += _check_order("cs_order_gnum", order, order_ref,
+                             _gnum_is_equal_s, &a);
+
+    /* Direct radix sort of keys with associated ids */
+
+    for (cs_lnum_t i = 0; i < n_ent; i++) {
+      keys[i] = g_num[i];
+      order[i] = i;
+    }
+    cs_sort_gnum_radix(n_ent, keys, order);
+    for (cs_lnum_t i = 0; i < n_ent; i++) {
+      if (keys[i] != g_num[order[i]])
+        order[i] = -1;
+    }
+    n_errors += _check_order("cs_sort_gnum_radix", order, order_ref,
+                             NULL, &a);
+
+    /* With list (list[i] = n_ent - i, so that order is reversed
+       for equal keys compared to the direct ordering) */
+
+    for (cs_lnum_t i = 0; i < n_ent; i++)
+      keys[i] = g_num[list[i] - 1];
+    a.g_num = keys;
+
+    cs_order_parallel_min = SIZE_MAX;
+    cs_order_gnum_allocated(list, g_num, order_ref, n_ent);
+    _stabilize(order_ref, _gnum_is_equal_s, &a);
+
+    cs_order_parallel_min = parallel_min;
+    cs_order_gnum_allocated(list, g_num, order, n_ent);
+    n_errors += _check_order("cs_order_gnum (list)", order, order_ref,
+                             _gnum_is_equal_s, &a);
+  }
+
+  /* Strided global numbers */
+
+  {
+    _test_array_t a = {.n_ent = n_ent, .stride = stride, .index = NULL,
+                       .g_num = g_num_s, .l_num = NULL, .val = NULL};
+
+    cs_order_parallel_min = SIZE_MAX;
+    cs_order_gnum_allocated_s(NULL, g_num_s, stride, order_ref, n_ent);
+    _stabilize(order_ref, _gnum_is_equal_s, &a);
+
+    cs_order_parallel_min = parallel_min;
+    cs_order_gnum_allocated_s(NULL, g_num_s, stride, order, n_ent);
+    n_errors += _check_order("cs_order_gnum_s", order, order_ref,
+                             _gnum_is_equal_s, &a);
+  }
+
+  /* Indexed global numbers */
+
+  {
+    _test_array_t a = {.n_ent = n_ent, .stride = 0, .index = index,
+                       .g_num = g_num_i, .l_num = NULL, .val = NULL};
+
+    cs_order_parallel_min = SIZE_MAX;
+    cs_order_gnum_allocated_i(NULL, g_num_i, index, order_ref, n_ent);
+    _stabilize(order_ref, _gnum_is_equal_i, &a);
+
+    cs_order_parallel_min = parallel_min;
+    cs_order_gnum_allocated_i(NULL, g_num_i, index, order, n_ent);
+    n_errors += _check_order("cs_order_gnum_i", order, order_ref,
+                             _gnum_is_equal_i, &a);
+  }
+
+  /* Local numbers */
+
+  {
+    _test_array_t a = {.n_ent = n_ent, .stride = 1, .index = NULL,
+                       .g_num = NULL, .l_num = l_num, .val = NULL};
+
+    cs_order_parallel_min = SIZE_MAX;
+    cs_order_lnum_allocated(NULL, l_num, order_ref, n_ent);
+    _stabilize(order_ref, _lnum_is_equal_s, &a);
+
+    cs_order_parallel_min = parallel_min;
+    cs_order_lnum_allocated(NULL, l_num, order, n_ent);
+    n_errors += _check_order("cs_order_lnum", order, order_ref,
+                             _lnum_is_equal_s, &a);
+
+    /* Sort of values (radix sort above CS_SORT_RADIX_MIN) */
+
+    cs_lnum_t *l_sorted;
+    BFT_MALLOC(l_sorted, n_ent, cs_lnum_t);
+    memcpy(l_sorted, l_num, n_ent*sizeof(cs_lnum_t));
+    cs_sort_lnum(l_sorted, n_ent);
+    for (cs_lnum_t i = 0; i < n_ent; i++)
+      order[i] = (l_sorted[i] == l_num[order_ref[i]]) ? order_ref[i] : -1;
+    BFT_FREE(l_sorted);
+    n_errors += _check_order("cs_sort_lnum", order, order_ref,
+                             NULL, &a);
+  }
+
+  /* Strided local numbers */
+
+  {
+    _test_array_t a = {.n_ent = n_ent, .stride = stride, .index = NULL,
+                       .g_num = NULL, .l_num = l_num_s, .val = NULL};
+
+    cs_order_parallel_min = SIZE_MAX;
+    cs_order_lnum_allocated_s(NULL, l_num_s, stride, order_ref, n_ent);
+    _stabilize(order_ref, _lnum_is_equal_s, &a);
+
+    cs_order_parallel_min = parallel_min;
+    cs_order_lnum_allocated_s(NULL, l_num_s, stride, order, n_ent);
+    n_errors += _check_order("cs_order_lnum_s", order, order_ref,
+                             _lnum_is_equal_s, &a);
+  }
+
+  /* Real values (merge sort) */
+
+  {
+    _test_array_t a = {.n_ent = n_ent, .stride = 1, .index = NULL,
+                       .g_num = NULL, .l_num = NULL, .val = val};
+
+    cs_order_parallel_min = SIZE_MAX;
+    cs_order_real_allocated(NULL, val, order_ref, n_ent);
+    _stabilize(order_ref, _real_is_equal, &a);
+
+    cs_order_parallel_min = parallel_min;
+    cs_order_real_allocated(NULL, val, order, n_ent);
+    n_errors += _check_order("cs_order_real", order, order_ref,
+                             _real_is_equal, &a);
+  }
+
+  BFT_FREE(g_num_i);
+  BFT_FREE(val);
+  BFT_FREE(l_num_s);
+  BFT_FREE(l_num);
+  BFT_FREE(keys);
+  BFT_FREE(g_num_s);
+  BFT_FREE(g_num);
+  BFT_FREE(index);
+  BFT_FREE(list);
+  BFT_FREE(order_ref);
+  BFT_FREE(order);
+
+  return n_errors;
+}
+
+/*---------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+  int n_errors = 0;
+  uint64_t seed = 1;
+
+  bft_error_handler_set(_bft_error_handler);
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  /* Sizes below and above the threshold, and numbers of distinct keys
+     ensuring many duplicates or few duplicates */
+
+  const cs_lnum_t n_ent[] = {1000, 2049, 30000, 200003};
+  const cs_gnum_t n_keys[] = {3, 1000, 1 << 30};
+
+  int n_threads_max = 1;
+#if defined(HAVE_OPENMP)
+  n_threads_max = omp_get_max_threads();
+  if (n_threads_max < 4)
+    n_threads_max = 4;
+#endif
+
+  for (int n_threads = 1; n_threads <= n_threads_max; n_threads *= 2) {
+
+#if defined(HAVE_OPENMP)
+    omp_set_num_threads(n_threads);
+#endif
+
+    for (size_t i = 0; i < sizeof(n_ent)/sizeof(n_ent[0]); i++) {
+      for (size_t j = 0; j < sizeof(n_keys)/sizeof(n_keys[0]); j++) {
+
+        bft_printf("\n%d thread(s), %d entities, %llu distinct keys\n\n",
+                   n_threads, (int)n_ent[i], (unsigned long long)n_keys[j]);
+
+        n_errors += _test_size(n_ent[i], n_keys[j], &seed);
+
+      }
+    }
+
+#if !defined(HAVE_OPENMP)
+    break;
+#endif
+  }
+
+  bft_mem_end();
+
+  if (n_errors > 0) {
+    bft_printf("\n%d errors\n", n_errors);
+    exit(EXIT_FAILURE);
+  }
+
+  bft_printf("\nAll orderings identical to reference\n");
+
+  exit(EXIT_SUCCESS);
+}
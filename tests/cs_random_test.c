@@ -284,6 +284,100 @@ _poisson_test(cs_lnum_t   n,
   }
 }
 
+static void
+_counter_test(cs_lnum_t   n,
+              cs_real_t  *x)
+{
+  int i, k;
+  int n_err = 0;
+
+  /* Philox4x32-10 known answers (from the Random123 distribution) */
+
+  const uint32_t kat_ctr[3][4]
+    = {{0, 0, 0, 0},
+       {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+       {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}};
+  const uint32_t kat_key[3][2]
+    = {{0, 0},
+       {0xffffffff, 0xffffffff},
+       {0xa4093822, 0x299f31d0}};
+  const uint32_t kat_res[3][4]
+    = {{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8},
+       {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd},
+       {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}};
+
+  for (k = 0; k < 3; k++) {
+    uint32_t r[4];
+    cs_random_philox4x32(kat_ctr[k], kat_key[k], r);
+    for (i = 0; i < 4; i++) {
+      if (r[i] != kat_res[k][i])
+        n_err++;
+    }
+  }
+
+  if (n_err > 0)
+    printf("ERROR in Philox4x32-10 known answer test\n");
+  else
+    printf("    Philox4x32-10 known answer test OK\n");
+
+  /* Values for a given key must not depend on the processing order */
+
+  double y[6], z[6];
+  n_err = 0;
+
+  for (k = n-1; k >= 0; k--)
+    cs_random_counter_normal(k, 3, 1, 1, x + k);
+
+  for (k = 0; k < n; k++) {
+    double w;
+    cs_random_counter_normal(k, 3, 1, 1, &w);
+    if (memcmp(&w, x + k, sizeof(double)) != 0) /* bitwise comparison */
+      n_err++;
+  }
+
+  cs_random_counter_uniform(17, 3, 0, 6, y);
+  cs_random_counter_uniform(17, 3, 0, 5, z);
+  if (memcmp(y, z, 5*sizeof(double)) != 0)
+    n_err++;
+  cs_random_counter_uniform(17, 4, 0, 5, z);
+  for (i = 0; i < 5; i++) {
+    if (memcmp(y + i, z + i, sizeof(double)) == 0)
+      n_err++;
+  }
+
+  if (n_err > 0)
+    printf("ERROR in counter-based reproducibility test\n");
+  else
+    printf("    counter-based reproducibility test OK\n");
+
+  /* Moments of counter-based normal distribution */
+
+  double x1 = 0., x2 = 0., x3 = 0., x4 = 0.;
+  int nits = 128;
+
+  for (k = 0; k < nits; ++k) {
+    cs_random_counter_normal(k, 1, 2, n, x);
+    for (i = 0; i < n; ++i) {
+      double xx2 = x[i] * x[i];
+      x1 += x[i];
+      x2 += xx2;
+      x3 += xx2 * x[i];
+      x4 += xx2 * xx2;
+    }
+  }
+
+  x1 /= (double) (n * nits);
+  x2 /= (double) (n * nits);
+  x3 /= (double) (n * nits);
+  x4 /= (double) (n * nits);
+
+  printf("    Counter-based normal moments: \n");
+  printf("      Compare to (0.0)               (1.0) \n");
+  printf("              %e       %e \n",x1,x2);
+  printf("      Compare to (0.0)               (3.0) \n");
+  printf("              %e       %e \n",x3,x4);
+}
+
 /*---------------------------------------------------------------------------*/
 
 int
@@ -336,5 +430,14 @@ main (int argc, char *argv[])
   printf("Fischer distribution for %d values in %f seconds\n",
          NPTS, wt1 - wt0);
 
+  wt0 = cs_timer_wtime();
+
+  _counter_test(NPTS, a);
+
+  wt1 = cs_timer_wtime();
+
+  printf("Counter-based generation for %d values in %f seconds\n",
+         NPTS, wt1 - wt0);
+
   exit(EXIT_SUCCESS);
 }